@@ -20,6 +20,16 @@
 include(CheckCXXCompilerFlag)
 # x86/amd64 compiler flags
 check_cxx_compiler_flag("-msse4.2" CXX_SUPPORTS_SSE4_2)
+# Flags for the runtime dispatched kernels, only applied to their source files
+if(MSVC)
+  set(ARROW_AVX2_FLAG "/arch:AVX2")
+  set(ARROW_AVX512_FLAG "/arch:AVX512")
+else()
+  set(ARROW_AVX2_FLAG "-mavx2")
+  set(ARROW_AVX512_FLAG "-march=skylake-avx512")
+endif()
+check_cxx_compiler_flag(${ARROW_AVX2_FLAG} CXX_SUPPORTS_AVX2)
+check_cxx_compiler_flag(${ARROW_AVX512_FLAG} CXX_SUPPORTS_AVX512)
 # power compiler flags
 check_cxx_compiler_flag("-maltivec" CXX_SUPPORTS_ALTIVEC)
 # Arm64 compiler flags
@@ -264,6 +274,20 @@ if(ARROW_USE_SIMD)
   add_definitions(-DARROW_USE_SIMD)
 endif()
 
+# Runtime dispatched kernels, see arrow/util/dispatch.h
+if(ARROW_USE_SIMD AND ARROW_RUNTIME_SIMD_LEVEL MATCHES "^(AVX2|AVX512|MAX)$")
+  if(CXX_SUPPORTS_AVX2)
+    set(ARROW_HAVE_RUNTIME_AVX2 ON)
+    add_definitions(-DARROW_HAVE_RUNTIME_AVX2)
+  endif()
+endif()
+if(ARROW_USE_SIMD AND ARROW_RUNTIME_SIMD_LEVEL MATCHES "^(AVX512|MAX)$")
+  if(CXX_SUPPORTS_AVX512)
+    set(ARROW_HAVE_RUNTIME_AVX512 ON)
+    add_definitions(-DARROW_HAVE_RUNTIME_AVX512)
+  endif()
+endif()
+
 if(APPLE AND "${COMPILER_FAMILY}" STREQUAL "clang")
   # Depending on the default OSX_DEPLOYMENT_TARGET (< 10.9), libstdc++ may be
   # the default standard library which does not support C++11. libc++ is the
@@ -39,6 +39,7 @@
 #include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/utf8.h"
 #include "arrow/visitor.h"
 #include "arrow/visitor_inline.h"
 
@@ -466,6 +467,31 @@ LargeBinaryArray::LargeBinaryArray(int64_t length,
                           null_count, offset));
 }
 
+namespace {
+
+template <typename ArrayType>
+Status ValidateStringArrayUTF8(const ArrayType& array) {
+  util::InitializeUTF8();
+  // Validating all values at once is much faster than one at a time, but
+  // null values may have arbitrary data
+  if (array.null_count() == 0) {
+    const auto& value_data = array.value_data();
+    if (ARROW_PREDICT_TRUE(util::ValidateUTF8Values(
+            value_data ? value_data->data() : nullptr, array.raw_value_offsets(),
+            array.length()))) {
+      return Status::OK();
+    }
+  }
+  for (int64_t i = 0; i < array.length(); ++i) {
+    if (array.IsValid(i) && !util::ValidateUTF8(array.GetView(i))) {
+      return Status::Invalid("Invalid UTF8 sequence at string index ", i);
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
 StringArray::StringArray(const std::shared_ptr<ArrayData>& data) {
   ARROW_CHECK_EQ(data->type->id(), Type::STRING);
   SetData(data);
@@ -479,6 +505,8 @@ StringArray::StringArray(int64_t length, const std::shared_ptr<Buffer>& value_of
                           offset));
 }
 
+Status StringArray::ValidateUTF8() const { return ValidateStringArrayUTF8(*this); }
+
 LargeStringArray::LargeStringArray(const std::shared_ptr<ArrayData>& data) {
   ARROW_CHECK_EQ(data->type->id(), Type::LARGE_STRING);
   SetData(data);
@@ -493,6 +521,8 @@ LargeStringArray::LargeStringArray(int64_t length,
                           null_count, offset));
 }
 
+Status LargeStringArray::ValidateUTF8() const { return ValidateStringArrayUTF8(*this); }
+
 // ----------------------------------------------------------------------
 // Fixed width binary
 
@@ -255,6 +255,56 @@ TYPED_TEST(TestStringArray, CompareNullByteSlots) { this->TestCompareNullByteSlo
 
 TYPED_TEST(TestStringArray, TestSliceGetString) { this->TestSliceGetString(); }
 
+template <typename T>
+class TestUTF8Array : public ::testing::Test {
+ public:
+  using TypeClass = T;
+  using offset_type = typename TypeClass::offset_type;
+  using ArrayType = typename TypeTraits<TypeClass>::ArrayType;
+
+  std::shared_ptr<ArrayType> MakeArray(const std::string& chars,
+                                       const std::vector<offset_type>& offsets,
+                                       const std::vector<uint8_t>& valid_bytes) {
+    std::shared_ptr<Buffer> value_buf, offsets_buf, null_bitmap;
+    ABORT_NOT_OK(AllocateBuffer(chars.size(), &value_buf));
+    std::memcpy(value_buf->mutable_data(), chars.data(), chars.size());
+    ABORT_NOT_OK(CopyBufferFromVector(offsets, default_memory_pool(), &offsets_buf));
+    ABORT_NOT_OK(BitUtil::BytesToBits(valid_bytes, default_memory_pool(), &null_bitmap));
+    return std::make_shared<ArrayType>(static_cast<int64_t>(valid_bytes.size()),
+                                       offsets_buf, value_buf, null_bitmap,
+                                       CountNulls(valid_bytes));
+  }
+};
+
+using UTF8Types = ::testing::Types<StringType, LargeStringType>;
+
+TYPED_TEST_CASE(TestUTF8Array, UTF8Types);
+
+TYPED_TEST(TestUTF8Array, ValidateUTF8) {
+  ASSERT_OK(this->MakeArray("", {0}, {})->ValidateUTF8());
+  ASSERT_OK(this->MakeArray("a\xc3\xa9\xe8\x9d\xa5", {0, 1, 1, 3, 6}, {1, 1, 0, 1})
+                ->ValidateUTF8());
+  ASSERT_RAISES(Invalid, this->MakeArray("a\xff", {0, 1, 2}, {1, 1})->ValidateUTF8());
+  // Valid data, but invalid values
+  ASSERT_RAISES(Invalid, this->MakeArray("\xc3\xa9", {0, 1, 2}, {1, 1})->ValidateUTF8());
+
+  // Null values are not validated
+  auto array = this->MakeArray("a\xff" "b", {0, 1, 2, 3}, {1, 0, 1});
+  ASSERT_OK(array->ValidateUTF8());
+  array = this->MakeArray("a\xff" "b", {0, 1, 2, 3}, {1, 1, 1});
+  ASSERT_RAISES(Invalid, array->ValidateUTF8());
+  // Neither are values outside of a slice
+  ASSERT_OK(checked_cast<const typename TestFixture::ArrayType&>(*array->Slice(2))
+                .ValidateUTF8());
+
+  // Long values
+  const std::string long_value = std::string(100, 'x') + "\xe8\x9d\xa5";
+  array = this->MakeArray(long_value + long_value, {0, 103, 206}, {1, 1});
+  ASSERT_OK(array->ValidateUTF8());
+  array = this->MakeArray(long_value + long_value, {0, 102, 206}, {1, 1});
+  ASSERT_RAISES(Invalid, array->ValidateUTF8());
+}
+
 // ----------------------------------------------------------------------
 // String builder tests
 
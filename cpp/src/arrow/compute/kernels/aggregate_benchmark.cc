@@ -23,8 +23,11 @@
 #include "arrow/compute/benchmark_util.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/group_by.h"
+#include "arrow/compute/kernels/minmax.h"
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/bit_util.h"
@@ -328,5 +331,50 @@ static void SumKernel(benchmark::State& state) {
 
 BENCHMARK(SumKernel)->Apply(RegressionSetArgs);
 
+static void MinMaxKernel(benchmark::State& state) {
+  const int64_t array_size = state.range(0) / sizeof(int64_t);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = std::static_pointer_cast<NumericArray<Int64Type>>(
+      rand.Int64(array_size, -100, 100, null_percent));
+
+  FunctionContext ctx;
+  MinMaxOptions options;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(MinMax(&ctx, options, Datum(array), &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(state.range(0));
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t));
+}
+
+BENCHMARK(MinMaxKernel)->Apply(RegressionSetArgs);
+
+static void GroupBySumKernel(benchmark::State& state) {
+  const int64_t num_rows = state.range(0) / sizeof(int64_t);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(1923);
+  auto keys = rand.Int64(num_rows, 0, 1000, 0);
+  auto values = rand.Int64(num_rows, -100, 100, null_percent);
+  auto batch = RecordBatch::Make(
+      schema({field("key", int64()), field("value", int64())}), num_rows, {keys, values});
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<RecordBatch> out;
+    ABORT_NOT_OK(GroupBy(&ctx, *batch, {0}, {{GroupByAggregate::SUM, 1}}, &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(state.range(0));
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+BENCHMARK(GroupBySumKernel)->Apply(RegressionSetArgs);
+
 }  // namespace compute
 }  // namespace arrow
@@ -1103,8 +1103,19 @@ struct BinaryToStringSameWidthCastFunctor {
     if (!options.allow_invalid_utf8) {
       util::InitializeUTF8();
 
-      ArrayDataVisitor<I> visitor;
-      Status st = visitor.Visit(input, this);
+      Status st;
+      if (input.length > 0 && input.GetNullCount() == 0) {
+        // Validating all values at once is much faster than one at a time
+        const uint8_t* data = input.buffers[2] ? input.buffers[2]->data() : nullptr;
+        if (ARROW_PREDICT_FALSE(!util::ValidateUTF8Values(
+                data, input.GetValues<typename I::offset_type>(1), input.length))) {
+          st = Status::Invalid("Invalid UTF8 payload");
+        }
+      } else {
+        // Null values may have arbitrary data
+        ArrayDataVisitor<I> visitor;
+        st = visitor.Visit(input, this);
+      }
       if (!st.ok()) {
         ctx->SetStatus(st);
         return;
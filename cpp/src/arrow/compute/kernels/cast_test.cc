@@ -152,6 +152,10 @@ class TestCast : public ComputeFixture, public TestBase {
     // Should refuse due to invalid utf8 payload
     CheckFails<SourceType, std::string>(src_type, strings, all, dest_type, options);
 
+    // Should refuse a character split between values
+    CheckFails<SourceType, std::string>(src_type, {"ol\xc3", "\xa1"}, {1, 1}, dest_type,
+                                        options);
+
     // Should accept due to option override
     options.allow_invalid_utf8 = true;
     CheckCase<SourceType, std::string, DestType, std::string>(
@@ -0,0 +1,857 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/group_by.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/dict_internal.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/sum_internal.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::DictionaryTraits;
+using internal::HashTraits;
+
+namespace compute {
+
+// ----------------------------------------------------------------------
+// Key encoding: map the values of one key column to dense memo indices
+
+class GroupKeyEncoder {
+ public:
+  virtual ~GroupKeyEncoder() = default;
+
+  /// \brief Write the memo index of each value of `array` to `out`
+  virtual Status Encode(const Array& array, int32_t* out) = 0;
+
+  /// \brief The distinct values seen so far, in memo index order
+  virtual Status GetUniques(std::shared_ptr<ArrayData>* out) const = 0;
+
+  virtual int32_t size() const = 0;
+};
+
+template <typename Type, typename Scalar>
+class TypedGroupKeyEncoder : public GroupKeyEncoder {
+ public:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+  TypedGroupKeyEncoder(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : type_(type), pool_(pool), memo_table_(new MemoTable(pool, 0)) {}
+
+  Status VisitNull() {
+    *out_++ = memo_table_->GetOrInsertNull();
+    return Status::OK();
+  }
+
+  Status VisitValue(const Scalar& value) {
+    *out_++ = memo_table_->GetOrInsert(value);
+    return Status::OK();
+  }
+
+  Status Encode(const Array& array, int32_t* out) override {
+    out_ = out;
+    // Ensure the null count is materialized before visiting the raw data
+    array.null_count();
+    return ArrayDataVisitor<Type>::Visit(*array.data(), this);
+  }
+
+  Status GetUniques(std::shared_ptr<ArrayData>* out) const override {
+    return DictionaryTraits<Type>::GetDictionaryArrayData(pool_, type_, *memo_table_, 0,
+                                                          out);
+  }
+
+  int32_t size() const override { return memo_table_->size(); }
+
+ private:
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+  std::unique_ptr<MemoTable> memo_table_;
+  int32_t* out_ = NULLPTR;
+};
+
+template <typename Type, typename Enable = void>
+struct GroupKeyEncoderTraits {};
+
+template <typename Type>
+struct GroupKeyEncoderTraits<Type, enable_if_has_c_type<Type>> {
+  using EncoderType = TypedGroupKeyEncoder<Type, typename Type::c_type>;
+};
+
+template <typename Type>
+struct GroupKeyEncoderTraits<Type, enable_if_boolean<Type>> {
+  using EncoderType = TypedGroupKeyEncoder<Type, bool>;
+};
+
+template <typename Type>
+struct GroupKeyEncoderTraits<Type, enable_if_binary<Type>> {
+  using EncoderType = TypedGroupKeyEncoder<Type, util::string_view>;
+};
+
+template <typename Type>
+struct GroupKeyEncoderTraits<Type, enable_if_fixed_size_binary<Type>> {
+  using EncoderType = TypedGroupKeyEncoder<Type, util::string_view>;
+};
+
+static Status MakeGroupKeyEncoder(FunctionContext* ctx,
+                                  const std::shared_ptr<DataType>& type,
+                                  std::unique_ptr<GroupKeyEncoder>* out) {
+#define GROUP_KEY_CASE(InType)                                                  \
+  case InType::type_id:                                                         \
+    out->reset(new typename GroupKeyEncoderTraits<InType>::EncoderType(         \
+        type, ctx->memory_pool()));                                             \
+    return Status::OK()
+
+  switch (type->id()) {
+    GROUP_KEY_CASE(BooleanType);
+    GROUP_KEY_CASE(UInt8Type);
+    GROUP_KEY_CASE(Int8Type);
+    GROUP_KEY_CASE(UInt16Type);
+    GROUP_KEY_CASE(Int16Type);
+    GROUP_KEY_CASE(UInt32Type);
+    GROUP_KEY_CASE(Int32Type);
+    GROUP_KEY_CASE(UInt64Type);
+    GROUP_KEY_CASE(Int64Type);
+    GROUP_KEY_CASE(FloatType);
+    GROUP_KEY_CASE(DoubleType);
+    GROUP_KEY_CASE(Date32Type);
+    GROUP_KEY_CASE(Date64Type);
+    GROUP_KEY_CASE(Time32Type);
+    GROUP_KEY_CASE(Time64Type);
+    GROUP_KEY_CASE(TimestampType);
+    GROUP_KEY_CASE(BinaryType);
+    GROUP_KEY_CASE(StringType);
+    GROUP_KEY_CASE(FixedSizeBinaryType);
+    GROUP_KEY_CASE(Decimal128Type);
+    default:
+      break;
+  }
+#undef GROUP_KEY_CASE
+
+  return Status::NotImplemented("GroupBy is not implemented for key type ",
+                                type->ToString());
+}
+
+// ----------------------------------------------------------------------
+// Grouped aggregate functions
+
+/// \brief Per-group aggregate state, indexed by group id
+///
+/// This mirrors the Consume / Merge / Finalize contract of AggregateFunction,
+/// except that every call addresses a vector of group states at once.
+class GroupedAggregateFunction {
+ public:
+  virtual ~GroupedAggregateFunction() = default;
+
+  /// \brief Grow the state to hold `num_groups` groups
+  virtual void Resize(int64_t num_groups) = 0;
+
+  /// \brief Consume an array, routing each value to its group state
+  virtual Status Consume(const Array& input, const int32_t* group_ids) = 0;
+
+  /// \brief Merge the group states of `src`; group i of `src` is group
+  /// `group_id_mapping[i]` of this
+  virtual Status Merge(const GroupedAggregateFunction& src,
+                       const int32_t* group_id_mapping) = 0;
+
+  /// \brief Convert the group states into an array with one entry per group
+  virtual Status Finalize(MemoryPool* pool, std::shared_ptr<Array>* out) const = 0;
+
+  virtual std::shared_ptr<DataType> out_type() const = 0;
+};
+
+// Call `func(i)` for every non-null index of `input`
+template <typename Func>
+static inline void VisitValidIndices(const Array& input, Func&& func) {
+  const int64_t length = input.length();
+  if (input.null_count() == 0) {
+    for (int64_t i = 0; i < length; i++) {
+      func(i);
+    }
+  } else {
+    internal::BitmapReader reader(input.null_bitmap_data(), input.offset(), length);
+    for (int64_t i = 0; i < length; i++) {
+      if (reader.IsSet()) {
+        func(i);
+      }
+      reader.Next();
+    }
+  }
+}
+
+// Build an array from per-group values, null where the group saw no value
+template <typename ArrowType, typename CType>
+static Status FinishGroupedValues(MemoryPool* pool, const std::vector<CType>& values,
+                                  const std::vector<int64_t>& counts,
+                                  std::shared_ptr<Array>* out) {
+  std::vector<uint8_t> valid_bytes(counts.size());
+  for (size_t i = 0; i < counts.size(); i++) {
+    valid_bytes[i] = counts[i] > 0;
+  }
+  NumericBuilder<ArrowType> builder(TypeTraits<ArrowType>::type_singleton(), pool);
+  RETURN_NOT_OK(builder.AppendValues(values.data(), static_cast<int64_t>(values.size()),
+                                     valid_bytes.data()));
+  return builder.Finish(out);
+}
+
+class GroupedCount final : public GroupedAggregateFunction {
+ public:
+  void Resize(int64_t num_groups) override { counts_.resize(num_groups, 0); }
+
+  Status Consume(const Array& input, const int32_t* group_ids) override {
+    int64_t* counts = counts_.data();
+    VisitValidIndices(input, [&](int64_t i) { ++counts[group_ids[i]]; });
+    return Status::OK();
+  }
+
+  Status Merge(const GroupedAggregateFunction& src,
+               const int32_t* group_id_mapping) override {
+    const auto& other = checked_cast<const GroupedCount&>(src);
+    for (size_t i = 0; i < other.counts_.size(); i++) {
+      counts_[group_id_mapping[i]] += other.counts_[i];
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(MemoryPool* pool, std::shared_ptr<Array>* out) const override {
+    Int64Builder builder(pool);
+    RETURN_NOT_OK(
+        builder.AppendValues(counts_.data(), static_cast<int64_t>(counts_.size())));
+    return builder.Finish(out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+ private:
+  std::vector<int64_t> counts_;
+};
+
+template <typename ArrowType>
+class GroupedSum final : public GroupedAggregateFunction {
+ public:
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using SumType = typename FindAccumulatorType<ArrowType>::Type;
+  using SumCType = typename SumType::c_type;
+
+  void Resize(int64_t num_groups) override {
+    sums_.resize(num_groups, 0);
+    counts_.resize(num_groups, 0);
+  }
+
+  Status Consume(const Array& input, const int32_t* group_ids) override {
+    const auto values = checked_cast<const ArrayType&>(input).raw_values();
+    SumCType* sums = sums_.data();
+    int64_t* counts = counts_.data();
+    VisitValidIndices(input, [&](int64_t i) {
+      sums[group_ids[i]] += values[i];
+      ++counts[group_ids[i]];
+    });
+    return Status::OK();
+  }
+
+  Status Merge(const GroupedAggregateFunction& src,
+               const int32_t* group_id_mapping) override {
+    const auto& other = checked_cast<const GroupedSum&>(src);
+    for (size_t i = 0; i < other.sums_.size(); i++) {
+      sums_[group_id_mapping[i]] += other.sums_[i];
+      counts_[group_id_mapping[i]] += other.counts_[i];
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(MemoryPool* pool, std::shared_ptr<Array>* out) const override {
+    return FinishGroupedValues<SumType>(pool, sums_, counts_, out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<SumType>::type_singleton();
+  }
+
+ private:
+  std::vector<SumCType> sums_;
+  std::vector<int64_t> counts_;
+};
+
+template <typename ArrowType>
+class GroupedMean final : public GroupedAggregateFunction {
+ public:
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+  void Resize(int64_t num_groups) override {
+    sums_.resize(num_groups, 0);
+    counts_.resize(num_groups, 0);
+  }
+
+  Status Consume(const Array& input, const int32_t* group_ids) override {
+    const auto values = checked_cast<const ArrayType&>(input).raw_values();
+    double* sums = sums_.data();
+    int64_t* counts = counts_.data();
+    VisitValidIndices(input, [&](int64_t i) {
+      sums[group_ids[i]] += static_cast<double>(values[i]);
+      ++counts[group_ids[i]];
+    });
+    return Status::OK();
+  }
+
+  Status Merge(const GroupedAggregateFunction& src,
+               const int32_t* group_id_mapping) override {
+    const auto& other = checked_cast<const GroupedMean&>(src);
+    for (size_t i = 0; i < other.sums_.size(); i++) {
+      sums_[group_id_mapping[i]] += other.sums_[i];
+      counts_[group_id_mapping[i]] += other.counts_[i];
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(MemoryPool* pool, std::shared_ptr<Array>* out) const override {
+    std::vector<double> means(sums_.size());
+    for (size_t i = 0; i < sums_.size(); i++) {
+      means[i] = counts_[i] > 0 ? sums_[i] / static_cast<double>(counts_[i]) : 0;
+    }
+    return FinishGroupedValues<DoubleType>(pool, means, counts_, out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return float64(); }
+
+ private:
+  std::vector<double> sums_;
+  std::vector<int64_t> counts_;
+};
+
+template <typename CType, bool IsMin, typename Enable = void>
+struct MinMaxOp {};
+
+template <typename CType, bool IsMin>
+struct MinMaxOp<CType, IsMin, typename std::enable_if<std::is_integral<CType>::value>::type> {
+  static constexpr CType initial() {
+    return IsMin ? std::numeric_limits<CType>::max() : std::numeric_limits<CType>::min();
+  }
+  static CType Merge(CType a, CType b) { return IsMin ? std::min(a, b) : std::max(a, b); }
+};
+
+template <typename CType, bool IsMin>
+struct MinMaxOp<CType, IsMin,
+                typename std::enable_if<std::is_floating_point<CType>::value>::type> {
+  static constexpr CType initial() {
+    return IsMin ? std::numeric_limits<CType>::infinity()
+                 : -std::numeric_limits<CType>::infinity();
+  }
+  static CType Merge(CType a, CType b) {
+    return IsMin ? std::fmin(a, b) : std::fmax(a, b);
+  }
+};
+
+template <typename ArrowType, bool IsMin>
+class GroupedMinMax final : public GroupedAggregateFunction {
+ public:
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using CType = typename ArrowType::c_type;
+  using Op = MinMaxOp<CType, IsMin>;
+
+  void Resize(int64_t num_groups) override {
+    values_.resize(num_groups, Op::initial());
+    counts_.resize(num_groups, 0);
+  }
+
+  Status Consume(const Array& input, const int32_t* group_ids) override {
+    const auto values = checked_cast<const ArrayType&>(input).raw_values();
+    CType* states = values_.data();
+    int64_t* counts = counts_.data();
+    VisitValidIndices(input, [&](int64_t i) {
+      states[group_ids[i]] = Op::Merge(states[group_ids[i]], values[i]);
+      ++counts[group_ids[i]];
+    });
+    return Status::OK();
+  }
+
+  Status Merge(const GroupedAggregateFunction& src,
+               const int32_t* group_id_mapping) override {
+    const auto& other = checked_cast<const GroupedMinMax&>(src);
+    for (size_t i = 0; i < other.values_.size(); i++) {
+      auto& dst = values_[group_id_mapping[i]];
+      dst = Op::Merge(dst, other.values_[i]);
+      counts_[group_id_mapping[i]] += other.counts_[i];
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(MemoryPool* pool, std::shared_ptr<Array>* out) const override {
+    return FinishGroupedValues<ArrowType>(pool, values_, counts_, out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<ArrowType>::type_singleton();
+  }
+
+ private:
+  std::vector<CType> values_;
+  std::vector<int64_t> counts_;
+};
+
+template <typename ArrowType>
+static std::unique_ptr<GroupedAggregateFunction> MakeTypedGroupedAggregate(
+    enum GroupByAggregate::kind kind) {
+  switch (kind) {
+    case GroupByAggregate::SUM:
+      return std::unique_ptr<GroupedAggregateFunction>(new GroupedSum<ArrowType>());
+    case GroupByAggregate::MEAN:
+      return std::unique_ptr<GroupedAggregateFunction>(new GroupedMean<ArrowType>());
+    case GroupByAggregate::MIN:
+      return std::unique_ptr<GroupedAggregateFunction>(
+          new GroupedMinMax<ArrowType, true>());
+    case GroupByAggregate::MAX:
+      return std::unique_ptr<GroupedAggregateFunction>(
+          new GroupedMinMax<ArrowType, false>());
+    default:
+      return nullptr;
+  }
+}
+
+static Status MakeGroupedAggregate(const GroupByAggregate& aggregate,
+                                   const DataType& type,
+                                   std::unique_ptr<GroupedAggregateFunction>* out) {
+  if (aggregate.kind == GroupByAggregate::COUNT) {
+    out->reset(new GroupedCount());
+    return Status::OK();
+  }
+
+#define GROUPED_AGG_CASE(T)                              \
+  case T::type_id:                                       \
+    *out = MakeTypedGroupedAggregate<T>(aggregate.kind); \
+    break
+
+  switch (type.id()) {
+    GROUPED_AGG_CASE(UInt8Type);
+    GROUPED_AGG_CASE(Int8Type);
+    GROUPED_AGG_CASE(UInt16Type);
+    GROUPED_AGG_CASE(Int16Type);
+    GROUPED_AGG_CASE(UInt32Type);
+    GROUPED_AGG_CASE(Int32Type);
+    GROUPED_AGG_CASE(UInt64Type);
+    GROUPED_AGG_CASE(Int64Type);
+    GROUPED_AGG_CASE(FloatType);
+    GROUPED_AGG_CASE(DoubleType);
+    default:
+      break;
+  }
+#undef GROUPED_AGG_CASE
+
+  if (*out == nullptr) {
+    return Status::NotImplemented("Grouped aggregate not implemented for type ", type);
+  }
+  return Status::OK();
+}
+
+static const char* AggregateName(enum GroupByAggregate::kind kind) {
+  switch (kind) {
+    case GroupByAggregate::COUNT:
+      return "count";
+    case GroupByAggregate::SUM:
+      return "sum";
+    case GroupByAggregate::MIN:
+      return "min";
+    case GroupByAggregate::MAX:
+      return "max";
+    case GroupByAggregate::MEAN:
+      return "mean";
+  }
+  return "";
+}
+
+// ----------------------------------------------------------------------
+// Composite keys: map tuples of per-column memo indices to group ids
+
+class GroupedAggregator::CompositeKeyTable {
+ public:
+  CompositeKeyTable(MemoryPool* pool, int num_keys)
+      : num_keys_(num_keys), memo_table_(pool, 0), tuple_(num_keys) {}
+
+  // `column_ids[k]` holds the memo indices of key column k
+  void Encode(const std::vector<std::vector<int32_t>>& column_ids, int64_t length,
+              int32_t* out) {
+    const auto tuple_size = static_cast<int32_t>(num_keys_ * sizeof(int32_t));
+    for (int64_t i = 0; i < length; i++) {
+      for (int k = 0; k < num_keys_; k++) {
+        tuple_[k] = column_ids[k][i];
+      }
+      out[i] = memo_table_.GetOrInsert(
+          tuple_.data(), tuple_size, [](int32_t) {},
+          [this](int32_t) {
+            key_indices_.insert(key_indices_.end(), tuple_.begin(), tuple_.end());
+          });
+    }
+  }
+
+  int64_t num_groups() const {
+    return static_cast<int64_t>(key_indices_.size()) / num_keys_;
+  }
+
+  // The memo indices of key column `key` for every group, in group order
+  std::vector<int32_t> KeyIndices(int key) const {
+    const auto num_groups = static_cast<size_t>(this->num_groups());
+    std::vector<int32_t> out(num_groups);
+    for (size_t i = 0; i < num_groups; i++) {
+      out[i] = key_indices_[i * num_keys_ + key];
+    }
+    return out;
+  }
+
+ private:
+  int num_keys_;
+  internal::BinaryMemoTable memo_table_;
+  std::vector<int32_t> tuple_;
+  // Row-major (group, key) matrix of memo indices
+  std::vector<int32_t> key_indices_;
+};
+
+// ----------------------------------------------------------------------
+// GroupedAggregator implementation
+
+GroupedAggregator::GroupedAggregator(FunctionContext* ctx) : ctx_(ctx) {}
+
+GroupedAggregator::~GroupedAggregator() {}
+
+Status GroupedAggregator::Make(FunctionContext* ctx,
+                               const std::vector<std::shared_ptr<Field>>& key_fields,
+                               const std::vector<std::shared_ptr<Field>>& value_fields,
+                               const std::vector<GroupByAggregate>& aggregates,
+                               std::unique_ptr<GroupedAggregator>* out) {
+  if (key_fields.empty()) {
+    return Status::Invalid("GroupBy needs at least one key column");
+  }
+
+  std::unique_ptr<GroupedAggregator> aggregator(new GroupedAggregator(ctx));
+  aggregator->key_fields_ = key_fields;
+  aggregator->value_fields_ = value_fields;
+  aggregator->aggregates_ = aggregates;
+
+  for (const auto& field : key_fields) {
+    std::unique_ptr<GroupKeyEncoder> encoder;
+    RETURN_NOT_OK(MakeGroupKeyEncoder(ctx, field->type(), &encoder));
+    aggregator->key_encoders_.push_back(std::move(encoder));
+  }
+  if (key_fields.size() > 1) {
+    aggregator->composite_keys_.reset(new CompositeKeyTable(
+        ctx->memory_pool(), static_cast<int>(key_fields.size())));
+  }
+
+  for (const auto& aggregate : aggregates) {
+    if (aggregate.value_index < 0 ||
+        aggregate.value_index >= static_cast<int>(value_fields.size())) {
+      return Status::IndexError("GroupBy aggregate value index ", aggregate.value_index,
+                                " out of bounds");
+    }
+    std::unique_ptr<GroupedAggregateFunction> function;
+    RETURN_NOT_OK(MakeGroupedAggregate(
+        aggregate, *value_fields[aggregate.value_index]->type(), &function));
+    aggregator->aggregate_functions_.push_back(std::move(function));
+  }
+
+  *out = std::move(aggregator);
+  return Status::OK();
+}
+
+Status GroupedAggregator::GetGroupIds(const std::vector<std::shared_ptr<Array>>& keys,
+                                      std::vector<int32_t>* group_ids) {
+  if (keys.size() != key_encoders_.size()) {
+    return Status::Invalid("Expected ", key_encoders_.size(), " key columns, got ",
+                           keys.size());
+  }
+  const int64_t length = keys[0]->length();
+  for (const auto& key : keys) {
+    if (key->length() != length) {
+      return Status::Invalid("GroupBy key columns must have the same length");
+    }
+  }
+
+  group_ids->resize(length);
+  if (composite_keys_ == nullptr) {
+    RETURN_NOT_OK(key_encoders_[0]->Encode(*keys[0], group_ids->data()));
+    num_groups_ = key_encoders_[0]->size();
+  } else {
+    std::vector<std::vector<int32_t>> column_ids(keys.size());
+    for (size_t k = 0; k < keys.size(); k++) {
+      column_ids[k].resize(length);
+      RETURN_NOT_OK(key_encoders_[k]->Encode(*keys[k], column_ids[k].data()));
+    }
+    composite_keys_->Encode(column_ids, length, group_ids->data());
+    num_groups_ = composite_keys_->num_groups();
+  }
+
+  for (auto& function : aggregate_functions_) {
+    function->Resize(num_groups_);
+  }
+  return Status::OK();
+}
+
+Status GroupedAggregator::Consume(const std::vector<std::shared_ptr<Array>>& keys,
+                                  const std::vector<std::shared_ptr<Array>>& values) {
+  if (values.size() != value_fields_.size()) {
+    return Status::Invalid("Expected ", value_fields_.size(), " value columns, got ",
+                           values.size());
+  }
+
+  std::vector<int32_t> group_ids;
+  RETURN_NOT_OK(GetGroupIds(keys, &group_ids));
+
+  for (size_t i = 0; i < aggregates_.size(); i++) {
+    const auto& value = values[aggregates_[i].value_index];
+    if (value->length() != static_cast<int64_t>(group_ids.size())) {
+      return Status::Invalid("GroupBy value columns must have the same length as keys");
+    }
+    RETURN_NOT_OK(aggregate_functions_[i]->Consume(*value, group_ids.data()));
+  }
+  return Status::OK();
+}
+
+Status GroupedAggregator::GetKeyColumns(std::vector<std::shared_ptr<Array>>* out) const {
+  out->resize(key_encoders_.size());
+  for (size_t k = 0; k < key_encoders_.size(); k++) {
+    std::shared_ptr<ArrayData> uniques;
+    RETURN_NOT_OK(key_encoders_[k]->GetUniques(&uniques));
+    if (composite_keys_ == nullptr) {
+      // Group ids are the memo indices of the single key column
+      (*out)[k] = MakeArray(uniques);
+      continue;
+    }
+    auto key_indices = composite_keys_->KeyIndices(static_cast<int>(k));
+    Int32Builder builder(ctx_->memory_pool());
+    RETURN_NOT_OK(builder.AppendValues(key_indices));
+    std::shared_ptr<Array> indices;
+    RETURN_NOT_OK(builder.Finish(&indices));
+    RETURN_NOT_OK(Take(ctx_, *MakeArray(uniques), *indices, TakeOptions(), &(*out)[k]));
+  }
+  return Status::OK();
+}
+
+Status GroupedAggregator::Merge(const GroupedAggregator& other) {
+  if (other.key_fields_.size() != key_fields_.size() ||
+      other.aggregates_.size() != aggregates_.size()) {
+    return Status::Invalid("Cannot merge GroupedAggregators of different shapes");
+  }
+  for (size_t i = 0; i < aggregates_.size(); i++) {
+    if (other.aggregates_[i].kind != aggregates_[i].kind ||
+        !other.aggregate_functions_[i]->out_type()->Equals(
+            aggregate_functions_[i]->out_type())) {
+      return Status::Invalid("Cannot merge GroupedAggregators of different aggregates");
+    }
+  }
+  if (other.num_groups_ == 0) {
+    return Status::OK();
+  }
+
+  // Re-encode the other aggregator's keys to find its groups in this one
+  std::vector<std::shared_ptr<Array>> other_keys;
+  RETURN_NOT_OK(other.GetKeyColumns(&other_keys));
+  for (size_t k = 0; k < other_keys.size(); k++) {
+    if (!other_keys[k]->type()->Equals(key_fields_[k]->type())) {
+      return Status::Invalid("Cannot merge GroupedAggregators with different key types");
+    }
+  }
+
+  std::vector<int32_t> group_id_mapping;
+  RETURN_NOT_OK(GetGroupIds(other_keys, &group_id_mapping));
+  for (size_t i = 0; i < aggregates_.size(); i++) {
+    RETURN_NOT_OK(aggregate_functions_[i]->Merge(*other.aggregate_functions_[i],
+                                                 group_id_mapping.data()));
+  }
+  return Status::OK();
+}
+
+Status GroupedAggregator::Finalize(std::shared_ptr<RecordBatch>* out) const {
+  std::vector<std::shared_ptr<Array>> columns;
+  RETURN_NOT_OK(GetKeyColumns(&columns));
+  std::vector<std::shared_ptr<Field>> fields = key_fields_;
+
+  for (size_t i = 0; i < aggregates_.size(); i++) {
+    const auto& aggregate = aggregates_[i];
+    const auto& function = aggregate_functions_[i];
+    std::shared_ptr<Array> column;
+    RETURN_NOT_OK(function->Finalize(ctx_->memory_pool(), &column));
+    const auto& value_name = value_fields_[aggregate.value_index]->name();
+    fields.push_back(field(value_name + "_" + AggregateName(aggregate.kind),
+                           function->out_type()));
+    columns.push_back(std::move(column));
+  }
+
+  *out = RecordBatch::Make(::arrow::schema(std::move(fields)), num_groups_,
+                           std::move(columns));
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// GroupBy entry points
+
+static Status MakeAggregatorForSchema(FunctionContext* ctx, const Schema& schema,
+                                      const std::vector<int>& key_columns,
+                                      const std::vector<GroupByAggregate>& aggregates,
+                                      std::unique_ptr<GroupedAggregator>* out) {
+  std::vector<std::shared_ptr<Field>> key_fields;
+  for (int i : key_columns) {
+    if (i < 0 || i >= schema.num_fields()) {
+      return Status::IndexError("GroupBy key column ", i, " out of bounds");
+    }
+    key_fields.push_back(schema.field(i));
+  }
+  return GroupedAggregator::Make(ctx, key_fields, schema.fields(), aggregates, out);
+}
+
+static Status ConsumeBatch(const RecordBatch& batch, const std::vector<int>& key_columns,
+                           GroupedAggregator* aggregator) {
+  std::vector<std::shared_ptr<Array>> keys;
+  for (int i : key_columns) {
+    keys.push_back(batch.column(i));
+  }
+  std::vector<std::shared_ptr<Array>> values;
+  for (int i = 0; i < batch.num_columns(); i++) {
+    values.push_back(batch.column(i));
+  }
+  return aggregator->Consume(keys, values);
+}
+
+Status GroupBy(FunctionContext* ctx, const RecordBatch& batch,
+               const std::vector<int>& key_columns,
+               const std::vector<GroupByAggregate>& aggregates,
+               std::shared_ptr<RecordBatch>* out) {
+  std::unique_ptr<GroupedAggregator> aggregator;
+  RETURN_NOT_OK(
+      MakeAggregatorForSchema(ctx, *batch.schema(), key_columns, aggregates, &aggregator));
+  RETURN_NOT_OK(ConsumeBatch(batch, key_columns, aggregator.get()));
+  return aggregator->Finalize(out);
+}
+
+Status GroupBy(FunctionContext* ctx, const Table& table,
+               const std::vector<int>& key_columns,
+               const std::vector<GroupByAggregate>& aggregates,
+               const GroupByOptions& options, std::shared_ptr<Table>* out) {
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  TableBatchReader reader(table);
+  RETURN_NOT_OK(reader.ReadAll(&batches));
+
+  int num_partitions = 1;
+  if (options.use_threads) {
+    num_partitions = std::min(static_cast<int>(batches.size()),
+                              internal::GetCpuThreadPool()->GetCapacity());
+    num_partitions = std::max(num_partitions, 1);
+  }
+
+  std::vector<std::unique_ptr<GroupedAggregator>> partials(num_partitions);
+  for (auto& partial : partials) {
+    RETURN_NOT_OK(
+        MakeAggregatorForSchema(ctx, *table.schema(), key_columns, aggregates, &partial));
+  }
+
+  // Each partition aggregates a contiguous range of batches independently.
+  // Merging the partitions in order then keeps the groups in order of first
+  // appearance.
+  const size_t num_batches = batches.size();
+  auto consume_partition = [&](int partition) {
+    const size_t begin = num_batches * partition / num_partitions;
+    const size_t end = num_batches * (partition + 1) / num_partitions;
+    for (size_t i = begin; i < end; i++) {
+      RETURN_NOT_OK(ConsumeBatch(*batches[i], key_columns, partials[partition].get()));
+    }
+    return Status::OK();
+  };
+  if (num_partitions > 1) {
+    RETURN_NOT_OK(internal::ParallelFor(num_partitions, consume_partition));
+  } else {
+    RETURN_NOT_OK(consume_partition(0));
+  }
+
+  for (int i = 1; i < num_partitions; i++) {
+    RETURN_NOT_OK(partials[0]->Merge(*partials[i]));
+  }
+
+  std::shared_ptr<RecordBatch> result;
+  RETURN_NOT_OK(partials[0]->Finalize(&result));
+  return Table::FromRecordBatches(result->schema(), {result}, out);
+}
+
+Status PartitionBy(FunctionContext* ctx, const RecordBatch& batch,
+                   const std::vector<int>& key_columns,
+                   std::shared_ptr<RecordBatch>* keys,
+                   std::vector<std::shared_ptr<RecordBatch>>* partitions) {
+  std::unique_ptr<GroupedAggregator> aggregator;
+  RETURN_NOT_OK(
+      MakeAggregatorForSchema(ctx, *batch.schema(), key_columns, {}, &aggregator));
+
+  std::vector<std::shared_ptr<Array>> key_arrays;
+  for (int i : key_columns) {
+    key_arrays.push_back(batch.column(i));
+  }
+  std::vector<int32_t> group_ids;
+  RETURN_NOT_OK(aggregator->GetGroupIds(key_arrays, &group_ids));
+  const int64_t num_groups = aggregator->num_groups();
+
+  // Counting sort of the row indices by group id, so that a single Take
+  // gathers every partition into a contiguous slice
+  std::vector<int64_t> offsets(num_groups + 1, 0);
+  for (int32_t group_id : group_ids) {
+    ++offsets[group_id + 1];
+  }
+  for (int64_t i = 0; i < num_groups; i++) {
+    offsets[i + 1] += offsets[i];
+  }
+  std::vector<int64_t> sorted_indices(group_ids.size());
+  {
+    std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+    for (int64_t row = 0; row < static_cast<int64_t>(group_ids.size()); row++) {
+      sorted_indices[positions[group_ids[row]]++] = row;
+    }
+  }
+
+  Int64Builder builder(ctx->memory_pool());
+  RETURN_NOT_OK(builder.AppendValues(sorted_indices));
+  std::shared_ptr<Array> indices;
+  RETURN_NOT_OK(builder.Finish(&indices));
+  std::shared_ptr<RecordBatch> sorted;
+  RETURN_NOT_OK(Take(ctx, batch, *indices, TakeOptions(), &sorted));
+
+  partitions->resize(num_groups);
+  for (int64_t i = 0; i < num_groups; i++) {
+    (*partitions)[i] = sorted->Slice(offsets[i], offsets[i + 1] - offsets[i]);
+  }
+  return aggregator->Finalize(keys);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,203 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+class Field;
+class RecordBatch;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \class GroupByAggregate
+///
+/// Describes one aggregate to compute per group.
+struct ARROW_EXPORT GroupByAggregate {
+  enum kind {
+    // Count non-null values, output is int64.
+    COUNT = 0,
+    // Sum of non-null values, output is the accumulator type of Sum.
+    SUM,
+    // Minimum of non-null values, output has the value type.
+    MIN,
+    // Maximum of non-null values, output has the value type.
+    MAX,
+    // Mean of non-null values, output is double.
+    MEAN,
+  };
+
+  GroupByAggregate(enum kind kind, int value_index)
+      : kind(kind), value_index(value_index) {}
+
+  enum kind kind;
+  /// Index of the value column the aggregate is computed over.
+  int value_index;
+};
+
+/// \class GroupByOptions
+struct ARROW_EXPORT GroupByOptions {
+  static GroupByOptions Defaults() { return GroupByOptions(); }
+
+  /// Aggregate the record batches of a Table concurrently on the CPU
+  /// thread pool, merging the partial results at the end.
+  bool use_threads = false;
+};
+
+class GroupedAggregateFunction;
+class GroupKeyEncoder;
+
+/// \brief Hash-based grouped aggregation state
+///
+/// Rows are mapped to group ids with a memo table per key column (see
+/// arrow/util/hashing.h). Like AggregateFunction, the state supports Consume,
+/// Merge and Finalize, so that partial results computed independently (for
+/// example one GroupedAggregator per thread) can be combined.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+class ARROW_EXPORT GroupedAggregator {
+ public:
+  ~GroupedAggregator();
+
+  /// \brief Create a GroupedAggregator
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] key_fields fields of the key columns
+  /// \param[in] value_fields fields of the value columns
+  /// \param[in] aggregates aggregates to compute, indexing into value_fields
+  /// \param[out] out the created GroupedAggregator
+  static Status Make(FunctionContext* ctx,
+                     const std::vector<std::shared_ptr<Field>>& key_fields,
+                     const std::vector<std::shared_ptr<Field>>& value_fields,
+                     const std::vector<GroupByAggregate>& aggregates,
+                     std::unique_ptr<GroupedAggregator>* out);
+
+  /// \brief Consume a set of equal-length key and value columns.
+  Status Consume(const std::vector<std::shared_ptr<Array>>& keys,
+                 const std::vector<std::shared_ptr<Array>>& values);
+
+  /// \brief Merge the groups of another GroupedAggregator into this one.
+  ///
+  /// The other aggregator must have been created with the same key types and
+  /// aggregates.
+  Status Merge(const GroupedAggregator& other);
+
+  /// \brief Produce one row per group: the key columns followed by one column
+  /// per aggregate, in the order they were given to Make.
+  ///
+  /// Aggregate columns are named "<value field name>_<aggregate>", e.g. "x_sum".
+  Status Finalize(std::shared_ptr<RecordBatch>* out) const;
+
+  /// \brief The number of distinct groups seen so far.
+  int64_t num_groups() const { return num_groups_; }
+
+  /// \brief Map each row of a set of equal-length key columns to its group id,
+  /// adding groups for keys not seen so far. Aggregates are not updated.
+  Status GetGroupIds(const std::vector<std::shared_ptr<Array>>& keys,
+                     std::vector<int32_t>* group_ids);
+
+ private:
+  explicit GroupedAggregator(FunctionContext* ctx);
+
+  Status GetKeyColumns(std::vector<std::shared_ptr<Array>>* out) const;
+
+  class CompositeKeyTable;
+
+  FunctionContext* ctx_;
+  std::vector<std::shared_ptr<Field>> key_fields_;
+  std::vector<std::shared_ptr<Field>> value_fields_;
+  std::vector<GroupByAggregate> aggregates_;
+  std::vector<std::unique_ptr<GroupKeyEncoder>> key_encoders_;
+  std::vector<std::unique_ptr<GroupedAggregateFunction>> aggregate_functions_;
+  // Only used with several key columns: maps the tuple of per-column memo
+  // indices to a group id.
+  std::unique_ptr<CompositeKeyTable> composite_keys_;
+  int64_t num_groups_ = 0;
+};
+
+/// \brief Group a table by one or more key columns and compute aggregates
+///
+/// The output table has one row per distinct key tuple (nulls form their own
+/// group), with the key columns first followed by one column per aggregate.
+/// Group order is the order of first appearance in the input.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] table the input table
+/// \param[in] key_columns indices of the key columns in the table
+/// \param[in] aggregates aggregates to compute, value_index refers to a table column
+/// \param[in] options see GroupByOptions
+/// \param[out] out resulting table
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* ctx, const Table& table,
+               const std::vector<int>& key_columns,
+               const std::vector<GroupByAggregate>& aggregates,
+               const GroupByOptions& options, std::shared_ptr<Table>* out);
+
+/// \brief Group a record batch by one or more key columns and compute aggregates
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch the input record batch
+/// \param[in] key_columns indices of the key columns in the batch
+/// \param[in] aggregates aggregates to compute, value_index refers to a batch column
+/// \param[out] out resulting record batch
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* ctx, const RecordBatch& batch,
+               const std::vector<int>& key_columns,
+               const std::vector<GroupByAggregate>& aggregates,
+               std::shared_ptr<RecordBatch>* out);
+
+/// \brief Split a record batch into one record batch per distinct key tuple
+///
+/// Rows are hashed on the key columns as in GroupBy (nulls form their own
+/// partition). Partitions are in order of first appearance of their key, and
+/// keep the relative order of their rows.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch the input record batch
+/// \param[in] key_columns indices of the key columns in the batch
+/// \param[out] keys the key columns, with one row per partition
+/// \param[out] partitions the rows of each partition, with all the batch's columns
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status PartitionBy(FunctionContext* ctx, const RecordBatch& batch,
+                   const std::vector<int>& key_columns,
+                   std::shared_ptr<RecordBatch>* keys,
+                   std::vector<std::shared_ptr<RecordBatch>>* partitions);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,269 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/group_by.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace compute {
+
+class TestGroupBy : public ComputeFixture, public TestBase {
+ protected:
+  void AssertGroupBy(const std::shared_ptr<RecordBatch>& input,
+                     const std::vector<int>& key_columns,
+                     const std::vector<GroupByAggregate>& aggregates,
+                     const std::shared_ptr<Schema>& expected_schema,
+                     const std::string& expected) {
+    std::shared_ptr<RecordBatch> actual;
+    ASSERT_OK(GroupBy(&this->ctx_, *input, key_columns, aggregates, &actual));
+    ASSERT_OK(actual->Validate());
+    AssertBatchesEqual(*RecordBatchFromJSON(expected_schema, expected), *actual);
+  }
+};
+
+TEST_F(TestGroupBy, SingleIntegerKey) {
+  auto input = RecordBatchFromJSON(schema({field("k", int32()), field("x", int64())}),
+                                   R"([{"k": 1, "x": 1},
+                                       {"k": 2, "x": 2},
+                                       {"k": 1, "x": 3},
+                                       {"k": null, "x": 4},
+                                       {"k": 2, "x": null},
+                                       {"k": null, "x": 6}])");
+  auto expected_schema = schema({field("k", int32()), field("x_count", int64()),
+                                 field("x_sum", int64()), field("x_min", int64()),
+                                 field("x_max", int64()), field("x_mean", float64())});
+  AssertGroupBy(input, {0},
+                {{GroupByAggregate::COUNT, 1},
+                 {GroupByAggregate::SUM, 1},
+                 {GroupByAggregate::MIN, 1},
+                 {GroupByAggregate::MAX, 1},
+                 {GroupByAggregate::MEAN, 1}},
+                expected_schema,
+                R"([{"k": 1, "x_count": 2, "x_sum": 4, "x_min": 1, "x_max": 3,
+                     "x_mean": 2.0},
+                    {"k": 2, "x_count": 1, "x_sum": 2, "x_min": 2, "x_max": 2,
+                     "x_mean": 2.0},
+                    {"k": null, "x_count": 2, "x_sum": 10, "x_min": 4, "x_max": 6,
+                     "x_mean": 5.0}])");
+}
+
+TEST_F(TestGroupBy, AllNullGroup) {
+  auto input = RecordBatchFromJSON(schema({field("k", utf8()), field("x", float64())}),
+                                   R"([{"k": "a", "x": null},
+                                       {"k": "b", "x": 1.5}])");
+  auto expected_schema = schema({field("k", utf8()), field("x_sum", float64()),
+                                 field("x_count", int64())});
+  AssertGroupBy(input, {0}, {{GroupByAggregate::SUM, 1}, {GroupByAggregate::COUNT, 1}},
+                expected_schema,
+                R"([{"k": "a", "x_sum": null, "x_count": 0},
+                    {"k": "b", "x_sum": 1.5, "x_count": 1}])");
+}
+
+TEST_F(TestGroupBy, MultipleKeys) {
+  auto input = RecordBatchFromJSON(
+      schema({field("a", int64()), field("b", utf8()), field("x", uint8())}),
+      R"([{"a": 1, "b": "x", "x": 1},
+          {"a": 1, "b": "y", "x": 2},
+          {"a": 2, "b": "x", "x": 3},
+          {"a": 1, "b": "x", "x": 4},
+          {"a": null, "b": "y", "x": 5},
+          {"a": null, "b": "y", "x": 6}])");
+  auto expected_schema =
+      schema({field("a", int64()), field("b", utf8()), field("x_sum", uint64())});
+  AssertGroupBy(input, {0, 1}, {{GroupByAggregate::SUM, 2}}, expected_schema,
+                R"([{"a": 1, "b": "x", "x_sum": 5},
+                    {"a": 1, "b": "y", "x_sum": 2},
+                    {"a": 2, "b": "x", "x_sum": 3},
+                    {"a": null, "b": "y", "x_sum": 11}])");
+}
+
+TEST_F(TestGroupBy, SlicedInput) {
+  auto input = RecordBatchFromJSON(schema({field("k", utf8()), field("x", int16())}),
+                                   R"([{"k": "aa", "x": 1},
+                                       {"k": "b", "x": 2},
+                                       {"k": "cc", "x": 3},
+                                       {"k": "b", "x": 4},
+                                       {"k": "cc", "x": 5}])");
+  auto expected_schema = schema({field("k", utf8()), field("x_sum", int64())});
+  AssertGroupBy(input->Slice(1, 3), {0}, {{GroupByAggregate::SUM, 1}}, expected_schema,
+                R"([{"k": "b", "x_sum": 6}, {"k": "cc", "x_sum": 3}])");
+}
+
+TEST_F(TestGroupBy, Empty) {
+  auto input = RecordBatchFromJSON(schema({field("k", int32()), field("x", int64())}),
+                                   "[]");
+  AssertGroupBy(input, {0}, {{GroupByAggregate::SUM, 1}},
+                schema({field("k", int32()), field("x_sum", int64())}), "[]");
+}
+
+TEST_F(TestGroupBy, Merge) {
+  auto s = schema({field("k", int64()), field("x", float64())});
+  std::vector<std::unique_ptr<GroupedAggregator>> aggregators(2);
+  for (auto& aggregator : aggregators) {
+    ASSERT_OK(GroupedAggregator::Make(&this->ctx_, {s->field(0)}, s->fields(),
+                                      {{GroupByAggregate::MEAN, 1},
+                                       {GroupByAggregate::MAX, 1}},
+                                      &aggregator));
+  }
+  auto batch0 = RecordBatchFromJSON(s, R"([{"k": 1, "x": 1}, {"k": 2, "x": 2}])");
+  auto batch1 = RecordBatchFromJSON(s, R"([{"k": 3, "x": 5}, {"k": 1, "x": 3}])");
+  ASSERT_OK(aggregators[0]->Consume({batch0->column(0)},
+                                    {batch0->column(0), batch0->column(1)}));
+  ASSERT_OK(aggregators[1]->Consume({batch1->column(0)},
+                                    {batch1->column(0), batch1->column(1)}));
+  ASSERT_OK(aggregators[0]->Merge(*aggregators[1]));
+  ASSERT_EQ(3, aggregators[0]->num_groups());
+
+  std::shared_ptr<RecordBatch> actual;
+  ASSERT_OK(aggregators[0]->Finalize(&actual));
+  auto expected = RecordBatchFromJSON(
+      schema({field("k", int64()), field("x_mean", float64()),
+              field("x_max", float64())}),
+      R"([{"k": 1, "x_mean": 2, "x_max": 3},
+          {"k": 2, "x_mean": 2, "x_max": 2},
+          {"k": 3, "x_mean": 5, "x_max": 5}])");
+  AssertBatchesEqual(*expected, *actual);
+}
+
+TEST_F(TestGroupBy, Table) {
+  auto s = schema({field("k", utf8()), field("x", int32())});
+  auto table = TableFromJSON(s, {R"([{"k": "a", "x": 1}, {"k": "b", "x": 2}])",
+                                 R"([{"k": "b", "x": 3}, {"k": "c", "x": 4}])",
+                                 R"([{"k": "a", "x": 5}])"});
+  auto expected = TableFromJSON(schema({field("k", utf8()), field("x_sum", int64())}),
+                                {R"([{"k": "a", "x_sum": 6},
+                                     {"k": "b", "x_sum": 5},
+                                     {"k": "c", "x_sum": 4}])"});
+
+  for (bool use_threads : {false, true}) {
+    auto options = GroupByOptions::Defaults();
+    options.use_threads = use_threads;
+    std::shared_ptr<Table> actual;
+    ASSERT_OK(
+        GroupBy(&this->ctx_, *table, {0}, {{GroupByAggregate::SUM, 1}}, options, &actual));
+    ASSERT_OK(actual->Validate());
+    AssertTablesEqual(*expected, *actual);
+  }
+}
+
+TEST_F(TestGroupBy, TableGroupOrder) {
+  // One distinct key per batch: with threads, the groups must still come out in
+  // order of first appearance whichever partition consumed each batch.
+  constexpr int32_t kNumBatches = 64;
+  auto s = schema({field("k", int32()), field("x", int32())});
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int32_t i = 0; i < kNumBatches; i++) {
+    std::shared_ptr<Array> keys, values;
+    ArrayFromVector<Int32Type, int32_t>({i, i}, &keys);
+    ArrayFromVector<Int32Type, int32_t>({1, i}, &values);
+    batches.push_back(RecordBatch::Make(s, 2, {keys, values}));
+  }
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches(s, batches, &table));
+
+  std::vector<int32_t> expected_keys;
+  std::vector<int64_t> expected_sums;
+  for (int32_t i = 0; i < kNumBatches; i++) {
+    expected_keys.push_back(i);
+    expected_sums.push_back(i + 1);
+  }
+  std::shared_ptr<Array> expected_k, expected_x_sum;
+  ArrayFromVector<Int32Type, int32_t>(expected_keys, &expected_k);
+  ArrayFromVector<Int64Type, int64_t>(expected_sums, &expected_x_sum);
+
+  // Make sure the batches are split across several partitions
+  const int capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetCpuThreadPoolCapacity(std::max(capacity, 4)));
+
+  for (bool use_threads : {false, true}) {
+    auto options = GroupByOptions::Defaults();
+    options.use_threads = use_threads;
+    std::shared_ptr<Table> actual;
+    ASSERT_OK(
+        GroupBy(&this->ctx_, *table, {0}, {{GroupByAggregate::SUM, 1}}, options, &actual));
+    ASSERT_OK(actual->Validate());
+    ASSERT_EQ(actual->num_rows(), kNumBatches);
+    AssertChunkedEqual(*actual->column(0), ArrayVector{expected_k});
+    AssertChunkedEqual(*actual->column(1), ArrayVector{expected_x_sum});
+  }
+  ASSERT_OK(SetCpuThreadPoolCapacity(capacity));
+}
+
+TEST_F(TestGroupBy, Errors) {
+  auto input = RecordBatchFromJSON(schema({field("k", int32()), field("x", utf8())}),
+                                   R"([{"k": 1, "x": "a"}])");
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_RAISES(NotImplemented,
+                GroupBy(&this->ctx_, *input, {0}, {{GroupByAggregate::SUM, 1}}, &out));
+  ASSERT_RAISES(IndexError,
+                GroupBy(&this->ctx_, *input, {2}, {{GroupByAggregate::COUNT, 1}}, &out));
+  ASSERT_RAISES(Invalid, GroupBy(&this->ctx_, *input, {}, {}, &out));
+
+  // Count works on any value type
+  ASSERT_OK(GroupBy(&this->ctx_, *input, {0}, {{GroupByAggregate::COUNT, 1}}, &out));
+}
+
+TEST_F(TestGroupBy, PartitionBy) {
+  auto s = schema({field("a", int64()), field("b", utf8()), field("x", uint8())});
+  auto input = RecordBatchFromJSON(s, R"([{"a": 1, "b": "x", "x": 1},
+                                          {"a": 1, "b": "y", "x": 2},
+                                          {"a": 2, "b": "x", "x": 3},
+                                          {"a": 1, "b": "x", "x": 4},
+                                          {"a": null, "b": "y", "x": 5},
+                                          {"a": null, "b": "y", "x": 6}])");
+  std::shared_ptr<RecordBatch> keys;
+  std::vector<std::shared_ptr<RecordBatch>> partitions;
+  ASSERT_OK(PartitionBy(&this->ctx_, *input, {0, 1}, &keys, &partitions));
+
+  ASSERT_OK(keys->Validate());
+  AssertBatchesEqual(*RecordBatchFromJSON(schema({s->field(0), s->field(1)}),
+                                          R"([{"a": 1, "b": "x"},
+                                              {"a": 1, "b": "y"},
+                                              {"a": 2, "b": "x"},
+                                              {"a": null, "b": "y"}])"),
+                     *keys);
+
+  ASSERT_EQ(partitions.size(), 4);
+  const char* expected[] = {
+      R"([{"a": 1, "b": "x", "x": 1}, {"a": 1, "b": "x", "x": 4}])",
+      R"([{"a": 1, "b": "y", "x": 2}])",
+      R"([{"a": 2, "b": "x", "x": 3}])",
+      R"([{"a": null, "b": "y", "x": 5}, {"a": null, "b": "y", "x": 6}])",
+  };
+  for (size_t i = 0; i < partitions.size(); i++) {
+    ASSERT_OK(partitions[i]->Validate());
+    AssertBatchesEqual(*RecordBatchFromJSON(s, expected[i]), *partitions[i]);
+  }
+
+  ASSERT_RAISES(IndexError, PartitionBy(&this->ctx_, *input, {3}, &keys, &partitions));
+}
+
+}  // namespace compute
+}  // namespace arrow
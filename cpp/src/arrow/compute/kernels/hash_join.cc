@@ -0,0 +1,409 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/hash_join.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/string_view.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::CpuInfo;
+using internal::HashTraits;
+using internal::ScalarHelper;
+
+namespace compute {
+
+namespace {
+
+// Matched row pairs produced by probing one left chunk
+struct JoinOutput {
+  std::vector<uint64_t> left;
+  std::vector<uint64_t> right;
+  // Only used for LEFT_OUTER: whether each right index is valid
+  std::vector<uint8_t> right_valid;
+};
+
+class HashJoinImpl {
+ public:
+  virtual ~HashJoinImpl() = default;
+
+  /// \brief Hash the right side
+  virtual Status Build(const ChunkedArray& right) = 0;
+
+  /// \brief Probe one chunk of the left side, whose first row is left row
+  /// `left_offset`. Must be thread-safe once Build has finished.
+  virtual Status Probe(const Array& left, int64_t left_offset, JoinOutput* out) const = 0;
+};
+
+template <typename Type, typename Scalar>
+class TypedHashJoin : public HashJoinImpl {
+ public:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+  TypedHashJoin(const HashJoinOptions& options, MemoryPool* pool)
+      : options_(options), pool_(pool) {}
+
+  Status Build(const ChunkedArray& right) override {
+    const int64_t num_rows = right.length() - right.null_count();
+    int num_partitions = options_.num_partitions;
+    if (num_partitions <= 0) {
+      // Roughly the memo table entry and the row list entry per build row
+      const int64_t build_size = num_rows * (sizeof(Scalar) + 3 * sizeof(int64_t));
+      const int64_t l2_size = CpuInfo::GetInstance()->CacheSize(CpuInfo::L2_CACHE);
+      num_partitions = static_cast<int>(
+          std::min<int64_t>(kMaxPartitions, std::max<int64_t>(1, build_size / l2_size)));
+    }
+    num_partitions = static_cast<int>(
+        BitUtil::NextPower2(std::min<int64_t>(num_partitions, kMaxPartitions)));
+    partition_shift_ = 64 - BitUtil::Log2(static_cast<uint64_t>(num_partitions));
+    partitions_.resize(num_partitions);
+
+    // Radix-partition the right rows by the high bits of their hash
+    std::vector<std::vector<std::pair<Scalar, uint64_t>>> partition_rows(num_partitions);
+    uint64_t row = 0;
+    for (const auto& chunk : right.chunks()) {
+      // Compute the lazy null count, so that the visitor skips the validity
+      // bitmap when there are no nulls
+      chunk->null_count();
+      RETURN_NOT_OK(VisitValues(
+          *chunk->data(), [&]() { ++row; },
+          [&](const Scalar& value) {
+            partition_rows[PartitionOf(value)].emplace_back(value, row++);
+          }));
+    }
+
+    auto build_partition = [&](int i) {
+      BuildPartition(partition_rows[i], &partitions_[i]);
+      // Release memory early
+      std::vector<std::pair<Scalar, uint64_t>>().swap(partition_rows[i]);
+      return Status::OK();
+    };
+    if (options_.use_threads && num_partitions > 1) {
+      return internal::ParallelFor(num_partitions, build_partition);
+    }
+    for (int i = 0; i < num_partitions; i++) {
+      RETURN_NOT_OK(build_partition(i));
+    }
+    return Status::OK();
+  }
+
+  Status Probe(const Array& left, int64_t left_offset, JoinOutput* out) const override {
+    const auto type = options_.type;
+    uint64_t row = left_offset;
+    auto emit_unmatched = [&]() {
+      if (type == HashJoinOptions::LEFT_OUTER) {
+        out->left.push_back(row);
+        out->right.push_back(0);
+        out->right_valid.push_back(0);
+      } else if (type == HashJoinOptions::LEFT_ANTI) {
+        out->left.push_back(row);
+      }
+    };
+
+    // Compute the lazy null count, so that the visitor skips the validity
+    // bitmap when there are no nulls
+    left.null_count();
+    return VisitValues(
+        *left.data(),
+        [&]() {
+          emit_unmatched();
+          ++row;
+        },
+        [&](const Scalar& value) {
+          const Partition& partition = partitions_[PartitionOf(value)];
+          const int32_t memo_index = partition.memo_table->Get(value);
+          if (memo_index == internal::kKeyNotFound) {
+            emit_unmatched();
+          } else if (type == HashJoinOptions::LEFT_SEMI) {
+            out->left.push_back(row);
+          } else if (type != HashJoinOptions::LEFT_ANTI) {
+            const int64_t begin = partition.offsets[memo_index];
+            const int64_t end = partition.offsets[memo_index + 1];
+            for (int64_t i = begin; i < end; i++) {
+              out->left.push_back(row);
+              out->right.push_back(partition.rows[i]);
+            }
+            if (type == HashJoinOptions::LEFT_OUTER) {
+              out->right_valid.insert(out->right_valid.end(), end - begin, 1);
+            }
+          }
+          ++row;
+        });
+  }
+
+ private:
+  static constexpr int64_t kMaxPartitions = 1024;
+
+  struct Partition {
+    std::unique_ptr<MemoTable> memo_table;
+    // The right rows of memo index i are rows[offsets[i]:offsets[i + 1]]
+    std::vector<int64_t> offsets;
+    std::vector<uint64_t> rows;
+  };
+
+  template <typename NullFunc, typename ValueFunc>
+  struct ValueVisitor {
+    Status VisitNull() {
+      visit_null();
+      return Status::OK();
+    }
+    Status VisitValue(const Scalar& value) {
+      visit_value(value);
+      return Status::OK();
+    }
+    NullFunc visit_null;
+    ValueFunc visit_value;
+  };
+
+  template <typename NullFunc, typename ValueFunc>
+  static Status VisitValues(const ArrayData& data, NullFunc&& visit_null,
+                            ValueFunc&& visit_value) {
+    using Visitor = ValueVisitor<typename std::decay<NullFunc>::type,
+                                 typename std::decay<ValueFunc>::type>;
+    Visitor visitor{std::forward<NullFunc>(visit_null),
+                    std::forward<ValueFunc>(visit_value)};
+    return ArrayDataVisitor<Type>::Visit(data, &visitor);
+  }
+
+  int PartitionOf(const Scalar& value) const {
+    if (partition_shift_ == 64) {
+      return 0;
+    }
+    // Use a different hash than the memo tables so that the partition bits
+    // are independent from the bucket bits
+    return static_cast<int>(ScalarHelper<Scalar, 1>::ComputeHash(value) >>
+                            partition_shift_);
+  }
+
+  void BuildPartition(const std::vector<std::pair<Scalar, uint64_t>>& rows,
+                      Partition* partition) const {
+    partition->memo_table.reset(new MemoTable(pool_, 0));
+    std::vector<int32_t> memo_indices(rows.size());
+    for (size_t i = 0; i < rows.size(); i++) {
+      memo_indices[i] = partition->memo_table->GetOrInsert(rows[i].first);
+    }
+
+    // Counting sort of the rows by memo index, which keeps them in row order
+    const int32_t num_keys = partition->memo_table->size();
+    partition->offsets.assign(num_keys + 1, 0);
+    for (int32_t memo_index : memo_indices) {
+      ++partition->offsets[memo_index + 1];
+    }
+    for (int32_t i = 0; i < num_keys; i++) {
+      partition->offsets[i + 1] += partition->offsets[i];
+    }
+    std::vector<int64_t> positions(partition->offsets.begin(),
+                                   partition->offsets.end() - 1);
+    partition->rows.resize(rows.size());
+    for (size_t i = 0; i < rows.size(); i++) {
+      partition->rows[positions[memo_indices[i]]++] = rows[i].second;
+    }
+  }
+
+  HashJoinOptions options_;
+  MemoryPool* pool_;
+  int partition_shift_ = 64;
+  std::vector<Partition> partitions_;
+};
+
+template <typename Type, typename Scalar>
+constexpr int64_t TypedHashJoin<Type, Scalar>::kMaxPartitions;
+
+template <typename Type, typename Enable = void>
+struct HashJoinTraits {};
+
+template <typename Type>
+struct HashJoinTraits<Type, enable_if_has_c_type<Type>> {
+  using HashJoinImpl = TypedHashJoin<Type, typename Type::c_type>;
+};
+
+template <typename Type>
+struct HashJoinTraits<Type, enable_if_boolean<Type>> {
+  using HashJoinImpl = TypedHashJoin<Type, bool>;
+};
+
+template <typename Type>
+struct HashJoinTraits<Type, enable_if_binary<Type>> {
+  using HashJoinImpl = TypedHashJoin<Type, util::string_view>;
+};
+
+template <typename Type>
+struct HashJoinTraits<Type, enable_if_fixed_size_binary<Type>> {
+  using HashJoinImpl = TypedHashJoin<Type, util::string_view>;
+};
+
+Status GetHashJoinImpl(FunctionContext* ctx, const DataType& type,
+                       const HashJoinOptions& options,
+                       std::unique_ptr<HashJoinImpl>* out) {
+#define HASH_JOIN_CASE(InType)                                                          \
+  case InType::type_id:                                                                 \
+    out->reset(                                                                         \
+        new typename HashJoinTraits<InType>::HashJoinImpl(options, ctx->memory_pool())); \
+    return Status::OK()
+
+  switch (type.id()) {
+    HASH_JOIN_CASE(BooleanType);
+    HASH_JOIN_CASE(UInt8Type);
+    HASH_JOIN_CASE(Int8Type);
+    HASH_JOIN_CASE(UInt16Type);
+    HASH_JOIN_CASE(Int16Type);
+    HASH_JOIN_CASE(UInt32Type);
+    HASH_JOIN_CASE(Int32Type);
+    HASH_JOIN_CASE(UInt64Type);
+    HASH_JOIN_CASE(Int64Type);
+    HASH_JOIN_CASE(FloatType);
+    HASH_JOIN_CASE(DoubleType);
+    HASH_JOIN_CASE(Date32Type);
+    HASH_JOIN_CASE(Date64Type);
+    HASH_JOIN_CASE(Time32Type);
+    HASH_JOIN_CASE(Time64Type);
+    HASH_JOIN_CASE(TimestampType);
+    HASH_JOIN_CASE(BinaryType);
+    HASH_JOIN_CASE(StringType);
+    HASH_JOIN_CASE(FixedSizeBinaryType);
+    HASH_JOIN_CASE(Decimal128Type);
+    default:
+      break;
+  }
+#undef HASH_JOIN_CASE
+
+  return Status::NotImplemented("HashJoin is not implemented for ", type.ToString());
+}
+
+std::shared_ptr<ChunkedArray> AsChunkedArray(const Datum& datum) {
+  if (datum.kind() == Datum::ARRAY) {
+    return std::make_shared<ChunkedArray>(ArrayVector{datum.make_array()});
+  } else if (datum.kind() == Datum::CHUNKED_ARRAY) {
+    return datum.chunked_array();
+  }
+  return nullptr;
+}
+
+Status HashJoinChunked(FunctionContext* ctx, const ChunkedArray& left,
+                       const ChunkedArray& right, const HashJoinOptions& options,
+                       std::shared_ptr<Array>* left_indices,
+                       std::shared_ptr<Array>* right_indices) {
+  if (!left.type()->Equals(right.type())) {
+    return Status::TypeError("HashJoin keys must have the same type, got ",
+                             left.type()->ToString(), " and ", right.type()->ToString());
+  }
+
+  std::unique_ptr<HashJoinImpl> impl;
+  RETURN_NOT_OK(GetHashJoinImpl(ctx, *left.type(), options, &impl));
+  RETURN_NOT_OK(impl->Build(right));
+
+  const int num_chunks = left.num_chunks();
+  std::vector<int64_t> chunk_offsets(num_chunks, 0);
+  for (int i = 1; i < num_chunks; i++) {
+    chunk_offsets[i] = chunk_offsets[i - 1] + left.chunk(i - 1)->length();
+  }
+  std::vector<JoinOutput> outputs(num_chunks);
+  auto probe_chunk = [&](int i) {
+    return impl->Probe(*left.chunk(i), chunk_offsets[i], &outputs[i]);
+  };
+  if (options.use_threads && num_chunks > 1) {
+    RETURN_NOT_OK(internal::ParallelFor(num_chunks, probe_chunk));
+  } else {
+    for (int i = 0; i < num_chunks; i++) {
+      RETURN_NOT_OK(probe_chunk(i));
+    }
+  }
+
+  // Concatenate the per-chunk outputs in chunk order
+  const bool has_right = options.type == HashJoinOptions::INNER ||
+                         options.type == HashJoinOptions::LEFT_OUTER;
+  UInt64Builder left_builder(ctx->memory_pool());
+  UInt64Builder right_builder(ctx->memory_pool());
+  int64_t length = 0;
+  for (const auto& output : outputs) {
+    length += static_cast<int64_t>(output.left.size());
+  }
+  RETURN_NOT_OK(left_builder.Reserve(length));
+  if (has_right) {
+    RETURN_NOT_OK(right_builder.Reserve(length));
+  }
+  for (auto& output : outputs) {
+    RETURN_NOT_OK(left_builder.AppendValues(output.left));
+    if (options.type == HashJoinOptions::LEFT_OUTER) {
+      RETURN_NOT_OK(right_builder.AppendValues(
+          output.right.data(), static_cast<int64_t>(output.right.size()),
+          output.right_valid.data()));
+    } else if (has_right) {
+      RETURN_NOT_OK(right_builder.AppendValues(output.right));
+    }
+    output = JoinOutput();
+  }
+
+  RETURN_NOT_OK(left_builder.Finish(left_indices));
+  if (has_right) {
+    RETURN_NOT_OK(right_builder.Finish(right_indices));
+  } else {
+    *right_indices = nullptr;
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status HashJoin(FunctionContext* ctx, const Datum& left, const Datum& right,
+                const HashJoinOptions& options, std::shared_ptr<Array>* left_indices,
+                std::shared_ptr<Array>* right_indices) {
+  auto left_chunked = AsChunkedArray(left);
+  auto right_chunked = AsChunkedArray(right);
+  if (left_chunked == nullptr || right_chunked == nullptr) {
+    return Status::Invalid("HashJoin expects array-like keys");
+  }
+  return HashJoinChunked(ctx, *left_chunked, *right_chunked, options, left_indices,
+                         right_indices);
+}
+
+Status HashJoin(FunctionContext* ctx, const Table& left, int left_key, const Table& right,
+                int right_key, const HashJoinOptions& options,
+                std::shared_ptr<Array>* left_indices,
+                std::shared_ptr<Array>* right_indices) {
+  if (left_key < 0 || left_key >= left.num_columns()) {
+    return Status::IndexError("Left join key ", left_key, " out of bounds");
+  }
+  if (right_key < 0 || right_key >= right.num_columns()) {
+    return Status::IndexError("Right join key ", right_key, " out of bounds");
+  }
+  return HashJoinChunked(ctx, *left.column(left_key), *right.column(right_key), options,
+                         left_indices, right_indices);
+}
+
+}  // namespace compute
+}  // namespace arrow
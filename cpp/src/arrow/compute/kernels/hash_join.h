@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+struct Datum;
+
+/// \class HashJoinOptions
+///
+/// The user can control the HashJoin kernel behavior with this class.
+struct ARROW_EXPORT HashJoinOptions {
+  enum join_type {
+    // Pairs of matching left and right rows.
+    INNER = 0,
+    // Like INNER, plus unmatched left rows paired with a null right index.
+    LEFT_OUTER,
+    // Left rows having at least one match, once each.
+    LEFT_SEMI,
+    // Left rows having no match.
+    LEFT_ANTI,
+  };
+
+  static HashJoinOptions Defaults() { return HashJoinOptions(); }
+
+  enum join_type type = INNER;
+
+  /// Build the partitions of the right side and probe the chunks of the left
+  /// side concurrently on the CPU thread pool.
+  bool use_threads = false;
+
+  /// Number of hash partitions of the build (right) side, rounded up to a
+  /// power of two. If 0, it is chosen so that each partition fits in the L2
+  /// cache.
+  int num_partitions = 0;
+};
+
+/// \brief Compute the row pairs of an equi-join on one key column
+///
+/// The right side is hashed (the "build" side) and the left side is probed
+/// against it. Null keys never match. The output indices are suitable for
+/// Take: `left_indices` refers to rows of `left`, `right_indices` to rows of
+/// `right` (for chunked inputs, the logical row position across chunks).
+///
+/// Output is ordered by left row, then by right row. For LEFT_OUTER, the right
+/// index of unmatched left rows is null. For LEFT_SEMI and LEFT_ANTI only the
+/// left indices are produced and `right_indices` is set to null.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left left join key, Array or ChunkedArray
+/// \param[in] right right join key, Array or ChunkedArray of the same type
+/// \param[in] options see HashJoinOptions
+/// \param[out] left_indices uint64 indices into left
+/// \param[out] right_indices uint64 indices into right
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashJoin(FunctionContext* ctx, const Datum& left, const Datum& right,
+                const HashJoinOptions& options, std::shared_ptr<Array>* left_indices,
+                std::shared_ptr<Array>* right_indices);
+
+/// \brief Compute the row pairs of an equi-join of two tables
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left left table
+/// \param[in] left_key index of the key column in the left table
+/// \param[in] right right table
+/// \param[in] right_key index of the key column in the right table
+/// \param[in] options see HashJoinOptions
+/// \param[out] left_indices uint64 indices into left
+/// \param[out] right_indices uint64 indices into right
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashJoin(FunctionContext* ctx, const Table& left, int left_key, const Table& right,
+                int right_key, const HashJoinOptions& options,
+                std::shared_ptr<Array>* left_indices,
+                std::shared_ptr<Array>* right_indices);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,129 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/hash_join.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestHashJoin : public ComputeFixture, public TestBase {
+ protected:
+  void AssertJoin(const Datum& left, const Datum& right, HashJoinOptions options,
+                  const std::string& expected_left, const std::string& expected_right) {
+    for (int num_partitions : {0, 1, 4}) {
+      for (bool use_threads : {false, true}) {
+        options.num_partitions = num_partitions;
+        options.use_threads = use_threads;
+        std::shared_ptr<Array> left_indices, right_indices;
+        ASSERT_OK(
+            HashJoin(&this->ctx_, left, right, options, &left_indices, &right_indices));
+        ASSERT_OK(left_indices->Validate());
+        AssertArraysEqual(*ArrayFromJSON(uint64(), expected_left), *left_indices);
+        if (expected_right.empty()) {
+          ASSERT_EQ(nullptr, right_indices);
+        } else {
+          ASSERT_OK(right_indices->Validate());
+          AssertArraysEqual(*ArrayFromJSON(uint64(), expected_right), *right_indices);
+        }
+      }
+    }
+  }
+
+  HashJoinOptions Options(enum HashJoinOptions::join_type type) {
+    auto options = HashJoinOptions::Defaults();
+    options.type = type;
+    return options;
+  }
+};
+
+TEST_F(TestHashJoin, Integers) {
+  auto left = ArrayFromJSON(int32(), "[1, 2, null, 3, 2, 5]");
+  auto right = ArrayFromJSON(int32(), "[2, 3, null, 2, 4]");
+
+  AssertJoin(left, right, Options(HashJoinOptions::INNER), "[1, 1, 3, 4, 4]",
+             "[0, 3, 1, 0, 3]");
+  AssertJoin(left, right, Options(HashJoinOptions::LEFT_OUTER),
+             "[0, 1, 1, 2, 3, 4, 4, 5]", "[null, 0, 3, null, 1, 0, 3, null]");
+  AssertJoin(left, right, Options(HashJoinOptions::LEFT_SEMI), "[1, 3, 4]", "");
+  AssertJoin(left, right, Options(HashJoinOptions::LEFT_ANTI), "[0, 2, 5]", "");
+}
+
+TEST_F(TestHashJoin, Strings) {
+  auto left = ChunkedArrayFromJSON(utf8(), {R"(["a", "bb"])", "[]", R"([null, "c"])"});
+  auto right = ChunkedArrayFromJSON(utf8(), {R"(["c", "a"])", R"(["", "c"])"});
+
+  AssertJoin(left, right, Options(HashJoinOptions::INNER), "[0, 3, 3]", "[1, 0, 3]");
+  AssertJoin(left, right, Options(HashJoinOptions::LEFT_ANTI), "[1, 2]", "");
+}
+
+TEST_F(TestHashJoin, Empty) {
+  auto left = ArrayFromJSON(int64(), "[1, 2]");
+  auto right = ArrayFromJSON(int64(), "[]");
+  AssertJoin(left, right, Options(HashJoinOptions::INNER), "[]", "[]");
+  AssertJoin(left, right, Options(HashJoinOptions::LEFT_OUTER), "[0, 1]",
+             "[null, null]");
+  AssertJoin(right, left, Options(HashJoinOptions::LEFT_SEMI), "[]", "");
+}
+
+TEST_F(TestHashJoin, TakeTables) {
+  auto left = TableFromJSON(schema({field("id", int64()), field("x", utf8())}),
+                            {R"([[1, "a"], [2, "b"]])", R"([[3, "c"]])"});
+  auto right = TableFromJSON(schema({field("y", float64()), field("id", int64())}),
+                             {R"([[0.5, 3], [1.5, 1], [2.5, 3]])"});
+
+  std::shared_ptr<Array> left_indices, right_indices;
+  ASSERT_OK(HashJoin(&this->ctx_, *left, 0, *right, 1, HashJoinOptions::Defaults(),
+                     &left_indices, &right_indices));
+
+  std::shared_ptr<Table> left_taken, right_taken;
+  ASSERT_OK(Take(&this->ctx_, *left, *left_indices, TakeOptions(), &left_taken));
+  ASSERT_OK(Take(&this->ctx_, *right, *right_indices, TakeOptions(), &right_taken));
+  AssertChunkedEqual(*ChunkedArrayFromJSON(utf8(), {R"(["a", "c", "c"])"}),
+                     *left_taken->column(1));
+  AssertChunkedEqual(*ChunkedArrayFromJSON(float64(), {"[1.5, 0.5, 2.5]"}),
+                     *right_taken->column(0));
+}
+
+TEST_F(TestHashJoin, Errors) {
+  std::shared_ptr<Array> left_indices, right_indices;
+  ASSERT_RAISES(TypeError, HashJoin(&this->ctx_, ArrayFromJSON(int32(), "[]"),
+                                    ArrayFromJSON(int64(), "[]"),
+                                    HashJoinOptions::Defaults(), &left_indices,
+                                    &right_indices));
+  auto list_type = list(int32());
+  ASSERT_RAISES(NotImplemented, HashJoin(&this->ctx_, ArrayFromJSON(list_type, "[]"),
+                                         ArrayFromJSON(list_type, "[]"),
+                                         HashJoinOptions::Defaults(), &left_indices,
+                                         &right_indices));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -58,10 +58,9 @@ struct MeanState {
   typename SumType::c_type sum = 0;
 };
 
-#define MEAN_AGG_FN_CASE(T)                             \
-  case T::type_id:                                      \
-    return std::static_pointer_cast<AggregateFunction>( \
-        std::make_shared<SumAggregateFunction<T, MeanState<T>>>());
+#define MEAN_AGG_FN_CASE(T) \
+  case T::type_id:          \
+    return MakeSumAggregateFunctionForType<T, MeanState<T>>();
 
 std::shared_ptr<AggregateFunction> MakeMeanAggregateFunction(const DataType& type,
                                                              FunctionContext* ctx) {
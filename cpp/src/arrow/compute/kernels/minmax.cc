@@ -21,12 +21,15 @@
 
 #include "arrow/compute/kernels/aggregate.h"
 #include "arrow/compute/kernels/minmax.h"
+#include "arrow/compute/kernels/minmax_internal.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 
 namespace arrow {
 
 using internal::checked_cast;
+using internal::DispatchLevel;
+using internal::IsDispatchLevelSupported;
 
 namespace compute {
 
@@ -45,11 +48,6 @@ struct MinMaxState<ArrowType,
     return *this;
   }
 
-  void MergeOne(c_type value) {
-    this->min = std::min(this->min, value);
-    this->max = std::max(this->max, value);
-  }
-
   c_type min = std::numeric_limits<c_type>::max();
   c_type max = std::numeric_limits<c_type>::min();
 };
@@ -66,18 +64,15 @@ struct MinMaxState<ArrowType,
     return *this;
   }
 
-  void MergeOne(c_type value) {
-    this->min = std::fmin(this->min, value);
-    this->max = std::fmax(this->max, value);
-  }
-
   c_type min = std::numeric_limits<c_type>::infinity();
   c_type max = -std::numeric_limits<c_type>::infinity();
 };
 
-template <typename ArrowType>
+template <typename ArrowType, DispatchLevel Level = DispatchLevel::NONE>
 class MinMaxAggregateFunction final
     : public AggregateFunctionStaticState<MinMaxState<ArrowType>> {
+  using Loops = MinMaxLoops<Level, typename ArrowType::c_type>;
+
  public:
   using StateType = MinMaxState<ArrowType>;
 
@@ -86,16 +81,14 @@ class MinMaxAggregateFunction final
   Status Consume(const Array& array, StateType* state) const override {
     StateType local;
 
-    internal::BitmapReader reader(array.null_bitmap_data(), array.offset(),
-                                  array.length());
     const auto values =
         checked_cast<const typename TypeTraits<ArrowType>::ArrayType&>(array)
             .raw_values();
-    for (int64_t i = 0; i < array.length(); i++) {
-      if (reader.IsSet()) {
-        local.MergeOne(values[i]);
-      }
-      reader.Next();
+    if (array.null_count() == 0) {
+      Loops::MinMaxDense(values, array.length(), &local.min, &local.max);
+    } else {
+      Loops::MinMaxSparse(values, array.null_bitmap_data(), array.offset(),
+                          array.length(), &local.min, &local.max);
     }
     *state = local;
 
@@ -120,10 +113,21 @@ class MinMaxAggregateFunction final
   MinMaxOptions options_;
 };
 
-#define MINMAX_AGG_FN_CASE(T)                           \
-  case T::type_id:                                      \
-    return std::static_pointer_cast<AggregateFunction>( \
-        std::make_shared<MinMaxAggregateFunction<T>>(options));
+template <typename ArrowType>
+std::shared_ptr<AggregateFunction> MakeMinMaxAggregateFunctionForType(
+    const MinMaxOptions& options) {
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (IsDispatchLevelSupported(DispatchLevel::AVX2)) {
+    return std::make_shared<MinMaxAggregateFunction<ArrowType, DispatchLevel::AVX2>>(
+        options);
+  }
+#endif
+  return std::make_shared<MinMaxAggregateFunction<ArrowType>>(options);
+}
+
+#define MINMAX_AGG_FN_CASE(T) \
+  case T::type_id:            \
+    return MakeMinMaxAggregateFunctionForType<T>(options);
 
 std::shared_ptr<AggregateFunction> MakeMinMaxAggregateFunction(
     const DataType& type, FunctionContext* ctx, const MinMaxOptions& options) {
@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/util/dispatch.h"
+
+namespace arrow {
+namespace compute {
+
+// The loops of the min/max kernels. Those for levels above NONE are only
+// instantiated in a source file compiled for that level (see
+// arrow/util/dispatch.h), so they must be self-contained.
+template <internal::DispatchLevel Level, typename CType>
+struct MinMaxLoops {
+  // Update min and max with values[0, length)
+  static void MinMaxDense(const CType* values, int64_t length, CType* min, CType* max);
+
+  // Update min and max with the valid values[0, length), where the validity
+  // bitmap starts at bit offset of bitmap
+  static void MinMaxSparse(const CType* values, const uint8_t* bitmap, int64_t offset,
+                           int64_t length, CType* min, CType* max);
+
+ private:
+  // Same as std::min and std::max for integers, and as std::fmin and std::fmax
+  // for floating point as long as current isn't NaN (comparisons with NaN are
+  // false, so NaN values are skipped). Written so that they vectorize.
+  static CType Min(CType current, CType value) {
+    return value < current ? value : current;
+  }
+  static CType Max(CType current, CType value) {
+    return value > current ? value : current;
+  }
+};
+
+template <internal::DispatchLevel Level, typename CType>
+void MinMaxLoops<Level, CType>::MinMaxDense(const CType* values, int64_t length,
+                                            CType* min, CType* max) {
+  CType local_min = *min;
+  CType local_max = *max;
+  for (int64_t i = 0; i < length; i++) {
+    local_min = Min(local_min, values[i]);
+    local_max = Max(local_max, values[i]);
+  }
+  *min = local_min;
+  *max = local_max;
+}
+
+template <internal::DispatchLevel Level, typename CType>
+void MinMaxLoops<Level, CType>::MinMaxSparse(const CType* values, const uint8_t* bitmap,
+                                             int64_t offset, int64_t length, CType* min,
+                                             CType* max) {
+  CType local_min = *min;
+  CType local_max = *max;
+  for (int64_t i = 0; i < length; i++) {
+    const int64_t bit = offset + i;
+    const bool valid = (bitmap[bit >> 3] >> (bit & 7)) & 1;
+    // Null values are replaced by the current min/max, which leaves them unchanged
+    local_min = Min(local_min, valid ? values[i] : local_min);
+    local_max = Max(local_max, valid ? values[i] : local_max);
+  }
+  *min = local_min;
+  *max = local_max;
+}
+
+#define ARROW_MINMAX_LOOPS_INSTANTIATION(DECL, LEVEL) \
+  DECL struct MinMaxLoops<LEVEL, uint8_t>;            \
+  DECL struct MinMaxLoops<LEVEL, int8_t>;             \
+  DECL struct MinMaxLoops<LEVEL, uint16_t>;           \
+  DECL struct MinMaxLoops<LEVEL, int16_t>;            \
+  DECL struct MinMaxLoops<LEVEL, uint32_t>;           \
+  DECL struct MinMaxLoops<LEVEL, int32_t>;            \
+  DECL struct MinMaxLoops<LEVEL, uint64_t>;           \
+  DECL struct MinMaxLoops<LEVEL, int64_t>;            \
+  DECL struct MinMaxLoops<LEVEL, float>;              \
+  DECL struct MinMaxLoops<LEVEL, double>;
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+// Instantiated in aggregate_avx2.cc
+ARROW_MINMAX_LOOPS_INSTANTIATION(extern template, internal::DispatchLevel::AVX2)
+#endif
+
+}  // namespace compute
+}  // namespace arrow
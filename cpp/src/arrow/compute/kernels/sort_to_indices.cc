@@ -18,19 +18,32 @@
 #include "arrow/compute/kernels/sort_to_indices.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <numeric>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/expression.h"
 #include "arrow/compute/logical_type.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/string_view.h"
+#include "arrow/visitor_inline.h"
 
 namespace arrow {
 
 class Array;
 
+using internal::checked_cast;
+
 namespace compute {
 
 /// \brief UnaryKernel implementing SortToIndices operation
@@ -190,5 +203,302 @@ Status SortToIndices(FunctionContext* ctx, const Array& values,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Multi-column sorting
+
+namespace {
+
+constexpr uint64_t kSignBit = static_cast<uint64_t>(1) << 63;
+
+// Order-preserving conversion of a value to an unsigned 64-bit integer
+template <typename CType, typename Enable = void>
+struct NormalizedKey {};
+
+template <typename CType>
+struct NormalizedKey<
+    CType, typename std::enable_if<std::is_unsigned<CType>::value>::type> {
+  static uint64_t Get(CType value) { return static_cast<uint64_t>(value); }
+};
+
+template <typename CType>
+struct NormalizedKey<
+    CType, typename std::enable_if<std::is_signed<CType>::value &&
+                                   std::is_integral<CType>::value>::type> {
+  static uint64_t Get(CType value) {
+    return static_cast<uint64_t>(static_cast<int64_t>(value)) ^ kSignBit;
+  }
+};
+
+template <typename CType>
+struct NormalizedKey<
+    CType, typename std::enable_if<std::is_floating_point<CType>::value>::type> {
+  static uint64_t Get(CType value) {
+    // All NaNs, whatever their sign and payload, compare equal and greater
+    // than +inf
+    if (std::isnan(value)) {
+      return std::numeric_limits<uint64_t>::max();
+    }
+    // Widening to double is exact; -0.0 and 0.0 must compare equal
+    double d = value == 0 ? 0.0 : static_cast<double>(value);
+    uint64_t bits;
+    std::memcpy(&bits, &d, sizeof(bits));
+    return (bits & kSignBit) ? ~bits : bits | kSignBit;
+  }
+};
+
+// A sort key column converted to one normalized key per row
+struct NormalizedColumn {
+  std::vector<uint64_t> keys;
+  // One byte per row, empty if the column has no nulls
+  std::vector<uint8_t> is_null;
+};
+
+class ColumnNormalizer {
+ public:
+  ColumnNormalizer(const ChunkedArray& column, NormalizedColumn* out)
+      : column_(column), out_(out) {}
+
+  Status Normalize() {
+    out_->keys.assign(column_.length(), 0);
+    if (column_.null_count() > 0) {
+      out_->is_null.assign(column_.length(), 0);
+    } else {
+      out_->is_null.clear();
+    }
+    return VisitTypeInline(*column_.type(), this);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Sorting of ", type, " arrays");
+  }
+
+  Status Visit(const BooleanType&) {
+    return VisitChunks<BooleanArray>([](const BooleanArray& array, int64_t i) {
+      return static_cast<uint64_t>(array.Value(i));
+    });
+  }
+
+#define VISIT_NORMALIZED(TYPE)                                              \
+  Status Visit(const TYPE&) {                                               \
+    using ArrayType = typename TypeTraits<TYPE>::ArrayType;                 \
+    using CType = typename TYPE::c_type;                                    \
+    return VisitChunks<ArrayType>([](const ArrayType& array, int64_t i) {   \
+      return NormalizedKey<CType>::Get(array.Value(i));                     \
+    });                                                                     \
+  }
+
+  VISIT_NORMALIZED(UInt8Type)
+  VISIT_NORMALIZED(Int8Type)
+  VISIT_NORMALIZED(UInt16Type)
+  VISIT_NORMALIZED(Int16Type)
+  VISIT_NORMALIZED(UInt32Type)
+  VISIT_NORMALIZED(Int32Type)
+  VISIT_NORMALIZED(UInt64Type)
+  VISIT_NORMALIZED(Int64Type)
+  VISIT_NORMALIZED(FloatType)
+  VISIT_NORMALIZED(DoubleType)
+  VISIT_NORMALIZED(Date32Type)
+  VISIT_NORMALIZED(Date64Type)
+  VISIT_NORMALIZED(Time32Type)
+  VISIT_NORMALIZED(Time64Type)
+  VISIT_NORMALIZED(TimestampType)
+  VISIT_NORMALIZED(DurationType)
+
+#undef VISIT_NORMALIZED
+
+  Status Visit(const BinaryType&) { return RankViews<BinaryArray>(); }
+  Status Visit(const StringType&) { return RankViews<StringArray>(); }
+  Status Visit(const LargeBinaryType&) { return RankViews<LargeBinaryArray>(); }
+  Status Visit(const LargeStringType&) { return RankViews<LargeStringArray>(); }
+  Status Visit(const FixedSizeBinaryType&) { return RankViews<FixedSizeBinaryArray>(); }
+
+ private:
+  template <typename ArrayType, typename GetKey>
+  Status VisitChunks(GetKey&& get_key) {
+    uint64_t* keys = out_->keys.data();
+    for (const auto& chunk : column_.chunks()) {
+      const auto& array = checked_cast<const ArrayType&>(*chunk);
+      const int64_t length = array.length();
+      if (array.null_count() == 0) {
+        for (int64_t i = 0; i < length; i++) {
+          keys[i] = get_key(array, i);
+        }
+      } else {
+        uint8_t* is_null = out_->is_null.data() + (keys - out_->keys.data());
+        for (int64_t i = 0; i < length; i++) {
+          if (array.IsNull(i)) {
+            is_null[i] = 1;
+          } else {
+            keys[i] = get_key(array, i);
+          }
+        }
+      }
+      keys += length;
+    }
+    return Status::OK();
+  }
+
+  // Variable-width values have no fixed-size order-preserving encoding:
+  // use their dense rank among the column values instead.
+  template <typename ArrayType>
+  Status RankViews() {
+    std::vector<std::pair<util::string_view, uint64_t>> views;
+    views.reserve(column_.length() - column_.null_count());
+    uint64_t row = 0;
+    for (const auto& chunk : column_.chunks()) {
+      const auto& array = checked_cast<const ArrayType&>(*chunk);
+      for (int64_t i = 0; i < array.length(); i++, row++) {
+        if (array.IsNull(i)) {
+          out_->is_null[row] = 1;
+        } else {
+          views.emplace_back(array.GetView(i), row);
+        }
+      }
+    }
+    std::sort(views.begin(), views.end(),
+              [](const std::pair<util::string_view, uint64_t>& left,
+                 const std::pair<util::string_view, uint64_t>& right) {
+                return left.first < right.first;
+              });
+    uint64_t rank = 0;
+    for (size_t i = 0; i < views.size(); i++) {
+      if (i > 0 && views[i].first != views[i - 1].first) {
+        ++rank;
+      }
+      out_->keys[views[i].second] = rank;
+    }
+    return Status::OK();
+  }
+
+  const ChunkedArray& column_;
+  NormalizedColumn* out_;
+};
+
+// Stable least-significant-digit radix sort of (keys, indices) pairs by key,
+// one byte at a time. Bytes which are equal across all keys are skipped.
+class RadixSorter {
+ public:
+  explicit RadixSorter(int64_t length) : tmp_keys_(length), tmp_indices_(length) {}
+
+  void Sort(std::vector<uint64_t>* keys, std::vector<uint64_t>* indices) {
+    const size_t length = keys->size();
+    std::array<std::array<uint64_t, 256>, 8> histograms{};
+    for (uint64_t key : *keys) {
+      for (int byte = 0; byte < 8; byte++) {
+        ++histograms[byte][(key >> (8 * byte)) & 0xff];
+      }
+    }
+
+    for (int byte = 0; byte < 8; byte++) {
+      auto& histogram = histograms[byte];
+      if (histogram[((*keys)[0] >> (8 * byte)) & 0xff] == length) {
+        // All keys share this byte, the pass would be a no-op
+        continue;
+      }
+      uint64_t offset = 0;
+      for (auto& count : histogram) {
+        const uint64_t next = offset + count;
+        count = offset;
+        offset = next;
+      }
+      for (size_t i = 0; i < length; i++) {
+        const uint64_t key = (*keys)[i];
+        const uint64_t pos = histogram[(key >> (8 * byte)) & 0xff]++;
+        tmp_keys_[pos] = key;
+        tmp_indices_[pos] = (*indices)[i];
+      }
+      keys->swap(tmp_keys_);
+      indices->swap(tmp_indices_);
+    }
+  }
+
+ private:
+  std::vector<uint64_t> tmp_keys_;
+  std::vector<uint64_t> tmp_indices_;
+};
+
+Status SortChunkedColumnsToIndices(FunctionContext* ctx, int64_t length,
+                                   const std::vector<const ChunkedArray*>& columns,
+                                   const std::vector<SortKey>& keys,
+                                   std::shared_ptr<Array>* offsets) {
+  std::vector<uint64_t> indices(length);
+  std::iota(indices.begin(), indices.end(), 0);
+
+  if (length > 0) {
+    RadixSorter sorter(length);
+    std::vector<uint64_t> sort_keys(length);
+    NormalizedColumn normalized;
+
+    // Sorting stably by each key, least significant first, yields the
+    // lexicographic order over all keys.
+    for (int k = static_cast<int>(keys.size()) - 1; k >= 0; k--) {
+      const SortKey& key = keys[k];
+      RETURN_NOT_OK(ColumnNormalizer(*columns[k], &normalized).Normalize());
+
+      const bool descending = key.order == SortKey::DESCENDING;
+      for (int64_t i = 0; i < length; i++) {
+        const uint64_t value = normalized.keys[indices[i]];
+        sort_keys[i] = descending ? ~value : value;
+      }
+      sorter.Sort(&sort_keys, &indices);
+
+      if (!normalized.is_null.empty()) {
+        const uint8_t* is_null = normalized.is_null.data();
+        auto not_null = [is_null](uint64_t index) { return is_null[index] == 0; };
+        auto is_null_first = [is_null](uint64_t index) { return is_null[index] != 0; };
+        if (key.null_placement == SortKey::NULLS_FIRST) {
+          std::stable_partition(indices.begin(), indices.end(), is_null_first);
+        } else {
+          std::stable_partition(indices.begin(), indices.end(), not_null);
+        }
+      }
+    }
+  }
+
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(
+      AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t), &indices_buf));
+  if (length > 0) {
+    std::memcpy(indices_buf->mutable_data(), indices.data(), length * sizeof(uint64_t));
+  }
+  *offsets = std::make_shared<UInt64Array>(length, indices_buf);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status SortToIndices(FunctionContext* ctx, const Table& table,
+                     const std::vector<SortKey>& keys, std::shared_ptr<Array>* offsets) {
+  if (keys.empty()) {
+    return Status::Invalid("Must specify one or more sort keys");
+  }
+  std::vector<const ChunkedArray*> columns;
+  for (const auto& key : keys) {
+    if (key.column < 0 || key.column >= table.num_columns()) {
+      return Status::IndexError("Sort key column ", key.column, " out of bounds");
+    }
+    columns.push_back(table.column(key.column).get());
+  }
+  return SortChunkedColumnsToIndices(ctx, table.num_rows(), columns, keys, offsets);
+}
+
+Status SortToIndices(FunctionContext* ctx, const RecordBatch& batch,
+                     const std::vector<SortKey>& keys, std::shared_ptr<Array>* offsets) {
+  if (keys.empty()) {
+    return Status::Invalid("Must specify one or more sort keys");
+  }
+  std::vector<std::shared_ptr<ChunkedArray>> chunked_columns;
+  std::vector<const ChunkedArray*> columns;
+  for (const auto& key : keys) {
+    if (key.column < 0 || key.column >= batch.num_columns()) {
+      return Status::IndexError("Sort key column ", key.column, " out of bounds");
+    }
+    chunked_columns.push_back(
+        std::make_shared<ChunkedArray>(ArrayVector{batch.column(key.column)}));
+    columns.push_back(chunked_columns.back().get());
+  }
+  return SortChunkedColumnsToIndices(ctx, batch.num_rows(), columns, keys, offsets);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "arrow/compute/kernel.h"
 #include "arrow/status.h"
@@ -26,6 +27,8 @@
 namespace arrow {
 
 class Array;
+class RecordBatch;
+class Table;
 
 namespace compute {
 
@@ -47,5 +50,62 @@ ARROW_EXPORT
 Status SortToIndices(FunctionContext* ctx, const Array& values,
                      std::shared_ptr<Array>* offsets);
 
+/// \class SortKey
+///
+/// One column of a multi-column sort, with its ordering and null placement.
+struct ARROW_EXPORT SortKey {
+  enum order {
+    ASCENDING = 0,
+    DESCENDING,
+  };
+
+  enum null_placement {
+    NULLS_LAST = 0,
+    NULLS_FIRST,
+  };
+
+  explicit SortKey(int column, enum order order = ASCENDING,
+                   enum null_placement null_placement = NULLS_LAST)
+      : column(column), order(order), null_placement(null_placement) {}
+
+  /// Index of the column to sort by.
+  int column;
+  enum order order;
+  enum null_placement null_placement;
+};
+
+/// \brief Returns the indices that would sort a table by several columns.
+///
+/// The sort is stable: rows comparing equal on all keys keep their original
+/// relative order. Columns may be chunked arbitrarily.
+///
+/// Every key column is first converted to an order-preserving unsigned 64-bit
+/// "normalized key" (integer, floating point, boolean and temporal columns
+/// directly, other columns through their dense rank), then the rows are
+/// sorted with a least-significant-key-first radix sort. Floating point NaNs
+/// compare equal to each other and greater than every other value, so they
+/// sort after +inf (before it in descending order).
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] table table to sort
+/// \param[in] keys sort keys, most significant first
+/// \param[out] offsets indices that would sort the table
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const Table& table,
+                     const std::vector<SortKey>& keys, std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices that would sort a record batch by several columns.
+///
+/// \see SortToIndices(FunctionContext*, const Table&, const std::vector<SortKey>&,
+///                    std::shared_ptr<Array>*)
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch record batch to sort
+/// \param[in] keys sort keys, most significant first
+/// \param[out] offsets indices that would sort the record batch
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const RecordBatch& batch,
+                     const std::vector<SortKey>& keys, std::shared_ptr<Array>* offsets);
+
 }  // namespace compute
 }  // namespace arrow
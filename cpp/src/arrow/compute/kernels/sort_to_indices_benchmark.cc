@@ -21,6 +21,7 @@
 
 #include "arrow/compute/benchmark_util.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 
@@ -55,5 +56,34 @@ BENCHMARK(SortToIndicesInt64)
     ->Args({1 << 23, 1})
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
+
+static void SortToIndicesTwoKeys(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t num_rows = args.size / (sizeof(int32_t) + sizeof(int64_t));
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  // (date, id) as in a typical partition sort
+  auto batch = RecordBatch::Make(schema({field("date", int32()), field("id", int64())}),
+                                 num_rows,
+                                 {rand.Int32(num_rows, 17000, 17365, args.null_proportion),
+                                  rand.Int64(num_rows, 0, 1LL << 40, 0)});
+  const std::vector<SortKey> keys = {SortKey(0), SortKey(1, SortKey::DESCENDING)};
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(SortToIndices(&ctx, *batch, keys, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+BENCHMARK(SortToIndicesTwoKeys)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
 }  // namespace compute
 }  // namespace arrow
@@ -23,13 +23,19 @@
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/sort_to_indices.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace compute {
 
 template <typename ArrowType>
@@ -191,5 +197,122 @@ TYPED_TEST(TestSortToIndicesKernelRandom, SortRandomValues) {
   }
 }
 
+class TestSortToIndicesTable : public ComputeFixture, public TestBase {
+ protected:
+  void AssertSortToIndices(const std::shared_ptr<Table>& table,
+                           const std::vector<SortKey>& keys,
+                           const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(arrow::compute::SortToIndices(&this->ctx_, *table, keys, &actual));
+    ASSERT_OK(actual->Validate());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+};
+
+TEST_F(TestSortToIndicesTable, SingleKey) {
+  auto s = schema({field("a", int32())});
+  auto table = TableFromJSON(s, {"[[3], [null], [-1]]", "[[2], [3], [null]]"});
+  AssertSortToIndices(table, {SortKey(0)}, "[2, 3, 0, 4, 1, 5]");
+  AssertSortToIndices(table, {SortKey(0, SortKey::DESCENDING)}, "[0, 4, 3, 2, 1, 5]");
+  AssertSortToIndices(table, {SortKey(0, SortKey::ASCENDING, SortKey::NULLS_FIRST)},
+                      "[1, 5, 2, 3, 0, 4]");
+}
+
+TEST_F(TestSortToIndicesTable, MultipleKeys) {
+  auto s = schema({field("date", date32()), field("id", utf8()), field("x", float64())});
+  auto table = TableFromJSON(s, {R"([[2, "b", 1.5],
+                                     [1, "c", -0.0],
+                                     [2, "a", null]])",
+                                 R"([[1, "c", 0.0],
+                                     [2, null, 2.5],
+                                     [1, "a", -3]])"});
+  AssertSortToIndices(table, {SortKey(0), SortKey(1)}, "[5, 1, 3, 2, 0, 4]");
+  AssertSortToIndices(table, {SortKey(0, SortKey::DESCENDING), SortKey(1)},
+                      "[2, 0, 4, 5, 1, 3]");
+  AssertSortToIndices(
+      table, {SortKey(1, SortKey::DESCENDING, SortKey::NULLS_FIRST), SortKey(2)},
+      "[4, 1, 3, 0, 5, 2]");
+}
+
+TEST_F(TestSortToIndicesTable, NaN) {
+  const double inf = std::numeric_limits<double>::infinity();
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  std::shared_ptr<Array> x, y;
+  ArrayFromVector<DoubleType, double>(
+      {true, true, true, true, true, false, true, true},
+      {-nan, 1.0, inf, nan, -inf, 0.0, -nan, -0.0}, &x);
+  ArrayFromVector<FloatType, float>(
+      {true, true, true, true, true, true, true, true},
+      {static_cast<float>(nan), 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, static_cast<float>(-nan),
+       0.0f},
+      &y);
+  auto table = Table::Make(schema({field("x", float64()), field("y", float32())}),
+                           {x, y});
+
+  // All NaNs are equal, whatever their sign, and sort after +inf
+  AssertSortToIndices(table, {SortKey(0)}, "[4, 7, 1, 2, 0, 3, 6, 5]");
+  AssertSortToIndices(table, {SortKey(0, SortKey::DESCENDING)},
+                      "[0, 3, 6, 2, 1, 7, 4, 5]");
+  AssertSortToIndices(table, {SortKey(0), SortKey(1, SortKey::DESCENDING)},
+                      "[4, 7, 1, 2, 0, 6, 3, 5]");
+}
+
+TEST_F(TestSortToIndicesTable, Errors) {
+  auto table = TableFromJSON(schema({field("a", int32())}), {"[[1]]"});
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, arrow::compute::SortToIndices(&this->ctx_, *table, {}, &out));
+  ASSERT_RAISES(IndexError,
+                arrow::compute::SortToIndices(&this->ctx_, *table, {SortKey(1)}, &out));
+}
+
+TEST_F(TestSortToIndicesTable, Random) {
+  auto rand = random::RandomArrayGenerator(0x5487656);
+  const int64_t length = 10000;
+  auto batch = RecordBatch::Make(schema({field("a", int16()), field("b", float64()),
+                                         field("c", utf8())}),
+                                 length,
+                                 {rand.Int16(length, -5, 5, 0.1),
+                                  rand.Float64(length, -1, 1, 0.1),
+                                  rand.String(length, 1, 3, 0.1)});
+  const std::vector<SortKey> keys = {
+      SortKey(2, SortKey::ASCENDING, SortKey::NULLS_FIRST),
+      SortKey(0, SortKey::DESCENDING), SortKey(1)};
+
+  std::shared_ptr<Array> offsets;
+  ASSERT_OK(arrow::compute::SortToIndices(&this->ctx_, *batch, keys, &offsets));
+  const auto& indices = checked_cast<const UInt64Array&>(*offsets);
+  ASSERT_EQ(length, indices.length());
+
+  const auto& a = checked_cast<const Int16Array&>(*batch->column(0));
+  const auto& b = checked_cast<const DoubleArray&>(*batch->column(1));
+  const auto& c = checked_cast<const StringArray&>(*batch->column(2));
+  // Returns -1, 0 or 1 comparing rows lhs and rhs on all keys
+  auto compare = [&](int64_t lhs, int64_t rhs) {
+    if (c.IsNull(lhs) != c.IsNull(rhs)) return c.IsNull(lhs) ? -1 : 1;
+    if (!c.IsNull(lhs) && c.GetView(lhs) != c.GetView(rhs)) {
+      return c.GetView(lhs) < c.GetView(rhs) ? -1 : 1;
+    }
+    if (a.IsNull(lhs) != a.IsNull(rhs)) return a.IsNull(lhs) ? 1 : -1;
+    if (!a.IsNull(lhs) && a.Value(lhs) != a.Value(rhs)) {
+      return a.Value(lhs) > a.Value(rhs) ? -1 : 1;
+    }
+    if (b.IsNull(lhs) != b.IsNull(rhs)) return b.IsNull(lhs) ? 1 : -1;
+    if (!b.IsNull(lhs) && b.Value(lhs) != b.Value(rhs)) {
+      return b.Value(lhs) < b.Value(rhs) ? -1 : 1;
+    }
+    return 0;
+  };
+  for (int64_t i = 1; i < length; i++) {
+    const auto lhs = static_cast<int64_t>(indices.Value(i - 1));
+    const auto rhs = static_cast<int64_t>(indices.Value(i));
+    const int cmp = compare(lhs, rhs);
+    ASSERT_LE(cmp, 0);
+    if (cmp == 0) {
+      // Stability
+      ASSERT_LT(lhs, rhs);
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -59,10 +59,9 @@ struct SumState {
   typename SumType::c_type sum = 0;
 };
 
-#define SUM_AGG_FN_CASE(T)                              \
-  case T::type_id:                                      \
-    return std::static_pointer_cast<AggregateFunction>( \
-        std::make_shared<SumAggregateFunction<T, SumState<T>>>());
+#define SUM_AGG_FN_CASE(T) \
+  case T::type_id:         \
+    return MakeSumAggregateFunctionForType<T, SumState<T>>();
 
 std::shared_ptr<AggregateFunction> MakeSumAggregateFunction(const DataType& type,
                                                             FunctionContext* ctx) {
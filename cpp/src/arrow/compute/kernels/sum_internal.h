@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <memory>
 #include <type_traits>
 
@@ -26,7 +27,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
-#include "arrow/util/logging.h"
+#include "arrow/util/dispatch.h"
 
 namespace arrow {
 
@@ -54,10 +55,137 @@ struct FindAccumulatorType<I, enable_if_floating_point<I>> {
   using Type = DoubleType;
 };
 
-template <typename ArrowType, typename StateType>
+// The loops of the sum kernels. Those for levels above NONE are only
+// instantiated in a source file compiled for that level (see
+// arrow/util/dispatch.h), so they must be self-contained.
+template <internal::DispatchLevel Level, typename CType, typename SumCType>
+struct SumLoops {
+  // Sum of values[0, length)
+  static SumCType SumDense(const CType* values, int64_t length);
+
+  // Sum and count of the valid values[0, length), where the validity bitmap
+  // starts at bit offset of bitmap. Requires a length over 2 * CHAR_BIT.
+  static SumCType SumSparse(const CType* values, const uint8_t* bitmap, int64_t offset,
+                            int64_t length, int64_t* count);
+
+ private:
+  // While this is not branchless, gcc needs this to be in a different function
+  // for it to generate cmov which ends to be slightly faster than
+  // multiplication but safe for handling NaN with doubles.
+  static CType MaskedValue(bool valid, CType value) { return valid ? value : 0; }
+
+  static void UnrolledSum(uint8_t bits, const CType* values, SumCType* sum,
+                          int64_t* count);
+};
+
+template <internal::DispatchLevel Level, typename CType, typename SumCType>
+SumCType SumLoops<Level, CType, SumCType>::SumDense(const CType* values,
+                                                    int64_t length) {
+  SumCType sum = 0;
+  for (int64_t i = 0; i < length; i++) {
+    sum += values[i];
+  }
+  return sum;
+}
+
+template <internal::DispatchLevel Level, typename CType, typename SumCType>
+void SumLoops<Level, CType, SumCType>::UnrolledSum(uint8_t bits, const CType* values,
+                                                   SumCType* sum, int64_t* count) {
+  if (bits < 0xFF) {
+    // Some nulls
+    for (size_t i = 0; i < 8; i++) {
+      *sum += MaskedValue(bits & (1U << i), values[i]);
+    }
+    *count += BitUtil::kBytePopcount[bits];
+  } else {
+    // No nulls
+    for (size_t i = 0; i < 8; i++) {
+      *sum += values[i];
+    }
+    *count += 8;
+  }
+}
+
+template <internal::DispatchLevel Level, typename CType, typename SumCType>
+SumCType SumLoops<Level, CType, SumCType>::SumSparse(const CType* values,
+                                                     const uint8_t* bitmap,
+                                                     int64_t offset, int64_t length,
+                                                     int64_t* count) {
+  SumCType sum = 0;
+  *count = 0;
+
+  // Sliced bitmaps on non-byte positions induce problem with the branchless
+  // unrolled technique. Thus extra padding is added on both left and right
+  // side of the slice such that both ends are byte-aligned. The first and
+  // last bitmap are properly masked to ignore extra values induced by
+  // padding.
+  //
+  // The execution is divided in 3 sections.
+  //
+  // 1. Compute the sum of the first masked byte.
+  // 2. Compute the sum of the middle bytes
+  // 3. Compute the sum of the last masked byte.
+
+  // The number of bytes covering the range, this includes partial bytes.
+  // This number bounded by `<= (length / 8) + 2`, e.g. a possible extra byte
+  // on the left, and on the right. The arithmetic is spelled out rather than
+  // calling the inline BitUtil helpers, as this function is also compiled with
+  // AVX2 enabled and must not emit out-of-line copies of shared inline
+  // functions. For the same reason the bound is checked with assert rather
+  // than DCHECK, which instantiates the logging helpers.
+  const int64_t covering_bytes = (offset + length + 7) / 8 - offset / 8;
+  assert(covering_bytes >= 3);
+
+  // Align values to the first batch of 8 elements. Note that values is
+  // already adjusted with the offset, thus we rewind a little to align to
+  // the closest 8-batch offset.
+  values -= offset % 8;
+
+  // Align bitmap at the first consumable byte.
+  bitmap += offset / 8;
+
+  // Consume the first (potentially partial) byte.
+  const uint8_t first_mask = BitUtil::kTrailingBitmask[offset % 8];
+  UnrolledSum(bitmap[0] & first_mask, values, &sum, count);
+
+  // Consume the (full) middle bytes. The loop iterates in unit of
+  // batches of 8 values and 1 byte of bitmap.
+  for (int64_t i = 1; i < covering_bytes - 1; i++) {
+    UnrolledSum(bitmap[i], &values[i * 8], &sum, count);
+  }
+
+  // Consume the last (potentially partial) byte.
+  const int64_t last_idx = covering_bytes - 1;
+  const uint8_t last_mask = BitUtil::kPrecedingWrappingBitmask[(offset + length) % 8];
+  UnrolledSum(bitmap[last_idx] & last_mask, &values[last_idx * 8], &sum, count);
+
+  return sum;
+}
+
+#define ARROW_SUM_LOOPS_INSTANTIATION(DECL, LEVEL)  \
+  DECL struct SumLoops<LEVEL, uint8_t, uint64_t>;   \
+  DECL struct SumLoops<LEVEL, int8_t, int64_t>;     \
+  DECL struct SumLoops<LEVEL, uint16_t, uint64_t>;  \
+  DECL struct SumLoops<LEVEL, int16_t, int64_t>;    \
+  DECL struct SumLoops<LEVEL, uint32_t, uint64_t>;  \
+  DECL struct SumLoops<LEVEL, int32_t, int64_t>;    \
+  DECL struct SumLoops<LEVEL, uint64_t, uint64_t>;  \
+  DECL struct SumLoops<LEVEL, int64_t, int64_t>;    \
+  DECL struct SumLoops<LEVEL, float, double>;       \
+  DECL struct SumLoops<LEVEL, double, double>;
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+// Instantiated in aggregate_avx2.cc
+ARROW_SUM_LOOPS_INSTANTIATION(extern template, internal::DispatchLevel::AVX2)
+#endif
+
+template <typename ArrowType, typename StateType,
+          internal::DispatchLevel Level = internal::DispatchLevel::NONE>
 class SumAggregateFunction final : public AggregateFunctionStaticState<StateType> {
   using CType = typename TypeTraits<ArrowType>::CType;
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using SumCType = typename FindAccumulatorType<ArrowType>::Type::c_type;
+  using Loops = SumLoops<Level, CType, SumCType>;
 
   // A small number of elements rounded to the next cacheline. This should
   // amount to a maximum of 4 cachelines when dealing with 8 bytes elements.
@@ -98,15 +226,8 @@ class SumAggregateFunction final : public AggregateFunctionStaticState<StateType
  private:
   StateType ConsumeDense(const ArrayType& array) const {
     StateType local;
-
-    const auto values = array.raw_values();
-    const int64_t length = array.length();
-    for (int64_t i = 0; i < length; i++) {
-      local.sum += values[i];
-    }
-
-    local.count = length;
-
+    local.sum = Loops::SumDense(array.raw_values(), array.length());
+    local.count = array.length();
     return local;
   }
 
@@ -127,81 +248,28 @@ class SumAggregateFunction final : public AggregateFunctionStaticState<StateType
     return local;
   }
 
-  // While this is not branchless, gcc needs this to be in a different function
-  // for it to generate cmov which ends to be slightly faster than
-  // multiplication but safe for handling NaN with doubles.
-  inline CType MaskedValue(bool valid, CType value) const { return valid ? value : 0; }
-
-  inline StateType UnrolledSum(uint8_t bits, const CType* values) const {
+  StateType ConsumeSparse(const ArrayType& array) const {
     StateType local;
-
-    if (bits < 0xFF) {
-      // Some nulls
-      for (size_t i = 0; i < 8; i++) {
-        local.sum += MaskedValue(bits & (1U << i), values[i]);
-      }
-      local.count += BitUtil::kBytePopcount[bits];
-    } else {
-      // No nulls
-      for (size_t i = 0; i < 8; i++) {
-        local.sum += values[i];
-      }
-      local.count += 8;
-    }
-
+    int64_t count;
+    local.sum = Loops::SumSparse(array.raw_values(), array.null_bitmap_data(),
+                                 array.offset(), array.length(), &count);
+    local.count = count;
     return local;
   }
+};
 
-  StateType ConsumeSparse(const ArrayType& array) const {
-    StateType local;
-
-    // Sliced bitmaps on non-byte positions induce problem with the branchless
-    // unrolled technique. Thus extra padding is added on both left and right
-    // side of the slice such that both ends are byte-aligned. The first and
-    // last bitmap are properly masked to ignore extra values induced by
-    // padding.
-    //
-    // The execution is divided in 3 sections.
-    //
-    // 1. Compute the sum of the first masked byte.
-    // 2. Compute the sum of the middle bytes
-    // 3. Compute the sum of the last masked byte.
-
-    const int64_t length = array.length();
-    const int64_t offset = array.offset();
-
-    // The number of bytes covering the range, this includes partial bytes.
-    // This number bounded by `<= (length / 8) + 2`, e.g. a possible extra byte
-    // on the left, and on the right.
-    const int64_t covering_bytes = BitUtil::CoveringBytes(offset, length);
-    DCHECK_GE(covering_bytes, 3);
-
-    // Align values to the first batch of 8 elements. Note that raw_values() is
-    // already adjusted with the offset, thus we rewind a little to align to
-    // the closest 8-batch offset.
-    const auto values = array.raw_values() - (offset % 8);
-
-    // Align bitmap at the first consumable byte.
-    const auto bitmap = array.null_bitmap_data() + BitUtil::RoundDown(offset, 8) / 8;
-
-    // Consume the first (potentially partial) byte.
-    const uint8_t first_mask = BitUtil::kTrailingBitmask[offset % 8];
-    local += UnrolledSum(bitmap[0] & first_mask, values);
-
-    // Consume the (full) middle bytes. The loop iterates in unit of
-    // batches of 8 values and 1 byte of bitmap.
-    for (int64_t i = 1; i < covering_bytes - 1; i++) {
-      local += UnrolledSum(bitmap[i], &values[i * 8]);
-    }
-
-    // Consume the last (potentially partial) byte.
-    const int64_t last_idx = covering_bytes - 1;
-    const uint8_t last_mask = BitUtil::kPrecedingWrappingBitmask[(offset + length) % 8];
-    local += UnrolledSum(bitmap[last_idx] & last_mask, &values[last_idx * 8]);
-
-    return local;
+// Make a SumAggregateFunction with the loops for the highest level the CPU
+// supports
+template <typename ArrowType, typename StateType>
+std::shared_ptr<AggregateFunction> MakeSumAggregateFunctionForType() {
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (internal::IsDispatchLevelSupported(internal::DispatchLevel::AVX2)) {
+    return std::make_shared<
+        SumAggregateFunction<ArrowType, StateType, internal::DispatchLevel::AVX2>>();
   }
-};  // namespace compute
+#endif
+  return std::make_shared<SumAggregateFunction<ArrowType, StateType>>();
+}
 
 }  // namespace compute
 }  // namespace arrow
@@ -17,10 +17,12 @@
 
 #include "arrow/csv/chunker.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <utility>
 
+#include "arrow/csv/lexing_internal.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/stl.h"
@@ -183,6 +185,60 @@ class Lexer {
   State state_ = FIELD_START;
 };
 
+// A lexer finding the end of fields a block at a time, falling back on Lexer
+// for unusual lines.  It must be used on consecutive lines of a single block.
+template <bool quoting, bool escaping>
+class ScanningLexer {
+ public:
+  ScanningLexer(const ParseOptions& options, const char* data, const char* data_end)
+      : options_(options), scanner_(options, data_end), data_end_(data_end) {
+    scanner_.Reset(data);
+  }
+
+  const char* ReadLine(const char* data, const char* data_end) {
+    const char* const line_start = data;
+    DCHECK_EQ(data_end, data_end_);
+    DCHECK_GT(data_end - data, 0);
+
+    while (true) {
+      int64_t num_specials;
+      const char* field_end = scanner_.NextFieldEnd(&num_specials);
+      DCHECK_GE(field_end, data);
+      if (ARROW_PREDICT_FALSE(field_end == data_end)) {
+        break;
+      }
+      if (ARROW_PREDICT_FALSE(num_specials != 0) &&
+          !detail::IsPlainQuoted<quoting>(options_, data, field_end, num_specials) &&
+          !detail::UnquoteField<quoting, escaping>(options_, data, field_end,
+                                                     [](char) {})) {
+        break;
+      }
+      data = field_end + 1;
+      if (*field_end != options_.delimiter) {
+        if (*field_end == '\r' && data != data_end && *data == '\n') {
+          data++;
+        }
+        return data;
+      }
+      if (ARROW_PREDICT_FALSE(data == data_end)) {
+        break;
+      }
+    }
+    // Truncated or unusual line
+    Lexer<quoting, escaping> lexer(options_);
+    const char* line_end = lexer.ReadLine(line_start, data_end);
+    if (line_end != nullptr) {
+      scanner_.Reset(line_end);
+    }
+    return line_end;
+  }
+
+ protected:
+  const ParseOptions& options_;
+  detail::StructuralScanner<quoting, escaping> scanner_;
+  const char* const data_end_;
+};
+
 // A BoundaryFinder implementation that assumes CSV cells can contain raw newlines,
 // and uses actual CSV lexing to delimit them.
 template <bool quoting, bool escaping>
@@ -210,13 +266,37 @@ class LexingBoundaryFinder : public BoundaryFinder {
   }
 
   Status FindLast(util::string_view block, int64_t* out_pos) override {
+    const char* data = block.data();
+    const char* const data_end = block.data() + block.size();
     Lexer<quoting, escaping> lexer(options_);
 
-    const char* data = block.data();
+    if (detail::CanScanStructurals(options_) && data < data_end) {
+      // Scan the rest of the block if the first line has long enough fields
+      const char* line_end = lexer.ReadLine(data, data_end);
+      if (line_end == nullptr) {
+        // No complete CSV line
+        *out_pos = -1;
+        return Status::OK();
+      }
+      const auto num_fields = 1 + std::count(data, line_end, options_.delimiter);
+      if (detail::IsWorthScanning(line_end - data, num_fields)) {
+        ScanningLexer<quoting, escaping> scanning_lexer(options_, line_end, data_end);
+        return FindLastLine(&scanning_lexer, block, line_end, out_pos);
+      }
+      return FindLastLine(&lexer, block, line_end, out_pos);
+    }
+    return FindLastLine(&lexer, block, data, out_pos);
+  }
+
+ protected:
+  // Find the end of the last line in `block`, lexing from `data` on
+  template <typename LexerType>
+  Status FindLastLine(LexerType* lexer, util::string_view block, const char* data,
+                      int64_t* out_pos) {
     const char* const data_end = block.data() + block.size();
 
     while (data < data_end) {
-      const char* line_end = lexer.ReadLine(data, data_end);
+      const char* line_end = lexer->ReadLine(data, data_end);
       if (line_end == nullptr) {
         // Cannot read any further
         break;
@@ -234,7 +314,6 @@ class LexingBoundaryFinder : public BoundaryFinder {
     return Status::OK();
   }
 
- protected:
   ParseOptions options_;
 };
 
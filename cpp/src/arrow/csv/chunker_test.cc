@@ -19,6 +19,7 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -261,5 +262,29 @@ TEST_P(BaseChunkerTest, EscapingNewline) {
   }
 }
 
+TEST_P(BaseChunkerTest, LongFields) {
+  // Long enough fields are lexed a block at a time, check lines crossing
+  // block boundaries
+  std::vector<std::string> lines;
+  std::vector<size_t> lengths;
+  for (int32_t i = 0; i < 20; ++i) {
+    const auto n = std::to_string(i);
+    std::string line = "plain value " + n + std::string(static_cast<size_t>(i), 'x');
+    if (options_.newlines_in_values && i % 3 == 0) {
+      line += ",\"quoted, with\nnewline " + n + "\"";
+    } else {
+      line += ",\"doubled \"\"quotes\"\", " + n + "\"";
+    }
+    // Quotes in the middle of a field are regular characters
+    line += ",mid\"field " + n + ",other\"quote " + n;
+    line += (i % 2 == 0) ? "\r" : "\n";
+    lengths.push_back(line.size());
+    lines.push_back(std::move(line));
+  }
+  auto csv = MakeCSVData(lines);
+  MakeChunker();
+  AssertChunking(*chunker_, csv, lengths);
+}
+
 }  // namespace csv
 }  // namespace arrow
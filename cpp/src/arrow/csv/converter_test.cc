@@ -216,6 +216,10 @@ static void TestStringConversionErrors() {
   auto type = TypeTraits<T>::type_singleton();
   // Invalid UTF8 in column 0
   AssertConversionError(type, {"ab,cdé\n", "\xff,gh\n"}, {0});
+  // Valid UTF8 when concatenated, but not as separate values
+  AssertConversionError(type, {"\xc3,x\n", "\xa9,y\n"}, {0});
+  // Invalid UTF8 in a long value
+  AssertConversionError(type, {"ab,cd\n", std::string(100, 'x') + "\xe9,gh\n"}, {0});
 }
 
 TEST(StringConversion, Errors) { TestStringConversionErrors<StringType>(); }
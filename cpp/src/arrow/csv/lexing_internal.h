@@ -0,0 +1,353 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Block-at-a-time lexing of CSV data, shared by the parser and the chunker.
+//
+// Blocks of 64 bytes are classified into bitmasks of delimiters, line
+// separators, quotes and escapes.  Escaped characters are masked out, and
+// quoted regions are resolved with a prefix XOR of the quote mask, which
+// yields the field terminators (delimiters and line separators outside of
+// quotes) without looking at each character.
+//
+// This is exact for well-formed CSV, where quotes only open a field or
+// close it.  Callers check the fields containing quotes or escapes with
+// UnquoteField(), and lex the line with the scalar state machine when the
+// quote tracking got confused, e.g. by a quote in the middle of a field.
+// The state machine is also faster on very short fields, so callers only
+// use the scanner when a first line shows that IsWorthScanning().
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/csv/options.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/sse_util.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace arrow {
+namespace csv {
+namespace detail {
+
+/// \brief Whether the structural scanner supports the given options
+///
+/// The delimiter, quote and escape characters must be distinct from each
+/// other and from the line separators.
+inline bool CanScanStructurals(const ParseOptions& options) {
+  auto is_special = [](char c) { return c == '\r' || c == '\n'; };
+  if (is_special(options.delimiter)) {
+    return false;
+  }
+  if (options.quoting &&
+      (is_special(options.quote_char) || options.quote_char == options.delimiter)) {
+    return false;
+  }
+  if (options.escaping &&
+      (is_special(options.escape_char) || options.escape_char == options.delimiter ||
+       (options.quoting && options.escape_char == options.quote_char))) {
+    return false;
+  }
+  return true;
+}
+
+// The number of bytes lexed at a time
+constexpr int64_t kLexingBlockSize = 64;
+
+// The fewest bytes per field (separator included) for which the scanner is
+// faster than the scalar state machine, on average
+constexpr int64_t kMinScannedFieldSize = 6;
+
+/// \brief Whether the scanner is worth using on lines like the given one
+inline bool IsWorthScanning(int64_t line_size, int64_t num_fields) {
+  return line_size >= kMinScannedFieldSize * num_fields;
+}
+
+struct CharMasks {
+  uint64_t delimiters;
+  uint64_t crs;
+  uint64_t lfs;
+  uint64_t quotes;
+  uint64_t escapes;
+};
+
+// Classify a block of data into bitmasks of the characters of interest
+template <bool Quoting, bool Escaping>
+class BlockClassifier {
+ public:
+  explicit BlockClassifier(const ParseOptions& options)
+      : delimiter_(options.delimiter),
+        quote_char_(options.quote_char),
+        escape_char_(options.escape_char) {}
+
+  void Classify(const char* data, CharMasks* out) const {
+    *out = CharMasks{0, 0, 0, 0, 0};
+#if defined(ARROW_HAVE_SSE2)
+    const __m128i delimiter = _mm_set1_epi8(delimiter_);
+    const __m128i quote_char = _mm_set1_epi8(quote_char_);
+    const __m128i escape_char = _mm_set1_epi8(escape_char_);
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+    for (int i = 0; i < kLexingBlockSize; i += 16) {
+      const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+      auto match = [&](__m128i chars) {
+        return static_cast<uint64_t>(static_cast<uint16_t>(
+                   _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, chars))))
+               << i;
+      };
+      out->delimiters |= match(delimiter);
+      out->crs |= match(cr);
+      out->lfs |= match(lf);
+      if (Quoting) {
+        out->quotes |= match(quote_char);
+      }
+      if (Escaping) {
+        out->escapes |= match(escape_char);
+      }
+    }
+#else
+    for (int i = 0; i < kLexingBlockSize; ++i) {
+      const char c = data[i];
+      const uint64_t bit = uint64_t(1) << i;
+      out->delimiters |= (c == delimiter_) ? bit : 0;
+      out->crs |= (c == '\r') ? bit : 0;
+      out->lfs |= (c == '\n') ? bit : 0;
+      if (Quoting) {
+        out->quotes |= (c == quote_char_) ? bit : 0;
+      }
+      if (Escaping) {
+        out->escapes |= (c == escape_char_) ? bit : 0;
+      }
+    }
+#endif
+  }
+
+ protected:
+  const char delimiter_;
+  const char quote_char_;
+  const char escape_char_;
+};
+
+inline int PopCount(uint64_t bits) {
+#ifdef _MSC_VER
+  return static_cast<int>(__popcnt64(bits));
+#else
+  return __builtin_popcountll(bits);
+#endif
+}
+
+// Return the mask of the bits set in `bits` or at odd distance after them,
+// i.e. the characters between an opening and a closing quote (the opening
+// quote included).  This is a carry-less multiplication by all ones.
+inline uint64_t PrefixXor(uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+// Return the mask of the characters escaped by the given escape characters.
+// `carry` tells whether the first character is escaped by the end of the
+// previous block, and is updated for the next block.
+inline uint64_t EscapedMask(uint64_t escapes, bool* carry) {
+  uint64_t escaped = *carry ? 1 : 0;
+  *carry = false;
+  // An escaped escape character doesn't escape the next one
+  escapes &= ~escaped;
+  while (escapes != 0) {
+    const uint64_t escape = escapes & (~escapes + 1);
+    const uint64_t next = escape << 1;
+    if (next == 0) {
+      *carry = true;
+    }
+    escaped |= next;
+    escapes &= ~(escape | next);
+  }
+  return escaped;
+}
+
+/// \brief Find field terminators in CSV data a block at a time
+///
+/// The terminators are the delimiters and line separators that are neither
+/// escaped nor quoted, a CR LF pair counting as a single terminator.  The
+/// scanner is Reset() at the start of a line, and then returns the
+/// terminators in order.
+template <bool Quoting, bool Escaping>
+class StructuralScanner {
+ public:
+  StructuralScanner(const ParseOptions& options, const char* data_end)
+      : classifier_(options), data_end_(data_end) {}
+
+  /// Restart scanning at `pos`, which must be the start of a line
+  void Reset(const char* pos) {
+    in_quotes_ = 0;
+    escape_carry_ = false;
+    cr_carry_ = 0;
+    LoadBlock(pos);
+  }
+
+  /// \brief Return the next terminator, or the end of the data
+  ///
+  /// `num_specials` is set to the number of quote and escape characters
+  /// between the previous terminator and this one.
+  const char* NextFieldEnd(int64_t* num_specials) {
+    *num_specials = 0;
+    while (ARROW_PREDICT_FALSE(structurals_ == 0)) {
+      *num_specials += PopCount(specials_);
+      if (data_end_ - block_start_ <= kLexingBlockSize) {
+        specials_ = 0;
+        return data_end_;
+      }
+      LoadBlock(block_start_ + kLexingBlockSize);
+    }
+    const uint64_t terminator = structurals_ & (~structurals_ + 1);
+    const uint64_t before_terminator = terminator - 1;
+    *num_specials += PopCount(specials_ & before_terminator);
+    specials_ &= ~before_terminator;
+    structurals_ ^= terminator;
+    return block_start_ + BitUtil::CountTrailingZeros(terminator);
+  }
+
+ protected:
+  void LoadBlock(const char* block_start) {
+    block_start_ = block_start;
+    const int64_t size = std::min(data_end_ - block_start, kLexingBlockSize);
+    CharMasks masks;
+    if (ARROW_PREDICT_TRUE(size == kLexingBlockSize)) {
+      classifier_.Classify(block_start, &masks);
+    } else {
+      // Zero-pad the last block, and ignore the padding
+      char padded[kLexingBlockSize] = {};
+      if (size > 0) {
+        std::memcpy(padded, block_start, static_cast<size_t>(size));
+      }
+      classifier_.Classify(padded, &masks);
+      const uint64_t valid = size > 0 ? ~uint64_t(0) >> (kLexingBlockSize - size) : 0;
+      masks.delimiters &= valid;
+      masks.crs &= valid;
+      masks.lfs &= valid;
+      masks.quotes &= valid;
+      masks.escapes &= valid;
+    }
+
+    const uint64_t escaped = Escaping ? EscapedMask(masks.escapes, &escape_carry_) : 0;
+    uint64_t in_quotes = 0;
+    if (Quoting) {
+      in_quotes = PrefixXor(masks.quotes & ~escaped) ^ in_quotes_;
+      // All ones if the block ends inside quotes
+      in_quotes_ = static_cast<uint64_t>(static_cast<int64_t>(in_quotes) >> 63);
+    }
+    const uint64_t unquoted = ~(escaped | in_quotes);
+    const uint64_t crs = masks.crs & unquoted;
+    // The LF of a CR LF pair doesn't terminate another field
+    const uint64_t lfs = masks.lfs & unquoted & ~((crs << 1) | cr_carry_);
+    cr_carry_ = crs >> 63;
+    structurals_ = (masks.delimiters & unquoted) | crs | lfs;
+    specials_ = masks.quotes | masks.escapes;
+  }
+
+  const BlockClassifier<Quoting, Escaping> classifier_;
+  const char* const data_end_;
+
+  const char* block_start_;
+  uint64_t structurals_;
+  uint64_t specials_;
+  uint64_t in_quotes_;
+  bool escape_carry_;
+  uint64_t cr_carry_;
+};
+
+/// \brief Whether a field found by the scanner is quoted, without any other
+/// quote or escape character
+///
+/// The value of such a field is the characters between the quotes.
+template <bool Quoting>
+bool IsPlainQuoted(const ParseOptions& options, const char* start, const char* end,
+                   int64_t num_specials) {
+  return Quoting && num_specials == 2 && end - start >= 2 &&
+         *start == options.quote_char && *(end - 1) == options.quote_char;
+}
+
+/// \brief Unquote and unescape a field found by the scanner
+///
+/// The field [start, end) contains quote or escape characters, which are
+/// processed as the scalar state machine does, calling `push` with each
+/// character of the value.  Returns false if the state machine wouldn't end
+/// the field at `end`, or if the field has unusual quoting (such as
+/// characters after the closing quote): the caller must then lex the line
+/// with the state machine instead.
+template <bool Quoting, bool Escaping, typename PushChar>
+bool UnquoteField(const ParseOptions& options, const char* start, const char* end,
+                  PushChar&& push) {
+  const char* data = start;
+  if (Quoting && *data == options.quote_char) {
+    // The field must end with the closing quote
+    const char* const closing_quote = end - 1;
+    if (closing_quote == start || *closing_quote != options.quote_char) {
+      return false;
+    }
+    ++data;
+    while (data < closing_quote) {
+      const char c = *data++;
+      if (Escaping && c == options.escape_char) {
+        if (data == closing_quote) {
+          return false;
+        }
+        push(*data++);
+      } else if (c == options.quote_char) {
+        if (!options.double_quote || data == closing_quote ||
+            *data != options.quote_char) {
+          return false;
+        }
+        push(*data++);
+      } else {
+        push(c);
+      }
+    }
+    return true;
+  }
+
+  while (data < end) {
+    const char c = *data++;
+    if (Escaping && c == options.escape_char) {
+      if (data == end) {
+        return false;
+      }
+      push(*data++);
+      continue;
+    }
+    // Quotes in the middle of a field are regular characters, but may have
+    // hidden a terminator from the scanner
+    if (Quoting && (c == options.delimiter || c == '\r' || c == '\n')) {
+      return false;
+    }
+    push(c);
+  }
+  return true;
+}
+
+}  // namespace detail
+}  // namespace csv
+}  // namespace arrow
@@ -19,9 +19,11 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <limits>
 #include <utility>
 
+#include "arrow/csv/lexing_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
@@ -96,12 +98,29 @@ class BlockParser::PresizedParsedWriter {
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  // Push the `size` chars at `data`, followed by at least `available - size`
+  // more readable chars.  The parsed data never gets ahead of the input data,
+  // so when 16 chars are readable there is room for them, and short fields
+  // are copied as a single 16-byte block.
+  void PushFieldChars(const char* data, uint32_t size, int64_t available) {
+    DCHECK_LE(parsed_size_ + size, parsed_capacity_);
+    if (size <= kShortCopySize && available >= kShortCopySize) {
+      DCHECK_LE(parsed_size_ + kShortCopySize, parsed_capacity_);
+      std::memcpy(parsed_ + parsed_size_, data, kShortCopySize);
+    } else {
+      std::memcpy(parsed_ + parsed_size_, data, size);
+    }
+    parsed_size_ += size;
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
   int64_t size() { return parsed_size_; }
 
  protected:
+  static constexpr int64_t kShortCopySize = 16;
+
   std::shared_ptr<ResizableBuffer> parsed_buffer_;
   uint8_t* parsed_;
   int64_t parsed_size_;
@@ -376,6 +395,92 @@ EmptyLine:
   return Status::OK();
 }
 
+template <typename SpecializedOptions, typename Scanner, typename ValuesWriter,
+          typename ParsedWriter>
+Status BlockParser::ParseLineScanned(Scanner* scanner, ValuesWriter* values_writer,
+                                     ParsedWriter* parsed_writer, const char* data,
+                                     const char* data_end, bool is_final,
+                                     const char** out_data) {
+  const char* const line_start = data;
+  int32_t num_cols = 0;
+  const char* field_end;
+  int64_t num_specials;
+
+  DCHECK_GT(data_end, data);
+
+  values_writer->BeginLine();
+  parsed_writer->BeginLine();
+
+  if (ARROW_PREDICT_FALSE(*data == '\r' || *data == '\n')) {
+    // Empty line
+    goto Fallback;
+  }
+
+  while (true) {
+    field_end = scanner->NextFieldEnd(&num_specials);
+    DCHECK_GE(field_end, data);
+    if (ARROW_PREDICT_FALSE(field_end == data_end)) {
+      // Truncated line, or last line without a line separator
+      goto Fallback;
+    }
+    if (ARROW_PREDICT_TRUE(num_specials == 0)) {
+      values_writer->StartField(false /* quoted */);
+      parsed_writer->PushFieldChars(data, static_cast<uint32_t>(field_end - data),
+                                    data_end - data);
+    } else if (detail::IsPlainQuoted<SpecializedOptions::quoting>(options_, data,
+                                                                   field_end,
+                                                                   num_specials)) {
+      values_writer->StartField(true /* quoted */);
+      parsed_writer->PushFieldChars(data + 1, static_cast<uint32_t>(field_end - data - 2),
+                                    data_end - data - 1);
+    } else {
+      values_writer->StartField(SpecializedOptions::quoting &&
+                                *data == options_.quote_char);
+      auto push = [parsed_writer](char c) { parsed_writer->PushFieldChar(c); };
+      if (!detail::UnquoteField<SpecializedOptions::quoting,
+                                SpecializedOptions::escaping>(options_, data, field_end,
+                                                              push)) {
+        goto Fallback;
+      }
+    }
+    values_writer->FinishField(parsed_writer);
+    ++num_cols;
+
+    data = field_end + 1;
+    if (*field_end != options_.delimiter) {
+      // At the end of line
+      if (*field_end == '\r' && data < data_end && *data == '\n') {
+        ++data;
+      }
+      break;
+    }
+    if (ARROW_PREDICT_FALSE(data == data_end)) {
+      // Truncated line, or last line ending with an empty field
+      goto Fallback;
+    }
+  }
+
+  if (ARROW_PREDICT_FALSE(num_cols != num_cols_)) {
+    if (num_cols_ == -1) {
+      num_cols_ = num_cols;
+    } else {
+      return MismatchingColumns(num_cols_, num_cols);
+    }
+  }
+  ++num_rows_;
+  *out_data = data;
+  return Status::OK();
+
+Fallback:
+  // Leave the unusual cases to the state machine, and restart scanning after them
+  values_writer->RollbackLine();
+  parsed_writer->RollbackLine();
+  RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, line_start,
+                                              data_end, is_final, out_data));
+  scanner->Reset(*out_data);
+  return Status::OK();
+}
+
 template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
 Status BlockParser::ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
                                const char* data, const char* data_end, bool is_final,
@@ -383,10 +488,29 @@ Status BlockParser::ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed
                                bool* finished_parsing) {
   int32_t num_rows_deadline = num_rows_ + rows_in_chunk;
 
+  // Find the field terminators a block at a time, unless the options are unusual
+  // or the first line shows fields too short for it to pay off
+  bool may_use_scanner = detail::CanScanStructurals(options_);
+  bool use_scanner = false;
+  detail::StructuralScanner<SpecializedOptions::quoting, SpecializedOptions::escaping>
+      scanner(options_, data_end);
+
   while (data < data_end && num_rows_ < num_rows_deadline) {
     const char* line_end = data;
-    RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, data,
-                                                data_end, is_final, &line_end));
+    if (use_scanner) {
+      RETURN_NOT_OK(ParseLineScanned<SpecializedOptions>(
+          &scanner, values_writer, parsed_writer, data, data_end, is_final, &line_end));
+    } else {
+      RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, data,
+                                                  data_end, is_final, &line_end));
+      if (may_use_scanner && line_end != data && num_cols_ > 0) {
+        may_use_scanner = false;
+        use_scanner = detail::IsWorthScanning(line_end - data, num_cols_);
+        if (use_scanner) {
+          scanner.Reset(line_end);
+        }
+      }
+    }
     if (line_end == data) {
       // Cannot parse any further
       *finished_parsing = true;
@@ -149,6 +149,14 @@ class ARROW_EXPORT BlockParser {
                    const char* data, const char* data_end, bool is_final,
                    const char** out_data);
 
+  // Parse a single line from the data pointer, finding the end of fields with
+  // a block-at-a-time scanner
+  template <typename SpecializedOptions, typename Scanner, typename ValuesWriter,
+            typename ParsedWriter>
+  Status ParseLineScanned(Scanner* scanner, ValuesWriter* values_writer,
+                          ParsedWriter* parsed_writer, const char* data,
+                          const char* data_end, bool is_final, const char** out_data);
+
   MemoryPool* pool_;
   const ParseOptions options_;
   // The number of rows parsed from the block
@@ -34,8 +34,11 @@ namespace csv {
 // >> For a static/global string constant, use a C style string instead
 const char* one_row = "abc,\"d,f\",12.34,\n";
 const char* one_row_escaped = "abc,d\\,f,12.34,\n";
+const char* one_row_long =
+    "\"Alice Smith\",\"123 Main Street, Springfield\",1234567.25,some free text here\n";
 
 const auto num_rows = static_cast<int32_t>((1024 * 64) / strlen(one_row));
+const auto num_long_rows = static_cast<int32_t>((1024 * 64) / strlen(one_row_long));
 
 static std::string BuildCSVData(const std::string& row, int32_t repeat) {
   std::stringstream ss;
@@ -79,6 +82,17 @@ static void ChunkCSVEscapedBlock(benchmark::State& state) {  // NOLINT non-const
   BenchmarkCSVChunking(state, csv, options);
 }
 
+static void ChunkCSVLongFieldsBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = BuildCSVData(one_row_long, num_long_rows);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = false;
+  options.newlines_in_values = true;
+
+  BenchmarkCSVChunking(state, csv, options);
+}
+
 static void ChunkCSVNoNewlinesBlock(
     benchmark::State& state) {  // NOLINT non-const reference
   auto csv = BuildCSVData(one_row_escaped, num_rows);
@@ -139,11 +153,23 @@ static void ParseCSVEscapedBlock(benchmark::State& state) {  // NOLINT non-const
   BenchmarkCSVParsing(state, csv, num_rows, options);
 }
 
+static void ParseCSVLongFieldsBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = BuildCSVData(one_row_long, num_long_rows);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = false;
+
+  BenchmarkCSVParsing(state, csv, num_long_rows, options);
+}
+
 BENCHMARK(ChunkCSVQuotedBlock);
 BENCHMARK(ChunkCSVEscapedBlock);
+BENCHMARK(ChunkCSVLongFieldsBlock);
 BENCHMARK(ChunkCSVNoNewlinesBlock);
 BENCHMARK(ParseCSVQuotedBlock);
 BENCHMARK(ParseCSVEscapedBlock);
+BENCHMARK(ParseCSVLongFieldsBlock);
 
 }  // namespace csv
 }  // namespace arrow
@@ -623,5 +623,94 @@ TEST(BlockParser, QuotedEscape) {
   }
 }
 
+// Long enough fields are lexed a block at a time, with the unusual lines
+// handed to the state machine.  Generate lines crossing block boundaries.
+std::vector<std::string> MakeLongFieldLines(
+    int32_t num_lines, std::vector<std::vector<std::string>>* columns,
+    std::vector<std::vector<bool>>* quoted) {
+  std::vector<std::string> lines;
+  columns->assign(4, {});
+  quoted->assign(4, {});
+  auto add_field = [&](int32_t col, std::string value, bool is_quoted) {
+    (*columns)[col].push_back(std::move(value));
+    (*quoted)[col].push_back(is_quoted);
+  };
+  for (int32_t i = 0; i < num_lines; ++i) {
+    const auto n = std::to_string(i);
+    const auto padding = std::string(static_cast<size_t>(i % 23), 'x');
+    std::string line = "plain value " + n + padding + ",";
+    add_field(0, "plain value " + n + padding, false);
+    switch (i % 4) {
+      case 0:
+        line += "\"quoted, with\nnewline " + n + "\",";
+        add_field(1, "quoted, with\nnewline " + n, true);
+        break;
+      case 1:
+        line += "\"doubled \"\"quotes\"\" " + n + "\",";
+        add_field(1, "doubled \"quotes\" " + n, true);
+        break;
+      case 2:
+        // Quotes in the middle of a field are regular characters
+        line += "mid\"field " + n + ",";
+        add_field(1, "mid\"field " + n, false);
+        break;
+      default:
+        line += "\"quoted\" then more " + n + ",";
+        add_field(1, "quoted then more " + n, true);
+        break;
+    }
+    line += "other\"quote " + n + ",";
+    add_field(2, "other\"quote " + n, false);
+    line += "last field " + n + (i % 3 == 0 ? "\r\n" : "\n");
+    add_field(3, "last field " + n, false);
+    lines.push_back(std::move(line));
+  }
+  return lines;
+}
+
+TEST(BlockParser, LongFields) {
+  std::vector<std::vector<std::string>> columns;
+  std::vector<std::vector<bool>> quoted;
+  auto csv = MakeCSVData(MakeLongFieldLines(100, &columns, &quoted));
+  {
+    BlockParser parser(ParseOptions::Defaults());
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, columns, quoted);
+  }
+  {
+    // Truncated data
+    BlockParser parser(ParseOptions::Defaults());
+    const auto line_end = csv.rfind('\n', csv.size() - 2) + 1;
+    AssertParsePartial(parser, csv.substr(0, csv.size() - 5),
+                       static_cast<uint32_t>(line_end));
+    for (auto& column : columns) {
+      column.pop_back();
+    }
+    for (auto& column : quoted) {
+      column.pop_back();
+    }
+    AssertColumnsEq(parser, columns, quoted);
+  }
+}
+
+TEST(BlockParser, LongFieldsEscaping) {
+  auto options = ParseOptions::Defaults();
+  options.escaping = true;
+
+  std::vector<std::string> lines;
+  std::vector<std::vector<std::string>> columns(3);
+  for (int32_t i = 0; i < 100; ++i) {
+    const auto n = std::to_string(i);
+    lines.push_back("escaped\\,delimiter " + n + ",\"escaped \\\"quote\\\\ " + n +
+                    "\",trailing escape\\\n" + n + "\n");
+    columns[0].push_back("escaped,delimiter " + n);
+    columns[1].push_back("escaped \"quote\\ " + n);
+    columns[2].push_back("trailing escape\n" + n);
+  }
+  BlockParser parser(options);
+  AssertParseOk(parser, MakeCSVData(lines));
+  AssertColumnsEq(parser, columns);
+}
+
 }  // namespace csv
 }  // namespace arrow
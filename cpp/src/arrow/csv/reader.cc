@@ -19,6 +19,8 @@
 
 #include <cstdint>
 #include <cstring>
+#include <deque>
+#include <future>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -27,15 +29,20 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/csv/chunker.h"
 #include "arrow/csv/column_builder.h"
+#include "arrow/csv/converter.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -61,20 +68,29 @@ using internal::ThreadPool;
 /////////////////////////////////////////////////////////////////////////
 // Base class for common functionality
 
-class BaseTableReader : public csv::TableReader {
+class ReaderMixin {
  public:
-  BaseTableReader(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
-                  const ReadOptions& read_options, const ParseOptions& parse_options,
-                  const ConvertOptions& convert_options)
+  ReaderMixin(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+              const ReadOptions& read_options, const ParseOptions& parse_options,
+              const ConvertOptions& convert_options)
       : pool_(pool),
         read_options_(read_options),
         parse_options_(parse_options),
         convert_options_(convert_options),
         input_(std::move(input)) {}
 
-  virtual Status Init() = 0;
-
  protected:
+  // Information about a target column, i.e. a column of the resulting Table
+  // or RecordBatches
+  struct ConversionColumn {
+    std::string name;
+    // Index of the column in the CSV file, or -1 if the column is missing
+    // from the file (it is then filled with nulls)
+    int32_t index;
+    // Type of the column, or null if the type should be inferred
+    std::shared_ptr<DataType> type;
+  };
+
   Status ReadNextBlock(bool first_block, std::shared_ptr<Buffer>* out) {
     std::shared_ptr<Buffer> buf;
     RETURN_NOT_OK(block_iterator_.Next(&buf));
@@ -109,7 +125,7 @@ class BaseTableReader : public csv::TableReader {
 
   Status ReadFirstBlock(std::shared_ptr<Buffer>* out) { return ReadNextBlock(true, out); }
 
-  // Read header and column names from buffer, create column builders
+  // Read header and column names from buffer, compute conversion schema
   Status ProcessHeader(const std::shared_ptr<Buffer>& buf,
                        std::shared_ptr<Buffer>* rest) {
     const uint8_t* data = buf->data();
@@ -166,27 +182,22 @@ class BaseTableReader : public csv::TableReader {
     DCHECK_GT(num_csv_cols_, 0);
 
     if (convert_options_.include_columns.empty()) {
-      return MakeColumnBuilders();
+      return MakeConversionSchema();
     } else {
-      return MakeColumnBuilders(convert_options_.include_columns);
+      return MakeConversionSchema(convert_options_.include_columns);
     }
   }
 
-  // Make column builders, assuming inclusion of all columns in CSV file order
-  Status MakeColumnBuilders() {
+  // Make conversion schema, assuming inclusion of all columns in CSV file order
+  Status MakeConversionSchema() {
     for (int32_t col_index = 0; col_index < num_csv_cols_; ++col_index) {
-      std::shared_ptr<ColumnBuilder> builder;
-      const auto& col_name = column_names_[col_index];
-
-      RETURN_NOT_OK(MakeCSVColumnBuilder(col_name, col_index, &builder));
-      column_builders_.push_back(builder);
-      builder_names_.push_back(col_name);
+      AddConversionColumn(column_names_[col_index], col_index);
     }
     return Status::OK();
   }
 
-  // Make column builders, assuming inclusion of columns in `include_columns` order
-  Status MakeColumnBuilders(const std::vector<std::string>& include_columns) {
+  // Make conversion schema, assuming inclusion of columns in `include_columns` order
+  Status MakeConversionSchema(const std::vector<std::string>& include_columns) {
     // Compute indices of columns in the CSV file
     std::unordered_map<std::string, int32_t> col_indices;
     col_indices.reserve(column_names_.size());
@@ -194,54 +205,36 @@ class BaseTableReader : public csv::TableReader {
       col_indices.emplace(column_names_[i], i);
     }
 
-    // For each column name in include_columns, build the corresponding ColumnBuilder
+    // For each column name in include_columns, add the corresponding ConversionColumn
     for (const auto& col_name : include_columns) {
-      std::shared_ptr<ColumnBuilder> builder;
       auto it = col_indices.find(col_name);
       if (it != col_indices.end()) {
-        auto col_index = it->second;
-        RETURN_NOT_OK(MakeCSVColumnBuilder(col_name, col_index, &builder));
+        AddConversionColumn(col_name, it->second);
       } else {
         // Column not in the CSV file
         if (convert_options_.include_missing_columns) {
-          RETURN_NOT_OK(MakeNullColumnBuilder(col_name, &builder));
+          AddConversionColumn(col_name, -1);
         } else {
           return Status::KeyError("Column '", col_name,
                                   "' in include_columns "
                                   "does not exist in CSV file");
         }
       }
-      column_builders_.push_back(builder);
-      builder_names_.push_back(col_name);
     }
     return Status::OK();
   }
 
-  // Make a column builder for the given CSV column name and index
-  Status MakeCSVColumnBuilder(const std::string& col_name, int32_t col_index,
-                              std::shared_ptr<ColumnBuilder>* out) {
+  void AddConversionColumn(const std::string& col_name, int32_t col_index) {
     // Does the named column have a fixed type?
-    auto it = convert_options_.column_types.find(col_name);
-    if (it == convert_options_.column_types.end()) {
-      return ColumnBuilder::Make(pool_, col_index, convert_options_, task_group_, out);
-    } else {
-      return ColumnBuilder::Make(pool_, it->second, col_index, convert_options_,
-                                 task_group_, out);
-    }
-  }
-
-  // Make a column builder for a column of nulls
-  Status MakeNullColumnBuilder(const std::string& col_name,
-                               std::shared_ptr<ColumnBuilder>* out) {
     std::shared_ptr<DataType> type;
-    // If the named column have a fixed type, use it, otherwise use null()
     auto it = convert_options_.column_types.find(col_name);
     if (it != convert_options_.column_types.end()) {
       type = it->second;
-    } else {
+    } else if (col_index == -1) {
+      // A column of nulls without a fixed type has the null type
       type = null();
     }
-    return ColumnBuilder::MakeNull(pool_, type, task_group_, out);
+    conversion_schema_.push_back({col_name, col_index, std::move(type)});
   }
 
   std::vector<std::string> GenerateColumnNames(int32_t num_cols) {
@@ -255,10 +248,11 @@ class BaseTableReader : public csv::TableReader {
     return res;
   }
 
-  Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
-                        const std::shared_ptr<Buffer>& completion,
-                        const std::shared_ptr<Buffer>& block, int64_t block_index,
-                        bool is_final, uint32_t* out_parsed_size = nullptr) {
+  // Parse `partial + completion + block`, i.e. a sequence of whole CSV rows
+  Status Parse(const std::shared_ptr<Buffer>& partial,
+               const std::shared_ptr<Buffer>& completion,
+               const std::shared_ptr<Buffer>& block, bool is_final,
+               std::shared_ptr<BlockParser>* out, uint32_t* out_parsed_size = nullptr) {
     static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
     auto parser =
         std::make_shared<BlockParser>(pool_, parse_options_, num_csv_cols_, max_num_rows);
@@ -286,6 +280,64 @@ class BaseTableReader : public csv::TableReader {
     if (out_parsed_size) {
       *out_parsed_size = parsed_size;
     }
+    *out = std::move(parser);
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  ConvertOptions convert_options_;
+
+  // Number of columns in the CSV file
+  int32_t num_csv_cols_ = -1;
+  // Column names in the CSV file
+  std::vector<std::string> column_names_;
+  // Target columns (not necessarily in CSV file order)
+  std::vector<ConversionColumn> conversion_schema_;
+
+  std::shared_ptr<io::InputStream> input_;
+  Iterator<std::shared_ptr<Buffer>> block_iterator_;
+
+  // Whether there was a trailing CR at the end of last parsed line
+  bool trailing_cr_ = false;
+};
+
+/////////////////////////////////////////////////////////////////////////
+// Base class for TableReader implementations
+
+class BaseTableReader : public ReaderMixin, public csv::TableReader {
+ public:
+  using ReaderMixin::ReaderMixin;
+
+  virtual Status Init() = 0;
+
+ protected:
+  // Make column builders from conversion schema
+  Status MakeColumnBuilders() {
+    for (const auto& column : conversion_schema_) {
+      std::shared_ptr<ColumnBuilder> builder;
+      if (column.index == -1) {
+        // Column not in the CSV file
+        RETURN_NOT_OK(ColumnBuilder::MakeNull(pool_, column.type, task_group_, &builder));
+      } else if (column.type != nullptr) {
+        RETURN_NOT_OK(ColumnBuilder::Make(pool_, column.type, column.index,
+                                          convert_options_, task_group_, &builder));
+      } else {
+        RETURN_NOT_OK(ColumnBuilder::Make(pool_, column.index, convert_options_,
+                                          task_group_, &builder));
+      }
+      column_builders_.push_back(builder);
+    }
+    return Status::OK();
+  }
+
+  Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
+                        const std::shared_ptr<Buffer>& completion,
+                        const std::shared_ptr<Buffer>& block, int64_t block_index,
+                        bool is_final, uint32_t* out_parsed_size = nullptr) {
+    std::shared_ptr<BlockParser> parser;
+    RETURN_NOT_OK(Parse(partial, completion, block, is_final, &parser, out_parsed_size));
     return ProcessData(parser, block_index);
   }
 
@@ -298,41 +350,25 @@ class BaseTableReader : public csv::TableReader {
   }
 
   Status MakeTable(std::shared_ptr<Table>* out) {
-    DCHECK_EQ(column_builders_.size(), builder_names_.size());
+    DCHECK_EQ(column_builders_.size(), conversion_schema_.size());
 
     std::vector<std::shared_ptr<Field>> fields;
     std::vector<std::shared_ptr<ChunkedArray>> columns;
 
-    for (int32_t i = 0; i < static_cast<int32_t>(builder_names_.size()); ++i) {
+    for (int32_t i = 0; i < static_cast<int32_t>(conversion_schema_.size()); ++i) {
       std::shared_ptr<ChunkedArray> array;
       RETURN_NOT_OK(column_builders_[i]->Finish(&array));
-      fields.push_back(::arrow::field(builder_names_[i], array->type()));
+      fields.push_back(::arrow::field(conversion_schema_[i].name, array->type()));
       columns.emplace_back(std::move(array));
     }
     *out = Table::Make(schema(fields), columns);
     return Status::OK();
   }
 
-  MemoryPool* pool_;
-  ReadOptions read_options_;
-  ParseOptions parse_options_;
-  ConvertOptions convert_options_;
-
-  // Number of columns in the CSV file
-  int32_t num_csv_cols_ = -1;
-  // Column names in the CSV file
-  std::vector<std::string> column_names_;
-  // Column builders for target Table (not necessarily in CSV file order)
+  // Column builders for target Table (in conversion schema order)
   std::vector<std::shared_ptr<ColumnBuilder>> column_builders_;
-  // Names of columns, in same order as column_builders_
-  std::vector<std::string> builder_names_;
 
-  std::shared_ptr<io::InputStream> input_;
-  Iterator<std::shared_ptr<Buffer>> block_iterator_;
   std::shared_ptr<internal::TaskGroup> task_group_;
-
-  // Whether there was a trailing CR at the end of last parsed line
-  bool trailing_cr_ = false;
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -361,6 +397,7 @@ class SerialTableReader : public BaseTableReader {
       return Status::Invalid("Empty CSV file");
     }
     RETURN_NOT_OK(ProcessHeader(block, &block));
+    RETURN_NOT_OK(MakeColumnBuilders());
 
     auto chunker = MakeChunker(parse_options_);
     auto empty = std::make_shared<Buffer>("");
@@ -437,6 +474,7 @@ class ThreadedTableReader : public BaseTableReader {
       return Status::Invalid("Empty CSV file");
     }
     RETURN_NOT_OK(ProcessHeader(block, &block));
+    RETURN_NOT_OK(MakeColumnBuilders());
 
     auto chunker = MakeChunker(parse_options_);
     auto empty = std::make_shared<Buffer>("");
@@ -482,7 +520,244 @@ class ThreadedTableReader : public BaseTableReader {
 };
 
 /////////////////////////////////////////////////////////////////////////
-// TableReader factory function
+// Streaming reader implementation
+
+class StreamingReaderImpl : public ReaderMixin, public csv::StreamingReader {
+ public:
+  // If `thread_pool` is null, blocks are converted serially
+  StreamingReaderImpl(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                      const ReadOptions& read_options, const ParseOptions& parse_options,
+                      const ConvertOptions& convert_options, ThreadPool* thread_pool)
+      : ReaderMixin(pool, input, read_options, parse_options, convert_options),
+        thread_pool_(thread_pool) {}
+
+  ~StreamingReaderImpl() override {
+    // Make sure all pending tasks are finished before we start destroying
+    // the members they refer to
+    for (auto& fut : pending_) {
+      fut.wait();
+    }
+  }
+
+  Status Init() {
+    RETURN_NOT_OK(
+        io::MakeInputStreamIterator(input_, read_options_.block_size, &block_iterator_));
+    // Readahead as many blocks as can be converted concurrently
+    max_pending_ = (thread_pool_ != nullptr) ? thread_pool_->GetCapacity() : 1;
+    RETURN_NOT_OK(
+        MakeReadaheadIterator(std::move(block_iterator_), max_pending_, &block_iterator_));
+
+    // Read first block and process header
+    RETURN_NOT_OK(ReadFirstBlock(&block_));
+    if (!block_) {
+      return Status::Invalid("Empty CSV file");
+    }
+    RETURN_NOT_OK(ProcessHeader(block_, &block_));
+
+    chunker_ = MakeChunker(parse_options_);
+    partial_ = std::make_shared<Buffer>("");
+
+    // Convert first block serially, inferring column types
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(ConvertFirstBlock(&batch));
+    pending_.push_back(MakeReadyFuture(std::move(batch)));
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    RETURN_NOT_OK(error_);
+    while (true) {
+      error_ = ScheduleBlocks();
+      if (!error_.ok()) {
+        break;
+      }
+      if (pending_.empty()) {
+        // EOF
+        out->reset();
+        return Status::OK();
+      }
+      auto maybe_batch = pending_.front().get();
+      pending_.pop_front();
+      if (!maybe_batch.ok()) {
+        error_ = maybe_batch.status();
+        break;
+      }
+      *out = std::move(maybe_batch).ValueOrDie();
+      // Skip empty blocks (e.g. a first block containing only the header)
+      if ((*out)->num_rows() > 0) {
+        return Status::OK();
+      }
+    }
+    // Stop reading after an error, but wait for pending tasks before reporting it
+    for (auto& fut : pending_) {
+      fut.wait();
+    }
+    pending_.clear();
+    out->reset();
+    return error_;
+  }
+
+ protected:
+  using BatchFuture = std::future<Result<std::shared_ptr<RecordBatch>>>;
+
+  static BatchFuture MakeReadyFuture(Result<std::shared_ptr<RecordBatch>> result) {
+    std::promise<Result<std::shared_ptr<RecordBatch>>> promise;
+    promise.set_value(std::move(result));
+    return promise.get_future();
+  }
+
+  // Get the next chunk of whole CSV rows, as `partial + completion + whole`.
+  // `block_` is null at EOF.
+  Status NextChunk(std::shared_ptr<Buffer>* partial, std::shared_ptr<Buffer>* completion,
+                   std::shared_ptr<Buffer>* whole, bool* is_final) {
+    DCHECK_NE(block_, nullptr);
+    std::shared_ptr<Buffer> next_block, next_partial;
+    RETURN_NOT_OK(block_iterator_.Next(&next_block));
+    *is_final = (next_block == nullptr);
+
+    if (*is_final) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(chunker_->ProcessFinal(partial_, block_, completion, whole));
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(
+          chunker_->ProcessWithPartial(partial_, block_, completion, &starts_with_whole));
+
+      // Get a complete CSV block inside `partial + block`, and keep
+      // the rest for the next iteration.
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, whole, &next_partial));
+    }
+
+    *partial = std::move(partial_);
+    partial_ = std::move(next_partial);
+    block_ = std::move(next_block);
+    return Status::OK();
+  }
+
+  // Launch conversion of blocks until the window of pending blocks is full
+  Status ScheduleBlocks() {
+    while (block_ && static_cast<int32_t>(pending_.size()) < max_pending_) {
+      std::shared_ptr<Buffer> partial, completion, whole;
+      bool is_final;
+      RETURN_NOT_OK(NextChunk(&partial, &completion, &whole, &is_final));
+
+      if (thread_pool_ != nullptr) {
+        pending_.push_back(
+            thread_pool_->Submit([this, partial, completion, whole, is_final] {
+              return ConvertBlock(partial, completion, whole, is_final);
+            }));
+      } else {
+        pending_.push_back(
+            MakeReadyFuture(ConvertBlock(partial, completion, whole, is_final)));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status MakeConverter(const std::shared_ptr<DataType>& type,
+                       std::shared_ptr<Converter>* out) {
+    if (type->id() == Type::DICTIONARY) {
+      // A new dictionary is computed for each block
+      const auto& dict_type = internal::checked_cast<const DictionaryType&>(*type);
+      ARROW_ASSIGN_OR_RAISE(*out, DictionaryConverter::Make(dict_type.value_type(),
+                                                            convert_options_, pool_));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(*out, Converter::Make(type, convert_options_, pool_));
+    }
+    return Status::OK();
+  }
+
+  // Convert the first block, fixing the type of each column for the
+  // following blocks
+  Status ConvertFirstBlock(std::shared_ptr<RecordBatch>* out) {
+    std::shared_ptr<Buffer> partial, completion, whole;
+    bool is_final;
+    RETURN_NOT_OK(NextChunk(&partial, &completion, &whole, &is_final));
+    std::shared_ptr<BlockParser> parser;
+    RETURN_NOT_OK(Parse(partial, completion, whole, is_final, &parser));
+
+    auto task_group = internal::TaskGroup::MakeSerial();
+    const auto num_cols = conversion_schema_.size();
+    std::vector<std::shared_ptr<Field>> fields(num_cols);
+    std::vector<std::shared_ptr<Array>> arrays(num_cols);
+    converters_.resize(num_cols);
+
+    for (size_t i = 0; i < num_cols; ++i) {
+      auto& column = conversion_schema_[i];
+      if (column.index == -1) {
+        // Column not in the CSV file
+        RETURN_NOT_OK(
+            MakeArrayOfNull(pool_, column.type, parser->num_rows(), &arrays[i]));
+      } else if (column.type != nullptr) {
+        RETURN_NOT_OK(MakeConverter(column.type, &converters_[i]));
+        RETURN_NOT_OK(converters_[i]->Convert(*parser, column.index, &arrays[i]));
+      } else {
+        // Infer column type using an inferring ColumnBuilder
+        std::shared_ptr<ColumnBuilder> builder;
+        std::shared_ptr<ChunkedArray> chunked;
+        RETURN_NOT_OK(ColumnBuilder::Make(pool_, column.index, convert_options_,
+                                          task_group, &builder));
+        builder->Insert(0, parser);
+        RETURN_NOT_OK(task_group->Finish());
+        RETURN_NOT_OK(builder->Finish(&chunked));
+        DCHECK_EQ(chunked->num_chunks(), 1);
+        arrays[i] = chunked->chunk(0);
+        column.type = arrays[i]->type();
+        RETURN_NOT_OK(MakeConverter(column.type, &converters_[i]));
+      }
+      fields[i] = ::arrow::field(column.name, column.type);
+    }
+
+    schema_ = ::arrow::schema(std::move(fields));
+    *out = RecordBatch::Make(schema_, parser->num_rows(), std::move(arrays));
+    return Status::OK();
+  }
+
+  // Convert a subsequent block, using the column types fixed by the first block.
+  // This may be called from several threads at once.
+  Result<std::shared_ptr<RecordBatch>> ConvertBlock(
+      const std::shared_ptr<Buffer>& partial, const std::shared_ptr<Buffer>& completion,
+      const std::shared_ptr<Buffer>& whole, bool is_final) {
+    std::shared_ptr<BlockParser> parser;
+    RETURN_NOT_OK(Parse(partial, completion, whole, is_final, &parser));
+
+    const auto num_cols = conversion_schema_.size();
+    std::vector<std::shared_ptr<Array>> arrays(num_cols);
+    for (size_t i = 0; i < num_cols; ++i) {
+      const auto& column = conversion_schema_[i];
+      if (column.index == -1) {
+        RETURN_NOT_OK(
+            MakeArrayOfNull(pool_, column.type, parser->num_rows(), &arrays[i]));
+      } else {
+        RETURN_NOT_OK(converters_[i]->Convert(*parser, column.index, &arrays[i]));
+      }
+    }
+    return RecordBatch::Make(schema_, parser->num_rows(), std::move(arrays));
+  }
+
+  ThreadPool* thread_pool_;
+  int32_t max_pending_ = 1;
+
+  std::unique_ptr<Chunker> chunker_;
+  // Next block to chunk, or null at EOF
+  std::shared_ptr<Buffer> block_;
+  // Trailing incomplete row of the previous block
+  std::shared_ptr<Buffer> partial_;
+
+  std::shared_ptr<Schema> schema_;
+  // One converter per target column (null for columns not in the CSV file)
+  std::vector<std::shared_ptr<Converter>> converters_;
+  // Blocks being converted, in file order
+  std::deque<BatchFuture> pending_;
+  // Sticky error
+  Status error_;
+};
+
+/////////////////////////////////////////////////////////////////////////
+// Factory functions
 
 Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
                          const ReadOptions& read_options,
@@ -502,5 +777,18 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   return Status::OK();
 }
 
+Status StreamingReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                             const ReadOptions& read_options,
+                             const ParseOptions& parse_options,
+                             const ConvertOptions& convert_options,
+                             std::shared_ptr<StreamingReader>* out) {
+  ThreadPool* thread_pool = read_options.use_threads ? GetCpuThreadPool() : nullptr;
+  auto result = std::make_shared<StreamingReaderImpl>(
+      pool, input, read_options, parse_options, convert_options, thread_pool);
+  RETURN_NOT_OK(result->Init());
+  *out = result;
+  return Status::OK();
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -21,6 +21,7 @@
 #include <memory>
 
 #include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
 
@@ -49,6 +50,27 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// A class that reads a CSV file incrementally, as a stream of RecordBatches
+///
+/// Each block of `ReadOptions::block_size` bytes is converted to a separate
+/// RecordBatch, so that only a few blocks need to be held in memory at once.
+/// Column types are inferred from the first block and are fixed afterwards:
+/// a value in a later block that cannot be converted to the inferred type
+/// is reported as an error.  If `ReadOptions::use_threads` is true, up to the
+/// CPU thread pool capacity of blocks are parsed and converted concurrently.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  /// Create a StreamingReader instance
+  ///
+  /// The CSV header and first block are read and converted here, so that
+  /// schema() is available as soon as this function returns.
+  static Status Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                     const ReadOptions&, const ParseOptions&, const ConvertOptions&,
+                     std::shared_ptr<StreamingReader>* out);
+};
+
 }  // namespace csv
 }  // namespace arrow
 
@@ -0,0 +1,202 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+static std::string MakeRows(int num_rows) {
+  std::string csv = "i64,str,f64\n";
+  for (int i = 0; i < num_rows; ++i) {
+    csv += std::to_string(i) + ",s" + std::to_string(i) + "," + std::to_string(i) +
+           ".5\n";
+  }
+  return csv;
+}
+
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() override { read_options_.use_threads = GetParam(); }
+
+  std::shared_ptr<io::InputStream> MakeInput(std::string csv) {
+    return std::make_shared<io::BufferReader>(Buffer::FromString(std::move(csv)));
+  }
+
+  void MakeReader(std::string csv) {
+    ASSERT_OK(StreamingReader::Make(default_memory_pool(), MakeInput(std::move(csv)),
+                                    read_options_, parse_options_, convert_options_,
+                                    &reader_));
+  }
+
+  void ReadAll(std::vector<std::shared_ptr<RecordBatch>>* out) {
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      ASSERT_OK(reader_->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      AssertSchemaEqual(*reader_->schema(), *batch->schema());
+      ASSERT_OK(batch->Validate());
+      out->push_back(std::move(batch));
+    }
+  }
+
+  // Check the streamed batches against the result of a TableReader
+  void AssertSameAsTableReader(std::string csv,
+                               const std::vector<std::shared_ptr<RecordBatch>>& batches) {
+    std::shared_ptr<TableReader> table_reader;
+    std::shared_ptr<Table> expected, actual;
+    ASSERT_OK(TableReader::Make(default_memory_pool(), MakeInput(std::move(csv)),
+                                read_options_, parse_options_, convert_options_,
+                                &table_reader));
+    ASSERT_OK(table_reader->Read(&expected));
+    ASSERT_OK(Table::FromRecordBatches(reader_->schema(), batches, &actual));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+
+ protected:
+  ReadOptions read_options_ = ReadOptions::Defaults();
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ConvertOptions convert_options_ = ConvertOptions::Defaults();
+  std::shared_ptr<StreamingReader> reader_;
+};
+
+TEST_P(StreamingReaderTest, Basics) {
+  auto csv = MakeRows(1000);
+  read_options_.block_size = 256;
+  MakeReader(csv);
+  AssertSchemaEqual(
+      *schema({field("i64", int64()), field("str", utf8()), field("f64", float64())}),
+      *reader_->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadAll(&batches);
+  ASSERT_GT(batches.size(), 1);
+  AssertSameAsTableReader(csv, batches);
+
+  // Reading past the end keeps returning null
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST_P(StreamingReaderTest, SingleBlock) {
+  auto csv = MakeRows(10);
+  MakeReader(csv);
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadAll(&batches);
+  ASSERT_EQ(batches.size(), 1);
+  AssertSameAsTableReader(csv, batches);
+}
+
+TEST_P(StreamingReaderTest, TypeFixedAfterFirstBlock) {
+  // The first block only has integers, a later one has a string
+  auto csv = MakeRows(1000) + "xxx,s,1.5\n";
+  read_options_.block_size = 256;
+  MakeReader(csv);
+  AssertSchemaEqual(
+      *schema({field("i64", int64()), field("str", utf8()), field("f64", float64())}),
+      *reader_->schema());
+
+  std::shared_ptr<RecordBatch> batch;
+  Status st;
+  do {
+    st = reader_->ReadNext(&batch);
+  } while (st.ok() && batch != nullptr);
+  ASSERT_RAISES(Invalid, st);
+  // The error is sticky
+  ASSERT_RAISES(Invalid, reader_->ReadNext(&batch));
+}
+
+TEST_P(StreamingReaderTest, ColumnTypes) {
+  auto csv = MakeRows(1000);
+  read_options_.block_size = 256;
+  convert_options_.column_types["i64"] = float32();
+  convert_options_.column_types["str"] = dictionary(int32(), utf8());
+  MakeReader(csv);
+  AssertSchemaEqual(*schema({field("i64", float32()),
+                             field("str", dictionary(int32(), utf8())),
+                             field("f64", float64())}),
+                    *reader_->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadAll(&batches);
+  int64_t num_rows = 0;
+  for (const auto& batch : batches) {
+    num_rows += batch->num_rows();
+  }
+  ASSERT_EQ(num_rows, 1000);
+}
+
+TEST_P(StreamingReaderTest, IncludeColumns) {
+  auto csv = MakeRows(1000);
+  read_options_.block_size = 256;
+  convert_options_.include_columns = {"f64", "missing", "i64"};
+  convert_options_.include_missing_columns = true;
+  convert_options_.column_types["missing"] = int16();
+  MakeReader(csv);
+  AssertSchemaEqual(
+      *schema({field("f64", float64()), field("missing", int16()), field("i64", int64())}),
+      *reader_->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadAll(&batches);
+  AssertSameAsTableReader(csv, batches);
+
+  convert_options_.include_missing_columns = false;
+  ASSERT_RAISES(KeyError, StreamingReader::Make(default_memory_pool(), MakeInput(csv),
+                                                read_options_, parse_options_,
+                                                convert_options_, &reader_));
+}
+
+TEST_P(StreamingReaderTest, HeaderOnly) {
+  MakeReader("a,b\n");
+  AssertSchemaEqual(*schema({field("a", null()), field("b", null())}),
+                    *reader_->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadAll(&batches);
+  ASSERT_EQ(batches.size(), 0);
+}
+
+TEST_P(StreamingReaderTest, Empty) {
+  ASSERT_RAISES(Invalid, StreamingReader::Make(default_memory_pool(), MakeInput(""),
+                                               read_options_, parse_options_,
+                                               convert_options_, &reader_));
+}
+
+INSTANTIATE_TEST_CASE_P(StreamingReaderTest, StreamingReaderTest,
+                        ::testing::Values(false, true));
+
+}  // namespace csv
+}  // namespace arrow
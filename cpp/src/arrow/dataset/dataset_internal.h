@@ -30,6 +30,7 @@
 #include "arrow/result.h"
 #include "arrow/scalar.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
@@ -40,6 +41,33 @@ namespace dataset {
 
 constexpr int kNoMatch = -1;
 
+/// \brief Total size of the buffers referenced by an array, including children and
+/// dictionaries. Buffers shared by slices are counted in full.
+static inline int64_t TotalBufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != NULLPTR) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += TotalBufferSize(*child);
+  }
+  if (data.dictionary != NULLPTR) {
+    size += TotalBufferSize(*data.dictionary->data());
+  }
+  return size;
+}
+
+/// \brief Total size of the buffers referenced by the columns of a RecordBatch.
+static inline int64_t TotalBufferSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    size += TotalBufferSize(*batch.column_data(i));
+  }
+  return size;
+}
+
 /// \brief Project a RecordBatch to a given schema.
 ///
 /// Projected record batches will reorder columns from input record batches when possible,
@@ -192,6 +220,25 @@ class ProjectedRecordBatchReader : public RecordBatchReader {
   RecordBatchIterator wrapped_;
 };
 
+/// \brief Yield the record batches of a Table, at most `max_chunksize` rows each if
+/// positive, otherwise one per chunk. The Table is kept alive by the iterator.
+class TableRecordBatchIterator {
+ public:
+  explicit TableRecordBatchIterator(std::shared_ptr<Table> table,
+                                    int64_t max_chunksize = -1)
+      : table_(std::move(table)), reader_(new TableBatchReader(*table_)) {
+    if (max_chunksize > 0) {
+      reader_->set_chunksize(max_chunksize);
+    }
+  }
+
+  Status Next(std::shared_ptr<RecordBatch>* out) { return reader_->ReadNext(out); }
+
+ private:
+  std::shared_ptr<Table> table_;
+  std::unique_ptr<TableBatchReader> reader_;
+};
+
 /// \brief GetFragmentsFromSources transforms a vector<DataSource> into a
 /// flattened DataFragmentIterator.
 static inline DataFragmentIterator GetFragmentsFromSources(
@@ -42,6 +42,13 @@ Status FileSource::Open(std::shared_ptr<arrow::io::RandomAccessFile>* out) const
   return Status::OK();
 }
 
+Status FileFormat::MakeWriter(std::shared_ptr<io::OutputStream> destination,
+                              std::shared_ptr<Schema> schema,
+                              std::shared_ptr<FileWriteOptions> options, MemoryPool* pool,
+                              std::unique_ptr<FileWriter>* out) const {
+  return Status::NotImplemented("Writing files of format '", name(), "'");
+}
+
 Status FileBasedDataFragment::Scan(std::shared_ptr<ScanContext> scan_context,
                                    ScanTaskIterator* out) {
   return format_->ScanFile(source_, scan_options_, scan_context, out);
@@ -126,6 +126,20 @@ class ARROW_DS_EXPORT FileWriteOptions : public WriteOptions {
   virtual std::string file_type() const = 0;
 };
 
+/// \brief Writes RecordBatches to a single file of some format
+class ARROW_DS_EXPORT FileWriter {
+ public:
+  virtual ~FileWriter() = default;
+
+  /// \brief Append a RecordBatch to the file.
+  virtual Status Write(std::shared_ptr<RecordBatch> batch) = 0;
+
+  /// \brief Write any buffered data and trailing metadata.
+  ///
+  /// The destination stream is not closed.
+  virtual Status Finish() = 0;
+};
+
 /// \brief Base class for file format implementation
 class ARROW_DS_EXPORT FileFormat {
  public:
@@ -150,6 +164,20 @@ class ARROW_DS_EXPORT FileFormat {
   virtual Status MakeFragment(const FileSource& location,
                               std::shared_ptr<ScanOptions> opts,
                               std::unique_ptr<DataFragment>* out) = 0;
+
+  /// \brief Open a writer of files in this format
+  ///
+  /// \param[in] destination the stream the file is written to
+  /// \param[in] schema the schema of the written RecordBatches
+  /// \param[in] options format-specific options, the defaults are used if null
+  /// \param[in] pool the memory pool used for allocations
+  /// \param[out] out the writer
+  ///
+  /// The default implementation returns NotImplemented.
+  virtual Status MakeWriter(std::shared_ptr<io::OutputStream> destination,
+                            std::shared_ptr<Schema> schema,
+                            std::shared_ptr<FileWriteOptions> options, MemoryPool* pool,
+                            std::unique_ptr<FileWriter>* out) const;
 };
 
 /// \brief A DataFragment that is stored in a file with a known format
@@ -0,0 +1,222 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_csv.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/csv/parser.h"
+#include "arrow/csv/reader.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/dataset/scanner_internal.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/stl.h"
+
+namespace arrow {
+namespace dataset {
+
+static Status OpenReader(std::shared_ptr<io::RandomAccessFile> input,
+                         const CsvFileFormat& format,
+                         const csv::ConvertOptions& convert_options, MemoryPool* pool,
+                         std::shared_ptr<csv::StreamingReader>* out) {
+  auto read_options = format.read_options;
+  // Parallelism is provided by the Scanner dispatching ScanTasks.
+  read_options.use_threads = false;
+  return csv::StreamingReader::Make(pool, std::move(input), read_options,
+                                    format.parse_options, convert_options, out);
+}
+
+static Status OpenReader(const FileSource& source, const CsvFileFormat& format,
+                         const csv::ConvertOptions& convert_options, MemoryPool* pool,
+                         std::shared_ptr<csv::StreamingReader>* out) {
+  std::shared_ptr<io::RandomAccessFile> input;
+  RETURN_NOT_OK(source.Open(&input));
+  return OpenReader(std::move(input), format, convert_options, pool, out);
+}
+
+// Read the column names of a CSV file from its header row, without converting
+// any data. The file position is reset to the start of the file.
+static Status ReadColumnNames(const CsvFileFormat& format, io::RandomAccessFile* input,
+                              std::vector<std::string>* out) {
+  const auto& read_options = format.read_options;
+  if (!read_options.column_names.empty()) {
+    *out = read_options.column_names;
+    return Status::OK();
+  }
+
+  std::shared_ptr<Buffer> block;
+  RETURN_NOT_OK(input->ReadAt(0, read_options.block_size, &block));
+  RETURN_NOT_OK(input->Seek(0));
+
+  const uint8_t* data = block->data();
+  const uint8_t* data_end = data + block->size();
+  if (read_options.skip_rows) {
+    auto num_skipped_rows = csv::SkipRows(data, static_cast<uint32_t>(data_end - data),
+                                          read_options.skip_rows, &data);
+    if (num_skipped_rows < read_options.skip_rows) {
+      return Status::Invalid("Could not skip initial ", read_options.skip_rows,
+                             " rows from CSV file");
+    }
+  }
+
+  csv::BlockParser parser(format.parse_options, /*num_cols=*/-1, /*max_num_rows=*/1);
+  uint32_t parsed_size = 0;
+  RETURN_NOT_OK(parser.Parse(
+      util::string_view(reinterpret_cast<const char*>(data), data_end - data),
+      &parsed_size));
+  if (parser.num_rows() != 1) {
+    return Status::Invalid("Could not read first row from CSV file");
+  }
+
+  out->clear();
+  if (read_options.autogenerate_column_names) {
+    for (int32_t i = 0; i < parser.num_cols(); ++i) {
+      out->push_back("f" + std::to_string(i));
+    }
+    return Status::OK();
+  }
+  return parser.VisitLastRow([&](const uint8_t* value, uint32_t size, bool quoted) {
+    out->emplace_back(reinterpret_cast<const char*>(value), size);
+    return Status::OK();
+  });
+}
+
+/// \brief A ScanTask backed by a CSV file.
+class CsvScanTask : public ScanTask {
+ public:
+  CsvScanTask(FileSource source, std::shared_ptr<CsvFileFormat> format,
+              std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context)
+      : source_(std::move(source)),
+        format_(std::move(format)),
+        options_(std::move(options)),
+        context_(std::move(context)) {}
+
+  RecordBatchIterator Scan() override {
+    // Blocks are converted as the iterator is advanced, so that only one
+    // block of the file is held in memory at a time.
+    std::shared_ptr<csv::StreamingReader> reader;
+    auto status = OpenReader(&reader);
+    // Propagate the error as an error iterator.
+    if (!status.ok()) {
+      return MakeErrorIterator<std::shared_ptr<RecordBatch>>(std::move(status));
+    }
+
+    return MakePointerIterator(std::move(reader));
+  }
+
+ private:
+  Status OpenReader(std::shared_ptr<csv::StreamingReader>* out) {
+    std::shared_ptr<io::RandomAccessFile> input;
+    RETURN_NOT_OK(source_.Open(&input));
+
+    auto convert_options = format_->convert_options;
+    // Push the projection down to the CSV converter: only the columns which are
+    // both materialized by the scan and present in the file are converted. The
+    // file's columns are known from its header row, which is read here rather
+    // than when the task is created so that files are not opened eagerly.
+    std::vector<std::string> columns;
+    if (MaterializedColumnNames(*options_, &columns)) {
+      std::vector<std::string> file_columns;
+      RETURN_NOT_OK(ReadColumnNames(*format_, input.get(), &file_columns));
+
+      convert_options.include_columns.clear();
+      for (const auto& name : columns) {
+        if (std::find(file_columns.begin(), file_columns.end(), name) ==
+            file_columns.end()) {
+          continue;
+        }
+        convert_options.include_columns.push_back(name);
+
+        // Convert to the type expected by the scan rather than the type inferred
+        // from this file's contents.
+        auto field = options_->schema ? options_->schema->GetFieldByName(name) : nullptr;
+        if (field != nullptr && convert_options.column_types.count(name) == 0) {
+          convert_options.column_types[name] = field->type();
+        }
+      }
+
+      if (convert_options.include_columns.empty() && !file_columns.empty()) {
+        // An empty include_columns means all columns: convert a single column to
+        // still yield batches with the right number of rows.
+        convert_options.include_columns.push_back(file_columns[0]);
+      }
+    }
+
+    return dataset::OpenReader(std::move(input), *format_, convert_options,
+                               context_->pool, out);
+  }
+
+  FileSource source_;
+  std::shared_ptr<CsvFileFormat> format_;
+  std::shared_ptr<ScanOptions> options_;
+  std::shared_ptr<ScanContext> context_;
+};
+
+Status CsvFileFormat::IsSupported(const FileSource& source, bool* supported) const {
+  std::shared_ptr<Schema> schema;
+  auto status = Inspect(source, &schema);
+  if (status.IsIOError()) {
+    return status;
+  }
+
+  *supported = status.ok();
+  return Status::OK();
+}
+
+Status CsvFileFormat::Inspect(const FileSource& source,
+                              std::shared_ptr<Schema>* out) const {
+  // Column types are inferred from the first block only, so that inspecting
+  // a large file is cheap.
+  std::shared_ptr<csv::StreamingReader> reader;
+  RETURN_NOT_OK(
+      OpenReader(source, *this, convert_options, default_memory_pool(), &reader));
+  *out = reader->schema();
+  return Status::OK();
+}
+
+Status CsvFileFormat::ScanFile(const FileSource& source,
+                               std::shared_ptr<ScanOptions> scan_options,
+                               std::shared_ptr<ScanContext> scan_context,
+                               ScanTaskIterator* out) const {
+  std::unique_ptr<ScanTask> task = internal::make_unique<CsvScanTask>(
+      source, std::make_shared<CsvFileFormat>(*this), std::move(scan_options),
+      std::move(scan_context));
+  std::vector<std::unique_ptr<ScanTask>> tasks;
+  tasks.emplace_back(std::move(task));
+  *out = MakeVectorIterator(std::move(tasks));
+  return Status::OK();
+}
+
+Status CsvFileFormat::MakeFragment(const FileSource& source,
+                                   std::shared_ptr<ScanOptions> opts,
+                                   std::unique_ptr<DataFragment>* out) {
+  *out = internal::make_unique<CsvFragment>(
+      source, std::make_shared<CsvFileFormat>(*this), std::move(opts));
+  return Status::OK();
+}
+
+}  // namespace dataset
+}  // namespace arrow
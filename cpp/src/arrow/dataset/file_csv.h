@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "arrow/csv/options.h"
 #include "arrow/dataset/file_base.h"
@@ -27,42 +28,58 @@
 #include "arrow/util/iterator.h"
 
 namespace arrow {
-
-namespace fs {
-
-class FileSystem;
-
-}  // namespace fs
-
 namespace dataset {
 
 class ARROW_DS_EXPORT CsvScanOptions : public FileScanOptions {
  public:
-  std::string file_type() const override;
-
- private:
-  csv::ParseOptions parse_options_;
-  csv::ConvertOptions convert_options_;
-  csv::ReadOptions read_options_;
+  std::string file_type() const override { return "csv"; }
 };
 
 class ARROW_DS_EXPORT CsvWriteOptions : public FileWriteOptions {
  public:
-  std::string file_type() const override;
+  std::string file_type() const override { return "csv"; }
 };
 
 /// \brief A FileFormat implementation that reads from CSV files
+///
+/// Each file is scanned by a single ScanTask which yields one RecordBatch per
+/// block of `read_options.block_size` bytes. When the ScanOptions carry a
+/// projection, only the projected and filtered columns are converted.
 class ARROW_DS_EXPORT CsvFileFormat : public FileFormat {
  public:
-  std::string name() const override;
+  /// Options affecting the parsing of CSV files
+  csv::ParseOptions parse_options = csv::ParseOptions::Defaults();
+  /// Options affecting the conversion of CSV columns. `include_columns` and
+  /// `column_types` are completed from the ScanOptions when scanning.
+  csv::ConvertOptions convert_options = csv::ConvertOptions::Defaults();
+  /// Options affecting the reading of CSV files. `use_threads` is ignored:
+  /// parallelism is left to the Scanner.
+  csv::ReadOptions read_options = csv::ReadOptions::Defaults();
+
+  std::string name() const override { return "csv"; }
 
   /// \brief Indicate if the FileSource is supported/readable by this format.
   Status IsSupported(const FileSource& source, bool* supported) const override;
 
+  /// \brief Return the schema of the file, inferred from its first block.
+  Status Inspect(const FileSource& source, std::shared_ptr<Schema>* out) const override;
+
   /// \brief Open a file for scanning
   Status ScanFile(const FileSource& source, std::shared_ptr<ScanOptions> scan_options,
                   std::shared_ptr<ScanContext> scan_context,
                   ScanTaskIterator* out) const override;
+
+  Status MakeFragment(const FileSource& source, std::shared_ptr<ScanOptions> opts,
+                      std::unique_ptr<DataFragment>* out) override;
+};
+
+class ARROW_DS_EXPORT CsvFragment : public FileBasedDataFragment {
+ public:
+  CsvFragment(const FileSource& source, std::shared_ptr<CsvFileFormat> format,
+              std::shared_ptr<ScanOptions> options)
+      : FileBasedDataFragment(source, std::move(format), std::move(options)) {}
+
+  bool splittable() const override { return false; }
 };
 
 }  // namespace dataset
@@ -0,0 +1,188 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_csv.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace dataset {
+
+class TestCsvFileFormat : public testing::Test {
+ public:
+  std::unique_ptr<FileSource> GetFileSource() {
+    return GetFileSource("f64,str\n1.0,a\n,b\nN/A,c\n2,d\n");
+  }
+
+  std::unique_ptr<FileSource> GetFileSource(std::string csv) {
+    return internal::make_unique<FileSource>(Buffer::FromString(std::move(csv)));
+  }
+
+  void Scan(const FileSource& source, std::vector<std::shared_ptr<RecordBatch>>* out) {
+    std::unique_ptr<DataFragment> fragment;
+    ASSERT_OK(format_->MakeFragment(source, opts_, &fragment));
+
+    ScanTaskIterator scan_task_it;
+    ASSERT_OK(fragment->Scan(ctx_, &scan_task_it));
+    for (auto maybe_task : scan_task_it) {
+      ASSERT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+      for (auto maybe_batch : task->Scan()) {
+        ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+        out->push_back(std::move(batch));
+      }
+    }
+  }
+
+ protected:
+  std::shared_ptr<CsvFileFormat> format_ = std::make_shared<CsvFileFormat>();
+  std::shared_ptr<ScanOptions> opts_ = ScanOptions::Defaults();
+  std::shared_ptr<ScanContext> ctx_ = std::make_shared<ScanContext>();
+};
+
+TEST_F(TestCsvFileFormat, ScanRecordBatchReader) {
+  auto source = GetFileSource();
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  Scan(*source, &batches);
+
+  int64_t row_count = 0;
+  for (const auto& batch : batches) {
+    ASSERT_EQ(batch->num_columns(), 2);
+    row_count += batch->num_rows();
+  }
+
+  ASSERT_EQ(row_count, 4);
+}
+
+TEST_F(TestCsvFileFormat, ScanBlocks) {
+  std::string csv = "i64\n";
+  for (int i = 0; i < 1000; ++i) {
+    csv += std::to_string(i) + "\n";
+  }
+  auto source = GetFileSource(std::move(csv));
+  format_->read_options.block_size = 256;
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  Scan(*source, &batches);
+
+  int64_t row_count = 0;
+  for (const auto& batch : batches) {
+    AssertSchemaEqual(*schema({field("i64", int64())}), *batch->schema());
+    row_count += batch->num_rows();
+  }
+
+  ASSERT_GT(batches.size(), 1);
+  ASSERT_EQ(row_count, 1000);
+}
+
+TEST_F(TestCsvFileFormat, ScanProjected) {
+  auto source = GetFileSource();
+
+  // Only the projected columns found in the file are converted, to the type
+  // of the scan's schema.
+  opts_->schema = schema({field("f64", float32()), field("missing", int32())});
+  opts_->projector = std::make_shared<RecordBatchProjector>(default_memory_pool(),
+                                                            opts_->schema);
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  Scan(*source, &batches);
+
+  int64_t row_count = 0;
+  for (const auto& batch : batches) {
+    AssertSchemaEqual(*schema({field("f64", float32())}), *batch->schema());
+    row_count += batch->num_rows();
+  }
+
+  ASSERT_EQ(row_count, 4);
+}
+
+TEST_F(TestCsvFileFormat, ScanProjectedAutogeneratedColumnNames) {
+  auto source = GetFileSource("skipped\n1.0,a\n,b\nN/A,c\n2,d\n");
+  format_->read_options.skip_rows = 1;
+  format_->read_options.autogenerate_column_names = true;
+
+  opts_->schema = schema({field("f1", utf8())});
+  opts_->projector = std::make_shared<RecordBatchProjector>(default_memory_pool(),
+                                                            opts_->schema);
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  Scan(*source, &batches);
+
+  int64_t row_count = 0;
+  for (const auto& batch : batches) {
+    AssertSchemaEqual(*schema({field("f1", utf8())}), *batch->schema());
+    row_count += batch->num_rows();
+  }
+
+  ASSERT_EQ(row_count, 4);
+}
+
+TEST_F(TestCsvFileFormat, ScanProjectedMissingColumns) {
+  auto source = GetFileSource();
+
+  opts_->schema = schema({field("missing", int32())});
+  opts_->projector = std::make_shared<RecordBatchProjector>(default_memory_pool(),
+                                                            opts_->schema);
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  Scan(*source, &batches);
+
+  int64_t row_count = 0;
+  for (const auto& batch : batches) {
+    ASSERT_EQ(batch->num_columns(), 1);
+    row_count += batch->num_rows();
+  }
+
+  ASSERT_EQ(row_count, 4);
+}
+
+TEST_F(TestCsvFileFormat, Inspect) {
+  auto source = GetFileSource();
+
+  std::shared_ptr<Schema> actual;
+  ASSERT_OK(format_->Inspect(*source.get(), &actual));
+  AssertSchemaEqual(*schema({field("f64", float64()), field("str", utf8())}), *actual);
+
+  // Only whole rows of the first block are used for inference.
+  format_->read_options.block_size = 16;
+  ASSERT_OK(format_->Inspect(*source.get(), &actual));
+  AssertSchemaEqual(*schema({field("f64", float64()), field("str", utf8())}), *actual);
+}
+
+TEST_F(TestCsvFileFormat, IsSupported) {
+  bool supported = false;
+
+  ASSERT_OK(format_->IsSupported(*GetFileSource(""), &supported));
+  ASSERT_EQ(supported, false);
+
+  ASSERT_OK(format_->IsSupported(*GetFileSource(), &supported));
+  ASSERT_EQ(supported, true);
+}
+
+}  // namespace dataset
+}  // namespace arrow
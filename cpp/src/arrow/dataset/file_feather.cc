@@ -0,0 +1,214 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_feather.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/dataset/scanner_internal.h"
+#include "arrow/ipc/feather.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/range.h"
+#include "arrow/util/stl.h"
+
+namespace arrow {
+namespace dataset {
+
+using ipc::feather::TableReader;
+using ipc::feather::TableWriter;
+
+static Status OpenReader(const FileSource& source, std::unique_ptr<TableReader>* out) {
+  std::shared_ptr<io::RandomAccessFile> input;
+  RETURN_NOT_OK(source.Open(&input));
+
+  auto status = TableReader::Open(input, out);
+  if (!status.ok()) {
+    return Status::IOError("Could not open feather input source '", source.path(),
+                           "': ", status.message());
+  }
+  return Status::OK();
+}
+
+/// \brief A ScanTask backed by a Feather file.
+class FeatherScanTask : public ScanTask {
+ public:
+  /// If project is false, all the columns of the file are read.
+  FeatherScanTask(FileSource source, bool project, std::vector<std::string> columns,
+                  int64_t batch_size)
+      : source_(std::move(source)),
+        project_(project),
+        columns_(std::move(columns)),
+        batch_size_(batch_size) {}
+
+  RecordBatchIterator Scan() override {
+    // Columns are read here rather than in ScanFile, so that the memory they
+    // use is only allocated when the task is executed.
+    std::shared_ptr<Table> table;
+    auto status = Read(&table);
+    // Propagate the error as an error iterator.
+    if (!status.ok()) {
+      return MakeErrorIterator<std::shared_ptr<RecordBatch>>(std::move(status));
+    }
+
+    return RecordBatchIterator(TableRecordBatchIterator(std::move(table), batch_size_));
+  }
+
+ private:
+  Status Read(std::shared_ptr<Table>* out) {
+    std::unique_ptr<TableReader> reader;
+    RETURN_NOT_OK(OpenReader(source_, &reader));
+    const int num_columns = static_cast<int>(reader->num_columns());
+    if (!project_) {
+      return reader->Read(internal::Iota(num_columns), out);
+    }
+
+    // The projection is resolved against the file's columns once it is opened
+    // here, rather than when the task is created, so that files are not
+    // opened eagerly.
+    std::vector<int> column_projection;
+    for (int i = 0; i < num_columns; ++i) {
+      auto name = reader->GetColumnName(i);
+      if (std::find(columns_.begin(), columns_.end(), name) != columns_.end()) {
+        column_projection.push_back(i);
+      }
+    }
+
+    if (column_projection.empty() && num_columns > 0) {
+      // Read a single column to still yield batches with the right number of rows.
+      column_projection.push_back(0);
+    }
+    return reader->Read(column_projection, out);
+  }
+
+  FileSource source_;
+  bool project_;
+  std::vector<std::string> columns_;
+  int64_t batch_size_;
+};
+
+Status FeatherFileFormat::IsSupported(const FileSource& source, bool* supported) const {
+  std::shared_ptr<io::RandomAccessFile> input;
+  RETURN_NOT_OK(source.Open(&input));
+
+  std::unique_ptr<TableReader> reader;
+  *supported = TableReader::Open(input, &reader).ok();
+  return Status::OK();
+}
+
+Status FeatherFileFormat::Inspect(const FileSource& source,
+                                  std::shared_ptr<Schema>* out) const {
+  std::unique_ptr<TableReader> reader;
+  RETURN_NOT_OK(OpenReader(source, &reader));
+  return reader->ReadSchema(out);
+}
+
+Status FeatherFileFormat::ScanFile(const FileSource& source,
+                                   std::shared_ptr<ScanOptions> scan_options,
+                                   std::shared_ptr<ScanContext> scan_context,
+                                   ScanTaskIterator* out) const {
+  std::vector<std::string> columns;
+  bool project = MaterializedColumnNames(*scan_options, &columns);
+
+  std::unique_ptr<ScanTask> task = internal::make_unique<FeatherScanTask>(
+      source, project, std::move(columns), batch_size);
+  std::vector<std::unique_ptr<ScanTask>> tasks;
+  tasks.emplace_back(std::move(task));
+  *out = MakeVectorIterator(std::move(tasks));
+  return Status::OK();
+}
+
+Status FeatherFileFormat::MakeFragment(const FileSource& source,
+                                       std::shared_ptr<ScanOptions> opts,
+                                       std::unique_ptr<DataFragment>* out) {
+  *out = internal::make_unique<FeatherFragment>(
+      source, std::make_shared<FeatherFileFormat>(*this), std::move(opts));
+  return Status::OK();
+}
+
+/// \brief A FileWriter buffering RecordBatches until the Feather file is finished.
+class FeatherFileWriter : public FileWriter {
+ public:
+  FeatherFileWriter(std::shared_ptr<io::OutputStream> destination,
+                    std::shared_ptr<Schema> schema, MemoryPool* pool)
+      : destination_(std::move(destination)), schema_(std::move(schema)), pool_(pool) {}
+
+  Status Write(std::shared_ptr<RecordBatch> batch) override {
+    if (!batch->schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("RecordBatch schema ", batch->schema()->ToString(),
+                             " does not match the writer's schema ",
+                             schema_->ToString());
+    }
+    batches_.push_back(std::move(batch));
+    return Status::OK();
+  }
+
+  Status Finish() override {
+    std::unique_ptr<TableWriter> writer;
+    RETURN_NOT_OK(TableWriter::Open(destination_, &writer));
+
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      std::shared_ptr<Array> column;
+      if (batches_.empty()) {
+        RETURN_NOT_OK(MakeArrayOfNull(schema_->field(i)->type(), 0, &column));
+      } else {
+        ArrayVector chunks;
+        for (const auto& batch : batches_) {
+          chunks.push_back(batch->column(i));
+        }
+        RETURN_NOT_OK(Concatenate(chunks, pool_, &column));
+      }
+      RETURN_NOT_OK(writer->Append(schema_->field(i)->name(), *column));
+    }
+
+    batches_.clear();
+    return writer->Finalize();
+  }
+
+ private:
+  std::shared_ptr<io::OutputStream> destination_;
+  std::shared_ptr<Schema> schema_;
+  MemoryPool* pool_;
+  std::vector<std::shared_ptr<RecordBatch>> batches_;
+};
+
+Status FeatherFileFormat::MakeWriter(std::shared_ptr<io::OutputStream> destination,
+                                     std::shared_ptr<Schema> schema,
+                                     std::shared_ptr<FileWriteOptions> options,
+                                     MemoryPool* pool,
+                                     std::unique_ptr<FileWriter>* out) const {
+  if (options != nullptr && options->file_type() != name()) {
+    return Status::TypeError("Expected write options for format '", name(),
+                             "', got options for '", options->file_type(), "'");
+  }
+  *out = internal::make_unique<FeatherFileWriter>(std::move(destination),
+                                                  std::move(schema), pool);
+  return Status::OK();
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -17,8 +17,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/type_fwd.h"
@@ -29,27 +31,55 @@ namespace dataset {
 
 class ARROW_DS_EXPORT FeatherScanOptions : public FileScanOptions {
  public:
-  std::string file_type() const override;
+  std::string file_type() const override { return "feather"; }
 };
 
 class ARROW_DS_EXPORT FeatherWriterOptions : public FileWriteOptions {
  public:
-  std::string file_type() const override;
+  std::string file_type() const override { return "feather"; }
 };
 
-/// \brief A FileFormat implementation that reads from Feather (Arrow
-/// IPC protocol) files
+/// \brief A FileFormat implementation that reads from and writes to Feather files
+///
+/// Only the columns materialized by the scan are read. Each file is scanned by
+/// a single ScanTask yielding RecordBatches of at most `batch_size` rows.
+///
+/// Feather files are written column by column, so written RecordBatches are
+/// buffered until the writer is finished.
 class ARROW_DS_EXPORT FeatherFileFormat : public FileFormat {
  public:
-  std::string name() const override;
+  /// Maximum number of rows of the yielded RecordBatches
+  int64_t batch_size = 1 << 16;
+
+  std::string name() const override { return "feather"; }
 
   /// \brief Indicate if the FileSource is supported/readable by this format.
   Status IsSupported(const FileSource& source, bool* supported) const override;
 
+  /// \brief Return the schema of the file if possible.
+  Status Inspect(const FileSource& source, std::shared_ptr<Schema>* out) const override;
+
   /// \brief Open a file for scanning
   Status ScanFile(const FileSource& source, std::shared_ptr<ScanOptions> scan_options,
                   std::shared_ptr<ScanContext> scan_context,
                   ScanTaskIterator* out) const override;
+
+  Status MakeFragment(const FileSource& source, std::shared_ptr<ScanOptions> opts,
+                      std::unique_ptr<DataFragment>* out) override;
+
+  Status MakeWriter(std::shared_ptr<io::OutputStream> destination,
+                    std::shared_ptr<Schema> schema,
+                    std::shared_ptr<FileWriteOptions> options, MemoryPool* pool,
+                    std::unique_ptr<FileWriter>* out) const override;
+};
+
+class ARROW_DS_EXPORT FeatherFragment : public FileBasedDataFragment {
+ public:
+  FeatherFragment(const FileSource& source, std::shared_ptr<FeatherFileFormat> format,
+                  std::shared_ptr<ScanOptions> options)
+      : FileBasedDataFragment(source, std::move(format), std::move(options)) {}
+
+  bool splittable() const override { return false; }
 };
 
 }  // namespace dataset
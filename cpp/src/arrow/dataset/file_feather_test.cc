@@ -0,0 +1,161 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_feather.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/feather.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/generator.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace dataset {
+
+constexpr int64_t kNumRows = 1000;
+
+class TestFeatherFileFormat : public testing::Test {
+ public:
+  std::unique_ptr<FileSource> GetFileSource() {
+    auto batch = ConstantArrayGenerator::Zeroes(kNumRows, schema_);
+
+    std::shared_ptr<io::BufferOutputStream> stream;
+    ARROW_EXPECT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &stream));
+    std::unique_ptr<ipc::feather::TableWriter> writer;
+    ARROW_EXPECT_OK(ipc::feather::TableWriter::Open(stream, &writer));
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      ARROW_EXPECT_OK(writer->Append(batch->column_name(i), *batch->column(i)));
+    }
+    ARROW_EXPECT_OK(writer->Finalize());
+
+    std::shared_ptr<Buffer> buffer;
+    ARROW_EXPECT_OK(stream->Finish(&buffer));
+    return internal::make_unique<FileSource>(std::move(buffer));
+  }
+
+  void Scan(const FileSource& source, std::vector<std::shared_ptr<RecordBatch>>* out) {
+    std::unique_ptr<DataFragment> fragment;
+    ASSERT_OK(format_->MakeFragment(source, opts_, &fragment));
+
+    ScanTaskIterator scan_task_it;
+    ASSERT_OK(fragment->Scan(ctx_, &scan_task_it));
+    for (auto maybe_task : scan_task_it) {
+      ASSERT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+      for (auto maybe_batch : task->Scan()) {
+        ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+        out->push_back(std::move(batch));
+      }
+    }
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_ =
+      schema({field("f64", float64()), field("i32", int32())});
+  std::shared_ptr<FeatherFileFormat> format_ = std::make_shared<FeatherFileFormat>();
+  std::shared_ptr<ScanOptions> opts_ = ScanOptions::Defaults();
+  std::shared_ptr<ScanContext> ctx_ = std::make_shared<ScanContext>();
+};
+
+TEST_F(TestFeatherFileFormat, ScanRecordBatchReader) {
+  auto source = GetFileSource();
+  format_->batch_size = 300;
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  Scan(*source, &batches);
+
+  int64_t row_count = 0;
+  for (const auto& batch : batches) {
+    AssertSchemaEqual(*schema_, *batch->schema());
+    ASSERT_LE(batch->num_rows(), 300);
+    row_count += batch->num_rows();
+  }
+
+  ASSERT_EQ(batches.size(), 4);
+  ASSERT_EQ(row_count, kNumRows);
+}
+
+TEST_F(TestFeatherFileFormat, ScanProjected) {
+  auto source = GetFileSource();
+
+  opts_->schema = schema({field("i32", int32()), field("missing", utf8())});
+  opts_->projector = std::make_shared<RecordBatchProjector>(default_memory_pool(),
+                                                            opts_->schema);
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  Scan(*source, &batches);
+
+  int64_t row_count = 0;
+  for (const auto& batch : batches) {
+    AssertSchemaEqual(*schema({field("i32", int32())}), *batch->schema());
+    row_count += batch->num_rows();
+  }
+
+  ASSERT_EQ(row_count, kNumRows);
+}
+
+TEST_F(TestFeatherFileFormat, ScanOpensFileInTask) {
+  // The file is only opened when the task is executed, so an invalid file is
+  // reported by the task rather than by the fragment.
+  auto buffer = std::make_shared<Buffer>(util::string_view("not a feather file"));
+  FileSource source(buffer);
+  opts_->schema = schema({field("i32", int32())});
+  opts_->projector = std::make_shared<RecordBatchProjector>(default_memory_pool(),
+                                                            opts_->schema);
+
+  std::unique_ptr<DataFragment> fragment;
+  ASSERT_OK(format_->MakeFragment(source, opts_, &fragment));
+
+  ScanTaskIterator scan_task_it;
+  ASSERT_OK(fragment->Scan(ctx_, &scan_task_it));
+  std::unique_ptr<ScanTask> task;
+  ASSERT_OK(scan_task_it.Next(&task));
+  ASSERT_NE(task, nullptr);
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_RAISES(IOError, task->Scan().Next(&batch));
+}
+
+TEST_F(TestFeatherFileFormat, Inspect) {
+  auto source = GetFileSource();
+
+  std::shared_ptr<Schema> actual;
+  ASSERT_OK(format_->Inspect(*source.get(), &actual));
+  AssertSchemaEqual(*schema_, *actual);
+}
+
+TEST_F(TestFeatherFileFormat, IsSupported) {
+  bool supported = false;
+
+  std::shared_ptr<Buffer> buf = std::make_shared<Buffer>(util::string_view(""));
+  ASSERT_OK(format_->IsSupported(FileSource(buf), &supported));
+  ASSERT_EQ(supported, false);
+
+  ASSERT_OK(format_->IsSupported(*GetFileSource(), &supported));
+  ASSERT_EQ(supported, true);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_json.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/dataset/scanner_internal.h"
+#include "arrow/json/chunker.h"
+#include "arrow/json/reader.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/stl.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief A ScanTask backed by a JSON file.
+class JsonScanTask : public ScanTask {
+ public:
+  JsonScanTask(FileSource source, std::shared_ptr<JsonFileFormat> format,
+               json::ParseOptions parse_options, std::shared_ptr<ScanContext> context)
+      : source_(std::move(source)),
+        format_(std::move(format)),
+        parse_options_(std::move(parse_options)),
+        context_(std::move(context)) {}
+
+  RecordBatchIterator Scan() override {
+    // Blocks are converted as the iterator is advanced, so that only one
+    // block of the file is held in memory at a time.
+    std::shared_ptr<json::StreamingReader> reader;
+    auto status = OpenReader(&reader);
+    // Propagate the error as an error iterator.
+    if (!status.ok()) {
+      return MakeErrorIterator<std::shared_ptr<RecordBatch>>(std::move(status));
+    }
+
+    return MakePointerIterator(std::move(reader));
+  }
+
+ private:
+  Status OpenReader(std::shared_ptr<json::StreamingReader>* out) {
+    std::shared_ptr<io::RandomAccessFile> input;
+    RETURN_NOT_OK(source_.Open(&input));
+
+    // Parallelism is provided by the Scanner dispatching ScanTasks.
+    auto read_options = format_->read_options;
+    read_options.use_threads = false;
+
+    return json::StreamingReader::Make(context_->pool, std::move(input), read_options,
+                                       parse_options_, out);
+  }
+
+  FileSource source_;
+  std::shared_ptr<JsonFileFormat> format_;
+  json::ParseOptions parse_options_;
+  std::shared_ptr<ScanContext> context_;
+};
+
+Status JsonFileFormat::IsSupported(const FileSource& source, bool* supported) const {
+  std::shared_ptr<Schema> schema;
+  auto status = Inspect(source, &schema);
+  if (status.IsIOError()) {
+    return status;
+  }
+
+  *supported = status.ok();
+  return Status::OK();
+}
+
+Status JsonFileFormat::Inspect(const FileSource& source,
+                               std::shared_ptr<Schema>* out) const {
+  std::shared_ptr<io::RandomAccessFile> input;
+  RETURN_NOT_OK(source.Open(&input));
+
+  // Only the first block is read, so that inspecting a large file is cheap.
+  std::shared_ptr<Buffer> block;
+  RETURN_NOT_OK(input->Read(read_options.block_size, &block));
+
+  if (block->size() == read_options.block_size) {
+    // The block probably ends with a truncated object; leave it out.
+    std::shared_ptr<Buffer> whole, partial;
+    RETURN_NOT_OK(json::MakeChunker(parse_options)->Process(block, &whole, &partial));
+    if (whole->size() > 0) {
+      block = std::move(whole);
+    }
+  }
+
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(json::ParseOne(parse_options, std::move(block), &batch));
+  *out = batch->schema();
+  return Status::OK();
+}
+
+Status JsonFileFormat::ScanFile(const FileSource& source,
+                                std::shared_ptr<ScanOptions> scan_options,
+                                std::shared_ptr<ScanContext> scan_context,
+                                ScanTaskIterator* out) const {
+  auto parse_options = this->parse_options;
+
+  // Push the projection down to the JSON parser: fields which are not
+  // materialized by the scan are ignored rather than converted.
+  std::vector<std::string> columns;
+  if (MaterializedColumnNames(*scan_options, &columns)) {
+    std::shared_ptr<Schema> file_schema;
+    std::vector<std::shared_ptr<Field>> fields;
+
+    for (const auto& name : columns) {
+      auto field = scan_options->schema ? scan_options->schema->GetFieldByName(name)
+                                        : nullptr;
+      if (field == nullptr) {
+        // Field referenced by the filter only, use the type found in the file.
+        if (file_schema == nullptr) {
+          RETURN_NOT_OK(Inspect(source, &file_schema));
+        }
+        field = file_schema->GetFieldByName(name);
+      }
+      if (field != nullptr) {
+        fields.push_back(std::move(field));
+      }
+    }
+
+    parse_options.explicit_schema = schema(std::move(fields));
+    parse_options.unexpected_field_behavior = json::UnexpectedFieldBehavior::Ignore;
+  }
+
+  std::unique_ptr<ScanTask> task = internal::make_unique<JsonScanTask>(
+      source, std::make_shared<JsonFileFormat>(*this), std::move(parse_options),
+      std::move(scan_context));
+  std::vector<std::unique_ptr<ScanTask>> tasks;
+  tasks.emplace_back(std::move(task));
+  *out = MakeVectorIterator(std::move(tasks));
+  return Status::OK();
+}
+
+Status JsonFileFormat::MakeFragment(const FileSource& source,
+                                    std::shared_ptr<ScanOptions> opts,
+                                    std::unique_ptr<DataFragment>* out) {
+  *out = internal::make_unique<JsonFragment>(
+      source, std::make_shared<JsonFileFormat>(*this), std::move(opts));
+  return Status::OK();
+}
+
+}  // namespace dataset
+}  // namespace arrow
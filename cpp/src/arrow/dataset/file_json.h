@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/type_fwd.h"
@@ -30,31 +31,52 @@ namespace dataset {
 
 class ARROW_DS_EXPORT JsonScanOptions : public FileScanOptions {
  public:
-  ///
-  std::string file_type() const override;
-
- private:
-  json::ParseOptions parse_options_;
-  json::ReadOptions read_options_;
+  std::string file_type() const override { return "json"; }
 };
 
 class ARROW_DS_EXPORT JsonWriteOptions : public FileWriteOptions {
  public:
-  std::string file_type() const override;
+  std::string file_type() const override { return "json"; }
 };
 
-/// \brief A FileFormat implementation that reads from JSON files
+/// \brief A FileFormat implementation that reads from line-delimited JSON files
+///
+/// Each file is scanned by a single ScanTask which yields one RecordBatch per
+/// block of `read_options.block_size` bytes. When the ScanOptions carry a
+/// projection, only the projected and filtered fields are converted.
 class ARROW_DS_EXPORT JsonFileFormat : public FileFormat {
  public:
-  std::string name() const override;
+  /// Options affecting the parsing of JSON files. `explicit_schema` and
+  /// `unexpected_field_behavior` are overridden when the scan is projected.
+  json::ParseOptions parse_options = json::ParseOptions::Defaults();
+  /// Options affecting the reading of JSON files. `use_threads` is ignored:
+  /// parallelism is left to the Scanner.
+  json::ReadOptions read_options = json::ReadOptions::Defaults();
+
+  std::string name() const override { return "json"; }
 
   /// \brief Indicate if the FileSource is supported/readable by this format.
   Status IsSupported(const FileSource& source, bool* supported) const override;
 
+  /// \brief Return the schema of the file, inferred from its first block.
+  Status Inspect(const FileSource& source, std::shared_ptr<Schema>* out) const override;
+
   /// \brief Open a file for scanning
   Status ScanFile(const FileSource& source, std::shared_ptr<ScanOptions> scan_options,
                   std::shared_ptr<ScanContext> scan_context,
                   ScanTaskIterator* out) const override;
+
+  Status MakeFragment(const FileSource& source, std::shared_ptr<ScanOptions> opts,
+                      std::unique_ptr<DataFragment>* out) override;
+};
+
+class ARROW_DS_EXPORT JsonFragment : public FileBasedDataFragment {
+ public:
+  JsonFragment(const FileSource& source, std::shared_ptr<JsonFileFormat> format,
+               std::shared_ptr<ScanOptions> options)
+      : FileBasedDataFragment(source, std::move(format), std::move(options)) {}
+
+  bool splittable() const override { return false; }
 };
 
 }  // namespace dataset
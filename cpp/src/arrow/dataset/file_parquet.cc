@@ -17,7 +17,10 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <cmath>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -25,12 +28,16 @@
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/range.h"
 #include "arrow/util/stl.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
+#include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/file_reader.h"
+#include "parquet/properties.h"
 #include "parquet/statistics.h"
 
 namespace arrow {
@@ -40,6 +47,8 @@ using parquet::arrow::SchemaField;
 using parquet::arrow::SchemaManifest;
 using parquet::arrow::StatisticsAsScalars;
 
+using internal::checked_cast;
+
 /// \brief A ScanTask backed by a parquet file and a RowGroup within a parquet file.
 class ParquetScanTask : public ScanTask {
  public:
@@ -83,15 +92,226 @@ class ParquetScanTask : public ScanTask {
   std::shared_ptr<ScanContext> context_;
 };
 
-// Skip RowGroups with a filter and metadata
+// Hash a value as it would be stored in a column chunk of physical type INT32
+// or INT64. Return false if the value can't be looked up in a Bloom filter.
+static bool HashIntegerValue(const parquet::BloomFilter& filter,
+                             const parquet::ColumnDescriptor& descr, int64_t value,
+                             uint64_t* out) {
+  switch (descr.physical_type()) {
+    case parquet::Type::INT32:
+      *out = filter.Hash(static_cast<int32_t>(value));
+      return true;
+    case parquet::Type::INT64:
+      *out = filter.Hash(value);
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Hash the i-th value of an array as it would be stored in a column chunk. The
+// array must have the type of the column as read by parquet::arrow. Return false
+// if the value can't be looked up in a Bloom filter.
+static bool HashValue(const parquet::BloomFilter& filter,
+                      const parquet::ColumnDescriptor& descr, const Array& values,
+                      int64_t i, uint64_t* out) {
+  switch (values.type_id()) {
+    case Type::INT8:
+      return HashIntegerValue(filter, descr,
+                              checked_cast<const Int8Array&>(values).Value(i), out);
+    case Type::INT16:
+      return HashIntegerValue(filter, descr,
+                              checked_cast<const Int16Array&>(values).Value(i), out);
+    case Type::INT32:
+      return HashIntegerValue(filter, descr,
+                              checked_cast<const Int32Array&>(values).Value(i), out);
+    case Type::INT64:
+      return HashIntegerValue(filter, descr,
+                              checked_cast<const Int64Array&>(values).Value(i), out);
+    case Type::UINT8:
+      return HashIntegerValue(filter, descr,
+                              checked_cast<const UInt8Array&>(values).Value(i), out);
+    case Type::UINT16:
+      return HashIntegerValue(filter, descr,
+                              checked_cast<const UInt16Array&>(values).Value(i), out);
+    case Type::UINT32:
+      return HashIntegerValue(filter, descr,
+                              checked_cast<const UInt32Array&>(values).Value(i), out);
+    case Type::UINT64:
+      return HashIntegerValue(
+          filter, descr,
+          static_cast<int64_t>(checked_cast<const UInt64Array&>(values).Value(i)), out);
+    case Type::DATE32:
+      return HashIntegerValue(filter, descr,
+                              checked_cast<const Date32Array&>(values).Value(i), out);
+    case Type::FLOAT: {
+      // Values equal to zero or NaN have several representations
+      float value = checked_cast<const FloatArray&>(values).Value(i);
+      if (descr.physical_type() != parquet::Type::FLOAT || value == 0 ||
+          std::isnan(value)) {
+        return false;
+      }
+      *out = filter.Hash(value);
+      return true;
+    }
+    case Type::DOUBLE: {
+      double value = checked_cast<const DoubleArray&>(values).Value(i);
+      if (descr.physical_type() != parquet::Type::DOUBLE || value == 0 ||
+          std::isnan(value)) {
+        return false;
+      }
+      *out = filter.Hash(value);
+      return true;
+    }
+    case Type::STRING:
+    case Type::BINARY: {
+      if (descr.physical_type() != parquet::Type::BYTE_ARRAY) {
+        return false;
+      }
+      parquet::ByteArray value(checked_cast<const BinaryArray&>(values).GetView(i));
+      *out = filter.Hash(&value);
+      return true;
+    }
+    case Type::FIXED_SIZE_BINARY: {
+      if (descr.physical_type() != parquet::Type::FIXED_LEN_BYTE_ARRAY) {
+        return false;
+      }
+      parquet::FLBA value(checked_cast<const FixedSizeBinaryArray&>(values).GetValue(i));
+      *out = filter.Hash(&value, static_cast<uint32_t>(descr.type_length()));
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+// Check predicates of a filter against the Bloom filters of a row group's column
+// chunks. Bloom filters are read lazily and cached.
+class RowGroupBloomFilters {
+ public:
+  RowGroupBloomFilters(parquet::ParquetFileReader* reader,
+                       const SchemaManifest* manifest, int row_group)
+      : reader_(reader), manifest_(manifest), row_group_(row_group) {}
+
+  // Return true if the Bloom filters prove that no row satisfies expr
+  bool Excludes(const Expression& expr) {
+    switch (expr.type()) {
+      case ExpressionType::AND: {
+        const auto& and_expr = checked_cast<const AndExpression&>(expr);
+        return Excludes(*and_expr.left_operand()) || Excludes(*and_expr.right_operand());
+      }
+      case ExpressionType::OR: {
+        const auto& or_expr = checked_cast<const OrExpression&>(expr);
+        return Excludes(*or_expr.left_operand()) && Excludes(*or_expr.right_operand());
+      }
+      case ExpressionType::COMPARISON: {
+        const auto& cmp = checked_cast<const ComparisonExpression&>(expr);
+        if (cmp.op() != compute::CompareOperator::EQUAL) {
+          return false;
+        }
+        auto lhs = cmp.left_operand(), rhs = cmp.right_operand();
+        if (lhs->type() == ExpressionType::SCALAR) {
+          std::swap(lhs, rhs);
+        }
+        if (lhs->type() != ExpressionType::FIELD ||
+            rhs->type() != ExpressionType::SCALAR) {
+          return false;
+        }
+        const auto& value = checked_cast<const ScalarExpression&>(*rhs).value();
+        std::shared_ptr<Array> values;
+        if (!value->is_valid || !MakeArrayFromScalar(*value, 1, &values).ok()) {
+          return false;
+        }
+        return ExcludesAll(checked_cast<const FieldExpression&>(*lhs).name(), *values);
+      }
+      case ExpressionType::IN: {
+        const auto& in_expr = checked_cast<const InExpression&>(expr);
+        if (in_expr.operand()->type() != ExpressionType::FIELD) {
+          return false;
+        }
+        const auto& field_expr = checked_cast<const FieldExpression&>(*in_expr.operand());
+        return ExcludesAll(field_expr.name(), *in_expr.set());
+      }
+      default:
+        return false;
+    }
+  }
+
+ private:
+  // Return true if none of the values is in the named column's chunk
+  bool ExcludesAll(const std::string& name, const Array& values) {
+    int column_index = -1;
+    for (const auto& schema_field : manifest_->schema_fields) {
+      if (schema_field.is_leaf() && schema_field.field->name() == name) {
+        // Values of a different type would have to be cast before hashing
+        if (schema_field.field->type()->Equals(*values.type())) {
+          column_index = schema_field.column_index;
+        }
+        break;
+      }
+    }
+    if (column_index == -1) {
+      return false;
+    }
+
+    const parquet::BloomFilter* filter = GetBloomFilter(column_index);
+    if (filter == nullptr) {
+      return false;
+    }
+    const auto& descr = *reader_->metadata()->schema()->Column(column_index);
+    for (int64_t i = 0; i < values.length(); ++i) {
+      uint64_t hash;
+      if (values.IsNull(i) || !HashValue(*filter, descr, values, i, &hash) ||
+          filter->FindHash(hash)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const parquet::BloomFilter* GetBloomFilter(int column_index) {
+    auto it = filters_.find(column_index);
+    if (it == filters_.end()) {
+      std::unique_ptr<parquet::BloomFilter> filter;
+      try {
+        if (row_group_reader_ == nullptr) {
+          row_group_reader_ = reader_->RowGroup(row_group_);
+        }
+        filter = row_group_reader_->GetColumnBloomFilter(column_index);
+      } catch (const ::parquet::ParquetException&) {
+        // Errors with Bloom filters are ignored and post-filtering will apply.
+      }
+      it = filters_.emplace(column_index, std::move(filter)).first;
+    }
+    return it->second.get();
+  }
+
+  parquet::ParquetFileReader* reader_;
+  const SchemaManifest* manifest_;
+  int row_group_;
+  std::shared_ptr<parquet::RowGroupReader> row_group_reader_;
+  std::unordered_map<int, std::unique_ptr<parquet::BloomFilter>> filters_;
+};
+
+// Skip RowGroups with a filter and metadata, and Bloom filters if present
 class RowGroupSkipper {
  public:
   static constexpr int kIterationDone = -1;
 
   RowGroupSkipper(std::shared_ptr<parquet::FileMetaData> metadata,
-                  std::shared_ptr<Expression> filter)
-      : metadata_(std::move(metadata)), filter_(filter), row_group_idx_(0) {
+                  std::shared_ptr<Expression> filter,
+                  parquet::ParquetFileReader* reader = NULLPTR)
+      : metadata_(std::move(metadata)),
+        filter_(filter),
+        reader_(reader),
+        row_group_idx_(0) {
     num_row_groups_ = metadata_->num_row_groups();
+    if (reader_ != nullptr &&
+        !SchemaManifest::Make(metadata_->schema(), metadata_->key_value_metadata(),
+                             parquet::default_arrow_reader_properties(), &manifest_)
+             .ok()) {
+      reader_ = nullptr;
+    }
   }
 
   int Next() {
@@ -100,7 +320,7 @@ class RowGroupSkipper {
       const auto row_group = metadata_->RowGroup(row_group_idx);
 
       const auto num_rows = row_group->num_rows();
-      if (CanSkip(*row_group)) {
+      if (CanSkip(row_group_idx, *row_group)) {
         rows_skipped_ += num_rows;
         continue;
       }
@@ -112,20 +332,27 @@ class RowGroupSkipper {
   }
 
  private:
-  bool CanSkip(const parquet::RowGroupMetaData& metadata) const {
+  bool CanSkip(int row_group_idx, const parquet::RowGroupMetaData& metadata) const {
+    auto expr = filter_;
     auto maybe_stats_expr = RowGroupStatisticsAsExpression(metadata);
     // Errors with statistics are ignored and post-filtering will apply.
-    if (!maybe_stats_expr.ok()) {
-      return false;
+    if (maybe_stats_expr.ok()) {
+      expr = filter_->Assume(maybe_stats_expr.ValueOrDie());
+      if (expr->IsNull() || expr->Equals(false)) {
+        return true;
+      }
     }
 
-    auto stats_expr = maybe_stats_expr.ValueOrDie();
-    auto expr = filter_->Assume(stats_expr);
-    return (expr->IsNull() || expr->Equals(false));
+    if (reader_ == nullptr) {
+      return false;
+    }
+    return RowGroupBloomFilters(reader_, &manifest_, row_group_idx).Excludes(*expr);
   }
 
   std::shared_ptr<parquet::FileMetaData> metadata_;
   std::shared_ptr<Expression> filter_;
+  parquet::ParquetFileReader* reader_;
+  SchemaManifest manifest_;
   int row_group_idx_;
   int num_row_groups_;
   int64_t rows_skipped_;
@@ -227,14 +454,14 @@ class ParquetScanTaskIterator {
       : options_(std::move(options)),
         context_(std::move(context)),
         column_projection_(std::move(column_projection)),
-        skipper_(std::move(metadata), options_->filter),
-        reader_(std::move(reader)) {}
+        reader_(std::move(reader)),
+        skipper_(std::move(metadata), options_->filter, reader_->parquet_reader()) {}
 
   std::shared_ptr<ScanOptions> options_;
   std::shared_ptr<ScanContext> context_;
   std::vector<int> column_projection_;
-  RowGroupSkipper skipper_;
   std::shared_ptr<parquet::arrow::FileReader> reader_;
+  RowGroupSkipper skipper_;
 };
 
 Status ParquetFileFormat::IsSupported(const FileSource& source, bool* supported) const {
@@ -302,6 +529,57 @@ Status ParquetFileFormat::OpenReader(
   return Status::OK();
 }
 
+/// \brief A FileWriter writing each RecordBatch as one or more Parquet row groups.
+class ParquetFileWriter : public FileWriter {
+ public:
+  ParquetFileWriter(std::unique_ptr<parquet::arrow::FileWriter> writer,
+                    int64_t row_group_size)
+      : writer_(std::move(writer)), row_group_size_(row_group_size) {}
+
+  Status Write(std::shared_ptr<RecordBatch> batch) override {
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(Table::FromRecordBatches({std::move(batch)}, &table));
+    return writer_->WriteTable(*table, row_group_size_);
+  }
+
+  Status Finish() override { return writer_->Close(); }
+
+ private:
+  std::unique_ptr<parquet::arrow::FileWriter> writer_;
+  int64_t row_group_size_;
+};
+
+Status ParquetFileFormat::MakeWriter(std::shared_ptr<io::OutputStream> destination,
+                                     std::shared_ptr<Schema> schema,
+                                     std::shared_ptr<FileWriteOptions> options,
+                                     MemoryPool* pool,
+                                     std::unique_ptr<FileWriter>* out) const {
+  if (options != nullptr && options->file_type() != name()) {
+    return Status::TypeError("Expected write options for format '", name(),
+                             "', got options for '", options->file_type(), "'");
+  }
+  auto parquet_options =
+      options == nullptr
+          ? std::make_shared<ParquetWriteOptions>()
+          : internal::checked_pointer_cast<ParquetWriteOptions>(std::move(options));
+
+  auto properties = parquet_options->writer_properties;
+  if (properties == nullptr) {
+    properties = parquet::default_writer_properties();
+  }
+  auto arrow_properties = parquet_options->arrow_writer_properties;
+  if (arrow_properties == nullptr) {
+    arrow_properties = parquet::default_arrow_writer_properties();
+  }
+
+  std::unique_ptr<parquet::arrow::FileWriter> writer;
+  RETURN_NOT_OK(parquet::arrow::FileWriter::Open(*schema, pool, std::move(destination),
+                                                 properties, arrow_properties, &writer));
+  *out = internal::make_unique<ParquetFileWriter>(std::move(writer),
+                                                  parquet_options->row_group_size);
+  return Status::OK();
+}
+
 static std::shared_ptr<Expression> ColumnChunkStatisticsAsExpression(
     const SchemaField& schema_field, const parquet::RowGroupMetaData& metadata) {
   // For the remaining of this function, failure to extract/parse statistics
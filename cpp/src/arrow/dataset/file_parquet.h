@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -25,8 +26,10 @@
 #include "arrow/dataset/visibility.h"
 
 namespace parquet {
+class ArrowWriterProperties;
 class ParquetFileReader;
 class RowGroupMetaData;
+class WriterProperties;
 }  // namespace parquet
 
 namespace arrow {
@@ -40,9 +43,20 @@ class ARROW_DS_EXPORT ParquetScanOptions : public FileScanOptions {
 class ARROW_DS_EXPORT ParquetWriteOptions : public FileWriteOptions {
  public:
   std::string file_type() const override { return "parquet"; }
+
+  /// Properties of the written Parquet files, the defaults are used if null
+  std::shared_ptr<parquet::WriterProperties> writer_properties;
+
+  /// Arrow-specific writing properties, the defaults are used if null
+  std::shared_ptr<parquet::ArrowWriterProperties> arrow_writer_properties;
+
+  /// Maximum number of rows per written row group
+  int64_t row_group_size = 64 * 1024 * 1024;
 };
 
-/// \brief A FileFormat implementation that reads from Parquet files
+/// \brief A FileFormat implementation that reads from and writes to Parquet files
+///
+/// Every RecordBatch written to a file is stored as one or more row groups.
 class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
  public:
   std::string name() const override { return "parquet"; }
@@ -60,6 +74,11 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
   Status MakeFragment(const FileSource& source, std::shared_ptr<ScanOptions> opts,
                       std::unique_ptr<DataFragment>* out) override;
 
+  Status MakeWriter(std::shared_ptr<io::OutputStream> destination,
+                    std::shared_ptr<Schema> schema,
+                    std::shared_ptr<FileWriteOptions> options, MemoryPool* pool,
+                    std::unique_ptr<FileWriter>* out) const override;
+
  private:
   Status OpenReader(const FileSource& source, MemoryPool* pool,
                     std::unique_ptr<::parquet::ParquetFileReader>* out) const;
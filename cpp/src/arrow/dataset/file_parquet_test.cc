@@ -21,6 +21,7 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/builder.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/test_util.h"
@@ -46,12 +47,12 @@ using parquet::default_writer_properties;
 using parquet::WriterProperties;
 
 using parquet::CreateOutputStream;
-using parquet::arrow::FileWriter;
 using parquet::arrow::WriteTable;
 
 using testing::Pointee;
 
-Status WriteRecordBatch(const RecordBatch& batch, FileWriter* writer) {
+Status WriteRecordBatch(const RecordBatch& batch,
+                        parquet::arrow::FileWriter* writer) {
   auto schema = batch.schema();
   auto size = batch.num_rows();
 
@@ -69,7 +70,8 @@ Status WriteRecordBatch(const RecordBatch& batch, FileWriter* writer) {
   return Status::OK();
 }
 
-Status WriteRecordBatchReader(RecordBatchReader* reader, FileWriter* writer) {
+Status WriteRecordBatchReader(RecordBatchReader* reader,
+                              parquet::arrow::FileWriter* writer) {
   auto schema = reader->schema();
 
   if (!schema->Equals(*writer->schema(), false)) {
@@ -90,9 +92,9 @@ Status WriteRecordBatchReader(
     const std::shared_ptr<WriterProperties>& properties = default_writer_properties(),
     const std::shared_ptr<ArrowWriterProperties>& arrow_properties =
         default_arrow_writer_properties()) {
-  std::unique_ptr<FileWriter> writer;
-  RETURN_NOT_OK(FileWriter::Open(*reader->schema(), pool, sink, properties,
-                                 arrow_properties, &writer));
+  std::unique_ptr<parquet::arrow::FileWriter> writer;
+  RETURN_NOT_OK(parquet::arrow::FileWriter::Open(*reader->schema(), pool, sink,
+                                                 properties, arrow_properties, &writer));
   RETURN_NOT_OK(WriteRecordBatchReader(reader, writer.get()));
   return writer->Close();
 }
@@ -392,5 +394,59 @@ TEST_F(TestParquetFileFormatPushDown, Basic) {
                             kNumRowGroups - 5);
 }
 
+TEST_F(TestParquetFileFormatPushDown, BloomFilter) {
+  // Two row groups holding respectively the even and the odd ids in [0, 100),
+  // so that their statistics overlap and only Bloom filters can tell them apart.
+  constexpr int64_t kNumIds = 100;
+  auto id_schema = schema({field("id", int64())});
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int64_t parity = 0; parity < 2; ++parity) {
+    Int64Builder builder;
+    for (int64_t id = parity; id < kNumIds; id += 2) {
+      ASSERT_OK(builder.Append(id));
+    }
+    std::shared_ptr<Array> ids;
+    ASSERT_OK(builder.Finish(&ids));
+    batches.push_back(RecordBatch::Make(id_schema, ids->length(), {ids}));
+  }
+
+  auto pool = default_memory_pool();
+  auto sink = CreateOutputStream(pool);
+  std::unique_ptr<parquet::arrow::FileWriter> writer;
+  auto properties = WriterProperties::Builder().enable_bloom_filter()->build();
+  ASSERT_OK(parquet::arrow::FileWriter::Open(*id_schema, pool, sink, properties,
+                                             default_arrow_writer_properties(), &writer));
+  for (const auto& batch : batches) {
+    ASSERT_OK(WriteRecordBatch(*batch, writer.get()));
+  }
+  ASSERT_OK(writer->Close());
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(sink->Finish(&buffer));
+
+  auto fragment = std::make_shared<ParquetFragment>(FileSource(buffer), opts_);
+
+  opts_->filter = scalar(true);
+  CountRowsAndBatchesInScan(*fragment, kNumIds, 2);
+
+  opts_->filter = ("id"_ == int64_t(40)).Copy();
+  CountRowsAndBatchesInScan(*fragment, kNumIds / 2, 1);
+  opts_->filter = ("id"_ == int64_t(41)).Copy();
+  CountRowsAndBatchesInScan(*fragment, kNumIds / 2, 1);
+  opts_->filter = ("id"_ == int64_t(40) or "id"_ == int64_t(41)).Copy();
+  CountRowsAndBatchesInScan(*fragment, kNumIds, 2);
+
+  Int64Builder set_builder;
+  ASSERT_OK(set_builder.AppendValues({2, 4, 6}));
+  std::shared_ptr<Array> set;
+  ASSERT_OK(set_builder.Finish(&set));
+  opts_->filter = ("id"_).In(set).Copy();
+  CountRowsAndBatchesInScan(*fragment, kNumIds / 2, 1);
+
+  // The literal type must match the column's for Bloom filters to be used
+  opts_->filter = ("id"_ == int32_t(40)).Copy();
+  CountRowsAndBatchesInScan(*fragment, kNumIds, 2);
+}
+
 }  // namespace dataset
 }  // namespace arrow
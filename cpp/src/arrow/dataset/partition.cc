@@ -19,17 +19,27 @@
 
 #include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/record_batch.h"
 #include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/formatting.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/stl.h"
+#include "arrow/visitor_inline.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace dataset {
 
 Result<std::shared_ptr<Expression>> ConvertPartitionKeys(
@@ -50,6 +60,64 @@ Result<std::shared_ptr<Expression>> ConvertPartitionKeys(
   return and_(subexpressions);
 }
 
+Result<std::string> PartitionScheme::Format(const RecordBatch& keys,
+                                            int64_t row) const {
+  return Status::NotImplemented("formatting paths with partition scheme ", name());
+}
+
+namespace {
+
+// Format a partition key value as parsed back by Scalar::Parse
+class FormatKeyImpl {
+ public:
+  FormatKeyImpl(const Array& array, int64_t row, std::string* out)
+      : array_(array), row_(row), out_(out) {}
+
+  template <typename T, typename Formatter = internal::StringFormatter<T>,
+            typename Value = typename Formatter::value_type>
+  Status Visit(const T&) {
+    const auto& array = checked_cast<const typename TypeTraits<T>::ArrayType&>(array_);
+    return Formatter{array_.type()}(array.Value(row_), [this](util::string_view v) {
+      *out_ = v.to_string();
+      return Status::OK();
+    });
+  }
+
+  Status Visit(const StringType&) {
+    *out_ = checked_cast<const StringArray&>(array_).GetString(row_);
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("formatting partition keys of type ", type);
+  }
+
+ private:
+  const Array& array_;
+  int64_t row_;
+  std::string* out_;
+};
+
+Status FormatKey(const RecordBatch& keys, int64_t row, const Field& field,
+                 std::string* out) {
+  auto column = keys.GetColumnByName(field.name());
+  if (column == nullptr) {
+    return Status::Invalid("no key column for partition field '", field.name(), "'");
+  }
+  if (column->IsNull(row)) {
+    return Status::Invalid("null key for partition field '", field.name(), "'");
+  }
+  FormatKeyImpl impl(*column, row, out);
+  RETURN_NOT_OK(VisitTypeInline(*column->type(), &impl));
+  if (out->empty() || out->find('/') != std::string::npos) {
+    return Status::Invalid("partition key '", *out, "' for field '", field.name(),
+                           "' is not a valid path segment");
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
 Result<std::shared_ptr<Expression>> ConstantPartitionScheme::Parse(
     const std::string& path) const {
   return expression_;
@@ -68,6 +136,15 @@ Result<std::shared_ptr<Expression>> SchemaPartitionScheme::Parse(
   return ConvertPartitionKeys(keys, *schema_);
 }
 
+Result<std::string> SchemaPartitionScheme::Format(const RecordBatch& keys,
+                                                  int64_t row) const {
+  std::vector<std::string> segments(schema_->num_fields());
+  for (int i = 0; i < schema_->num_fields(); i++) {
+    RETURN_NOT_OK(FormatKey(keys, row, *schema_->field(i), &segments[i]));
+  }
+  return fs::internal::JoinAbstractPath(segments);
+}
+
 std::vector<UnconvertedKey> HivePartitionScheme::GetUnconvertedKeys(
     const std::string& path) const {
   auto segments = fs::internal::SplitAbstractPath(path);
@@ -88,6 +165,18 @@ Result<std::shared_ptr<Expression>> HivePartitionScheme::Parse(
   return ConvertPartitionKeys(GetUnconvertedKeys(path), *schema_);
 }
 
+Result<std::string> HivePartitionScheme::Format(const RecordBatch& keys,
+                                                int64_t row) const {
+  std::vector<std::string> segments(schema_->num_fields());
+  for (int i = 0; i < schema_->num_fields(); i++) {
+    const auto& field = schema_->field(i);
+    std::string value;
+    RETURN_NOT_OK(FormatKey(keys, row, *field, &value));
+    segments[i] = field->name() + "=" + value;
+  }
+  return fs::internal::JoinAbstractPath(segments);
+}
+
 Status ApplyPartitionScheme(const PartitionScheme& scheme,
                             std::vector<fs::FileStats> files, PathPartitions* out) {
   return ApplyPartitionScheme(scheme, "", std::move(files), out);
@@ -84,6 +84,21 @@ class ARROW_DS_EXPORT PartitionScheme {
   Status Parse(const std::string& path, std::shared_ptr<Expression>* out) const {
     return Parse(path).Value(out);
   }
+
+  /// \brief The fields which partition keys are drawn from, or null if the scheme
+  /// has no fixed set of fields
+  virtual std::shared_ptr<Schema> schema() const { return NULLPTR; }
+
+  /// \brief Format a partition identifier from partition key values
+  ///
+  /// This is the inverse of Parse: the returned path, relative to the root of a
+  /// partition, parses back to equality expressions on the given keys.
+  ///
+  /// \param[in] keys partition key values, with one column per field of schema()
+  /// (matched by name)
+  /// \param[in] row the row of keys to format
+  /// \return the formatted path
+  virtual Result<std::string> Format(const RecordBatch& keys, int64_t row) const;
 };
 
 /// \brief Trivial partition scheme which yields an expression provided on construction.
@@ -115,7 +130,10 @@ class ARROW_DS_EXPORT SchemaPartitionScheme : public PartitionScheme {
 
   Result<std::shared_ptr<Expression>> Parse(const std::string& path) const override;
 
-  const std::shared_ptr<Schema>& schema() { return schema_; }
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  /// \brief Format one path segment per field of the schema, e.g. "2009/11"
+  Result<std::string> Format(const RecordBatch& keys, int64_t row) const override;
 
  protected:
   std::shared_ptr<Schema> schema_;
@@ -141,7 +159,11 @@ class ARROW_DS_EXPORT HivePartitionScheme : public PartitionScheme {
 
   std::vector<UnconvertedKey> GetUnconvertedKeys(const std::string& path) const;
 
-  const std::shared_ptr<Schema>& schema() { return schema_; }
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  /// \brief Format one $key=$value path segment per field of the schema,
+  /// e.g. "year=2009/month=11"
+  Result<std::string> Format(const RecordBatch& keys, int64_t row) const override;
 
  protected:
   std::shared_ptr<Schema> schema_;
@@ -100,6 +100,34 @@ TEST_F(TestPartitionScheme, Hive) {
   AssertParseError("/alpha=0.0/beta=3.25");  // conversion of "0.0" to int32 fails
 }
 
+TEST_F(TestPartitionScheme, Format) {
+  auto partition_schema = schema({field("alpha", int32()), field("beta", utf8())});
+  auto keys = RecordBatchFromJSON(partition_schema, R"([
+    [0, "hello"],
+    [3, "world"],
+    [null, "x"],
+    [1, "a/b"]
+  ])");
+
+  SchemaPartitionScheme schema_scheme(partition_schema);
+  ASSERT_OK_AND_ASSIGN(auto path, schema_scheme.Format(*keys, 0));
+  ASSERT_EQ(path, "0/hello");
+
+  HivePartitionScheme hive_scheme(partition_schema);
+  ASSERT_OK_AND_ASSIGN(path, hive_scheme.Format(*keys, 1));
+  ASSERT_EQ(path, "alpha=3/beta=world");
+
+  // Formatted paths parse back to the keys
+  scheme_ = std::make_shared<HivePartitionScheme>(partition_schema);
+  AssertParse("/" + path, "alpha"_ == int32_t(3) and "beta"_ == "world");
+
+  ASSERT_RAISES(Invalid, hive_scheme.Format(*keys, 2));  // null key
+  ASSERT_RAISES(Invalid, hive_scheme.Format(*keys, 3));  // separator in key
+
+  HivePartitionScheme missing_scheme(schema({field("gamma", int32())}));
+  ASSERT_RAISES(Invalid, missing_scheme.Format(*keys, 0));
+}
+
 template <typename T>
 void PopFront(size_t n, std::vector<T>* v) {
   std::move(v->begin() + n, v->end(), v->begin());
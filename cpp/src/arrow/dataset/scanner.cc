@@ -18,8 +18,14 @@
 #include "arrow/dataset/scanner.h"
 
 #include <algorithm>
+#include <atomic>
+#include <deque>
+#include <future>
+#include <iterator>
 #include <memory>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/dataset_internal.h"
@@ -86,6 +92,162 @@ ScanTaskIterator SimpleScanner::Scan() {
                                           options_->evaluator, options_->projector);
 }
 
+using ScanTaskVector = std::vector<std::unique_ptr<ScanTask>>;
+using RecordBatchVector = std::vector<std::shared_ptr<RecordBatch>>;
+
+/// \brief Scans up to `readahead` DataFragments concurrently on the ThreadPool,
+/// yielding the ScanTasks of each fragment in order.
+class FragmentReadaheadIterator {
+ public:
+  FragmentReadaheadIterator(DataFragmentIterator fragments,
+                            std::shared_ptr<ScanContext> context, int readahead)
+      : fragments_(std::move(fragments)),
+        context_(std::move(context)),
+        readahead_(readahead) {}
+
+  Status Next(ScanTaskIterator* out) {
+    while (!fragments_done_ && static_cast<int>(pending_.size()) < readahead_) {
+      std::shared_ptr<DataFragment> fragment;
+      RETURN_NOT_OK(fragments_.Next(&fragment));
+      if (fragment == nullptr) {
+        fragments_done_ = true;
+        break;
+      }
+
+      auto context = context_;
+      pending_.push_back(context_->thread_pool->Submit(
+          [fragment, context]() -> Result<ScanTaskVector> {
+            ScanTaskIterator scan_task_it;
+            RETURN_NOT_OK(fragment->Scan(context, &scan_task_it));
+            ScanTaskVector scan_tasks;
+            for (auto maybe_scan_task : scan_task_it) {
+              ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
+              scan_tasks.push_back(std::move(scan_task));
+            }
+            return std::move(scan_tasks);
+          }));
+    }
+
+    if (pending_.empty()) {
+      *out = IterationTraits<ScanTaskIterator>::End();
+      return Status::OK();
+    }
+
+    auto future = std::move(pending_.front());
+    pending_.pop_front();
+    ARROW_ASSIGN_OR_RAISE(auto scan_tasks, future.get());
+    *out = MakeVectorIterator(std::move(scan_tasks));
+    return Status::OK();
+  }
+
+ private:
+  DataFragmentIterator fragments_;
+  std::shared_ptr<ScanContext> context_;
+  int readahead_;
+  bool fragments_done_ = false;
+  std::deque<std::future<Result<ScanTaskVector>>> pending_;
+};
+
+/// \brief Executes ScanTasks ahead of consumption on the ThreadPool, as long as
+/// less than `readahead_bytes` of their RecordBatches wait to be consumed.
+///
+/// The yielded ScanTasks wrap the materialized RecordBatches.
+class ScanTaskReadaheadIterator {
+ public:
+  ScanTaskReadaheadIterator(ScanTaskIterator scan_tasks,
+                            internal::ThreadPool* thread_pool, int64_t readahead_bytes)
+      : scan_tasks_(std::move(scan_tasks)),
+        thread_pool_(thread_pool),
+        max_pending_(std::max(1, thread_pool->GetCapacity())),
+        readahead_bytes_(readahead_bytes),
+        bytes_ready_(std::make_shared<std::atomic<int64_t>>(0)) {}
+
+  Status Next(std::unique_ptr<ScanTask>* out) {
+    RETURN_NOT_OK(Pump());
+    if (pending_.empty()) {
+      *out = nullptr;
+      return Status::OK();
+    }
+
+    auto future = std::move(pending_.front());
+    pending_.pop_front();
+    ARROW_ASSIGN_OR_RAISE(auto batches, future.get());
+    for (const auto& batch : batches) {
+      *bytes_ready_ -= TotalBufferSize(*batch);
+    }
+    *out = internal::make_unique<SimpleScanTask>(std::move(batches));
+
+    // Start the next ScanTasks while the caller consumes this one.
+    return Pump();
+  }
+
+ private:
+  Status Pump() {
+    // At least one ScanTask is always pending, or the iteration would stall.
+    while (!scan_tasks_done_ && static_cast<int>(pending_.size()) < max_pending_ &&
+           (pending_.empty() || bytes_ready_->load() < readahead_bytes_)) {
+      std::unique_ptr<ScanTask> next_task;
+      RETURN_NOT_OK(scan_tasks_.Next(&next_task));
+      if (next_task == nullptr) {
+        scan_tasks_done_ = true;
+        break;
+      }
+
+      std::shared_ptr<ScanTask> scan_task = std::move(next_task);
+      auto bytes_ready = bytes_ready_;
+      pending_.push_back(
+          thread_pool_->Submit([scan_task, bytes_ready]() -> Result<RecordBatchVector> {
+            RecordBatchVector batches;
+            for (auto maybe_batch : scan_task->Scan()) {
+              ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+              *bytes_ready += TotalBufferSize(*batch);
+              batches.push_back(std::move(batch));
+            }
+            return std::move(batches);
+          }));
+    }
+    return Status::OK();
+  }
+
+  ScanTaskIterator scan_tasks_;
+  internal::ThreadPool* thread_pool_;
+  int max_pending_;
+  int64_t readahead_bytes_;
+  // Size of the RecordBatches materialized by pending ScanTasks, shared with the
+  // ThreadPool's tasks.
+  std::shared_ptr<std::atomic<int64_t>> bytes_ready_;
+  bool scan_tasks_done_ = false;
+  std::deque<std::future<Result<RecordBatchVector>>> pending_;
+};
+
+ScanTaskIterator ThreadedScanner::ScanFragments() {
+  auto fragments_it = GetFragmentsFromSources(sources_, options_);
+  // Fragment discovery may block, e.g. when listing a remote directory, do it in
+  // a background thread.
+  auto status = MakeReadaheadIterator(std::move(fragments_it),
+                                      options_->fragment_readahead, &fragments_it);
+  if (!status.ok()) {
+    return MakeErrorIterator<std::unique_ptr<ScanTask>>(std::move(status));
+  }
+
+  // Scanning a fragment may block too, e.g. when reading a file's metadata,
+  // scan several fragments concurrently.
+  Iterator<ScanTaskIterator> scan_task_its(FragmentReadaheadIterator(
+      std::move(fragments_it), context_, options_->fragment_readahead));
+  auto scan_task_it = MakeFlattenIterator(std::move(scan_task_its));
+  return ProjectAndFilterScanTaskIterator(std::move(scan_task_it), options_->filter,
+                                          options_->evaluator, options_->projector);
+}
+
+ScanTaskIterator ThreadedScanner::Scan() {
+  auto scan_task_it = ScanFragments();
+  if (options_->readahead_bytes == 0) {
+    return scan_task_it;
+  }
+  return ScanTaskIterator(ScanTaskReadaheadIterator(
+      std::move(scan_task_it), context_->thread_pool, options_->readahead_bytes));
+}
+
 Status ScanTaskIteratorFromRecordBatch(std::vector<std::shared_ptr<RecordBatch>> batches,
                                        ScanTaskIterator* out) {
   std::unique_ptr<ScanTask> scan_task = internal::make_unique<SimpleScanTask>(batches);
@@ -139,6 +301,20 @@ Status ScannerBuilder::UseThreads(bool use_threads) {
   return Status::OK();
 }
 
+Status ScannerBuilder::Readahead(int fragment_readahead, int64_t readahead_bytes) {
+  if (fragment_readahead <= 0) {
+    return Status::Invalid("fragment_readahead must be strictly positive, got ",
+                           fragment_readahead);
+  }
+  if (readahead_bytes < 0) {
+    return Status::Invalid("readahead_bytes must be positive or 0, got ",
+                           readahead_bytes);
+  }
+  scan_options_->fragment_readahead = fragment_readahead;
+  scan_options_->readahead_bytes = readahead_bytes;
+  return Status::OK();
+}
+
 Status ScannerBuilder::Finish(std::unique_ptr<Scanner>* out) const {
   scan_options_->schema = dataset_->schema();
   if (has_projection_ && !project_columns_.empty()) {
@@ -154,7 +330,11 @@ Status ScannerBuilder::Finish(std::unique_ptr<Scanner>* out) const {
     scan_options_->evaluator = std::make_shared<TreeEvaluator>(scan_context_->pool);
   }
 
-  out->reset(new SimpleScanner(dataset_->sources(), scan_options_, scan_context_));
+  if (scan_options_->use_threads) {
+    out->reset(new ThreadedScanner(dataset_->sources(), scan_options_, scan_context_));
+  } else {
+    out->reset(new SimpleScanner(dataset_->sources(), scan_options_, scan_context_));
+  }
   return Status::OK();
 }
 
@@ -208,5 +388,42 @@ Status Scanner::ToTable(std::shared_ptr<Table>* out) {
   return aggregator.Finish(options_->schema, out);
 }
 
+Status ThreadedScanner::ToTable(std::shared_ptr<Table>* out) {
+  auto task_group = TaskGroup::MakeThreaded(context_->thread_pool);
+
+  // The batches of each ScanTask, in scan order. Appending to a deque doesn't
+  // invalidate references to its elements, which running tasks write to.
+  std::deque<RecordBatchVector> task_batches;
+
+  Status status;
+  for (auto maybe_scan_task : ScanFragments()) {
+    if (!maybe_scan_task.ok()) {
+      status = maybe_scan_task.status();
+      break;
+    }
+    std::shared_ptr<ScanTask> scan_task = std::move(maybe_scan_task).ValueOrDie();
+    task_batches.emplace_back();
+    RecordBatchVector* batches = &task_batches.back();
+    task_group->Append([scan_task, batches] {
+      for (auto maybe_batch : scan_task->Scan()) {
+        ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+        batches->push_back(std::move(batch));
+      }
+      return Status::OK();
+    });
+  }
+
+  // Wait for all tasks to complete, even on error, as they reference task_batches.
+  status &= task_group->Finish();
+  RETURN_NOT_OK(status);
+
+  RecordBatchVector batches;
+  for (auto& scan_task_batches : task_batches) {
+    std::move(scan_task_batches.begin(), scan_task_batches.end(),
+              std::back_inserter(batches));
+  }
+  return Table::FromRecordBatches(options_->schema, batches, out);
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -57,6 +58,13 @@ class ARROW_DS_EXPORT ScanOptions {
   // ScanContext.
   bool use_threads = false;
 
+  // Number of DataFragments a ThreadedScanner scans ahead of consumption.
+  int fragment_readahead = 8;
+
+  // Approximate limit on the size of RecordBatches a ThreadedScanner
+  // materializes ahead of consumption.
+  int64_t readahead_bytes = 64 << 20;
+
   // Filter
   std::shared_ptr<Expression> filter;
   // Evaluator for Filter
@@ -136,9 +144,9 @@ class ARROW_DS_EXPORT Scanner {
   ///
   /// \param[out] out output parameter
   ///
-  /// Use this convenience utility with care. This will serially materialize the
+  /// Use this convenience utility with care. This will materialize the whole
   /// Scan result in memory before creating the Table.
-  Status ToTable(std::shared_ptr<Table>* out);
+  virtual Status ToTable(std::shared_ptr<Table>* out);
 
  protected:
   /// \brief Return a TaskGroup according to ScanContext thread rules.
@@ -172,6 +180,37 @@ class ARROW_DS_EXPORT SimpleScanner : public Scanner {
   ScanTaskIterator Scan() override;
 };
 
+/// \brief ThreadedScanner is a Scanner hiding the latency of fragment discovery
+/// and reads by prefetching on the ScanContext's ThreadPool.
+///
+/// - DataSource::GetFragments is iterated in a background thread.
+/// - Up to `fragment_readahead` DataFragments are scanned concurrently on the
+///   ThreadPool, and their ScanTasks are yielded in order.
+/// - ScanTasks yielded by Scan are executed ahead of consumption on the
+///   ThreadPool. Execution stops once `readahead_bytes` of RecordBatches are
+///   materialized and not yet consumed, the yielded ScanTasks then only wait for
+///   their results.
+/// - ToTable executes all ScanTasks in parallel. The batches of the resulting
+///   Table are in scan order.
+///
+/// Since consuming a ScanTask may wait on the ThreadPool, the iterator returned
+/// by Scan must not be consumed from a task of the same ThreadPool.
+class ARROW_DS_EXPORT ThreadedScanner : public Scanner {
+ public:
+  ThreadedScanner(std::vector<std::shared_ptr<DataSource>> sources,
+                  std::shared_ptr<ScanOptions> options,
+                  std::shared_ptr<ScanContext> context)
+      : Scanner(std::move(sources), std::move(options), std::move(context)) {}
+
+  ScanTaskIterator Scan() override;
+
+  Status ToTable(std::shared_ptr<Table>* out) override;
+
+ private:
+  /// \brief Prefetch fragments, but not the results of ScanTasks.
+  ScanTaskIterator ScanFragments();
+};
+
 /// \brief ScannerBuilder is a factory class to construct a Scanner. It is used
 /// to pass information, notably a potential filter expression and a subset of
 /// columns to materialize.
@@ -209,8 +248,18 @@ class ARROW_DS_EXPORT ScannerBuilder {
 
   /// \brief Indicate if the Scanner should make use of the available
   ///        ThreadPool found in ScanContext;
+  ///
+  /// If true, the built Scanner is a ThreadedScanner.
   Status UseThreads(bool use_threads = true);
 
+  /// \brief Set how far ahead of consumption a ThreadedScanner prefetches.
+  ///
+  /// \param[in] fragment_readahead number of DataFragments scanned ahead, must be
+  ///            strictly positive.
+  /// \param[in] readahead_bytes approximate size of RecordBatches materialized
+  ///            ahead. If 0, ScanTasks are not executed ahead.
+  Status Readahead(int fragment_readahead, int64_t readahead_bytes);
+
   /// \brief Return the constructed now-immutable Scanner object
   Status Finish(std::unique_ptr<Scanner>* out) const;
 
@@ -17,8 +17,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
@@ -56,6 +59,31 @@ static inline RecordBatchIterator ProjectRecordBatch(
   return MakeMaybeMapIterator(project, std::move(it));
 }
 
+/// \brief Collect the names of the columns a scan must materialize, i.e. the
+/// fields of the projected schema followed by the fields referenced by the
+/// filter. Returns false if the scan has no projection, in which case every
+/// column must be materialized.
+static inline bool MaterializedColumnNames(const ScanOptions& options,
+                                           std::vector<std::string>* out) {
+  out->clear();
+  if (options.projector == nullptr) {
+    return false;
+  }
+
+  for (const auto& field : options.projector->schema()->fields()) {
+    out->push_back(field->name());
+  }
+
+  if (options.filter != nullptr) {
+    for (const auto& name : FieldsInExpression(*options.filter)) {
+      if (std::find(out->begin(), out->end(), name) == out->end()) {
+        out->push_back(name);
+      }
+    }
+  }
+  return true;
+}
+
 class FilterAndProjectScanTask : public ScanTask {
  public:
   FilterAndProjectScanTask(std::unique_ptr<ScanTask> task,
@@ -138,6 +138,93 @@ TEST_F(TestSimpleScanner, ToTable) {
   AssertTablesEqual(*expected, *actual);
 }
 
+class TestThreadedScanner : public DatasetFixtureMixin {
+ public:
+  // Sources of fragments yielding batches of distinct lengths, to check ordering
+  std::vector<std::shared_ptr<DataSource>> MakeSources(
+      std::vector<std::shared_ptr<RecordBatch>>* all_batches) {
+    std::vector<std::shared_ptr<DataSource>> sources;
+    int64_t length = 1;
+    for (int i = 0; i < 2; ++i) {
+      DataFragmentVector fragments;
+      for (int j = 0; j < 8; ++j) {
+        std::vector<std::shared_ptr<RecordBatch>> batches;
+        for (int k = 0; k < 3; ++k) {
+          batches.push_back(ConstantArrayGenerator::Zeroes(length++, schema_));
+        }
+        all_batches->insert(all_batches->end(), batches.begin(), batches.end());
+        fragments.push_back(std::make_shared<SimpleDataFragment>(batches));
+      }
+      sources.push_back(std::make_shared<SimpleDataSource>(fragments));
+    }
+    return sources;
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_ =
+      schema({field("i32", int32()), field("f64", float64())});
+};
+
+TEST_F(TestThreadedScanner, Scan) {
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  auto sources = MakeSources(&batches);
+
+  for (int64_t readahead_bytes : {0, 1, 1 << 20}) {
+    options_->fragment_readahead = 3;
+    options_->readahead_bytes = readahead_bytes;
+    ThreadedScanner scanner{sources, options_, ctx_};
+
+    // ScanTasks and their batches are yielded in order
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(MakeRecordBatchReader(batches, schema_, &reader));
+    AssertScannerEquals(reader.get(), &scanner);
+  }
+}
+
+TEST_F(TestThreadedScanner, ToTable) {
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  auto sources = MakeSources(&batches);
+
+  std::shared_ptr<Table> expected, actual;
+  ASSERT_OK(Table::FromRecordBatches(batches, &expected));
+
+  options_->schema = schema_;
+  options_->fragment_readahead = 2;
+  ThreadedScanner scanner{sources, options_, ctx_};
+  ASSERT_OK(scanner.ToTable(&actual));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/true);
+}
+
+class FailingFragment : public DataFragment {
+ public:
+  Status Scan(std::shared_ptr<ScanContext>, ScanTaskIterator*) override {
+    return Status::IOError("Could not scan fragment");
+  }
+
+  bool splittable() const override { return false; }
+};
+
+TEST_F(TestThreadedScanner, Errors) {
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  auto sources = MakeSources(&batches);
+  sources.push_back(std::make_shared<SimpleDataSource>(
+      DataFragmentVector{std::make_shared<FailingFragment>()}));
+
+  options_->schema = schema_;
+  ThreadedScanner scanner{sources, options_, ctx_};
+  std::shared_ptr<Table> table;
+  ASSERT_RAISES(IOError, scanner.ToTable(&table));
+
+  Status status;
+  for (auto maybe_scan_task : scanner.Scan()) {
+    status = maybe_scan_task.status();
+    if (!status.ok()) {
+      break;
+    }
+  }
+  ASSERT_RAISES(IOError, status);
+}
+
 class TestScannerBuilder : public ::testing::Test {
   void SetUp() {
     std::vector<std::shared_ptr<DataSource>> sources;
@@ -171,6 +258,22 @@ TEST_F(TestScannerBuilder, TestProject) {
   ASSERT_RAISES(Invalid, builder.Project({"i8", "not_found_column"}));
 }
 
+TEST_F(TestScannerBuilder, TestUseThreads) {
+  ScannerBuilder builder(dataset_, ctx_);
+  std::unique_ptr<Scanner> scanner;
+
+  ASSERT_OK(builder.Finish(&scanner));
+  ASSERT_NE(dynamic_cast<SimpleScanner*>(scanner.get()), nullptr);
+
+  ASSERT_OK(builder.UseThreads(true));
+  ASSERT_OK(builder.Readahead(4, 1 << 10));
+  ASSERT_OK(builder.Finish(&scanner));
+  ASSERT_NE(dynamic_cast<ThreadedScanner*>(scanner.get()), nullptr);
+
+  ASSERT_RAISES(Invalid, builder.Readahead(0, 1 << 10));
+  ASSERT_RAISES(Invalid, builder.Readahead(4, -1));
+}
+
 TEST_F(TestScannerBuilder, TestFilter) {
   ScannerBuilder builder(dataset_, ctx_);
 
@@ -51,6 +51,7 @@ struct DiscoveryOptions;
 class FileBasedDataFragment;
 class FileFormat;
 class FileScanOptions;
+class FileWriter;
 class FileWriteOptions;
 
 class Expression;
@@ -79,8 +80,9 @@ class ScannerBuilder;
 class ScanTask;
 using ScanTaskIterator = Iterator<std::unique_ptr<ScanTask>>;
 
+struct DatasetWriteOptions;
 class DatasetWriter;
-class WriteContext;
+struct WriteContext;
 class WriteOptions;
 
 }  // namespace dataset
@@ -0,0 +1,304 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/writer.h"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/group_by.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/partition.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/stl.h"
+#include "arrow/util/task_group.h"
+
+namespace arrow {
+namespace dataset {
+
+using internal::TaskGroup;
+
+class DatasetWriter::Impl {
+ public:
+  Impl(DatasetWriteOptions options, std::shared_ptr<WriteContext> context)
+      : options_(std::move(options)), context_(std::move(context)) {}
+
+  Status Init() {
+    if (options_.format == nullptr) {
+      return Status::Invalid("DatasetWriter requires a file format");
+    }
+    if (options_.filesystem == nullptr) {
+      return Status::Invalid("DatasetWriter requires a filesystem");
+    }
+    if (options_.max_open_files < 1) {
+      return Status::Invalid("max_open_files must be at least 1, got ",
+                             options_.max_open_files);
+    }
+    if (options_.max_bytes_per_file < 0) {
+      return Status::Invalid("max_bytes_per_file must be positive or 0, got ",
+                             options_.max_bytes_per_file);
+    }
+    if (options_.partition_scheme != nullptr) {
+      partition_schema_ = options_.partition_scheme->schema();
+      if (partition_schema_ == nullptr) {
+        return Status::Invalid("Partition scheme '", options_.partition_scheme->name(),
+                               "' has no schema of partition fields");
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Write(const std::shared_ptr<RecordBatch>& batch) {
+    if (batch->num_rows() == 0) {
+      return Status::OK();
+    }
+
+    std::vector<std::shared_ptr<RecordBatch>> parts;
+    std::vector<std::string> dirs;
+    RETURN_NOT_OK(Split(batch, &parts, &dirs));
+
+    const int64_t batch_size = TotalBufferSize(*batch);
+
+    // At most max_open_files partitions are written at once, so that their
+    // files can all be open simultaneously.
+    const size_t max_open_files = static_cast<size_t>(options_.max_open_files);
+    for (size_t start = 0; start < parts.size(); start += max_open_files) {
+      const size_t end = std::min(parts.size(), start + max_open_files);
+      const int64_t chunk_start_time = clock_ + 1;
+
+      std::vector<PartitionState*> states;
+      for (size_t i = start; i < end; ++i) {
+        PartitionState* state = &partitions_[dirs[i]];
+        if (state->last_used >= chunk_start_time) {
+          return Status::Invalid("Distinct partition keys were formatted to the same ",
+                                 "path '", dirs[i], "'");
+        }
+        state->dir = dirs[i];
+        state->last_used = ++clock_;
+        states.push_back(state);
+      }
+
+      // Opening files may evict others, do it serially.
+      for (size_t i = 0; i < states.size(); ++i) {
+        if (states[i]->writer == nullptr) {
+          RETURN_NOT_OK(
+              OpenFile(states[i], parts[start + i]->schema(), chunk_start_time));
+        }
+      }
+
+      auto task_group = options_.use_threads && context_->thread_pool != nullptr
+                            ? TaskGroup::MakeThreaded(context_->thread_pool)
+                            : TaskGroup::MakeSerial();
+      for (size_t i = 0; i < states.size(); ++i) {
+        PartitionState* state = states[i];
+        std::shared_ptr<RecordBatch> part = parts[start + i];
+        const int64_t part_size = batch_size * part->num_rows() / batch->num_rows();
+        task_group->Append([state, part, part_size] {
+          RETURN_NOT_OK(state->writer->Write(part));
+          state->bytes_written += part_size;
+          return Status::OK();
+        });
+      }
+      RETURN_NOT_OK(task_group->Finish());
+
+      if (options_.max_bytes_per_file > 0) {
+        for (PartitionState* state : states) {
+          if (state->bytes_written >= options_.max_bytes_per_file) {
+            RETURN_NOT_OK(CloseFile(state));
+          }
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Finish() {
+    Status st;
+    for (auto& name_state : partitions_) {
+      if (name_state.second.writer != nullptr) {
+        // Attempt to close every file, even after an error.
+        st &= CloseFile(&name_state.second);
+      }
+    }
+    return st;
+  }
+
+  const std::vector<std::string>& written_paths() const { return written_paths_; }
+
+ private:
+  struct PartitionState {
+    // Directory of the partition, relative to the base directory
+    std::string dir;
+    bool dir_created = false;
+    std::shared_ptr<io::OutputStream> stream;
+    std::unique_ptr<FileWriter> writer;
+    int64_t bytes_written = 0;
+    int64_t last_used = 0;
+  };
+
+  // Split a batch by partition key values, also yielding the directory of
+  // each partition.
+  Status Split(const std::shared_ptr<RecordBatch>& batch,
+               std::vector<std::shared_ptr<RecordBatch>>* parts,
+               std::vector<std::string>* dirs) {
+    if (partition_schema_ == nullptr) {
+      *parts = {batch};
+      *dirs = {""};
+      return Status::OK();
+    }
+
+    std::vector<int> key_columns;
+    for (const auto& field : partition_schema_->fields()) {
+      int i = batch->schema()->GetFieldIndex(field->name());
+      if (i == -1) {
+        return Status::Invalid("Partition field '", field->name(),
+                               "' not found in RecordBatch with schema ",
+                               batch->schema()->ToString());
+      }
+      key_columns.push_back(i);
+    }
+
+    compute::FunctionContext ctx(context_->pool);
+    std::shared_ptr<RecordBatch> keys;
+    RETURN_NOT_OK(compute::PartitionBy(&ctx, *batch, key_columns, &keys, parts));
+
+    dirs->resize(parts->size());
+    for (size_t i = 0; i < parts->size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE((*dirs)[i], options_.partition_scheme->Format(*keys, i));
+    }
+
+    if (options_.drop_partition_columns) {
+      std::sort(key_columns.begin(), key_columns.end(), std::greater<int>());
+      for (auto& part : *parts) {
+        for (int i : key_columns) {
+          RETURN_NOT_OK(part->RemoveColumn(i, &part));
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  // Open a new file for a partition. If too many files are open, the least
+  // recently used file not written since `min_protected_time` is closed first.
+  Status OpenFile(PartitionState* state, const std::shared_ptr<Schema>& schema,
+                  int64_t min_protected_time) {
+    while (num_open_files_ >= options_.max_open_files) {
+      PartitionState* lru = nullptr;
+      for (auto& name_state : partitions_) {
+        PartitionState* candidate = &name_state.second;
+        if (candidate->writer != nullptr && candidate->last_used < min_protected_time &&
+            (lru == nullptr || candidate->last_used < lru->last_used)) {
+          lru = candidate;
+        }
+      }
+      DCHECK_NE(lru, nullptr);
+      RETURN_NOT_OK(CloseFile(lru));
+    }
+
+    std::string dir = options_.base_dir;
+    if (!state->dir.empty()) {
+      dir = fs::internal::ConcatAbstractPath(dir, state->dir);
+    }
+    if (!state->dir_created && !dir.empty()) {
+      RETURN_NOT_OK(options_.filesystem->CreateDir(dir, /*recursive=*/true));
+      state->dir_created = true;
+    }
+
+    auto basename = options_.basename_prefix + std::to_string(written_paths_.size()) +
+                    "." + options_.format->name();
+    auto path = fs::internal::ConcatAbstractPath(dir, basename);
+    RETURN_NOT_OK(options_.filesystem->OpenOutputStream(path, &state->stream));
+    RETURN_NOT_OK(options_.format->MakeWriter(state->stream, schema,
+                                              options_.file_write_options,
+                                              context_->pool, &state->writer));
+    written_paths_.push_back(std::move(path));
+    ++num_open_files_;
+    return Status::OK();
+  }
+
+  Status CloseFile(PartitionState* state) {
+    auto writer = std::move(state->writer);
+    auto stream = std::move(state->stream);
+    state->bytes_written = 0;
+    --num_open_files_;
+
+    RETURN_NOT_OK(writer->Finish());
+    return stream->Close();
+  }
+
+  DatasetWriteOptions options_;
+  std::shared_ptr<WriteContext> context_;
+  std::shared_ptr<Schema> partition_schema_;
+
+  std::unordered_map<std::string, PartitionState> partitions_;
+  std::vector<std::string> written_paths_;
+  int num_open_files_ = 0;
+  // Incremented each time a partition is written to, for LRU eviction
+  int64_t clock_ = 0;
+};
+
+DatasetWriter::DatasetWriter(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+DatasetWriter::~DatasetWriter() = default;
+
+Status DatasetWriter::Make(DatasetWriteOptions options,
+                           std::shared_ptr<WriteContext> context,
+                           std::unique_ptr<DatasetWriter>* out) {
+  auto impl = internal::make_unique<Impl>(std::move(options), std::move(context));
+  RETURN_NOT_OK(impl->Init());
+  out->reset(new DatasetWriter(std::move(impl)));
+  return Status::OK();
+}
+
+Status DatasetWriter::Write(const std::shared_ptr<RecordBatch>& batch) {
+  return impl_->Write(batch);
+}
+
+Status DatasetWriter::Write(Scanner* scanner) {
+  for (auto maybe_scan_task : scanner->Scan()) {
+    ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
+    for (auto maybe_batch : scan_task->Scan()) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+      RETURN_NOT_OK(impl_->Write(batch));
+    }
+  }
+  return Status::OK();
+}
+
+Status DatasetWriter::Finish() { return impl_->Finish(); }
+
+const std::vector<std::string>& DatasetWriter::written_paths() const {
+  return impl_->written_paths();
+}
+
+}  // namespace dataset
+}  // namespace arrow
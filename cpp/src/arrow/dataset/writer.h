@@ -17,12 +17,16 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace dataset {
@@ -32,5 +36,87 @@ class ARROW_DS_EXPORT WriteOptions {
   virtual ~WriteOptions() = default;
 };
 
+/// \brief Shared state for a write operation
+struct ARROW_DS_EXPORT WriteContext {
+  MemoryPool* pool = arrow::default_memory_pool();
+  internal::ThreadPool* thread_pool = arrow::internal::GetCpuThreadPool();
+};
+
+/// \brief Options controlling the layout of a written dataset
+struct ARROW_DS_EXPORT DatasetWriteOptions {
+  /// The format of the written files
+  std::shared_ptr<FileFormat> format;
+
+  /// Format-specific options, the format's defaults are used if null
+  std::shared_ptr<FileWriteOptions> file_write_options;
+
+  /// The filesystem written to
+  std::shared_ptr<fs::FileSystem> filesystem;
+
+  /// The directory under which files are written
+  std::string base_dir;
+
+  /// The scheme splitting rows into directories. Rows are split on the fields of
+  /// the scheme's schema, matched by name. If null, the dataset is unpartitioned.
+  std::shared_ptr<PartitionScheme> partition_scheme;
+
+  /// Whether partition key columns are dropped from the written files, as their
+  /// values are recoverable from the path
+  bool drop_partition_columns = true;
+
+  /// Maximum number of files simultaneously open for writing. When exceeded, the
+  /// least recently written file is finished and a later write to its partition
+  /// starts a new file.
+  int max_open_files = 64;
+
+  /// Target size of a written file, in bytes of (estimated) in-memory data. A
+  /// file is finished once this is reached. If 0, files are never split.
+  int64_t max_bytes_per_file = 0;
+
+  /// Prefix of written file names, which are completed with a sequence number
+  /// and the format's name, e.g. "part-3.parquet"
+  std::string basename_prefix = "part-";
+
+  /// Whether partitions of a batch are written in parallel
+  bool use_threads = true;
+};
+
+/// \brief Writes RecordBatches to a (possibly partitioned) dataset of files
+///
+/// Each written RecordBatch is split by its partition key values; the rows of each
+/// partition are appended to a file of that partition's directory. Files of
+/// distinct partitions are written concurrently.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+class ARROW_DS_EXPORT DatasetWriter {
+ public:
+  ~DatasetWriter();
+
+  /// \brief Create a DatasetWriter
+  static Status Make(DatasetWriteOptions options, std::shared_ptr<WriteContext> context,
+                     std::unique_ptr<DatasetWriter>* out);
+
+  /// \brief Write the rows of a RecordBatch
+  Status Write(const std::shared_ptr<RecordBatch>& batch);
+
+  /// \brief Write all RecordBatches yielded by a Scanner
+  Status Write(Scanner* scanner);
+
+  /// \brief Finish all files which are still open
+  ///
+  /// The writer must not be used afterwards.
+  Status Finish();
+
+  /// \brief The paths of all files written so far, in creation order
+  const std::vector<std::string>& written_paths() const;
+
+ private:
+  class Impl;
+  explicit DatasetWriter(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace dataset
 }  // namespace arrow
@@ -0,0 +1,210 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/writer.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/dataset/file_feather.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/partition.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/ipc/feather.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace dataset {
+
+using internal::checked_cast;
+
+class TestDatasetWriter : public testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(options_.filesystem,
+                         fs::internal::MockFileSystem::Make(fs::kNoTime, {}));
+    options_.format = std::make_shared<FeatherFileFormat>();
+    options_.base_dir = "base";
+  }
+
+  // A batch of rows {key: i % 4, value: i} for i in [offset, offset + length)
+  std::shared_ptr<RecordBatch> MakeBatch(int64_t offset, int64_t length) {
+    Int32Builder key_builder;
+    Int64Builder value_builder;
+    for (int64_t i = offset; i < offset + length; ++i) {
+      ARROW_EXPECT_OK(key_builder.Append(static_cast<int32_t>(i % 4)));
+      ARROW_EXPECT_OK(value_builder.Append(i));
+    }
+    std::shared_ptr<Array> keys, values;
+    ARROW_EXPECT_OK(key_builder.Finish(&keys));
+    ARROW_EXPECT_OK(value_builder.Finish(&values));
+    return RecordBatch::Make(schema_, length, {keys, values});
+  }
+
+  void MakeWriter() {
+    ASSERT_OK(DatasetWriter::Make(options_, ctx_, &writer_));
+  }
+
+  void ReadFile(const std::string& path, std::shared_ptr<Table>* out) {
+    std::shared_ptr<io::RandomAccessFile> file;
+    ASSERT_OK(options_.filesystem->OpenInputFile(path, &file));
+    std::unique_ptr<ipc::feather::TableReader> reader;
+    ASSERT_OK(ipc::feather::TableReader::Open(file, &reader));
+    ASSERT_OK(reader->Read(out));
+  }
+
+  // Check that every file of a "key" partition only holds the values of its key,
+  // and return the total number of rows
+  void AssertPartitionedFiles(int64_t* num_rows) {
+    *num_rows = 0;
+    for (const auto& path : writer_->written_paths()) {
+      std::shared_ptr<Table> table;
+      ReadFile(path, &table);
+      AssertSchemaEqual(*schema({field("value", int64())}), *table->schema());
+
+      auto key_pos = path.find("key=");
+      ASSERT_NE(key_pos, std::string::npos) << path;
+      int64_t key = std::stoll(path.substr(key_pos + 4));
+      for (const auto& chunk : table->column(0)->chunks()) {
+        const auto& values = checked_cast<const Int64Array&>(*chunk);
+        for (int64_t i = 0; i < values.length(); ++i) {
+          ASSERT_EQ(values.Value(i) % 4, key) << path;
+        }
+      }
+      *num_rows += table->num_rows();
+    }
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_ =
+      schema({field("key", int32()), field("value", int64())});
+  DatasetWriteOptions options_;
+  std::shared_ptr<WriteContext> ctx_ = std::make_shared<WriteContext>();
+  std::unique_ptr<DatasetWriter> writer_;
+};
+
+TEST_F(TestDatasetWriter, Unpartitioned) {
+  MakeWriter();
+  auto batch1 = MakeBatch(0, 10);
+  auto batch2 = MakeBatch(10, 5);
+  ASSERT_OK(writer_->Write(batch1));
+  ASSERT_OK(writer_->Write(batch2));
+  ASSERT_OK(writer_->Finish());
+
+  ASSERT_EQ(writer_->written_paths(), std::vector<std::string>{"base/part-0.feather"});
+  std::shared_ptr<Table> expected, actual;
+  ASSERT_OK(Table::FromRecordBatches({batch1, batch2}, &expected));
+  ReadFile("base/part-0.feather", &actual);
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST_F(TestDatasetWriter, HivePartitioned) {
+  options_.partition_scheme =
+      std::make_shared<HivePartitionScheme>(schema({field("key", int32())}));
+  MakeWriter();
+  ASSERT_OK(writer_->Write(MakeBatch(0, 100)));
+  ASSERT_OK(writer_->Write(MakeBatch(100, 100)));
+  ASSERT_OK(writer_->Finish());
+
+  // One file per partition, appended to by both batches
+  ASSERT_EQ(writer_->written_paths().size(), 4);
+  for (const auto& path : writer_->written_paths()) {
+    ASSERT_EQ(path.find("base/key="), 0) << path;
+  }
+  int64_t num_rows;
+  AssertPartitionedFiles(&num_rows);
+  ASSERT_EQ(num_rows, 200);
+}
+
+TEST_F(TestDatasetWriter, SchemaPartitioned) {
+  options_.partition_scheme =
+      std::make_shared<SchemaPartitionScheme>(schema({field("key", int32())}));
+  options_.drop_partition_columns = false;
+  MakeWriter();
+  ASSERT_OK(writer_->Write(MakeBatch(0, 3)));
+  ASSERT_OK(writer_->Finish());
+
+  ASSERT_EQ(writer_->written_paths(),
+            (std::vector<std::string>{"base/0/part-0.feather", "base/1/part-1.feather",
+                                      "base/2/part-2.feather"}));
+  std::shared_ptr<Table> table;
+  ReadFile("base/1/part-1.feather", &table);
+  AssertSchemaEqual(*schema_, *table->schema());
+  ASSERT_EQ(table->num_rows(), 1);
+}
+
+TEST_F(TestDatasetWriter, MaxOpenFiles) {
+  options_.partition_scheme =
+      std::make_shared<HivePartitionScheme>(schema({field("key", int32())}));
+  options_.max_open_files = 3;
+  MakeWriter();
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_OK(writer_->Write(MakeBatch(i * 50, 50)));
+  }
+  ASSERT_OK(writer_->Finish());
+
+  // Files are finished to write other partitions, so partitions span several files
+  ASSERT_GT(writer_->written_paths().size(), 4);
+  int64_t num_rows;
+  AssertPartitionedFiles(&num_rows);
+  ASSERT_EQ(num_rows, 200);
+}
+
+TEST_F(TestDatasetWriter, MaxBytesPerFile) {
+  options_.max_bytes_per_file = 1;
+  MakeWriter();
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK(writer_->Write(MakeBatch(i * 10, 10)));
+  }
+  ASSERT_OK(writer_->Finish());
+
+  ASSERT_EQ(writer_->written_paths(),
+            (std::vector<std::string>{"base/part-0.feather", "base/part-1.feather",
+                                      "base/part-2.feather"}));
+  for (const auto& path : writer_->written_paths()) {
+    std::shared_ptr<Table> table;
+    ReadFile(path, &table);
+    ASSERT_EQ(table->num_rows(), 10);
+  }
+}
+
+TEST_F(TestDatasetWriter, Errors) {
+  options_.partition_scheme =
+      std::make_shared<HivePartitionScheme>(schema({field("missing", int32())}));
+  MakeWriter();
+  ASSERT_RAISES(Invalid, writer_->Write(MakeBatch(0, 10)));
+
+  options_.max_open_files = 0;
+  ASSERT_RAISES(Invalid, DatasetWriter::Make(options_, ctx_, &writer_));
+
+  options_.max_open_files = 1;
+  options_.partition_scheme = std::make_shared<ConstantPartitionScheme>(scalar(true));
+  ASSERT_RAISES(Invalid, DatasetWriter::Make(options_, ctx_, &writer_));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -32,6 +32,8 @@
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
@@ -110,6 +112,55 @@ Status RandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
   return Read(nbytes, out);
 }
 
+ReadRangesOptions ReadRangesOptions::Defaults() { return ReadRangesOptions(); }
+
+Status RandomAccessFile::ReadRanges(const std::vector<ReadRange>& ranges,
+                                    const ReadRangesOptions& options,
+                                    std::vector<std::shared_ptr<Buffer>>* out) {
+  for (const auto& range : ranges) {
+    if (range.offset < 0 || range.length < 0) {
+      return Status::Invalid("Invalid read range (offset = ", range.offset,
+                             ", length = ", range.length, ")");
+    }
+  }
+
+  const auto coalesced = internal::CoalesceReadRanges(ranges, options.hole_size_limit,
+                                                      options.range_size_limit);
+  std::vector<std::shared_ptr<Buffer>> buffers(coalesced.size());
+  auto io_pool = internal::GetIOThreadPool();
+  if (coalesced.size() == 1 || io_pool->OwnsThisThread()) {
+    // A single read, or a caller already running on the IO thread pool, which
+    // must not wait on its own pool
+    for (size_t i = 0; i < coalesced.size(); ++i) {
+      RETURN_NOT_OK(ReadAt(coalesced[i].offset, coalesced[i].length, &buffers[i]));
+    }
+  } else if (coalesced.size() > 1) {
+    auto task_group = ::arrow::internal::TaskGroup::MakeThreaded(io_pool);
+    for (size_t i = 0; i < coalesced.size(); ++i) {
+      task_group->Append([this, &coalesced, &buffers, i] {
+        return ReadAt(coalesced[i].offset, coalesced[i].length, &buffers[i]);
+      });
+    }
+    RETURN_NOT_OK(task_group->Finish());
+  }
+
+  out->resize(ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    // The last coalesced range starting at or before the range contains it
+    auto it = std::upper_bound(
+        coalesced.begin(), coalesced.end(), ranges[i].offset,
+        [](int64_t offset, const ReadRange& range) { return offset < range.offset; });
+    DCHECK(it != coalesced.begin());
+    --it;
+    const auto& buffer = buffers[it - coalesced.begin()];
+    const int64_t slice_offset = std::min(ranges[i].offset - it->offset, buffer->size());
+    const int64_t slice_length =
+        std::min(ranges[i].length, buffer->size() - slice_offset);
+    (*out)[i] = SliceBuffer(buffer, slice_offset, slice_length);
+  }
+  return Status::OK();
+}
+
 Status Writable::Write(const std::string& data) {
   return Write(data.c_str(), static_cast<int64_t>(data.size()));
 }
@@ -203,6 +254,51 @@ void CloseFromDestructor(FileInterface* file) {
   }
 }
 
+std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+                                          int64_t hole_size_limit,
+                                          int64_t range_size_limit) {
+  if (ranges.empty()) {
+    return ranges;
+  }
+  std::sort(ranges.begin(), ranges.end(), [](const ReadRange& a, const ReadRange& b) {
+    return a.offset < b.offset || (a.offset == b.offset && a.length < b.length);
+  });
+
+  std::vector<ReadRange> coalesced;
+  ReadRange current = ranges[0];
+  for (size_t i = 1; i < ranges.size(); ++i) {
+    const ReadRange& next = ranges[i];
+    const int64_t current_end = current.offset + current.length;
+    const int64_t merged_end = std::max(current_end, next.offset + next.length);
+    // Overlapping ranges are always merged, so that each range is contained in
+    // a single coalesced range.
+    const bool overlapping = next.offset < current_end;
+    const bool close = next.offset - current_end <= hole_size_limit &&
+                       merged_end - current.offset <= range_size_limit;
+    if (overlapping || close) {
+      current.length = merged_end - current.offset;
+    } else {
+      coalesced.push_back(current);
+      current = next;
+    }
+  }
+  coalesced.push_back(current);
+  return coalesced;
+}
+
+// IO threads mostly wait, so the capacity isn't tied to the number of cores
+static constexpr int kDefaultIOThreadPoolCapacity = 8;
+
+::arrow::internal::ThreadPool* GetIOThreadPool() {
+  static std::shared_ptr<::arrow::internal::ThreadPool> pool = [] {
+    std::shared_ptr<::arrow::internal::ThreadPool> pool;
+    ARROW_CHECK_OK(
+        ::arrow::internal::ThreadPool::Make(kDefaultIOThreadPoolCapacity, &pool));
+    return pool;
+  }();
+  return pool.get();
+}
+
 #ifndef NDEBUG
 
 // Debug mode concurrency checking
@@ -174,6 +174,31 @@ class ARROW_EXPORT InputStream : virtual public FileInterface, virtual public Re
   InputStream() = default;
 };
 
+/// \brief A range of bytes of a file
+struct ARROW_EXPORT ReadRange {
+  int64_t offset;
+  int64_t length;
+
+  friend bool operator==(const ReadRange& left, const ReadRange& right) {
+    return left.offset == right.offset && left.length == right.length;
+  }
+  friend bool operator!=(const ReadRange& left, const ReadRange& right) {
+    return !(left == right);
+  }
+};
+
+/// \brief Options for coalescing the ranges read by RandomAccessFile::ReadRanges
+struct ARROW_EXPORT ReadRangesOptions {
+  /// Ranges separated by at most this many bytes are read at once, i.e. the bytes
+  /// in between are read and discarded rather than issuing a separate read.
+  int64_t hole_size_limit = 8192;
+  /// A read is not extended with another range if it would exceed this many
+  /// bytes. A single range larger than this is still read at once.
+  int64_t range_size_limit = 32 * 1024 * 1024;
+
+  static ReadRangesOptions Defaults();
+};
+
 class ARROW_EXPORT RandomAccessFile : public InputStream, public Seekable {
  public:
   /// Necessary because we hold a std::unique_ptr
@@ -214,6 +239,23 @@ class ARROW_EXPORT RandomAccessFile : public InputStream, public Seekable {
   /// retrieved by calling Buffer::size().
   virtual Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out);
 
+  /// \brief Read several ranges of bytes, coalescing nearby ranges
+  ///
+  /// Ranges are merged according to the options, and the merged ranges are read
+  /// concurrently. The returned buffers are zero-copy slices of the merged reads.
+  /// Ranges may overlap. The default implementation issues ReadAt calls from the
+  /// IO thread pool, which is beneficial when reads have a high latency, e.g.
+  /// on remote filesystems. When called from a task of the IO thread pool, it
+  /// reads the coalesced ranges serially instead of waiting on its own pool.
+  ///
+  /// \param[in] ranges the ranges to read
+  /// \param[in] options options for coalescing ranges
+  /// \param[out] out one buffer per range, in order. As with ReadAt, a buffer is
+  /// shorter than requested if the range extends past the end of the file.
+  virtual Status ReadRanges(const std::vector<ReadRange>& ranges,
+                            const ReadRangesOptions& options,
+                            std::vector<std::shared_ptr<Buffer>>* out);
+
  protected:
   RandomAccessFile();
 
@@ -15,12 +15,16 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -28,6 +32,7 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/slow.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
@@ -288,6 +293,114 @@ TEST(TestRandomAccessFile, GetStream) {
   ASSERT_RAISES(IOError, stream1->Read(1, &bytes_read, buf3));
 }
 
+TEST(TestCoalesceReadRanges, Basics) {
+  auto check = [](std::vector<ReadRange> ranges, std::vector<ReadRange> expected) {
+    ASSERT_EQ(internal::CoalesceReadRanges(std::move(ranges), /*hole_size_limit=*/10,
+                                           /*range_size_limit=*/100),
+              expected);
+  };
+
+  check({}, {});
+  // Unsorted, close ranges are merged
+  check({{110, 11}, {0, 15}, {20, 5}}, {{0, 25}, {110, 11}});
+  // Adjacent and overlapping ranges
+  check({{0, 10}, {10, 10}, {5, 3}, {15, 10}}, {{0, 25}});
+  // Separated by more than the hole size limit
+  check({{0, 10}, {21, 10}}, {{0, 10}, {21, 10}});
+  // Merging would exceed the range size limit
+  check({{0, 60}, {65, 40}}, {{0, 60}, {65, 40}});
+  // Large ranges are still read at once, and overlapping ranges are merged
+  // regardless of the size limit
+  check({{0, 150}, {100, 100}}, {{0, 200}});
+  // Empty ranges
+  check({{5, 0}, {5, 10}, {200, 0}}, {{5, 10}, {200, 0}});
+}
+
+// A BufferReader counting the ReadAt calls
+class CountingBufferReader : public BufferReader {
+ public:
+  using BufferReader::BufferReader;
+
+  std::atomic<int> read_count{0};
+
+ protected:
+  Status DoReadAt(int64_t position, int64_t nbytes,
+                  std::shared_ptr<Buffer>* out) override {
+    ++read_count;
+    return BufferReader::DoReadAt(position, nbytes, out);
+  }
+};
+
+TEST(TestRandomAccessFile, ReadRanges) {
+  std::string data = "data1data2data3data4data5";
+  auto buf = std::make_shared<Buffer>(data);
+  CountingBufferReader file(buf);
+
+  ReadRangesOptions options = ReadRangesOptions::Defaults();
+  options.hole_size_limit = 3;
+  std::vector<std::shared_ptr<Buffer>> out;
+  ASSERT_OK(file.ReadRanges({{20, 5}, {0, 5}, {2, 5}, {10, 4}}, options, &out));
+  ASSERT_EQ(file.read_count, 2);
+
+  ASSERT_EQ(out.size(), 4);
+  AssertBufferEqual(*out[0], "data5");
+  AssertBufferEqual(*out[1], "data1");
+  AssertBufferEqual(*out[2], "ta1da");
+  AssertBufferEqual(*out[3], "data");
+  // Zero-copy slices of the file's buffer
+  for (const auto& range_buffer : out) {
+    ASSERT_GE(range_buffer->data(), buf->data());
+    ASSERT_LE(range_buffer->data() + range_buffer->size(), buf->data() + buf->size());
+  }
+
+  // Ranges past the end of the file are truncated
+  ASSERT_OK(file.ReadRanges({{23, 5}, {30, 1}}, options, &out));
+  AssertBufferEqual(*out[0], "a5");
+  AssertBufferEqual(*out[1], "");
+
+  ASSERT_RAISES(Invalid, file.ReadRanges({{-1, 5}}, options, &out));
+}
+
+TEST(TestRandomAccessFile, ReadRangesFromIOThreadPool) {
+  // A reader recording the threads its reads run on
+  class ThreadRecordingBufferReader : public BufferReader {
+   public:
+    using BufferReader::BufferReader;
+
+    std::mutex mutex;
+    std::set<std::thread::id> thread_ids;
+
+   protected:
+    Status DoReadAt(int64_t position, int64_t nbytes,
+                    std::shared_ptr<Buffer>* out) override {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        thread_ids.insert(std::this_thread::get_id());
+      }
+      return BufferReader::DoReadAt(position, nbytes, out);
+    }
+  };
+
+  std::string data = "data1data2data3data4data5";
+  ThreadRecordingBufferReader file(std::make_shared<Buffer>(data));
+  ReadRangesOptions options = ReadRangesOptions::Defaults();
+  options.hole_size_limit = 0;
+
+  // Called from an IO pool task, the ranges are read on the calling thread
+  std::vector<std::shared_ptr<Buffer>> out;
+  std::thread::id task_thread_id;
+  auto read_ranges = [&]() {
+    task_thread_id = std::this_thread::get_id();
+    return file.ReadRanges({{0, 5}, {10, 5}, {20, 5}}, options, &out);
+  };
+  ASSERT_OK(internal::GetIOThreadPool()->Submit(read_ranges).get());
+  ASSERT_EQ(out.size(), 3);
+  AssertBufferEqual(*out[0], "data1");
+  AssertBufferEqual(*out[1], "data3");
+  AssertBufferEqual(*out[2], "data5");
+  ASSERT_EQ(file.thread_ids, std::set<std::thread::id>{task_thread_id});
+}
+
 TEST(TestMemcopy, ParallelMemcopy) {
 #if defined(ARROW_VALGRIND)
   // Compensate for Valgrind's slowness
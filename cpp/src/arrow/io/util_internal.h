@@ -17,7 +17,11 @@
 
 #pragma once
 
+#include <cstdint>
+#include <vector>
+
 #include "arrow/io/interfaces.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -26,6 +30,20 @@ namespace internal {
 
 ARROW_EXPORT void CloseFromDestructor(FileInterface* file);
 
+/// \brief Merge ranges separated by at most `hole_size_limit` bytes, as long as
+/// the merged range doesn't exceed `range_size_limit` bytes
+///
+/// The returned ranges are sorted by offset and cover all input ranges.
+ARROW_EXPORT std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+                                                       int64_t hole_size_limit,
+                                                       int64_t range_size_limit);
+
+/// \brief Return the process-global thread pool for IO-bound tasks
+///
+/// Unlike the CPU thread pool, its capacity doesn't depend on the number of
+/// cores, since its threads mostly wait on IO.
+ARROW_EXPORT ::arrow::internal::ThreadPool* GetIOThreadPool();
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
@@ -17,18 +17,28 @@
 
 #include "arrow/ipc/dictionary.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <utility>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/buffer.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace ipc {
 
 // ----------------------------------------------------------------------
@@ -134,11 +144,184 @@ Status DictionaryMemo::AddDictionary(int64_t id,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Dictionary deltas
+
+namespace {
+
+// Whether a dictionary has a layout that DeltaStorage can append to
+bool CanAppendInPlace(const Array& array) {
+  if (array.null_count() != 0) {
+    return false;
+  }
+  const DataType& type = *array.type();
+  switch (type.id()) {
+    case Type::NA:
+    case Type::BOOL:
+    case Type::DICTIONARY:
+      return false;
+    case Type::BINARY:
+    case Type::STRING:
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      return true;
+    default:
+      break;
+  }
+  return is_fixed_width(type.id()) &&
+         checked_cast<const FixedWidthType&>(type).bit_width() % 8 == 0;
+}
+
+// Make room for `nbytes` more bytes after the first `size` bytes of
+// `*buffer`. When it is full, switch to a new buffer at least twice as large;
+// arrays viewing the old buffer keep it alive and unchanged.
+Status Reserve(MemoryPool* pool, int64_t size, int64_t nbytes,
+               std::shared_ptr<Buffer>* buffer) {
+  if (*buffer != nullptr && size + nbytes <= (*buffer)->capacity()) {
+    return Status::OK();
+  }
+  std::shared_ptr<Buffer> new_buffer;
+  RETURN_NOT_OK(AllocateBuffer(pool, std::max(size + nbytes, 2 * size), &new_buffer));
+  if (size > 0) {
+    std::memcpy(new_buffer->mutable_data(), (*buffer)->data(), static_cast<size_t>(size));
+  }
+  *buffer = std::move(new_buffer);
+  return Status::OK();
+}
+
+Status AppendBytes(MemoryPool* pool, const uint8_t* data, int64_t nbytes,
+                   std::shared_ptr<Buffer>* buffer, int64_t* size) {
+  RETURN_NOT_OK(Reserve(pool, *size, nbytes, buffer));
+  if (nbytes > 0) {
+    std::memcpy((*buffer)->mutable_data() + *size, data, static_cast<size_t>(nbytes));
+  }
+  *size += nbytes;
+  return Status::OK();
+}
+
+}  // namespace
+
+// The buffers of a dictionary that received deltas. They have spare capacity
+// and the dictionary arrays handed out only view a prefix of them, so a delta
+// is appended by writing past the end of every existing view.
+struct DictionaryMemo::DeltaStorage {
+  int64_t length = 0;
+  // Fixed-width values, or binary offsets
+  std::shared_ptr<Buffer> data;
+  int64_t data_size = 0;
+  // Binary value bytes
+  std::shared_ptr<Buffer> values;
+  int64_t values_size = 0;
+
+  Status Append(const ArrayData& array, MemoryPool* pool) {
+    if (array.length == 0) {
+      return Status::OK();
+    }
+    if (is_binary_like(array.type->id())) {
+      RETURN_NOT_OK(AppendBinary<int32_t>(array, pool));
+    } else if (is_large_binary_like(array.type->id())) {
+      RETURN_NOT_OK(AppendBinary<int64_t>(array, pool));
+    } else {
+      const int64_t byte_width =
+          checked_cast<const FixedWidthType&>(*array.type).bit_width() / 8;
+      RETURN_NOT_OK(AppendBytes(pool,
+                                array.buffers[1]->data() + array.offset * byte_width,
+                                array.length * byte_width, &data, &data_size));
+    }
+    length += array.length;
+    return Status::OK();
+  }
+
+  template <typename offset_type>
+  Status AppendBinary(const ArrayData& array, MemoryPool* pool) {
+    if (data_size == 0) {
+      const offset_type zero = 0;
+      RETURN_NOT_OK(AppendBytes(pool, reinterpret_cast<const uint8_t*>(&zero),
+                                sizeof(offset_type), &data, &data_size));
+    }
+    const offset_type* offsets = array.GetValues<offset_type>(1);
+    const int64_t nbytes = offsets[array.length] - offsets[0];
+    if (values_size + nbytes > std::numeric_limits<offset_type>::max()) {
+      return Status::CapacityError("Dictionary delta would overflow binary offsets");
+    }
+
+    const int64_t offsets_size = array.length * sizeof(offset_type);
+    RETURN_NOT_OK(Reserve(pool, data_size, offsets_size, &data));
+    auto out = reinterpret_cast<offset_type*>(data->mutable_data() + data_size);
+    for (int64_t i = 0; i < array.length; ++i) {
+      out[i] = static_cast<offset_type>(values_size + offsets[i + 1] - offsets[0]);
+    }
+    data_size += offsets_size;
+
+    const uint8_t* bytes = nbytes > 0 ? array.buffers[2]->data() + offsets[0] : nullptr;
+    return AppendBytes(pool, bytes, nbytes, &values, &values_size);
+  }
+
+  std::shared_ptr<Array> View(const std::shared_ptr<DataType>& type) const {
+    BufferVector buffers = {nullptr, SliceBuffer(data, 0, data_size)};
+    if (values != nullptr) {
+      buffers.push_back(SliceBuffer(values, 0, values_size));
+    }
+    return MakeArray(ArrayData::Make(type, length, std::move(buffers), /*null_count=*/0));
+  }
+};
+
+Status DictionaryMemo::AddDictionaryDelta(int64_t id, const std::shared_ptr<Array>& delta,
+                                          MemoryPool* pool) {
+  auto it = id_to_dictionary_.find(id);
+  if (it == id_to_dictionary_.end()) {
+    return Status::KeyError("No dictionary with id ", id, " to append a delta to");
+  }
+  std::shared_ptr<Array>& dictionary = it->second;
+  if (!delta->type()->Equals(*dictionary->type())) {
+    return Status::Invalid("Dictionary delta of type ", delta->type()->ToString(),
+                           " does not match dictionary of type ",
+                           dictionary->type()->ToString());
+  }
+  if (delta->length() == 0) {
+    return Status::OK();
+  }
+
+  if (!CanAppendInPlace(*dictionary) || !CanAppendInPlace(*delta)) {
+    id_to_delta_storage_.erase(id);
+    return Concatenate({dictionary, delta}, pool, &dictionary);
+  }
+
+  std::shared_ptr<DeltaStorage>& storage = id_to_delta_storage_[id];
+  Status st;
+  if (storage == nullptr) {
+    // First delta: move the original dictionary to growable buffers
+    storage = std::make_shared<DeltaStorage>();
+    st = storage->Append(*dictionary->data(), pool);
+  }
+  if (st.ok()) {
+    st = storage->Append(*delta->data(), pool);
+  }
+  if (!st.ok()) {
+    id_to_delta_storage_.erase(id);
+    return st;
+  }
+  dictionary = storage->View(dictionary->type());
+  return Status::OK();
+}
+
+Status DictionaryMemo::ReplaceDictionary(int64_t id,
+                                         const std::shared_ptr<Array>& dictionary) {
+  auto it = id_to_dictionary_.find(id);
+  if (it == id_to_dictionary_.end()) {
+    return Status::KeyError("Dictionary with id ", id, " not found");
+  }
+  it->second = dictionary;
+  id_to_delta_storage_.erase(id);
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // CollectDictionaries implementation
 
 struct DictionaryCollector {
   DictionaryMemo* dictionary_memo_;
+  DictionaryVector* dictionaries_;
 
   Status WalkChildren(const DataType& type, const Array& array) {
     for (int i = 0; i < type.num_children(); ++i) {
@@ -149,13 +332,14 @@ struct DictionaryCollector {
   }
 
   Status Visit(const std::shared_ptr<Field>& field, const Array& array) {
-    auto type = array.type();
+    // Walk the field's type, as nested fields are tracked by their address
+    const auto& type = field->type();
     if (type->id() == Type::DICTIONARY) {
       const auto& dict_array = static_cast<const DictionaryArray&>(array);
       auto dictionary = dict_array.dictionary();
       int64_t id = -1;
       RETURN_NOT_OK(dictionary_memo_->GetOrAssignId(field, &id));
-      RETURN_NOT_OK(dictionary_memo_->AddDictionary(id, dictionary));
+      dictionaries_->emplace_back(id, dictionary);
 
       // Traverse the dictionary to gather any nested dictionaries
       const auto& dict_type = static_cast<const DictionaryType&>(*type);
@@ -166,8 +350,7 @@ struct DictionaryCollector {
     return Status::OK();
   }
 
-  Status Collect(const RecordBatch& batch) {
-    const Schema& schema = *batch.schema();
+  Status Collect(const RecordBatch& batch, const Schema& schema) {
     for (int i = 0; i < schema.num_fields(); ++i) {
       RETURN_NOT_OK(Visit(schema.field(i), *batch.column(i)));
     }
@@ -176,8 +359,19 @@ struct DictionaryCollector {
 };
 
 Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo) {
-  DictionaryCollector collector{memo};
-  return collector.Collect(batch);
+  DictionaryVector dictionaries;
+  RETURN_NOT_OK(CollectDictionaries(batch, *batch.schema(), memo, &dictionaries));
+  for (const auto& pair : dictionaries) {
+    RETURN_NOT_OK(memo->AddDictionary(pair.first, pair.second));
+  }
+  return Status::OK();
+}
+
+Status CollectDictionaries(const RecordBatch& batch, const Schema& schema,
+                           DictionaryMemo* memo, DictionaryVector* out) {
+  out->clear();
+  DictionaryCollector collector{memo, out};
+  return collector.Collect(batch, schema);
 }
 
 }  // namespace ipc
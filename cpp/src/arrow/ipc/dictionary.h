@@ -23,6 +23,8 @@
 #include <cstdint>
 #include <memory>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
@@ -33,11 +35,14 @@ namespace arrow {
 class Array;
 class DataType;
 class Field;
+class MemoryPool;
 class RecordBatch;
+class Schema;
 
 namespace ipc {
 
 using DictionaryMap = std::unordered_map<int64_t, std::shared_ptr<Array>>;
+using DictionaryVector = std::vector<std::pair<int64_t, std::shared_ptr<Array>>>;
 
 /// \brief Memoization data structure for assigning id numbers to
 /// dictionaries and tracking their current state through possible
@@ -77,6 +82,19 @@ class ARROW_EXPORT DictionaryMemo {
   /// KeyError if that dictionary already exists
   Status AddDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
 
+  /// \brief Append a delta to the dictionary with a particular id. Returns
+  /// KeyError if there is no dictionary with that id yet
+  ///
+  /// For fixed-width and binary dictionaries without nulls, the appended
+  /// dictionary is kept in buffers with spare capacity, so that later deltas
+  /// only copy their own values. Arrays returned before remain valid.
+  Status AddDictionaryDelta(int64_t id, const std::shared_ptr<Array>& delta,
+                            MemoryPool* pool);
+
+  /// \brief Replace the dictionary with a particular id. Returns KeyError
+  /// if there is no dictionary with that id yet
+  Status ReplaceDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
+
   const DictionaryMap& id_to_dictionary() const { return id_to_dictionary_; }
 
   /// \brief The number of fields tracked in the memo
@@ -84,6 +102,8 @@ class ARROW_EXPORT DictionaryMemo {
   int num_dictionaries() const { return static_cast<int>(id_to_dictionary_.size()); }
 
  private:
+  struct DeltaStorage;
+
   Status AddFieldInternal(int64_t id, const std::shared_ptr<Field>& field);
 
   // Dictionary memory addresses, to track whether a particular
@@ -94,12 +114,24 @@ class ARROW_EXPORT DictionaryMemo {
   DictionaryMap id_to_dictionary_;
   std::unordered_map<int64_t, std::shared_ptr<DataType>> id_to_type_;
 
+  // Growable buffers of the dictionaries which received deltas
+  std::unordered_map<int64_t, std::shared_ptr<DeltaStorage>> id_to_delta_storage_;
+
   ARROW_DISALLOW_COPY_AND_ASSIGN(DictionaryMemo);
 };
 
 ARROW_EXPORT
 Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo);
 
+/// \brief Gather the dictionaries of a record batch with their ids, leaving
+/// the memo's dictionaries unchanged
+///
+/// The ids are those of the fields of `schema`, which the batch must conform
+/// to. Fields not in the memo yet are assigned new ids.
+ARROW_EXPORT
+Status CollectDictionaries(const RecordBatch& batch, const Schema& schema,
+                           DictionaryMemo* memo, DictionaryVector* out);
+
 }  // namespace ipc
 }  // namespace arrow
 
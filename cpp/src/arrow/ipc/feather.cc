@@ -441,6 +441,20 @@ class TableReader::TableReaderImpl {
     return col_meta->name()->str();
   }
 
+  Status ReadSchema(std::shared_ptr<Schema>* out) {
+    std::vector<std::shared_ptr<Field>> fields;
+    for (int i = 0; i < num_columns(); ++i) {
+      const fbs::Column* col_meta = metadata_->column(i);
+      std::shared_ptr<DataType> type;
+      std::shared_ptr<Array> dictionary;
+      RETURN_NOT_OK(GetDataType(col_meta->values(), col_meta->metadata_type(),
+                                col_meta->metadata(), &type, &dictionary));
+      fields.push_back(::arrow::field(GetColumnName(i), type));
+    }
+    *out = schema(fields);
+    return Status::OK();
+  }
+
   Status GetColumn(int i, std::shared_ptr<ChunkedArray>* out) {
     const fbs::Column* col_meta = metadata_->column(i);
 
@@ -546,6 +560,10 @@ int64_t TableReader::num_columns() const { return impl_->num_columns(); }
 
 std::string TableReader::GetColumnName(int i) const { return impl_->GetColumnName(i); }
 
+Status TableReader::ReadSchema(std::shared_ptr<Schema>* out) {
+  return impl_->ReadSchema(out);
+}
+
 Status TableReader::GetColumn(int i, std::shared_ptr<ChunkedArray>* out) {
   return impl_->GetColumn(i, out);
 }
@@ -33,6 +33,7 @@ namespace arrow {
 class Array;
 class ChunkedArray;
 class Status;
+class Schema;
 class Table;
 
 namespace io {
@@ -84,6 +85,12 @@ class ARROW_EXPORT TableReader {
 
   std::string GetColumnName(int i) const;
 
+  /// \brief Return the schema of the file without reading the column values
+  ///
+  /// \param[out] out the returned schema
+  /// \return Status
+  Status ReadSchema(std::shared_ptr<Schema>* out);
+
   /// \brief Read a column from the file as an arrow::ChunkedArray.
   ///
   /// \param[in] i the column index to read
@@ -353,6 +353,20 @@ TEST_F(TestTableReader, ReadNames) {
   AssertTablesEqual(*expected, *result);
 }
 
+TEST_F(TestTableReader, ReadSchema) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::test::MakeIntRecordBatch(&batch));
+
+  ASSERT_OK(writer_->Append("f0", *batch->column(0)));
+  ASSERT_OK(writer_->Append("f1", *batch->column(1)));
+  Finish();
+
+  std::shared_ptr<Schema> result;
+  ASSERT_OK(reader_->ReadSchema(&result));
+  auto expected = schema({field("f0", int32()), field("f1", int32())});
+  AssertSchemaEqual(*expected, *result);
+}
+
 class TestTableWriter : public ::testing::Test {
  public:
   void SetUp() {
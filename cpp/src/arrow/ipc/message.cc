@@ -241,8 +241,10 @@ std::string FormatMessageType(Message::Type type) {
   return "unknown";
 }
 
-Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile* file,
-                   std::unique_ptr<Message>* message) {
+// Read the metadata of the message at the given offset, null for EOS
+static Status ReadMetadataAt(int64_t offset, int32_t metadata_length,
+                             io::RandomAccessFile* file,
+                             std::shared_ptr<Buffer>* metadata) {
   ARROW_CHECK_GT(static_cast<size_t>(metadata_length), sizeof(int32_t))
       << "metadata_length should be at least 4";
 
@@ -279,7 +281,7 @@ Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile
 
   if (flatbuffer_length == 0) {
     // EOS
-    *message = nullptr;
+    *metadata = nullptr;
     return Status::OK();
   }
 
@@ -289,11 +291,34 @@ Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile
                            ", metadata length: ", metadata_length);
   }
 
-  std::shared_ptr<Buffer> metadata =
-      SliceBuffer(buffer, prefix_size, buffer->size() - prefix_size);
+  *metadata = SliceBuffer(buffer, prefix_size, buffer->size() - prefix_size);
+  return Status::OK();
+}
+
+Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile* file,
+                   std::unique_ptr<Message>* message) {
+  std::shared_ptr<Buffer> metadata;
+  RETURN_NOT_OK(ReadMetadataAt(offset, metadata_length, file, &metadata));
+  if (metadata == nullptr) {
+    *message = nullptr;
+    return Status::OK();
+  }
   return Message::ReadFrom(offset + metadata_length, metadata, file, message);
 }
 
+Status ReadMessageMetadata(int64_t offset, int32_t metadata_length,
+                           io::RandomAccessFile* file,
+                           std::unique_ptr<Message>* message) {
+  std::shared_ptr<Buffer> metadata;
+  RETURN_NOT_OK(ReadMetadataAt(offset, metadata_length, file, &metadata));
+  if (metadata == nullptr) {
+    *message = nullptr;
+    return Status::OK();
+  }
+  RETURN_NOT_OK(MaybeAlignMetadata(&metadata));
+  return Message::Open(metadata, /*body=*/nullptr, message);
+}
+
 Status AlignStream(io::InputStream* stream, int32_t alignment) {
   int64_t position = -1;
   RETURN_NOT_OK(stream->Tell(&position));
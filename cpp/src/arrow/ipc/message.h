@@ -197,6 +197,16 @@ ARROW_EXPORT
 Status ReadMessage(const int64_t offset, const int32_t metadata_length,
                    io::RandomAccessFile* file, std::unique_ptr<Message>* message);
 
+/// \brief Like ReadMessage, but only read the metadata of the message
+///
+/// The message returned has no body. Its body, if any, starts at
+/// offset + metadata_length in the file, so that parts of it can be read
+/// individually.
+ARROW_EXPORT
+Status ReadMessageMetadata(const int64_t offset, const int32_t metadata_length,
+                           io::RandomAccessFile* file,
+                           std::unique_ptr<Message>* message);
+
 /// \brief Advance stream to an 8-byte offset if its position is not a multiple
 /// of 8 already
 /// \param[in] stream an input stream
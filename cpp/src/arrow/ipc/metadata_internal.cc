@@ -35,6 +35,7 @@
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
@@ -858,6 +859,7 @@ Status WriteFBMessage(FBB& fbb, flatbuf::MessageHeader header_type,
 using FieldNodeVector =
     flatbuffers::Offset<flatbuffers::Vector<const flatbuf::FieldNode*>>;
 using BufferVector = flatbuffers::Offset<flatbuffers::Vector<const flatbuf::Buffer*>>;
+using BodyCompressionOffset = flatbuffers::Offset<flatbuf::BodyCompression>;
 
 static Status WriteFieldNodes(FBB& fbb, const std::vector<FieldMetadata>& nodes,
                               FieldNodeVector* out) {
@@ -890,17 +892,41 @@ static Status WriteBuffers(FBB& fbb, const std::vector<BufferMetadata>& buffers,
   return Status::OK();
 }
 
+static Status WriteBodyCompression(FBB& fbb, Compression::type compression,
+                                   BodyCompressionOffset* out) {
+  flatbuf::CompressionType codec;
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      *out = 0;
+      return Status::OK();
+    case Compression::LZ4_FRAME:
+      codec = flatbuf::CompressionType_LZ4_FRAME;
+      break;
+    case Compression::ZSTD:
+      codec = flatbuf::CompressionType_ZSTD;
+      break;
+    default:
+      return Status::Invalid("Unsupported IPC body compression: ",
+                             util::Codec::GetCodecAsString(compression));
+  }
+  *out =
+      flatbuf::CreateBodyCompression(fbb, codec, flatbuf::BodyCompressionMethod_BUFFER);
+  return Status::OK();
+}
+
 static Status MakeRecordBatch(FBB& fbb, int64_t length, int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
-                              RecordBatchOffset* offset) {
+                              Compression::type compression, RecordBatchOffset* offset) {
   FieldNodeVector fb_nodes;
   BufferVector fb_buffers;
+  BodyCompressionOffset fb_compression;
 
   RETURN_NOT_OK(WriteFieldNodes(fbb, nodes, &fb_nodes));
   RETURN_NOT_OK(WriteBuffers(fbb, buffers, &fb_buffers));
+  RETURN_NOT_OK(WriteBodyCompression(fbb, compression, &fb_compression));
 
-  *offset = flatbuf::CreateRecordBatch(fbb, length, fb_nodes, fb_buffers);
+  *offset = flatbuf::CreateRecordBatch(fbb, length, fb_nodes, fb_buffers, fb_compression);
   return Status::OK();
 }
 
@@ -917,10 +943,12 @@ Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
 Status WriteRecordBatchMessage(int64_t length, int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
-  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
+  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, compression,
+                                &record_batch));
   return WriteFBMessage(fbb, flatbuf::MessageHeader_RecordBatch, record_batch.Union(),
                         body_length, out);
 }
@@ -1091,14 +1119,18 @@ Status WriteSparseTensorMessage(const SparseTensor& sparse_tensor, int64_t body_
                         fb_sparse_tensor.Union(), body_length, out);
 }
 
-Status WriteDictionaryMessage(int64_t id, int64_t length, int64_t body_length,
+Status WriteDictionaryMessage(int64_t id, bool is_delta, int64_t length,
+                              int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
                               std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
-  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
-  auto dictionary_batch = flatbuf::CreateDictionaryBatch(fbb, id, record_batch).Union();
+  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, compression,
+                                &record_batch));
+  auto dictionary_batch =
+      flatbuf::CreateDictionaryBatch(fbb, id, record_batch, is_delta).Union();
   return WriteFBMessage(fbb, flatbuf::MessageHeader_DictionaryBatch, dictionary_batch,
                         body_length, out);
 }
@@ -1295,6 +1327,30 @@ Status GetSparseTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>
   }
 }
 
+Status GetCompression(const flatbuf::RecordBatch* batch, Compression::type* out) {
+  const flatbuf::BodyCompression* compression = batch->compression();
+  if (compression == nullptr) {
+    *out = Compression::UNCOMPRESSED;
+    return Status::OK();
+  }
+  if (compression->method() != flatbuf::BodyCompressionMethod_BUFFER) {
+    return Status::Invalid("Unsupported IPC body compression method: ",
+                           static_cast<int>(compression->method()));
+  }
+  switch (compression->codec()) {
+    case flatbuf::CompressionType_LZ4_FRAME:
+      *out = Compression::LZ4_FRAME;
+      break;
+    case flatbuf::CompressionType_ZSTD:
+      *out = Compression::ZSTD;
+      break;
+    default:
+      return Status::Invalid("Unsupported IPC body compression codec: ",
+                             static_cast<int>(compression->codec()));
+  }
+  return Status::OK();
+}
+
 }  // namespace internal
 }  // namespace ipc
 }  // namespace arrow
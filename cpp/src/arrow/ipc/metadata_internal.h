@@ -34,6 +34,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/util/compression.h"
 
 #include "generated/Message_generated.h"
 #include "generated/Schema_generated.h"
@@ -122,6 +123,10 @@ Status GetSparseTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>
                                std::vector<std::string>* dim_names, int64_t* length,
                                SparseTensorFormat::type* sparse_tensor_format_id);
 
+// Extract the body compression codec of a record batch, UNCOMPRESSED if the
+// body isn't compressed
+Status GetCompression(const flatbuf::RecordBatch* batch, Compression::type* out);
+
 static inline Status VerifyMessage(const uint8_t* data, int64_t size,
                                    const flatbuf::Message** out) {
   flatbuffers::Verifier verifier(data, size, /*max_depth=*/128);
@@ -145,6 +150,7 @@ Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
 Status WriteRecordBatchMessage(const int64_t length, const int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out);
 
 Status WriteTensorMessage(const Tensor& tensor, const int64_t buffer_start_offset,
@@ -158,10 +164,11 @@ Status WriteFileFooter(const Schema& schema, const std::vector<FileBlock>& dicti
                        const std::vector<FileBlock>& record_batches,
                        io::OutputStream* out);
 
-Status WriteDictionaryMessage(const int64_t id, const int64_t length,
+Status WriteDictionaryMessage(const int64_t id, const bool is_delta, const int64_t length,
                               const int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
                               std::shared_ptr<Buffer>* out);
 
 static inline Status WriteFlatbufferBuilder(flatbuffers::FlatBufferBuilder& fbb,
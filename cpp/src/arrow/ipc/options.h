@@ -18,7 +18,9 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -44,6 +46,30 @@ struct ARROW_EXPORT IpcOptions {
   /// consisting of a 4-byte prefix instead of 8 byte
   bool write_legacy_ipc_format = false;
 
+  /// \brief Compression codec for the body buffers of record batches and
+  /// dictionaries. Only UNCOMPRESSED, LZ4_FRAME and ZSTD are supported
+  ///
+  /// Buffers which do not compress well are written uncompressed so that
+  /// they can be read without copying.
+  Compression::type compression = Compression::UNCOMPRESSED;
+  int compression_level = util::kUseDefaultCompressionLevel;
+
+  /// \brief Use the global CPU thread pool to compress or decompress the
+  /// buffers of a record batch in parallel
+  ///
+  /// Ignored when reading or writing from a task of the CPU thread pool, whose
+  /// buffers are then processed serially.
+  bool use_threads = true;
+
+  /// \brief Fields to read from record batches, each given by its path of
+  /// child indices from the schema, e.g. {2} for the third top-level field
+  /// and {2, 0} for the first child of that field. Only struct and list
+  /// fields can have their children selected. Empty reads all fields
+  ///
+  /// Readers then return batches and schemas without the other fields,
+  /// whose buffers are not read. The included fields keep their schema order.
+  std::vector<std::vector<int>> included_fields;
+
   static IpcOptions Defaults();
 };
 
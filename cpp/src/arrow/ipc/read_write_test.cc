@@ -16,9 +16,12 @@
 // under the License.
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
+#include <future>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <string>
 
@@ -47,7 +50,9 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/key_value_metadata.h"
+#include "arrow/util/thread_pool.h"
 
 #include "generated/Message_generated.h"  // IWYU pragma: keep
 
@@ -60,6 +65,17 @@ namespace test {
 
 using BatchVector = std::vector<std::shared_ptr<RecordBatch>>;
 
+// The IPC body compression codecs available in this build
+std::vector<Compression::type> AvailableCompressions() {
+  std::vector<Compression::type> compressions;
+  for (auto compression : {Compression::LZ4_FRAME, Compression::ZSTD}) {
+    if (util::Codec::IsAvailable(compression)) {
+      compressions.push_back(compression);
+    }
+  }
+  return compressions;
+}
+
 TEST(TestMessage, Equals) {
   std::string metadata = "foo";
   std::string body = "bar";
@@ -715,9 +731,14 @@ struct FileWriterHelper {
   }
 
   Status ReadBatches(BatchVector* out_batches) {
+    return ReadBatches(IpcOptions::Defaults(), out_batches);
+  }
+
+  Status ReadBatches(const IpcOptions& options, BatchVector* out_batches) {
     auto buf_reader = std::make_shared<io::BufferReader>(buffer_);
     std::shared_ptr<RecordBatchFileReader> reader;
-    RETURN_NOT_OK(RecordBatchFileReader::Open(buf_reader.get(), footer_offset_, &reader));
+    RETURN_NOT_OK(
+        RecordBatchFileReader::Open(buf_reader.get(), footer_offset_, options, &reader));
 
     EXPECT_EQ(num_batches_written_, reader->num_record_batches());
     for (int i = 0; i < num_batches_written_; ++i) {
@@ -756,9 +777,13 @@ struct StreamWriterHelper {
   }
 
   Status ReadBatches(BatchVector* out_batches) {
+    return ReadBatches(IpcOptions::Defaults(), out_batches);
+  }
+
+  Status ReadBatches(const IpcOptions& options, BatchVector* out_batches) {
     auto buf_reader = std::make_shared<io::BufferReader>(buffer_);
     std::shared_ptr<RecordBatchReader> reader;
-    RETURN_NOT_OK(RecordBatchStreamReader::Open(buf_reader, &reader));
+    RETURN_NOT_OK(RecordBatchStreamReader::Open(buf_reader, options, &reader));
     return reader->ReadAll(out_batches);
   }
 
@@ -767,6 +792,15 @@ struct StreamWriterHelper {
   std::shared_ptr<RecordBatchWriter> writer_;
 };
 
+// Make a batch with a single dictionary-encoded column
+std::shared_ptr<RecordBatch> MakeDictionaryBatch(const std::shared_ptr<Array>& dict,
+                                                 const std::string& indices_json) {
+  auto type = dictionary(int32(), dict->type());
+  auto array = std::make_shared<DictionaryArray>(
+      type, ArrayFromJSON(int32(), indices_json), dict);
+  return RecordBatch::Make(schema({field("f0", type)}), array->length(), {array});
+}
+
 // Parameterized mixin with tests for RecordBatchStreamWriter / RecordBatchFileWriter
 
 template <class WriterHelperType>
@@ -815,13 +849,14 @@ class ReaderWriterMixin {
     }
   }
 
-  void TestDictionaryRoundtrip() {
+  void TestDictionaryRoundtrip(const IpcOptions& options = IpcOptions::Defaults()) {
     std::shared_ptr<RecordBatch> batch;
     ASSERT_OK(MakeDictionary(&batch));
 
     BatchVector out_batches;
-    ASSERT_OK(RoundTripHelper({batch}, IpcOptions::Defaults(), &out_batches));
+    ASSERT_OK(RoundTripHelper({batch}, options, &out_batches));
     ASSERT_EQ(out_batches.size(), 1);
+    CompareBatch(*batch, *out_batches[0]);
 
     // TODO(wesm): This was broken in ARROW-3144. I'm not sure how to
     // restore the deduplication logic yet because dictionaries are
@@ -831,6 +866,98 @@ class ReaderWriterMixin {
     // CheckDictionariesDeduplicated(*out_batches[0]);
   }
 
+  void TestDictionaryDeltas() {
+    auto dict1 = ArrayFromJSON(utf8(), R"(["foo", "bar"])");
+    // Extends dict1, so only ["baz", "quux"] is written, as a delta
+    auto dict2 = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz", "quux"])");
+    auto batch1 = MakeDictionaryBatch(dict1, "[0, 1, 1]");
+    auto batch2 = MakeDictionaryBatch(dict2, "[3, 2, null, 0]");
+    // Unchanged dictionary, nothing is written
+    auto batch3 = MakeDictionaryBatch(dict2, "[1]");
+    // Same values in a different array
+    auto batch4 =
+        MakeDictionaryBatch(ArrayFromJSON(utf8(), R"(["foo", "bar", "baz", "quux"])"),
+                            "[2]");
+
+    BatchVector in_batches = {batch1, batch2, batch3, batch4};
+    BatchVector out_batches;
+    ASSERT_OK(RoundTripHelper(in_batches, IpcOptions::Defaults(), &out_batches));
+    ASSERT_EQ(out_batches.size(), in_batches.size());
+
+    for (size_t i = 0; i < in_batches.size(); ++i) {
+      const auto& expected =
+          checked_cast<const DictionaryArray&>(*in_batches[i]->column(0));
+      const auto& actual =
+          checked_cast<const DictionaryArray&>(*out_batches[i]->column(0));
+      AssertArraysEqual(*expected.indices(), *actual.indices());
+      // Files only keep the dictionary with all deltas applied, which is
+      // still valid for earlier batches
+      ASSERT_LE(expected.dictionary()->length(), actual.dictionary()->length());
+      ASSERT_TRUE(actual.dictionary()->RangeEquals(
+          0, expected.dictionary()->length(), 0, *expected.dictionary()));
+    }
+  }
+
+  void TestDictionaryReplacement() {
+    auto batch1 = MakeDictionaryBatch(ArrayFromJSON(utf8(), R"(["foo", "bar"])"), "[0]");
+    auto batch2 = MakeDictionaryBatch(ArrayFromJSON(utf8(), R"(["bar", "foo"])"), "[0]");
+
+    WriterHelper writer_helper;
+    ASSERT_OK(writer_helper.Init(batch1->schema(), IpcOptions::Defaults()));
+    ASSERT_OK(writer_helper.WriteBatch(batch1));
+    ASSERT_RAISES(Invalid, writer_helper.WriteBatch(batch2));
+  }
+
+  void TestIncludedFields() {
+    auto a = ArrayFromJSON(int32(), "[1, 2, null]");
+    auto b = ArrayFromJSON(utf8(), R"(["foo", null, "bar"])");
+    auto x = ArrayFromJSON(int64(), "[4, 5, 6]");
+    auto y = ArrayFromJSON(utf8(), R"(["x", "y", null])");
+    std::shared_ptr<Array> c;
+    ASSERT_OK(StructArray::Make({x, y}, std::vector<std::string>{"x", "y"}).Value(&c));
+    auto d = std::make_shared<DictionaryArray>(dictionary(int8(), utf8()),
+                                               ArrayFromJSON(int8(), "[0, 1, 0]"),
+                                               ArrayFromJSON(utf8(), R"(["p", "q"])"));
+    auto e = std::make_shared<DictionaryArray>(dictionary(int8(), utf8()),
+                                               ArrayFromJSON(int8(), "[1, 0, 1]"),
+                                               ArrayFromJSON(utf8(), R"(["r", "s"])"));
+    auto batch = RecordBatch::Make(
+        schema({field("a", a->type()), field("b", b->type()), field("c", c->type()),
+                field("d", d->type()), field("e", e->type())}),
+        3, {a, b, c, d, e});
+
+    std::shared_ptr<Array> c_y;
+    ASSERT_OK(StructArray::Make({y}, std::vector<std::string>{"y"}).Value(&c_y));
+    auto expected = RecordBatch::Make(schema({field("b", b->type()),
+                                              field("c", c_y->type()),
+                                              field("d", d->type())}),
+                                      3, {b, c_y, d});
+
+    auto options = IpcOptions::Defaults();
+    // Selected fields are returned in schema order
+    options.included_fields = {{3}, {2, 1}, {1}};
+    BatchVector out_batches;
+    ASSERT_OK(RoundTripHelper({batch, batch}, IpcOptions::Defaults(), options,
+                              &out_batches));
+    ASSERT_EQ(out_batches.size(), 2);
+    for (const auto& out_batch : out_batches) {
+      CompareBatch(*expected, *out_batch);
+    }
+
+    // Selecting a whole field includes all its children
+    options.included_fields = {{2, 0}, {2}};
+    ASSERT_OK(RoundTripHelper({batch}, IpcOptions::Defaults(), options, &out_batches));
+    CompareBatch(*RecordBatch::Make(schema({field("c", c->type())}), 3, {c}),
+                 *out_batches[0]);
+
+    options.included_fields = {{5}};
+    ASSERT_RAISES(Invalid, RoundTripHelper({batch}, IpcOptions::Defaults(), options,
+                                           &out_batches));
+    options.included_fields = {{0, 0}};
+    ASSERT_RAISES(Invalid, RoundTripHelper({batch}, IpcOptions::Defaults(), options,
+                                           &out_batches));
+  }
+
   void TestWriteDifferentSchema() {
     // Test writing batches with a different schema than the RecordBatchWriter
     // was initialized with.
@@ -862,13 +989,19 @@ class ReaderWriterMixin {
  private:
   Status RoundTripHelper(const BatchVector& in_batches, const IpcOptions& options,
                          BatchVector* out_batches) {
+    return RoundTripHelper(in_batches, options, options, out_batches);
+  }
+
+  Status RoundTripHelper(const BatchVector& in_batches, const IpcOptions& write_options,
+                         const IpcOptions& read_options, BatchVector* out_batches) {
     WriterHelper writer_helper;
-    RETURN_NOT_OK(writer_helper.Init(in_batches[0]->schema(), options));
+    RETURN_NOT_OK(writer_helper.Init(in_batches[0]->schema(), write_options));
     for (const auto& batch : in_batches) {
       RETURN_NOT_OK(writer_helper.WriteBatch(batch));
     }
     RETURN_NOT_OK(writer_helper.Finish());
-    RETURN_NOT_OK(writer_helper.ReadBatches(out_batches));
+    out_batches->clear();
+    RETURN_NOT_OK(writer_helper.ReadBatches(read_options, out_batches));
     for (const auto& batch : *out_batches) {
       RETURN_NOT_OK(batch->Validate());
     }
@@ -905,6 +1038,13 @@ TEST_P(TestFileFormat, RoundTrip) {
   options.write_legacy_ipc_format = true;
   TestRoundTrip(*GetParam(), options);
   TestZeroLengthRoundTrip(*GetParam(), options);
+
+  for (auto compression : AvailableCompressions()) {
+    options = IpcOptions::Defaults();
+    options.compression = compression;
+    TestRoundTrip(*GetParam(), options);
+    TestZeroLengthRoundTrip(*GetParam(), options);
+  }
 }
 
 TEST_P(TestStreamFormat, RoundTrip) {
@@ -915,6 +1055,14 @@ TEST_P(TestStreamFormat, RoundTrip) {
   options.write_legacy_ipc_format = true;
   TestRoundTrip(*GetParam(), options);
   TestZeroLengthRoundTrip(*GetParam(), options);
+
+  for (auto compression : AvailableCompressions()) {
+    options = IpcOptions::Defaults();
+    options.compression = compression;
+    options.use_threads = false;
+    TestRoundTrip(*GetParam(), options);
+    TestZeroLengthRoundTrip(*GetParam(), options);
+  }
 }
 
 INSTANTIATE_TEST_CASE_P(GenericIpcRoundTripTests, TestIpcRoundTrip, BATCH_CASES());
@@ -958,6 +1106,254 @@ TEST_F(TestStreamFormat, DictionaryRoundTrip) { TestDictionaryRoundtrip(); }
 
 TEST_F(TestFileFormat, DictionaryRoundTrip) { TestDictionaryRoundtrip(); }
 
+TEST_F(TestStreamFormat, DictionaryDeltas) { TestDictionaryDeltas(); }
+
+TEST_F(TestFileFormat, DictionaryDeltas) { TestDictionaryDeltas(); }
+
+TEST_F(TestStreamFormat, DictionaryReplacement) { TestDictionaryReplacement(); }
+
+TEST_F(TestFileFormat, DictionaryReplacement) { TestDictionaryReplacement(); }
+
+TEST_F(TestStreamFormat, IncludedFields) { TestIncludedFields(); }
+
+TEST_F(TestFileFormat, IncludedFields) { TestIncludedFields(); }
+
+// Records the ranges read from a buffer
+class TrackedBufferReader : public io::BufferReader {
+ public:
+  using io::BufferReader::BufferReader;
+
+  std::vector<std::pair<int64_t, int64_t>> read_ranges;
+
+ protected:
+  using io::BufferReader::DoReadAt;
+
+  Status DoReadAt(int64_t position, int64_t nbytes,
+                  std::shared_ptr<Buffer>* out) override {
+    read_ranges.emplace_back(position, nbytes);
+    return io::BufferReader::DoReadAt(position, nbytes, out);
+  }
+};
+
+TEST(TestRecordBatchFileReader, IncludedFieldsOnlyReadSelectedBuffers) {
+  std::vector<int64_t> large_values(1000);
+  std::iota(large_values.begin(), large_values.end(), 0);
+  std::shared_ptr<Array> large, small;
+  ArrayFromVector<Int64Type, int64_t>(large_values, &large);
+  ArrayFromVector<Int8Type, int8_t>(std::vector<int8_t>(1000, 1), &small);
+  auto dict = std::make_shared<DictionaryArray>(dictionary(int8(), utf8()), small,
+                                                ArrayFromJSON(utf8(), R"(["a", "b"])"));
+  auto batch = RecordBatch::Make(schema({field("large", large->type()),
+                                         field("small", small->type()),
+                                         field("dict", dict->type())}),
+                                 1000, {large, small, dict});
+
+  FileWriterHelper writer_helper;
+  ASSERT_OK(writer_helper.Init(batch->schema(), IpcOptions::Defaults()));
+  ASSERT_OK(writer_helper.WriteBatch(batch));
+  ASSERT_OK(writer_helper.Finish());
+
+  auto options = IpcOptions::Defaults();
+  options.included_fields = {{1}};
+  auto file = std::make_shared<TrackedBufferReader>(writer_helper.buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(file, writer_helper.footer_offset_, options,
+                                        &reader));
+  file->read_ranges.clear();
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_OK(reader->ReadRecordBatch(0, &out));
+  ASSERT_EQ(1, out->num_columns());
+  AssertArraysEqual(*small, *out->column(0));
+
+  // Only metadata and the 1000 bytes of "small" were read, and its buffer is
+  // a slice of the file
+  int64_t bytes_read = 0;
+  for (const auto& range : file->read_ranges) {
+    bytes_read += range.second;
+  }
+  ASSERT_LT(bytes_read, 2000);
+  const uint8_t* data = out->column(0)->data()->buffers[1]->data();
+  ASSERT_GE(data, writer_helper.buffer_->data());
+  ASSERT_LT(data, writer_helper.buffer_->data() + writer_helper.buffer_->size());
+
+  // Open the file again without reading its footer
+  auto other_file = std::make_shared<TrackedBufferReader>(writer_helper.buffer_);
+  std::shared_ptr<RecordBatchFileReader> other_reader;
+  ASSERT_OK(RecordBatchFileReader::Open(other_file, reader->footer(),
+                                        IpcOptions::Defaults(), &other_reader));
+  ASSERT_TRUE(other_file->read_ranges.empty());
+  ASSERT_TRUE(other_reader->schema()->Equals(*batch->schema()));
+  ASSERT_EQ(1, other_reader->num_record_batches());
+  ASSERT_OK(other_reader->ReadRecordBatch(0, &out));
+  CompareBatch(*batch, *out);
+}
+
+TEST(TestRecordBatchStreamWriter, DictionaryDeltaOnlyHasNewValues) {
+  auto dict1 = ArrayFromJSON(utf8(), R"(["foo", "bar"])");
+  auto dict2 = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz"])");
+  auto batch1 = MakeDictionaryBatch(dict1, "[0, 1]");
+  auto batch2 = MakeDictionaryBatch(dict2, "[2]");
+
+  std::shared_ptr<io::BufferOutputStream> out;
+  ASSERT_OK(io::BufferOutputStream::Create(0, default_memory_pool(), &out));
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(out.get(), batch1->schema(), &writer));
+  ASSERT_OK(writer->WriteRecordBatch(*batch1));
+  ASSERT_OK(writer->WriteRecordBatch(*batch2));
+  ASSERT_OK(writer->Close());
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(out->Finish(&buffer));
+
+  // Schema, dictionary, batch, delta, batch
+  io::BufferReader buffer_reader(buffer);
+  std::unique_ptr<MessageReader> message_reader = MessageReader::Open(&buffer_reader);
+  std::vector<Message::Type> types;
+  std::vector<bool> is_delta;
+  std::vector<int64_t> lengths;
+  std::unique_ptr<Message> message;
+  while (true) {
+    ASSERT_OK(message_reader->ReadNextMessage(&message));
+    if (message == nullptr) {
+      break;
+    }
+    types.push_back(message->type());
+    if (message->type() == Message::DICTIONARY_BATCH) {
+      const flatbuf::Message* fb_message;
+      ASSERT_OK(internal::VerifyMessage(message->metadata()->data(),
+                                        message->metadata()->size(), &fb_message));
+      auto dictionary_batch = fb_message->header_as_DictionaryBatch();
+      is_delta.push_back(dictionary_batch->isDelta());
+      lengths.push_back(dictionary_batch->data()->length());
+    }
+  }
+  ASSERT_EQ(std::vector<Message::Type>({Message::SCHEMA, Message::DICTIONARY_BATCH,
+                                        Message::RECORD_BATCH, Message::DICTIONARY_BATCH,
+                                        Message::RECORD_BATCH}),
+            types);
+  ASSERT_EQ(std::vector<bool>({false, true}), is_delta);
+  ASSERT_EQ(std::vector<int64_t>({2, 1}), lengths);
+
+  // The first batch still sees the dictionary it was written with
+  io::BufferReader batch_reader(buffer);
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(&batch_reader, &reader));
+  BatchVector batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_EQ(2, batches.size());
+  CompareBatch(*batch1, *batches[0]);
+  CompareBatch(*batch2, *batches[1]);
+}
+
+TEST_F(TestStreamFormat, CompressedDictionaryRoundTrip) {
+  for (auto compression : AvailableCompressions()) {
+    auto options = IpcOptions::Defaults();
+    options.compression = compression;
+    TestDictionaryRoundtrip(options);
+  }
+}
+
+TEST(TestIpcCompression, UnsupportedCodec) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  auto options = IpcOptions::Defaults();
+  options.compression = Compression::GZIP;
+
+  std::shared_ptr<ResizableBuffer> buffer;
+  ASSERT_OK(AllocateResizableBuffer(0, &buffer));
+  io::BufferOutputStream sink(buffer);
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       RecordBatchStreamWriter::Open(&sink, batch->schema(), options));
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*batch));
+}
+
+TEST(TestIpcCompression, IncompressibleBuffersAreNotCopied) {
+  constexpr int64_t kLength = 1 << 14;
+
+  // A highly compressible column and an incompressible one
+  std::shared_ptr<Buffer> zeros, noise;
+  ASSERT_OK(AllocateBuffer(kLength * sizeof(int64_t), &zeros));
+  ASSERT_OK(AllocateBuffer(kLength * sizeof(int64_t), &noise));
+  memset(zeros->mutable_data(), 0, zeros->size());
+  random_bytes(noise->size(), /*seed=*/42, noise->mutable_data());
+  auto schema = ::arrow::schema({field("zeros", int64()), field("noise", int64())});
+  auto batch = RecordBatch::Make(schema, kLength,
+                                 {std::make_shared<Int64Array>(kLength, zeros),
+                                  std::make_shared<Int64Array>(kLength, noise)});
+
+  for (auto compression : AvailableCompressions()) {
+    auto options = IpcOptions::Defaults();
+    options.compression = compression;
+
+    std::shared_ptr<ResizableBuffer> buffer;
+    ASSERT_OK(AllocateResizableBuffer(0, &buffer));
+    io::BufferOutputStream sink(buffer);
+    ASSERT_OK_AND_ASSIGN(auto writer,
+                         RecordBatchStreamWriter::Open(&sink, schema, options));
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+    ASSERT_OK(writer->Close());
+    ASSERT_OK(sink.Close());
+
+    // Only the zeros were compressed
+    ASSERT_LT(buffer->size(), noise->size() + zeros->size() / 2);
+    ASSERT_GT(buffer->size(), noise->size());
+
+    std::shared_ptr<RecordBatchReader> reader;
+    auto source = std::make_shared<io::BufferReader>(buffer);
+    ASSERT_OK(RecordBatchStreamReader::Open(source, &reader));
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(reader->ReadNext(&result));
+    ASSERT_OK(result->Validate());
+    CompareBatch(*batch, *result);
+
+    // The incompressible buffer was read without copying
+    const uint8_t* noise_data = result->column(1)->data()->buffers[1]->data();
+    ASSERT_GE(noise_data, buffer->data());
+    ASSERT_LT(noise_data, buffer->data() + buffer->size());
+  }
+}
+
+TEST(TestIpcCompression, ReadWriteFromCpuThreadPool) {
+  // Reading compressed batches from a task of a single-threaded CPU pool must
+  // not wait on decompression tasks queued behind it
+  const int capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetCpuThreadPoolCapacity(1));
+
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+  for (auto compression : AvailableCompressions()) {
+    auto options = IpcOptions::Defaults();
+    options.compression = compression;
+    ASSERT_TRUE(options.use_threads);
+
+    auto round_trip = [&]() -> Status {
+      std::shared_ptr<ResizableBuffer> buffer;
+      RETURN_NOT_OK(AllocateResizableBuffer(0, &buffer));
+      io::BufferOutputStream sink(buffer);
+      ARROW_ASSIGN_OR_RAISE(
+          auto writer, RecordBatchStreamWriter::Open(&sink, batch->schema(), options));
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+      RETURN_NOT_OK(writer->Close());
+      RETURN_NOT_OK(sink.Close());
+
+      std::shared_ptr<RecordBatchReader> reader;
+      auto source = std::make_shared<io::BufferReader>(buffer);
+      RETURN_NOT_OK(RecordBatchStreamReader::Open(source, &reader));
+      std::shared_ptr<RecordBatch> result;
+      RETURN_NOT_OK(reader->ReadNext(&result));
+      if (!result->Equals(*batch)) {
+        return Status::Invalid("Round-tripped batch differs");
+      }
+      return Status::OK();
+    };
+    auto fut = ::arrow::internal::GetCpuThreadPool()->Submit(round_trip);
+    ASSERT_EQ(std::future_status::ready, fut.wait_for(std::chrono::seconds(30)));
+    ASSERT_OK(fut.get());
+  }
+
+  ASSERT_OK(SetCpuThreadPoolCapacity(capacity));
+}
+
 TEST_F(TestStreamFormat, DifferentSchema) { TestWriteDifferentSchema(); }
 
 TEST_F(TestFileFormat, DifferentSchema) { TestWriteDifferentSchema(); }
@@ -1429,6 +1825,50 @@ TEST(TestDictionaryMemo, ReusedDictionaries) {
   ASSERT_EQ(0, returned_id);
 }
 
+TEST(TestDictionaryMemo, DictionaryDeltas) {
+  DictionaryMemo memo;
+  auto pool = default_memory_pool();
+  auto field1 = field("a", dictionary(int8(), utf8()));
+  auto field2 = field("b", dictionary(int8(), int64()));
+  ASSERT_OK(memo.AddField(0, field1));
+  ASSERT_OK(memo.AddField(1, field2));
+
+  ASSERT_RAISES(KeyError,
+                memo.AddDictionaryDelta(0, ArrayFromJSON(utf8(), R"(["c"])"), pool));
+  ASSERT_OK(memo.AddDictionary(0, ArrayFromJSON(utf8(), R"(["a", "b"])")));
+  ASSERT_RAISES(Invalid,
+                memo.AddDictionaryDelta(0, ArrayFromJSON(int64(), "[1]"), pool));
+
+  std::shared_ptr<Array> dict1, dict2;
+  ASSERT_OK(memo.AddDictionaryDelta(0, ArrayFromJSON(utf8(), R"(["c"])"), pool));
+  ASSERT_OK(memo.GetDictionary(0, &dict1));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b", "c"])"), *dict1);
+
+  auto delta = ArrayFromJSON(utf8(), R"(["x", "d", "e"])")->Slice(1);
+  ASSERT_OK(memo.AddDictionaryDelta(0, delta, pool));
+  ASSERT_OK(memo.GetDictionary(0, &dict2));
+  ASSERT_OK(dict2->Validate());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b", "c", "d", "e"])"), *dict2);
+  // The earlier dictionary is unchanged, and the delta was appended to its
+  // buffers rather than copying them
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b", "c"])"), *dict1);
+  ASSERT_EQ(dict1->data()->buffers[1]->data(), dict2->data()->buffers[1]->data());
+  ASSERT_EQ(dict1->data()->buffers[2]->data(), dict2->data()->buffers[2]->data());
+
+  // Fixed-width values
+  ASSERT_OK(memo.AddDictionary(1, ArrayFromJSON(int64(), "[1, 2]")));
+  ASSERT_OK(memo.AddDictionaryDelta(1, ArrayFromJSON(int64(), "[3]"), pool));
+  ASSERT_OK(memo.AddDictionaryDelta(1, ArrayFromJSON(int64(), "[4, 5]"), pool));
+  ASSERT_OK(memo.GetDictionary(1, &dict1));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 2, 3, 4, 5]"), *dict1);
+
+  // Nulls are concatenated
+  ASSERT_OK(memo.AddDictionaryDelta(1, ArrayFromJSON(int64(), "[null, 7]"), pool));
+  ASSERT_OK(memo.AddDictionaryDelta(1, ArrayFromJSON(int64(), "[8]"), pool));
+  ASSERT_OK(memo.GetDictionary(1, &dict1));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 2, 3, 4, 5, null, 7, 8]"), *dict1);
+}
+
 }  // namespace test
 }  // namespace ipc
 }  // namespace arrow
@@ -19,9 +19,11 @@
 
 #include <cstdint>
 #include <cstring>
+#include <map>
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -34,19 +36,26 @@
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
+#include "arrow/ipc/util.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 #include "generated/File_generated.h"  // IWYU pragma: export
 #include "generated/Message_generated.h"
 #include "generated/Schema_generated.h"
 
+using arrow::internal::checked_cast;
 using arrow::internal::checked_pointer_cast;
 
 namespace arrow {
@@ -96,8 +105,10 @@ Status InvalidMessageType(Message::Type expected, Message::Type actual) {
 /// Accessor class for flatbuffers metadata
 class IpcComponentSource {
  public:
-  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file)
-      : metadata_(metadata), file_(file) {}
+  // Buffer offsets are relative to `body_offset` in the file
+  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file,
+                     int64_t body_offset = 0)
+      : metadata_(metadata), file_(file), body_offset_(body_offset) {}
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
     auto buffers = metadata_->buffers();
@@ -120,7 +131,7 @@ class IpcComponentSource {
             "Buffer ", buffer_index,
             " did not start on 8-byte aligned offset: ", buffer->offset());
       }
-      return file_->ReadAt(buffer->offset(), buffer->length(), out);
+      return file_->ReadAt(body_offset_ + buffer->offset(), buffer->length(), out);
     }
   }
 
@@ -144,6 +155,7 @@ class IpcComponentSource {
  private:
   const flatbuf::RecordBatch* metadata_;
   io::RandomAccessFile* file_;
+  int64_t body_offset_;
 };
 
 /// Bookkeeping struct for loading array objects from their constituent pieces of raw data
@@ -159,18 +171,196 @@ struct ArrayLoaderContext {
   int max_recursion_depth;
 };
 
+// ----------------------------------------------------------------------
+// Field selection, see IpcOptions::included_fields
+
+/// A field selected for reading
+struct FieldSelection {
+  // Whether the whole field is read, otherwise only the selected children
+  bool all = false;
+  std::map<int, FieldSelection> children;
+
+  // The field with the unselected descendants pruned from its type
+  std::shared_ptr<Field> field;
+};
+
+struct ReadSelection {
+  std::map<int, FieldSelection> fields;
+
+  // The schema of the selected fields
+  std::shared_ptr<Schema> schema;
+
+  // The ids of the dictionaries used by the selected fields
+  std::unordered_set<int64_t> dictionary_ids;
+};
+
+static Status AddFieldPath(const std::vector<std::shared_ptr<Field>>& fields,
+                           const std::vector<int>& path, size_t depth,
+                           std::map<int, FieldSelection>* selected) {
+  const int index = path[depth];
+  if (index < 0 || index >= static_cast<int>(fields.size())) {
+    return Status::Invalid("Out of bounds field index ", index,
+                           " in included field path");
+  }
+  FieldSelection* selection = &(*selected)[index];
+  if (depth + 1 == path.size()) {
+    selection->all = true;
+    selection->children.clear();
+    return Status::OK();
+  }
+  if (selection->all) {
+    return Status::OK();
+  }
+  const auto& type = *fields[index]->type();
+  switch (type.id()) {
+    case Type::STRUCT:
+    case Type::LIST:
+    case Type::LARGE_LIST:
+    case Type::FIXED_SIZE_LIST:
+      break;
+    default:
+      return Status::Invalid("Cannot select children of field '", fields[index]->name(),
+                             "' of type ", type.ToString());
+  }
+  return AddFieldPath(type.children(), path, depth + 1, &selection->children);
+}
+
+static void ProjectField(const std::shared_ptr<Field>& field, FieldSelection* selection) {
+  if (selection->all) {
+    selection->field = field;
+    return;
+  }
+  const auto& type = field->type();
+  std::vector<std::shared_ptr<Field>> children;
+  for (auto& pair : selection->children) {
+    ProjectField(type->child(pair.first), &pair.second);
+    children.push_back(pair.second.field);
+  }
+  std::shared_ptr<DataType> projected_type;
+  switch (type->id()) {
+    case Type::STRUCT:
+      projected_type = struct_(children);
+      break;
+    case Type::LIST:
+      projected_type = list(children[0]);
+      break;
+    case Type::LARGE_LIST:
+      projected_type = large_list(children[0]);
+      break;
+    default:
+      projected_type = fixed_size_list(
+          children[0], checked_cast<const FixedSizeListType&>(*type).list_size());
+      break;
+  }
+  selection->field = field->WithType(projected_type);
+}
+
+// Find the dictionary-encoded fields among a field and its descendants
+static void CollectDictionaryFields(
+    const std::shared_ptr<Field>& field, const DictionaryMemo& memo,
+    std::vector<std::pair<int64_t, std::shared_ptr<Field>>>* out) {
+  const DataType* type = field->type().get();
+  if (memo.HasDictionary(*field)) {
+    int64_t id = -1;
+    DCHECK_OK(memo.GetId(*field, &id));
+    out->emplace_back(id, field);
+  }
+  if (type->id() == Type::DICTIONARY) {
+    type = checked_cast<const DictionaryType&>(*type).value_type().get();
+  }
+  for (const auto& child : type->children()) {
+    CollectDictionaryFields(child, memo, out);
+  }
+}
+
+static Status MakeReadSelection(const Schema& schema, const DictionaryMemo* memo,
+                                const std::vector<std::vector<int>>& paths,
+                                std::unique_ptr<ReadSelection>* out) {
+  std::unique_ptr<ReadSelection> selection(new ReadSelection());
+  for (const auto& path : paths) {
+    if (path.empty()) {
+      return Status::Invalid("Empty included field path");
+    }
+    RETURN_NOT_OK(AddFieldPath(schema.fields(), path, 0, &selection->fields));
+  }
+
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::pair<int64_t, std::shared_ptr<Field>>> dictionary_fields;
+  for (auto& pair : selection->fields) {
+    ProjectField(schema.field(pair.first), &pair.second);
+    fields.push_back(pair.second.field);
+    if (memo != nullptr) {
+      // The pruned nested fields aren't in the memo, but they can't be
+      // dictionary-encoded, and their selected leaves are the original fields
+      CollectDictionaryFields(pair.second.field, *memo, &dictionary_fields);
+    }
+  }
+  for (const auto& pair : dictionary_fields) {
+    selection->dictionary_ids.insert(pair.first);
+  }
+  selection->schema = ::arrow::schema(std::move(fields), schema.metadata());
+  *out = std::move(selection);
+  return Status::OK();
+}
+
+// Advance past the field nodes and buffers of a field which isn't read
+static void SkipField(const DataType& type, ArrayLoaderContext* context) {
+  switch (type.id()) {
+    case Type::NA:
+      // ARROW-6379: NullType has no buffers in the IPC payload
+      ++context->field_index;
+      return;
+    case Type::DICTIONARY:
+      // Only the indices are in the record batch
+      SkipField(*checked_cast<const DictionaryType&>(type).index_type(), context);
+      return;
+    case Type::EXTENSION:
+      SkipField(*checked_cast<const ExtensionType&>(type).storage_type(), context);
+      return;
+    case Type::STRUCT:
+    case Type::FIXED_SIZE_LIST:
+      context->buffer_index += 1;
+      break;
+    case Type::BINARY:
+    case Type::STRING:
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      context->buffer_index += 3;
+      break;
+    case Type::UNION:
+      context->buffer_index +=
+          checked_cast<const UnionType&>(type).mode() == UnionMode::DENSE ? 3 : 2;
+      break;
+    default:
+      // Fixed-width types, and list types with their offsets
+      context->buffer_index += 2;
+      break;
+  }
+  ++context->field_index;
+  for (const auto& child : type.children()) {
+    SkipField(*child->type(), context);
+  }
+}
+
 static Status LoadArray(const Field& field, ArrayLoaderContext* context, ArrayData* out);
 
 class ArrayLoader {
  public:
-  ArrayLoader(const Field& field, ArrayData* out, ArrayLoaderContext* context)
-      : field_(field), context_(context), out_(out) {}
+  // If `selection` is given, only its selected children are loaded
+  ArrayLoader(const Field& field, ArrayData* out, ArrayLoaderContext* context,
+              const FieldSelection* selection = NULLPTR)
+      : field_(field), context_(context), out_(out), selection_(selection) {}
 
   Status Load() {
     if (context_->max_recursion_depth <= 0) {
       return Status::Invalid("Max recursion depth reached");
     }
 
+    if (selection_ != nullptr && !selection_->all) {
+      RETURN_NOT_OK(LoadSelectedChildren());
+      out_->type = selection_->field->type();
+      return Status::OK();
+    }
     RETURN_NOT_OK(VisitTypeInline(*field_.type(), this));
     out_->type = field_.type();
     return Status::OK();
@@ -234,8 +424,9 @@ class ArrayLoader {
     return LoadChildren(type.children());
   }
 
-  Status LoadChild(const Field& field, ArrayData* out) {
-    ArrayLoader loader(field, out, context_);
+  Status LoadChild(const Field& field, ArrayData* out,
+                   const FieldSelection* selection = NULLPTR) {
+    ArrayLoader loader(field, out, context_, selection);
     --context_->max_recursion_depth;
     RETURN_NOT_OK(loader.Load());
     ++context_->max_recursion_depth;
@@ -253,6 +444,32 @@ class ArrayLoader {
     return Status::OK();
   }
 
+  // Load a struct or list field of which only some children are read
+  Status LoadSelectedChildren() {
+    const DataType& type = *field_.type();
+    if (type.id() == Type::STRUCT || type.id() == Type::FIXED_SIZE_LIST) {
+      out_->buffers.resize(1);
+      RETURN_NOT_OK(LoadCommon());
+    } else {
+      out_->buffers.resize(2);
+      RETURN_NOT_OK(LoadCommon());
+      RETURN_NOT_OK(GetBuffer(context_->buffer_index++, &out_->buffers[1]));
+    }
+
+    out_->child_data.reserve(selection_->children.size());
+    for (int i = 0; i < type.num_children(); ++i) {
+      auto it = selection_->children.find(i);
+      if (it == selection_->children.end()) {
+        SkipField(*type.child(i)->type(), context_);
+        continue;
+      }
+      auto field_array = std::make_shared<ArrayData>();
+      RETURN_NOT_OK(LoadChild(*type.child(i), field_array.get(), &it->second));
+      out_->child_data.emplace_back(field_array);
+    }
+    return Status::OK();
+  }
+
   Status Visit(const NullType& type) {
     out_->buffers.resize(1);
 
@@ -344,6 +561,8 @@ class ArrayLoader {
 
   // Used in visitor pattern
   ArrayData* out_;
+
+  const FieldSelection* selection_;
 };
 
 static Status LoadArray(const Field& field, ArrayLoaderContext* context, ArrayData* out) {
@@ -372,43 +591,138 @@ Status ReadRecordBatch(const Message& message, const std::shared_ptr<Schema>& sc
 // ----------------------------------------------------------------------
 // Array loading
 
+static Status DecompressBuffer(util::Codec* codec, std::shared_ptr<Buffer>* buffer) {
+  if (*buffer == nullptr || (*buffer)->size() == 0) {
+    return Status::OK();
+  }
+  if ((*buffer)->size() < kCompressionPrefixLength) {
+    return Status::IOError("Compressed IPC buffer is too short (", (*buffer)->size(),
+                           " bytes)");
+  }
+  int64_t uncompressed_length;
+  memcpy(&uncompressed_length, (*buffer)->data(), kCompressionPrefixLength);
+  uncompressed_length = BitUtil::FromLittleEndian(uncompressed_length);
+  if (uncompressed_length == -1) {
+    // Written without compression
+    *buffer = SliceBuffer(*buffer, kCompressionPrefixLength);
+    return Status::OK();
+  }
+  if (uncompressed_length < 0) {
+    return Status::IOError("Invalid uncompressed length of IPC buffer: ",
+                           uncompressed_length);
+  }
+
+  std::shared_ptr<Buffer> uncompressed;
+  RETURN_NOT_OK(AllocateBuffer(uncompressed_length, &uncompressed));
+  int64_t actual_length;
+  RETURN_NOT_OK(codec->Decompress((*buffer)->size() - kCompressionPrefixLength,
+                                  (*buffer)->data() + kCompressionPrefixLength,
+                                  uncompressed_length, uncompressed->mutable_data(),
+                                  &actual_length));
+  if (actual_length != uncompressed_length) {
+    return Status::IOError("Expected IPC buffer of ", uncompressed_length,
+                           " bytes after decompression, got ", actual_length);
+  }
+  *buffer = std::move(uncompressed);
+  return Status::OK();
+}
+
+static void CollectBuffers(ArrayData* data, std::vector<std::shared_ptr<Buffer>*>* out) {
+  for (auto& buffer : data->buffers) {
+    out->push_back(&buffer);
+  }
+  for (const auto& child : data->child_data) {
+    CollectBuffers(child.get(), out);
+  }
+}
+
+// Decompress the buffers of the loaded arrays (but not of their dictionaries,
+// which are read separately)
+static Status DecompressBuffers(Compression::type compression, const IpcOptions& options,
+                                std::vector<std::shared_ptr<ArrayData>>* arrays) {
+  std::unique_ptr<util::Codec> codec;
+  RETURN_NOT_OK(util::Codec::Create(compression, &codec));
+
+  std::vector<std::shared_ptr<Buffer>*> buffers;
+  for (const auto& array : *arrays) {
+    CollectBuffers(array.get(), &buffers);
+  }
+  // Blocking a worker of the CPU thread pool on nested tasks may deadlock,
+  // e.g. when the reader is run from a dataset scan task
+  const bool use_threads =
+      options.use_threads && !::arrow::internal::GetCpuThreadPool()->OwnsThisThread();
+  return ::arrow::internal::OptionalParallelFor(
+      use_threads, static_cast<int>(buffers.size()),
+      [&](int i) { return DecompressBuffer(codec.get(), buffers[i]); });
+}
+
 static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
-                                        int64_t num_rows, int max_recursion_depth,
+                                        const ReadSelection* selection,
+                                        int64_t num_rows, Compression::type compression,
+                                        const IpcOptions& options,
                                         IpcComponentSource* source,
                                         const DictionaryMemo* dictionary_memo,
                                         std::shared_ptr<RecordBatch>* out) {
+  const int max_recursion_depth = options.max_recursion_depth;
   ArrayLoaderContext context{source, dictionary_memo, /*field_index=*/0,
                              /*buffer_index=*/0, max_recursion_depth};
 
-  std::vector<std::shared_ptr<ArrayData>> arrays(schema->num_fields());
+  std::vector<std::shared_ptr<ArrayData>> arrays;
+  arrays.reserve(selection != nullptr ? selection->fields.size()
+                                      : static_cast<size_t>(schema->num_fields()));
   for (int i = 0; i < schema->num_fields(); ++i) {
+    const FieldSelection* field_selection = nullptr;
+    if (selection != nullptr) {
+      if (arrays.size() == selection->fields.size()) {
+        // None of the remaining fields are read
+        break;
+      }
+      auto it = selection->fields.find(i);
+      if (it == selection->fields.end()) {
+        SkipField(*schema->field(i)->type(), &context);
+        continue;
+      }
+      field_selection = &it->second;
+    }
     auto arr = std::make_shared<ArrayData>();
-    RETURN_NOT_OK(LoadArray(*schema->field(i), &context, arr.get()));
+    ArrayLoader loader(*schema->field(i), arr.get(), &context, field_selection);
+    RETURN_NOT_OK(loader.Load());
     if (num_rows != arr->length) {
       return Status::IOError("Array length did not match record batch length");
     }
-    arrays[i] = std::move(arr);
+    arrays.push_back(std::move(arr));
   }
 
-  *out = RecordBatch::Make(schema, num_rows, std::move(arrays));
+  if (compression != Compression::UNCOMPRESSED) {
+    RETURN_NOT_OK(DecompressBuffers(compression, options, &arrays));
+  }
+
+  *out = RecordBatch::Make(selection != nullptr ? selection->schema : schema, num_rows,
+                           std::move(arrays));
   return Status::OK();
 }
 
 static inline Status ReadRecordBatch(const flatbuf::RecordBatch* metadata,
                                      const std::shared_ptr<Schema>& schema,
+                                     const ReadSelection* selection,
                                      const DictionaryMemo* dictionary_memo,
                                      const IpcOptions& options,
-                                     io::RandomAccessFile* file,
+                                     io::RandomAccessFile* file, int64_t body_offset,
                                      std::shared_ptr<RecordBatch>* out) {
-  IpcComponentSource source(metadata, file);
-  return LoadRecordBatchFromSource(schema, metadata->length(),
-                                   options.max_recursion_depth, &source, dictionary_memo,
-                                   out);
+  Compression::type compression;
+  RETURN_NOT_OK(internal::GetCompression(metadata, &compression));
+  IpcComponentSource source(metadata, file, body_offset);
+  return LoadRecordBatchFromSource(schema, selection, metadata->length(), compression,
+                                   options, &source, dictionary_memo, out);
 }
 
-Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
-                       const DictionaryMemo* dictionary_memo, const IpcOptions& options,
-                       io::RandomAccessFile* file, std::shared_ptr<RecordBatch>* out) {
+static Status ReadRecordBatchInternal(const Buffer& metadata,
+                                      const std::shared_ptr<Schema>& schema,
+                                      const ReadSelection* selection,
+                                      const DictionaryMemo* dictionary_memo,
+                                      const IpcOptions& options,
+                                      io::RandomAccessFile* file, int64_t body_offset,
+                                      std::shared_ptr<RecordBatch>* out) {
   const flatbuf::Message* message;
   RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
   auto batch = message->header_as_RecordBatch();
@@ -416,11 +730,27 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
     return Status::IOError(
         "Header-type of flatbuffer-encoded Message is not RecordBatch.");
   }
-  return ReadRecordBatch(batch, schema, dictionary_memo, options, file, out);
+  return ReadRecordBatch(batch, schema, selection, dictionary_memo, options, file,
+                         body_offset, out);
+}
+
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       const DictionaryMemo* dictionary_memo, const IpcOptions& options,
+                       io::RandomAccessFile* file, std::shared_ptr<RecordBatch>* out) {
+  std::unique_ptr<ReadSelection> selection;
+  if (!options.included_fields.empty()) {
+    RETURN_NOT_OK(MakeReadSelection(*schema, dictionary_memo, options.included_fields,
+                                    &selection));
+  }
+  return ReadRecordBatchInternal(metadata, schema, selection.get(), dictionary_memo,
+                                 options, file, /*body_offset=*/0, out);
 }
 
-Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
-                      io::RandomAccessFile* file) {
+// Read a dictionary batch into the memo, unless a selection is given which
+// doesn't use that dictionary
+static Status ReadDictionary(const Buffer& metadata, const ReadSelection* selection,
+                             DictionaryMemo* dictionary_memo, io::RandomAccessFile* file,
+                             int64_t body_offset = 0) {
   auto options = IpcOptions::Defaults();
 
   const flatbuf::Message* message;
@@ -432,6 +762,9 @@ Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
   }
 
   int64_t id = dictionary_batch->id();
+  if (selection != nullptr && selection->dictionary_ids.count(id) == 0) {
+    return Status::OK();
+  }
 
   // Look up the field, which must have been added to the
   // DictionaryMemo already prior to invoking this function
@@ -444,11 +777,15 @@ Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
   std::shared_ptr<RecordBatch> batch;
   auto batch_meta = dictionary_batch->data();
   RETURN_NOT_OK(ReadRecordBatch(batch_meta, ::arrow::schema({value_field}),
-                                dictionary_memo, options, file, &batch));
+                                /*selection=*/nullptr, dictionary_memo, options, file,
+                                body_offset, &batch));
   if (batch->num_columns() != 1) {
     return Status::Invalid("Dictionary record batch must only contain one field");
   }
   auto dictionary = batch->column(0);
+  if (dictionary_batch->isDelta()) {
+    return dictionary_memo->AddDictionaryDelta(id, dictionary, default_memory_pool());
+  }
   return dictionary_memo->AddDictionary(id, dictionary);
 }
 
@@ -464,9 +801,15 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
   RecordBatchStreamReaderImpl() {}
   ~RecordBatchStreamReaderImpl() {}
 
-  Status Open(std::unique_ptr<MessageReader> message_reader) {
+  Status Open(std::unique_ptr<MessageReader> message_reader, const IpcOptions& options) {
     message_reader_ = std::move(message_reader);
-    return ReadSchema();
+    options_ = options;
+    RETURN_NOT_OK(ReadSchema());
+    if (!options_.included_fields.empty()) {
+      RETURN_NOT_OK(MakeReadSelection(*schema_, &dictionary_memo_,
+                                      options_.included_fields, &selection_));
+    }
+    return Status::OK();
   }
 
   Status ReadSchema() {
@@ -488,7 +831,8 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
     DCHECK_EQ(message.type(), Message::DICTIONARY_BATCH);
     CHECK_HAS_BODY(message);
     io::BufferReader reader(message.body());
-    return ReadDictionary(*message.metadata(), &dictionary_memo_, &reader);
+    return ReadDictionary(*message.metadata(), selection_.get(), &dictionary_memo_,
+                          &reader);
   }
 
   Status ReadInitialDictionaries() {
@@ -543,27 +887,35 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
 
     std::unique_ptr<Message> message;
     RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
+
+    // Apply any dictionary deltas preceding the next record batch
+    while (message != nullptr && message->type() == Message::DICTIONARY_BATCH) {
+      RETURN_NOT_OK(ParseDictionary(*message));
+      RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
+    }
     if (message == nullptr) {
       // End of stream
       *batch = nullptr;
       return Status::OK();
     }
 
-    if (message->type() == Message::DICTIONARY_BATCH) {
-      // TODO(wesm): implement delta dictionaries
-      return Status::NotImplemented("Delta dictionaries not yet implemented");
-    } else {
-      CHECK_HAS_BODY(*message);
-      io::BufferReader reader(message->body());
-      return ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_, &reader,
-                             batch);
-    }
+    CHECK_HAS_BODY(*message);
+    io::BufferReader reader(message->body());
+    return ReadRecordBatchInternal(*message->metadata(), schema_, selection_.get(),
+                                   &dictionary_memo_, options_, &reader,
+                                   /*body_offset=*/0, batch);
   }
 
-  std::shared_ptr<Schema> schema() const { return schema_; }
+  std::shared_ptr<Schema> schema() const {
+    return selection_ != nullptr ? selection_->schema : schema_;
+  }
 
  private:
   std::unique_ptr<MessageReader> message_reader_;
+  IpcOptions options_;
+
+  // The fields to read, null to read all
+  std::unique_ptr<ReadSelection> selection_;
 
   bool read_initial_dictionaries_ = false;
 
@@ -583,22 +935,28 @@ RecordBatchStreamReader::~RecordBatchStreamReader() {}
 
 Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_reader,
                                      std::shared_ptr<RecordBatchReader>* reader) {
-  // Private ctor
-  auto result = std::shared_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
-  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader)));
-  *reader = result;
-  return Status::OK();
+  return Open(std::move(message_reader), IpcOptions::Defaults(), reader);
 }
 
 Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_reader,
                                      std::unique_ptr<RecordBatchReader>* reader) {
   // Private ctor
   auto result = std::unique_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
-  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader)));
+  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader), IpcOptions::Defaults()));
   *reader = std::move(result);
   return Status::OK();
 }
 
+Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_reader,
+                                     const IpcOptions& options,
+                                     std::shared_ptr<RecordBatchReader>* reader) {
+  // Private ctor
+  auto result = std::shared_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
+  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader), options));
+  *reader = result;
+  return Status::OK();
+}
+
 Status RecordBatchStreamReader::Open(io::InputStream* stream,
                                      std::shared_ptr<RecordBatchReader>* out) {
   return Open(MessageReader::Open(stream), out);
@@ -609,6 +967,12 @@ Status RecordBatchStreamReader::Open(const std::shared_ptr<io::InputStream>& str
   return Open(MessageReader::Open(stream), out);
 }
 
+Status RecordBatchStreamReader::Open(const std::shared_ptr<io::InputStream>& stream,
+                                     const IpcOptions& options,
+                                     std::shared_ptr<RecordBatchReader>* out) {
+  return Open(MessageReader::Open(stream), options, out);
+}
+
 std::shared_ptr<Schema> RecordBatchStreamReader::schema() const {
   return impl_->schema();
 }
@@ -620,20 +984,34 @@ Status RecordBatchStreamReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
 // ----------------------------------------------------------------------
 // Reader implementation
 
+struct RecordBatchFileReader::Footer {
+  // The location where the Arrow file layout ends
+  int64_t footer_offset;
+
+  std::shared_ptr<Buffer> buffer;
+  const flatbuf::Footer* footer;
+
+  std::shared_ptr<Schema> schema;
+
+  // The dictionary-encoded fields of the schema, with their dictionary ids
+  std::vector<std::pair<int64_t, std::shared_ptr<Field>>> dictionary_fields;
+};
+
 class RecordBatchFileReader::RecordBatchFileReaderImpl {
  public:
-  RecordBatchFileReaderImpl() : file_(NULLPTR), footer_offset_(0), footer_(NULLPTR) {}
+  RecordBatchFileReaderImpl() : file_(NULLPTR) {}
 
-  Status ReadFooter() {
+  Status ReadFooter(Footer* out) {
     int magic_size = static_cast<int>(strlen(kArrowMagicBytes));
+    const int64_t footer_offset = out->footer_offset;
 
-    if (footer_offset_ <= magic_size * 2 + 4) {
-      return Status::Invalid("File is too small: ", footer_offset_);
+    if (footer_offset <= magic_size * 2 + 4) {
+      return Status::Invalid("File is too small: ", footer_offset);
     }
 
     std::shared_ptr<Buffer> buffer;
     int file_end_size = static_cast<int>(magic_size + sizeof(int32_t));
-    RETURN_NOT_OK(file_->ReadAt(footer_offset_ - file_end_size, file_end_size, &buffer));
+    RETURN_NOT_OK(file_->ReadAt(footer_offset - file_end_size, file_end_size, &buffer));
 
     const int64_t expected_footer_size = magic_size + sizeof(int32_t);
     if (buffer->size() < expected_footer_size) {
@@ -646,38 +1024,38 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
 
     int32_t footer_length = *reinterpret_cast<const int32_t*>(buffer->data());
 
-    if (footer_length <= 0 || footer_length + magic_size * 2 + 4 > footer_offset_) {
+    if (footer_length <= 0 || footer_length + magic_size * 2 + 4 > footer_offset) {
       return Status::Invalid("File is smaller than indicated metadata size");
     }
 
     // Now read the footer
-    RETURN_NOT_OK(file_->ReadAt(footer_offset_ - footer_length - file_end_size,
-                                footer_length, &footer_buffer_));
+    RETURN_NOT_OK(file_->ReadAt(footer_offset - footer_length - file_end_size,
+                                footer_length, &out->buffer));
 
-    auto data = footer_buffer_->data();
-    flatbuffers::Verifier verifier(data, footer_buffer_->size(), 128);
+    auto data = out->buffer->data();
+    flatbuffers::Verifier verifier(data, out->buffer->size(), 128);
     if (!flatbuf::VerifyFooterBuffer(verifier)) {
       return Status::IOError("Verification of flatbuffer-encoded Footer failed.");
     }
-    footer_ = flatbuf::GetFooter(data);
+    out->footer = flatbuf::GetFooter(data);
 
     return Status::OK();
   }
 
-  int num_dictionaries() const { return footer_->dictionaries()->size(); }
+  int num_dictionaries() const { return footer_->footer->dictionaries()->size(); }
 
-  int num_record_batches() const { return footer_->recordBatches()->size(); }
+  int num_record_batches() const { return footer_->footer->recordBatches()->size(); }
 
   MetadataVersion version() const {
-    return internal::GetMetadataVersion(footer_->version());
+    return internal::GetMetadataVersion(footer_->footer->version());
   }
 
   FileBlock GetRecordBatchBlock(int i) const {
-    return FileBlockFromFlatbuffer(footer_->recordBatches()->Get(i));
+    return FileBlockFromFlatbuffer(footer_->footer->recordBatches()->Get(i));
   }
 
   FileBlock GetDictionaryBlock(int i) const {
-    return FileBlockFromFlatbuffer(footer_->dictionaries()->Get(i));
+    return FileBlockFromFlatbuffer(footer_->footer->dictionaries()->Get(i));
   }
 
   Status ReadMessageFromBlock(const FileBlock& block, std::unique_ptr<Message>* out) {
@@ -692,14 +1070,38 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
     return Status::OK();
   }
 
+  // When only some fields are read, the message body isn't read with the
+  // metadata, so that the buffers of the other fields are never read
+  Status ReadMessageMetadataFromBlock(const FileBlock& block,
+                                      std::unique_ptr<Message>* out) {
+    DCHECK(BitUtil::IsMultipleOf8(block.offset));
+    DCHECK(BitUtil::IsMultipleOf8(block.metadata_length));
+
+    RETURN_NOT_OK(ReadMessageMetadata(block.offset, block.metadata_length, file_, out));
+    if (*out == nullptr) {
+      return Status::IOError("Unexpected end of stream marker in IPC file at offset ",
+                             block.offset);
+    }
+    return Status::OK();
+  }
+
   Status ReadDictionaries() {
     // Read all the dictionaries
     for (int i = 0; i < num_dictionaries(); ++i) {
+      const FileBlock block = GetDictionaryBlock(i);
       std::unique_ptr<Message> message;
-      RETURN_NOT_OK(ReadMessageFromBlock(GetDictionaryBlock(i), &message));
+      if (selection_ != nullptr) {
+        RETURN_NOT_OK(ReadMessageMetadataFromBlock(block, &message));
+        RETURN_NOT_OK(ReadDictionary(*message->metadata(), selection_.get(),
+                                     &dictionary_memo_, file_,
+                                     block.offset + block.metadata_length));
+        continue;
+      }
+      RETURN_NOT_OK(ReadMessageFromBlock(block, &message));
 
       io::BufferReader reader(message->body());
-      RETURN_NOT_OK(ReadDictionary(*message->metadata(), &dictionary_memo_, &reader));
+      RETURN_NOT_OK(ReadDictionary(*message->metadata(), /*selection=*/nullptr,
+                                   &dictionary_memo_, &reader));
     }
     return Status::OK();
   }
@@ -713,51 +1115,95 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
       read_dictionaries_ = true;
     }
 
+    const FileBlock block = GetRecordBatchBlock(i);
     std::unique_ptr<Message> message;
-    RETURN_NOT_OK(ReadMessageFromBlock(GetRecordBatchBlock(i), &message));
+    if (selection_ != nullptr) {
+      RETURN_NOT_OK(ReadMessageMetadataFromBlock(block, &message));
+      CHECK_MESSAGE_TYPE(Message::RECORD_BATCH, message->type());
+      return ReadRecordBatchInternal(*message->metadata(), footer_->schema,
+                                     selection_.get(), &dictionary_memo_, options_,
+                                     file_, block.offset + block.metadata_length,
+                                     batch);
+    }
+    RETURN_NOT_OK(ReadMessageFromBlock(block, &message));
 
     io::BufferReader reader(message->body());
-    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_,
-                                         &reader, batch);
+    return ReadRecordBatchInternal(*message->metadata(), footer_->schema,
+                                   /*selection=*/nullptr, &dictionary_memo_, options_,
+                                   &reader, /*body_offset=*/0, batch);
   }
 
-  Status ReadSchema() {
+  Status ReadSchema(Footer* footer) {
     // Get the schema and record any observed dictionaries
-    return internal::GetSchema(footer_->schema(), &dictionary_memo_, &schema_);
+    RETURN_NOT_OK(internal::GetSchema(footer->footer->schema(), &dictionary_memo_,
+                                      &footer->schema));
+    for (const auto& field : footer->schema->fields()) {
+      CollectDictionaryFields(field, dictionary_memo_, &footer->dictionary_fields);
+    }
+    return Status::OK();
   }
 
-  Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset) {
+  Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
+              const IpcOptions& options) {
     owned_file_ = file;
-    return Open(file.get(), footer_offset);
+    return Open(file.get(), footer_offset, options);
   }
 
-  Status Open(io::RandomAccessFile* file, int64_t footer_offset) {
+  Status Open(io::RandomAccessFile* file, int64_t footer_offset,
+              const IpcOptions& options) {
     file_ = file;
-    footer_offset_ = footer_offset;
-    RETURN_NOT_OK(ReadFooter());
-    return ReadSchema();
+    options_ = options;
+    auto footer = std::make_shared<Footer>();
+    footer->footer_offset = footer_offset;
+    RETURN_NOT_OK(ReadFooter(footer.get()));
+    RETURN_NOT_OK(ReadSchema(footer.get()));
+    footer_ = std::move(footer);
+    return MakeSelection();
   }
 
-  std::shared_ptr<Schema> schema() const { return schema_; }
+  Status Open(const std::shared_ptr<io::RandomAccessFile>& file,
+              const std::shared_ptr<const Footer>& footer, const IpcOptions& options) {
+    owned_file_ = file;
+    file_ = file.get();
+    options_ = options;
+    footer_ = footer;
+    // Record the dictionary-encoded fields as GetSchema would
+    for (const auto& pair : footer_->dictionary_fields) {
+      RETURN_NOT_OK(dictionary_memo_.AddField(pair.first, pair.second));
+    }
+    return MakeSelection();
+  }
+
+  Status MakeSelection() {
+    if (options_.included_fields.empty()) {
+      return Status::OK();
+    }
+    return MakeReadSelection(*footer_->schema, &dictionary_memo_,
+                             options_.included_fields, &selection_);
+  }
+
+  std::shared_ptr<Schema> schema() const {
+    return selection_ != nullptr ? selection_->schema : footer_->schema;
+  }
+
+  std::shared_ptr<const Footer> footer() const { return footer_; }
 
  private:
   io::RandomAccessFile* file_;
 
   std::shared_ptr<io::RandomAccessFile> owned_file_;
 
-  // The location where the Arrow file layout ends. May be the end of the file
-  // or some other location if embedded in a larger file.
-  int64_t footer_offset_;
+  IpcOptions options_;
+
+  // Footer metadata and the schema reconstructed from it, which may be
+  // shared with other readers of the same file
+  std::shared_ptr<const Footer> footer_;
 
-  // Footer metadata
-  std::shared_ptr<Buffer> footer_buffer_;
-  const flatbuf::Footer* footer_;
+  // The fields to read, null to read all
+  std::unique_ptr<ReadSelection> selection_;
 
   bool read_dictionaries_ = false;
   DictionaryMemo dictionary_memo_;
-
-  // Reconstructed schema, including any read dictionaries
-  std::shared_ptr<Schema> schema_;
 };
 
 RecordBatchFileReader::RecordBatchFileReader() {
@@ -775,8 +1221,14 @@ Status RecordBatchFileReader::Open(io::RandomAccessFile* file,
 
 Status RecordBatchFileReader::Open(io::RandomAccessFile* file, int64_t footer_offset,
                                    std::shared_ptr<RecordBatchFileReader>* reader) {
+  return Open(file, footer_offset, IpcOptions::Defaults(), reader);
+}
+
+Status RecordBatchFileReader::Open(io::RandomAccessFile* file, int64_t footer_offset,
+                                   const IpcOptions& options,
+                                   std::shared_ptr<RecordBatchFileReader>* reader) {
   *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
-  return (*reader)->impl_->Open(file, footer_offset);
+  return (*reader)->impl_->Open(file, footer_offset, options);
 }
 
 Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
@@ -789,12 +1241,31 @@ Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>&
 Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
                                    int64_t footer_offset,
                                    std::shared_ptr<RecordBatchFileReader>* reader) {
+  return Open(file, footer_offset, IpcOptions::Defaults(), reader);
+}
+
+Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
+                                   int64_t footer_offset, const IpcOptions& options,
+                                   std::shared_ptr<RecordBatchFileReader>* reader) {
   *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
-  return (*reader)->impl_->Open(file, footer_offset);
+  return (*reader)->impl_->Open(file, footer_offset, options);
+}
+
+Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
+                                   const std::shared_ptr<const Footer>& footer,
+                                   const IpcOptions& options,
+                                   std::shared_ptr<RecordBatchFileReader>* reader) {
+  *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
+  return (*reader)->impl_->Open(file, footer, options);
 }
 
 std::shared_ptr<Schema> RecordBatchFileReader::schema() const { return impl_->schema(); }
 
+std::shared_ptr<const RecordBatchFileReader::Footer> RecordBatchFileReader::footer()
+    const {
+  return impl_->footer();
+}
+
 int RecordBatchFileReader::num_record_batches() const {
   return impl_->num_record_batches();
 }
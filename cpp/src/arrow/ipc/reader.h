@@ -71,6 +71,16 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   static Status Open(std::unique_ptr<MessageReader> message_reader,
                      std::unique_ptr<RecordBatchReader>* out);
 
+  /// \brief Create batch reader from generic MessageReader, reading only the
+  /// fields given by IpcOptions::included_fields
+  ///
+  /// \param[in] message_reader a MessageReader implementation
+  /// \param[in] options options for deserialization
+  /// \param[out] out the created RecordBatchReader object
+  /// \return Status
+  static Status Open(std::unique_ptr<MessageReader> message_reader,
+                     const IpcOptions& options, std::shared_ptr<RecordBatchReader>* out);
+
   /// \brief Record batch stream reader from InputStream
   ///
   /// \param[in] stream an input stream instance. Must stay alive throughout
@@ -86,7 +96,16 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   static Status Open(const std::shared_ptr<io::InputStream>& stream,
                      std::shared_ptr<RecordBatchReader>* out);
 
-  /// \brief Returns the schema read from the stream
+  /// \brief Open stream and retain ownership of stream object
+  /// \param[in] stream the input stream
+  /// \param[in] options options for deserialization
+  /// \param[out] out the batch reader
+  /// \return Status
+  static Status Open(const std::shared_ptr<io::InputStream>& stream,
+                     const IpcOptions& options, std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Returns the schema read from the stream, restricted to the
+  /// included fields if any
   std::shared_ptr<Schema> schema() const override;
 
   Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
@@ -101,6 +120,10 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
 /// \brief Reads the record batch file format
 class ARROW_EXPORT RecordBatchFileReader {
  public:
+  /// \brief The parsed file footer and schema, which can be reused to open
+  /// the same file again without reading them
+  struct Footer;
+
   ~RecordBatchFileReader();
 
   /// \brief Open a RecordBatchFileReader
@@ -126,6 +149,21 @@ class ARROW_EXPORT RecordBatchFileReader {
   static Status Open(io::RandomAccessFile* file, int64_t footer_offset,
                      std::shared_ptr<RecordBatchFileReader>* reader);
 
+  /// \brief Open a RecordBatchFileReader reading only the fields given by
+  /// IpcOptions::included_fields
+  ///
+  /// Only the buffers of those fields are read from the file, so that reads
+  /// from a memory-mapped file touch none of the other fields' pages.
+  ///
+  /// \param[in] file the data source
+  /// \param[in] footer_offset the position of the end of the Arrow file
+  /// \param[in] options options for deserialization
+  /// \param[out] reader the returned reader
+  /// \return Status
+  static Status Open(io::RandomAccessFile* file, int64_t footer_offset,
+                     const IpcOptions& options,
+                     std::shared_ptr<RecordBatchFileReader>* reader);
+
   /// \brief Version of Open that retains ownership of file
   ///
   /// \param[in] file the data source
@@ -144,9 +182,37 @@ class ARROW_EXPORT RecordBatchFileReader {
                      int64_t footer_offset,
                      std::shared_ptr<RecordBatchFileReader>* reader);
 
-  /// \brief The schema read from the file
+  /// \brief Version of Open that retains ownership of file
+  ///
+  /// \param[in] file the data source
+  /// \param[in] footer_offset the position of the end of the Arrow file
+  /// \param[in] options options for deserialization
+  /// \param[out] reader the returned reader
+  /// \return Status
+  static Status Open(const std::shared_ptr<io::RandomAccessFile>& file,
+                     int64_t footer_offset, const IpcOptions& options,
+                     std::shared_ptr<RecordBatchFileReader>* reader);
+
+  /// \brief Open a file whose footer was already read by another reader
+  ///
+  /// \param[in] file the data source, with the same contents as the file
+  /// the footer was read from
+  /// \param[in] footer the footer returned by footer()
+  /// \param[in] options options for deserialization
+  /// \param[out] reader the returned reader
+  /// \return Status
+  static Status Open(const std::shared_ptr<io::RandomAccessFile>& file,
+                     const std::shared_ptr<const Footer>& footer,
+                     const IpcOptions& options,
+                     std::shared_ptr<RecordBatchFileReader>* reader);
+
+  /// \brief The schema read from the file, restricted to the included fields
+  /// if any
   std::shared_ptr<Schema> schema() const;
 
+  /// \brief The footer read from the file, for opening it again
+  std::shared_ptr<const Footer> footer() const;
+
   /// \brief Returns the number of record batches in the file
   int num_record_batches() const;
 
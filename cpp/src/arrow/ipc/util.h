@@ -38,6 +38,17 @@ static constexpr int32_t kArrowIpcAlignment = 8;
 
 static constexpr uint8_t kPaddingBytes[kArrowAlignment] = {0};
 
+// Compressed buffers are prefixed with their uncompressed length as an int64
+static constexpr int64_t kCompressionPrefixLength = 8;
+
+// The uncompressed length prefix of buffers written without compression (-1)
+static constexpr uint8_t kNoCompressionLength[kCompressionPrefixLength] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+
+// Buffers are written without compression unless compression shrinks them
+// below this ratio of their original size
+static constexpr double kMaxCompressionRatio = 0.9;
+
 static inline int64_t PaddedLength(int64_t nbytes, int32_t alignment = kArrowAlignment) {
   return ((nbytes + alignment - 1) / alignment) * alignment;
 }
@@ -44,7 +44,10 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/stl.h"
 #include "arrow/visitor.h"
 
@@ -156,13 +159,14 @@ class RecordBatchSerializer : public ArrayVisitor {
   // Override this for writing dictionary metadata
   virtual Status SerializeMetadata(int64_t num_rows) {
     return WriteRecordBatchMessage(num_rows, out_->body_length, field_nodes_,
-                                   buffer_meta_, &out_->metadata);
+                                   buffer_meta_, options_.compression, &out_->metadata);
   }
 
   Status Assemble(const RecordBatch& batch) {
     if (field_nodes_.size() > 0) {
       field_nodes_.clear();
       buffer_meta_.clear();
+      buffer_parts_.clear();
       out_->body_buffers.clear();
     }
 
@@ -171,26 +175,37 @@ class RecordBatchSerializer : public ArrayVisitor {
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
     }
 
+    const bool compressed = options_.compression != Compression::UNCOMPRESSED;
+    if (compressed) {
+      RETURN_NOT_OK(CompressBodyBuffers());
+    } else {
+      buffer_parts_.assign(out_->body_buffers.size(), 1);
+    }
+
     // The position for the start of a buffer relative to the passed frame of
     // reference. May be 0 or some other position in an address space
     int64_t offset = buffer_start_offset_;
 
-    buffer_meta_.reserve(out_->body_buffers.size());
+    buffer_meta_.reserve(buffer_parts_.size());
 
     // Construct the buffer metadata for the record batch header
-    for (size_t i = 0; i < out_->body_buffers.size(); ++i) {
-      const Buffer* buffer = out_->body_buffers[i].get();
+    size_t body_index = 0;
+    for (int num_parts : buffer_parts_) {
       int64_t size = 0;
-      int64_t padding = 0;
-
-      // The buffer might be null if we are handling zero row lengths.
-      if (buffer) {
-        size = buffer->size();
-        padding = BitUtil::RoundUpToMultipleOf8(size) - size;
+      int64_t padded_size = 0;
+      for (int i = 0; i < num_parts; ++i) {
+        const Buffer* buffer = out_->body_buffers[body_index++].get();
+
+        // The buffer might be null if we are handling zero row lengths.
+        if (buffer) {
+          size = padded_size + buffer->size();
+          padded_size += BitUtil::RoundUpToMultipleOf8(buffer->size());
+        }
       }
 
-      buffer_meta_.push_back({offset, size + padding});
-      offset += size + padding;
+      // The padding must not be handed to the decompressor
+      buffer_meta_.push_back({offset, compressed ? size : padded_size});
+      offset += padded_size;
     }
 
     out_->body_length = offset - buffer_start_offset_;
@@ -205,6 +220,77 @@ class RecordBatchSerializer : public ArrayVisitor {
   }
 
  protected:
+  // Convert the body buffers to the IPC buffer compression format: each buffer
+  // is prefixed with its uncompressed length as a little-endian int64, followed
+  // by the compressed data. Buffers that don't compress well are prefixed with
+  // -1 instead and appended uncompressed as a separate body buffer, so that
+  // they aren't copied.
+  Status CompressBodyBuffers() {
+    if (options_.compression != Compression::LZ4_FRAME &&
+        options_.compression != Compression::ZSTD) {
+      return Status::Invalid("Unsupported IPC body compression: ",
+                             util::Codec::GetCodecAsString(options_.compression));
+    }
+    std::unique_ptr<util::Codec> codec;
+    RETURN_NOT_OK(
+        util::Codec::Create(options_.compression, options_.compression_level, &codec));
+
+    static std::shared_ptr<Buffer> kUncompressedPrefix =
+        std::make_shared<Buffer>(kNoCompressionLength, kCompressionPrefixLength);
+
+    const auto& buffers = out_->body_buffers;
+    std::vector<std::shared_ptr<Buffer>> compressed(buffers.size());
+    auto compress_buffer = [&](int i) -> Status {
+      const Buffer* buffer = buffers[i].get();
+      if (buffer == nullptr || buffer->size() == 0) {
+        return Status::OK();
+      }
+      const int64_t max_length = codec->MaxCompressedLen(buffer->size(), buffer->data());
+      std::shared_ptr<ResizableBuffer> result;
+      RETURN_NOT_OK(
+          AllocateResizableBuffer(pool_, kCompressionPrefixLength + max_length, &result));
+      int64_t length = 0;
+      RETURN_NOT_OK(codec->Compress(buffer->size(), buffer->data(), max_length,
+                                    result->mutable_data() + kCompressionPrefixLength,
+                                    &length));
+      if (static_cast<double>(kCompressionPrefixLength + length) >
+          kMaxCompressionRatio * static_cast<double>(buffer->size())) {
+        // Not worth the decompression cost, leave uncompressed
+        return Status::OK();
+      }
+      const int64_t uncompressed_length = BitUtil::ToLittleEndian(buffer->size());
+      memcpy(result->mutable_data(), &uncompressed_length, kCompressionPrefixLength);
+      RETURN_NOT_OK(result->Resize(kCompressionPrefixLength + length));
+      compressed[i] = std::move(result);
+      return Status::OK();
+    };
+    // Blocking a worker of the CPU thread pool on nested tasks may deadlock
+    const bool use_threads = options_.use_threads &&
+                             !::arrow::internal::GetCpuThreadPool()->OwnsThisThread();
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        use_threads, static_cast<int>(buffers.size()), compress_buffer));
+
+    std::vector<std::shared_ptr<Buffer>> body_buffers;
+    body_buffers.reserve(buffers.size());
+    buffer_parts_.clear();
+    for (size_t i = 0; i < buffers.size(); ++i) {
+      if (compressed[i] != nullptr) {
+        body_buffers.push_back(std::move(compressed[i]));
+        buffer_parts_.push_back(1);
+      } else if (buffers[i] == nullptr || buffers[i]->size() == 0) {
+        // Empty buffers have no length prefix
+        body_buffers.push_back(buffers[i]);
+        buffer_parts_.push_back(1);
+      } else {
+        body_buffers.push_back(kUncompressedPrefix);
+        body_buffers.push_back(buffers[i]);
+        buffer_parts_.push_back(2);
+      }
+    }
+    out_->body_buffers = std::move(body_buffers);
+    return Status::OK();
+  }
+
   template <typename ArrayType>
   Status VisitFixedWidth(const ArrayType& array) {
     std::shared_ptr<Buffer> data = array.values();
@@ -502,6 +588,8 @@ class RecordBatchSerializer : public ArrayVisitor {
 
   std::vector<internal::FieldMetadata> field_nodes_;
   std::vector<internal::BufferMetadata> buffer_meta_;
+  // Number of body buffers making up each buffer of the IPC message
+  std::vector<int> buffer_parts_;
 
   const IpcOptions& options_;
   int64_t max_recursion_depth_;
@@ -510,14 +598,17 @@ class RecordBatchSerializer : public ArrayVisitor {
 
 class DictionaryWriter : public RecordBatchSerializer {
  public:
-  DictionaryWriter(int64_t dictionary_id, MemoryPool* pool, int64_t buffer_start_offset,
-                   const IpcOptions& options, IpcPayload* out)
+  DictionaryWriter(int64_t dictionary_id, bool is_delta, MemoryPool* pool,
+                   int64_t buffer_start_offset, const IpcOptions& options,
+                   IpcPayload* out)
       : RecordBatchSerializer(pool, buffer_start_offset, options, out),
-        dictionary_id_(dictionary_id) {}
+        dictionary_id_(dictionary_id),
+        is_delta_(is_delta) {}
 
   Status SerializeMetadata(int64_t num_rows) override {
-    return WriteDictionaryMessage(dictionary_id_, num_rows, out_->body_length,
-                                  field_nodes_, buffer_meta_, &out_->metadata);
+    return WriteDictionaryMessage(dictionary_id_, is_delta_, num_rows, out_->body_length,
+                                  field_nodes_, buffer_meta_, options_.compression,
+                                  &out_->metadata);
   }
 
   Status Assemble(const std::shared_ptr<Array>& dictionary) {
@@ -529,6 +620,7 @@ class DictionaryWriter : public RecordBatchSerializer {
 
  private:
   int64_t dictionary_id_;
+  bool is_delta_;
 };
 
 Status WriteIpcPayload(const IpcPayload& payload, const IpcOptions& options,
@@ -576,9 +668,16 @@ Status GetSchemaPayload(const Schema& schema, const IpcOptions& options,
 Status GetDictionaryPayload(int64_t id, const std::shared_ptr<Array>& dictionary,
                             const IpcOptions& options, MemoryPool* pool,
                             IpcPayload* out) {
+  return GetDictionaryPayload(id, /*is_delta=*/false, dictionary, options, pool, out);
+}
+
+Status GetDictionaryPayload(int64_t id, bool is_delta,
+                            const std::shared_ptr<Array>& dictionary,
+                            const IpcOptions& options, MemoryPool* pool,
+                            IpcPayload* out) {
   out->type = Message::DICTIONARY_BATCH;
   // Frame of reference is 0, see ARROW-384
-  DictionaryWriter writer(id, pool, /*buffer_start_offset=*/0, options, out);
+  DictionaryWriter writer(id, is_delta, pool, /*buffer_start_offset=*/0, options, out);
   return writer.Assemble(dictionary);
 }
 
@@ -931,11 +1030,10 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
     if (!wrote_dictionaries_) {
       RETURN_NOT_OK(WriteDictionaries(batch));
       wrote_dictionaries_ = true;
+    } else if (dictionary_memo_->num_dictionaries() > 0) {
+      RETURN_NOT_OK(WriteDictionaryDeltas(batch));
     }
 
-    // TODO(wesm): Check for delta dictionaries. Can we scan for
-    // deltas while computing the RecordBatch payload to save time?
-
     internal::IpcPayload payload;
     RETURN_NOT_OK(GetRecordBatchPayload(batch, options_, pool_, &payload));
     return payload_writer_->WritePayload(payload);
@@ -966,9 +1064,13 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
   }
 
   Status WriteDictionaries(const RecordBatch& batch) {
-    RETURN_NOT_OK(CollectDictionaries(batch, dictionary_memo_));
+    // Use the ids assigned to the writer's schema, the batch may have its own
+    DictionaryVector dictionaries;
+    RETURN_NOT_OK(CollectDictionaries(batch, schema_, dictionary_memo_, &dictionaries));
+
+    for (const auto& pair : dictionaries) {
+      RETURN_NOT_OK(dictionary_memo_->AddDictionary(pair.first, pair.second));
 
-    for (auto& pair : dictionary_memo_->id_to_dictionary()) {
       internal::IpcPayload payload;
       int64_t dictionary_id = pair.first;
       const auto& dictionary = pair.second;
@@ -980,6 +1082,40 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  // Write the values a batch's dictionaries gained since they were last
+  // written, as delta dictionary batches
+  Status WriteDictionaryDeltas(const RecordBatch& batch) {
+    DictionaryVector dictionaries;
+    RETURN_NOT_OK(CollectDictionaries(batch, schema_, dictionary_memo_, &dictionaries));
+
+    for (const auto& pair : dictionaries) {
+      int64_t dictionary_id = pair.first;
+      const auto& dictionary = pair.second;
+      std::shared_ptr<Array> last_dictionary;
+      RETURN_NOT_OK(dictionary_memo_->GetDictionary(dictionary_id, &last_dictionary));
+      if (dictionary->data() == last_dictionary->data()) {
+        continue;
+      }
+
+      const int64_t last_length = last_dictionary->length();
+      if (dictionary->length() < last_length ||
+          !dictionary->RangeEquals(0, last_length, 0, *last_dictionary)) {
+        return Status::Invalid("Dictionary with id ", dictionary_id,
+                               " was replaced by a dictionary which does not extend it, "
+                               "only dictionary deltas are supported");
+      }
+      if (dictionary->length() > last_length) {
+        internal::IpcPayload payload;
+        RETURN_NOT_OK(GetDictionaryPayload(dictionary_id, /*is_delta=*/true,
+                                           dictionary->Slice(last_length), options_,
+                                           pool_, &payload));
+        RETURN_NOT_OK(payload_writer_->WritePayload(payload));
+      }
+      RETURN_NOT_OK(dictionary_memo_->ReplaceDictionary(dictionary_id, dictionary));
+    }
+    return Status::OK();
+  }
+
  protected:
   std::unique_ptr<internal::IpcPayloadWriter> payload_writer_;
   std::shared_ptr<Schema> shared_schema_;
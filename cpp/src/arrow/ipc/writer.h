@@ -58,6 +58,11 @@ class ARROW_EXPORT RecordBatchWriter {
 
   /// \brief Write a record batch to the stream
   ///
+  /// The dictionaries of dictionary-encoded columns are written before the
+  /// first batch. When a later batch has a dictionary extending the one
+  /// written before, only the new values are written, as a delta dictionary
+  /// batch. Any other change of dictionary is rejected.
+  ///
   /// \param[in] batch the record batch to write to the stream
   /// \return Status
   virtual Status WriteRecordBatch(const RecordBatch& batch) = 0;
@@ -385,6 +390,20 @@ Status GetDictionaryPayload(int64_t id, const std::shared_ptr<Array>& dictionary
                             const IpcOptions& options, MemoryPool* pool,
                             IpcPayload* payload);
 
+/// \brief Compute IpcPayload for a dictionary, or a delta to append to it
+/// \param[in] id the dictionary id
+/// \param[in] is_delta whether the values are appended to the current
+/// dictionary rather than replacing it
+/// \param[in] dictionary the dictionary values
+/// \param[in] options options for serialization
+/// \param[out] payload the output IpcPayload
+/// \return Status
+ARROW_EXPORT
+Status GetDictionaryPayload(int64_t id, bool is_delta,
+                            const std::shared_ptr<Array>& dictionary,
+                            const IpcOptions& options, MemoryPool* pool,
+                            IpcPayload* payload);
+
 /// \brief Compute IpcPayload for the given record batch
 /// \param[in] batch the RecordBatch that is being serialized
 /// \param[in] options options for serialization
@@ -37,6 +37,7 @@
 #include "arrow/util/stl.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/trie.h"
+#include "arrow/util/utf8.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -705,6 +706,12 @@ class HandlerBase : public BlockParser,
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
+    // rapidjson can validate the encoding itself, but one character at a time,
+    // which is much slower than validating the whole block at once
+    util::InitializeUTF8();
+    if (ARROW_PREDICT_FALSE(!util::ValidateUTF8(json->data(), json->size()))) {
+      return ParseError("invalid UTF8 data");
+    }
     rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
     using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
     return DoParse(handler, InputStream(ms));
@@ -214,6 +214,15 @@ TEST(BlockParserWithSchema, FailOnIncompleteJson) {
   ASSERT_RAISES(Invalid, ParseFromString(options, "{\"a\":0, \"b\"", &parsed));
 }
 
+TEST(BlockParserWithSchema, FailOnInvalidUTF8) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema({field("a", utf8())});
+  std::shared_ptr<Array> parsed;
+  ASSERT_RAISES(Invalid, ParseFromString(options, "{\"a\":\"\xff\"}", &parsed));
+  ASSERT_RAISES(Invalid, ParseFromString(options, "{\"a\":\"\xe5\xbf\"}", &parsed));
+  ASSERT_RAISES(Invalid, ParseFromString(options, "{\"\xc3\":\"x\"}", &parsed));
+}
+
 TEST(BlockParser, Basics) {
   auto options = ParseOptions::Defaults();
   options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
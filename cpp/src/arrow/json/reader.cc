@@ -17,6 +17,8 @@
 
 #include "arrow/json/reader.h"
 
+#include <deque>
+#include <future>
 #include <utility>
 #include <vector>
 
@@ -28,6 +30,7 @@
 #include "arrow/json/converter.h"
 #include "arrow/json/parser.h"
 #include "arrow/record_batch.h"
+#include "arrow/result.h"
 #include "arrow/table.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
@@ -45,6 +48,48 @@ using internal::ThreadPool;
 
 namespace json {
 
+// Parse `partial + completion + whole`, i.e. a sequence of whole JSON objects
+static Status ParseBlock(MemoryPool* pool, const ParseOptions& parse_options,
+                         const std::shared_ptr<Buffer>& partial,
+                         const std::shared_ptr<Buffer>& completion,
+                         const std::shared_ptr<Buffer>& whole,
+                         std::shared_ptr<Array>* out) {
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::Make(pool, parse_options, &parser));
+  RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
+                                             whole->size()));
+
+  if (partial->size() != 0 || completion->size() != 0) {
+    std::shared_ptr<Buffer> straddling;
+    if (partial->size() == 0) {
+      straddling = completion;
+    } else if (completion->size() == 0) {
+      straddling = partial;
+    } else {
+      RETURN_NOT_OK(ConcatenateBuffers({partial, completion}, pool, &straddling));
+    }
+    RETURN_NOT_OK(parser->Parse(straddling));
+  }
+
+  if (whole->size() != 0) {
+    RETURN_NOT_OK(parser->Parse(whole));
+  }
+
+  return parser->Finish(out);
+}
+
+static std::shared_ptr<DataType> InitialType(const ParseOptions& parse_options) {
+  return parse_options.explicit_schema
+             ? struct_(parse_options.explicit_schema->fields())
+             : struct_({});
+}
+
+static const PromotionGraph* PromotionGraphFor(const ParseOptions& parse_options) {
+  return parse_options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
+             ? GetPromotionGraph()
+             : nullptr;
+}
+
 class TableReaderImpl : public TableReader,
                         public std::enable_shared_from_this<TableReaderImpl> {
  public:
@@ -114,45 +159,182 @@ class TableReaderImpl : public TableReader,
 
  private:
   Status MakeBuilder() {
-    auto type = parse_options_.explicit_schema
-                    ? struct_(parse_options_.explicit_schema->fields())
-                    : struct_({});
-
-    auto promotion_graph =
-        parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-            ? GetPromotionGraph()
-            : nullptr;
-
-    return MakeChunkedArrayBuilder(task_group_, pool_, promotion_graph, type, &builder_);
+    return MakeChunkedArrayBuilder(task_group_, pool_, PromotionGraphFor(parse_options_),
+                                   InitialType(parse_options_), &builder_);
   }
 
   Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
                         const std::shared_ptr<Buffer>& completion,
                         const std::shared_ptr<Buffer>& whole, int64_t block_index) {
-    std::unique_ptr<BlockParser> parser;
-    RETURN_NOT_OK(BlockParser::Make(pool_, parse_options_, &parser));
-    RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
-                                               whole->size()));
-
-    if (partial->size() != 0 || completion->size() != 0) {
-      std::shared_ptr<Buffer> straddling;
-      if (partial->size() == 0) {
-        straddling = completion;
-      } else if (completion->size() == 0) {
-        straddling = partial;
-      } else {
-        RETURN_NOT_OK(ConcatenateBuffers({partial, completion}, pool_, &straddling));
+    std::shared_ptr<Array> parsed;
+    RETURN_NOT_OK(ParseBlock(pool_, parse_options_, partial, completion, whole, &parsed));
+    builder_->Insert(block_index, field("", parsed->type()), parsed);
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  std::unique_ptr<Chunker> chunker_;
+  std::shared_ptr<TaskGroup> task_group_;
+  Iterator<std::shared_ptr<Buffer>> block_iterator_;
+  std::shared_ptr<ChunkedArrayBuilder> builder_;
+};
+
+class StreamingReaderImpl : public StreamingReader,
+                            public std::enable_shared_from_this<StreamingReaderImpl> {
+ public:
+  // If `thread_pool` is null, blocks are parsed serially
+  StreamingReaderImpl(MemoryPool* pool, const ReadOptions& read_options,
+                      const ParseOptions& parse_options, ThreadPool* thread_pool)
+      : pool_(pool),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        chunker_(MakeChunker(parse_options_)),
+        thread_pool_(thread_pool),
+        promotion_graph_(PromotionGraphFor(parse_options_)),
+        type_(InitialType(parse_options_)) {}
+
+  Status Init(std::shared_ptr<io::InputStream> input) {
+    Iterator<std::shared_ptr<Buffer>> it;
+    RETURN_NOT_OK(io::MakeInputStreamIterator(input, read_options_.block_size, &it));
+    // Readahead as many blocks as can be parsed concurrently
+    max_pending_ = (thread_pool_ != nullptr) ? thread_pool_->GetCapacity() : 1;
+    RETURN_NOT_OK(MakeReadaheadIterator(std::move(it), max_pending_, &block_iterator_));
+
+    RETURN_NOT_OK(block_iterator_.Next(&block_));
+    if (!block_) {
+      return Status::Invalid("Empty JSON file");
+    }
+    partial_ = std::make_shared<Buffer>("");
+
+    // Convert first block, so that the schema is known
+    std::shared_ptr<Buffer> partial, completion, whole;
+    std::shared_ptr<Array> parsed;
+    RETURN_NOT_OK(NextChunk(&partial, &completion, &whole));
+    RETURN_NOT_OK(ParseBlock(pool_, parse_options_, partial, completion, whole, &parsed));
+    return ConvertBlock(parsed, &first_batch_);
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (first_batch_) {
+      *out = std::move(first_batch_);
+      if ((*out)->num_rows() > 0) {
+        return Status::OK();
+      }
+    }
+    RETURN_NOT_OK(error_);
+    while (true) {
+      error_ = ScheduleBlocks();
+      if (!error_.ok()) {
+        break;
       }
-      RETURN_NOT_OK(parser->Parse(straddling));
+      if (pending_.empty()) {
+        // EOF
+        out->reset();
+        return Status::OK();
+      }
+      auto maybe_parsed = pending_.front().get();
+      pending_.pop_front();
+      if (!maybe_parsed.ok()) {
+        error_ = maybe_parsed.status();
+        break;
+      }
+      error_ = ConvertBlock(maybe_parsed.ValueOrDie(), out);
+      if (!error_.ok()) {
+        break;
+      }
+      // Skip empty blocks (e.g. whitespace only)
+      if ((*out)->num_rows() > 0) {
+        return Status::OK();
+      }
+    }
+    // Stop reading after an error, but wait for pending tasks before reporting it
+    for (auto& fut : pending_) {
+      fut.wait();
+    }
+    pending_.clear();
+    out->reset();
+    return error_;
+  }
+
+ private:
+  using ParsedFuture = std::future<Result<std::shared_ptr<Array>>>;
+
+  static ParsedFuture MakeReadyFuture(Result<std::shared_ptr<Array>> result) {
+    std::promise<Result<std::shared_ptr<Array>>> promise;
+    promise.set_value(std::move(result));
+    return promise.get_future();
+  }
+
+  // Get the next chunk of whole JSON objects, as `partial + completion + whole`.
+  // `block_` is null at EOF.
+  Status NextChunk(std::shared_ptr<Buffer>* partial, std::shared_ptr<Buffer>* completion,
+                   std::shared_ptr<Buffer>* whole) {
+    DCHECK_NE(block_, nullptr);
+    std::shared_ptr<Buffer> next_block, next_partial;
+    RETURN_NOT_OK(block_iterator_.Next(&next_block));
+
+    if (!next_block) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(chunker_->ProcessFinal(partial_, block_, completion, whole));
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(
+          chunker_->ProcessWithPartial(partial_, block_, completion, &starts_with_whole));
+
+      // Get all whole objects entirely inside the current buffer
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, whole, &next_partial));
     }
 
-    if (whole->size() != 0) {
-      RETURN_NOT_OK(parser->Parse(whole));
+    *partial = std::move(partial_);
+    partial_ = std::move(next_partial);
+    block_ = std::move(next_block);
+    return Status::OK();
+  }
+
+  // Launch parsing of blocks until the window of pending blocks is full
+  Status ScheduleBlocks() {
+    while (block_ && static_cast<int32_t>(pending_.size()) < max_pending_) {
+      std::shared_ptr<Buffer> partial, completion, whole;
+      RETURN_NOT_OK(NextChunk(&partial, &completion, &whole));
+
+      auto self = shared_from_this();
+      auto parse = [self, partial, completion, whole]() -> Result<std::shared_ptr<Array>> {
+        std::shared_ptr<Array> parsed;
+        RETURN_NOT_OK(ParseBlock(self->pool_, self->parse_options_, partial, completion,
+                                 whole, &parsed));
+        return parsed;
+      };
+      if (thread_pool_ != nullptr) {
+        pending_.push_back(thread_pool_->Submit(std::move(parse)));
+      } else {
+        pending_.push_back(MakeReadyFuture(parse()));
+      }
     }
+    return Status::OK();
+  }
 
-    std::shared_ptr<Array> parsed;
-    RETURN_NOT_OK(parser->Finish(&parsed));
-    builder_->Insert(block_index, field("", parsed->type()), parsed);
+  // Convert a parsed block, starting from the types of the previous block.
+  // This is called serially, in file order.
+  Status ConvertBlock(const std::shared_ptr<Array>& parsed,
+                      std::shared_ptr<RecordBatch>* out) {
+    std::shared_ptr<ChunkedArrayBuilder> builder;
+    RETURN_NOT_OK(MakeChunkedArrayBuilder(TaskGroup::MakeSerial(), pool_,
+                                          promotion_graph_, type_, &builder));
+    builder->Insert(0, field("", parsed->type()), parsed);
+    std::shared_ptr<ChunkedArray> converted;
+    RETURN_NOT_OK(builder->Finish(&converted));
+    DCHECK_EQ(converted->num_chunks(), 1);
+
+    // Later blocks are converted starting from the (possibly promoted) types
+    // of this block
+    type_ = converted->type();
+    RETURN_NOT_OK(RecordBatch::FromStructArray(converted->chunk(0), out));
+    schema_ = (*out)->schema();
     return Status::OK();
   }
 
@@ -160,9 +342,24 @@ class TableReaderImpl : public TableReader,
   ReadOptions read_options_;
   ParseOptions parse_options_;
   std::unique_ptr<Chunker> chunker_;
-  std::shared_ptr<TaskGroup> task_group_;
+  ThreadPool* thread_pool_;
+  int32_t max_pending_ = 1;
+  const PromotionGraph* promotion_graph_;
+
   Iterator<std::shared_ptr<Buffer>> block_iterator_;
-  std::shared_ptr<ChunkedArrayBuilder> builder_;
+  // Next block to chunk, or null at EOF
+  std::shared_ptr<Buffer> block_;
+  // Trailing incomplete object of the previous block
+  std::shared_ptr<Buffer> partial_;
+
+  // Struct type of the last converted block
+  std::shared_ptr<DataType> type_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> first_batch_;
+  // Blocks being parsed, in file order
+  std::deque<ParsedFuture> pending_;
+  // Sticky error
+  Status error_;
 };
 
 Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
@@ -182,6 +379,18 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   return Status::OK();
 }
 
+Status StreamingReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                             const ReadOptions& read_options,
+                             const ParseOptions& parse_options,
+                             std::shared_ptr<StreamingReader>* out) {
+  ThreadPool* thread_pool = read_options.use_threads ? GetCpuThreadPool() : nullptr;
+  auto ptr =
+      std::make_shared<StreamingReaderImpl>(pool, read_options, parse_options, thread_pool);
+  RETURN_NOT_OK(ptr->Init(std::move(input)));
+  *out = std::move(ptr);
+  return Status::OK();
+}
+
 Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
                 std::shared_ptr<RecordBatch>* out) {
   std::unique_ptr<BlockParser> parser;
@@ -190,12 +399,8 @@ Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
   std::shared_ptr<Array> parsed;
   RETURN_NOT_OK(parser->Finish(&parsed));
 
-  auto type =
-      options.explicit_schema ? struct_(options.explicit_schema->fields()) : struct_({});
-  auto promotion_graph =
-      options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-          ? GetPromotionGraph()
-          : nullptr;
+  auto type = InitialType(options);
+  auto promotion_graph = PromotionGraphFor(options);
   std::shared_ptr<ChunkedArrayBuilder> builder;
   RETURN_NOT_OK(MakeChunkedArrayBuilder(internal::TaskGroup::MakeSerial(),
                                         default_memory_pool(), promotion_graph, type,
@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "arrow/json/options.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
@@ -29,7 +30,6 @@ namespace arrow {
 class Buffer;
 class MemoryPool;
 class Table;
-class RecordBatch;
 class Array;
 class DataType;
 
@@ -55,6 +55,34 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// A class that reads a JSON file incrementally, as a stream of RecordBatches
+///
+/// The file is expected to consist of individual line-separated JSON objects.
+/// Each block of `ReadOptions::block_size` bytes is converted to a separate
+/// RecordBatch, so that only a few blocks need to be held in memory at once.
+/// If `ReadOptions::use_threads` is true, up to the CPU thread pool capacity of
+/// blocks are parsed concurrently; conversion happens in file order as batches
+/// are read.
+///
+/// When unexpected fields are inferred, each block is converted starting from
+/// the types of the previous block, which may be promoted (for example from
+/// int64 to double) or extended with new fields.  Batches which were already
+/// emitted are left as is, so the schema of a batch may differ from the
+/// schema of the batches before it; schema() returns the schema of the last
+/// batch read (or of the first block, if none was read yet).
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  /// Create a StreamingReader instance
+  ///
+  /// The first block is read and converted here, so that schema() is
+  /// available as soon as this function returns.
+  static Status Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                     const ReadOptions&, const ParseOptions&,
+                     std::shared_ptr<StreamingReader>* out);
+};
+
 ARROW_EXPORT Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
                              std::shared_ptr<RecordBatch>* out);
 
@@ -25,6 +25,7 @@
 #include "arrow/json/options.h"
 #include "arrow/json/reader.h"
 #include "arrow/json/test_common.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 
@@ -273,5 +274,130 @@ TEST(ReaderTest, MultipleChunksParallel) {
   AssertTablesEqual(*serial, *threaded);
 }
 
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUpReader(const std::string& json) {
+    json_ = json;
+    read_options_.use_threads = GetParam();
+    std::shared_ptr<io::InputStream> input;
+    ASSERT_OK(MakeStream(json_, &input));
+    ASSERT_OK(StreamingReader::Make(default_memory_pool(), input, read_options_,
+                                    parse_options_, &reader_));
+  }
+
+  void ReadAll(std::vector<std::shared_ptr<RecordBatch>>* out) {
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      ASSERT_OK(reader_->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      AssertSchemaEqual(*reader_->schema(), *batch->schema());
+      ASSERT_OK(batch->Validate());
+      out->push_back(std::move(batch));
+    }
+  }
+
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ReadOptions read_options_ = ReadOptions::Defaults();
+  std::string json_;
+  std::shared_ptr<StreamingReader> reader_;
+};
+
+INSTANTIATE_TEST_CASE_P(StreamingReaderTest, StreamingReaderTest,
+                        ::testing::Values(false, true));
+
+TEST_P(StreamingReaderTest, Empty) {
+  read_options_.use_threads = GetParam();
+  std::shared_ptr<io::InputStream> input;
+  ASSERT_OK(MakeStream("", &input));
+  ASSERT_RAISES(Invalid, StreamingReader::Make(default_memory_pool(), input,
+                                               read_options_, parse_options_, &reader_));
+}
+
+TEST_P(StreamingReaderTest, MultipleChunks) {
+  std::string json;
+  for (int i = 0; i < 1000; ++i) {
+    json += "{\"a\":" + std::to_string(i) + ", \"b\":\"" + std::to_string(i) + "\"}\n";
+  }
+  read_options_.block_size = 256;
+  SetUpReader(json);
+  AssertSchemaEqual(*schema({field("a", int64()), field("b", utf8())}),
+                    *reader_->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadAll(&batches);
+  ASSERT_GT(batches.size(), 1);
+
+  int64_t expected = 0;
+  for (const auto& batch : batches) {
+    const auto& a = checked_cast<const Int64Array&>(*batch->column(0));
+    for (int64_t i = 0; i < a.length(); ++i) {
+      ASSERT_EQ(a.Value(i), expected) << " at index " << i;
+      ++expected;
+    }
+  }
+  ASSERT_EQ(expected, 1000);
+}
+
+TEST_P(StreamingReaderTest, SchemaPromotion) {
+  // Integers only in the first half, doubles and a new field in the second half
+  std::string json;
+  for (int i = 0; i < 100; ++i) {
+    json += "{\"a\":" + std::to_string(i) + "}\n";
+  }
+  for (int i = 0; i < 100; ++i) {
+    json += "{\"a\":" + std::to_string(i) + ".5, \"b\":\"x\"}\n";
+  }
+  read_options_.block_size = 64;
+  SetUpReader(json);
+  AssertSchemaEqual(*schema({field("a", int64())}), *reader_->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadAll(&batches);
+
+  // Emitted batches are not rewritten when a later block promotes the schema
+  AssertSchemaEqual(*schema({field("a", int64())}), *batches.front()->schema());
+  AssertSchemaEqual(*schema({field("a", float64()), field("b", utf8())}),
+                    *batches.back()->schema());
+  AssertSchemaEqual(*batches.back()->schema(), *reader_->schema());
+
+  int64_t num_rows = 0;
+  bool promoted = false;
+  for (const auto& batch : batches) {
+    // Once promoted, the types of later batches are kept
+    if (batch->column(0)->type_id() == Type::DOUBLE) {
+      promoted = true;
+    }
+    if (promoted) {
+      ASSERT_EQ(batch->column(0)->type_id(), Type::DOUBLE);
+    }
+    num_rows += batch->num_rows();
+  }
+  ASSERT_EQ(num_rows, 200);
+}
+
+TEST_P(StreamingReaderTest, UnexpectedFieldError) {
+  std::string json;
+  for (int i = 0; i < 100; ++i) {
+    json += "{\"a\":" + std::to_string(i) + "}\n";
+  }
+  json += "{\"a\":0, \"b\":0}\n";
+  read_options_.block_size = 64;
+  parse_options_.explicit_schema = schema({field("a", int32())});
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  SetUpReader(json);
+  AssertSchemaEqual(*parse_options_.explicit_schema, *reader_->schema());
+
+  std::shared_ptr<RecordBatch> batch;
+  Status st;
+  do {
+    st = reader_->ReadNext(&batch);
+  } while (st.ok() && batch != nullptr);
+  ASSERT_RAISES(Invalid, st);
+  // The error is sticky
+  ASSERT_RAISES(Invalid, reader_->ReadNext(&batch));
+}
+
 }  // namespace json
 }  // namespace arrow
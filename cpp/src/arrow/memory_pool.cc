@@ -23,8 +23,11 @@
 #include <iostream>   // IWYU pragma: keep
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"  // IWYU pragma: keep
 
 #ifdef ARROW_JEMALLOC
@@ -533,4 +536,243 @@ int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
 
 std::string ProxyMemoryPool::backend_name() const { return impl_->backend_name(); }
 
+///////////////////////////////////////////////////////////////////////
+// CachingMemoryPool implementation
+
+namespace {
+
+// The smallest size class is the alignment of allocations
+constexpr int kMinSizeClassLog2 = 6;
+
+// Identifies the CachingMemoryPool instances in the thread-local free lists,
+// since their addresses may be reused
+std::atomic<uint64_t> next_caching_pool_id(0);
+
+// The free lists of one thread, indexed by size class. They are only used by
+// their thread, except when all cached regions are released, so the mutex is
+// uncontended.
+struct ThreadFreeLists {
+  explicit ThreadFreeLists(int num_size_classes) : lists(num_size_classes) {}
+
+  std::mutex mutex;
+  std::vector<std::vector<uint8_t*>> lists;
+};
+
+}  // namespace
+
+constexpr int64_t CachingMemoryPool::kDefaultCapacity;
+constexpr int64_t CachingMemoryPool::kDefaultMaxCachedSize;
+
+class CachingMemoryPool::CachingMemoryPoolImpl
+    : public std::enable_shared_from_this<CachingMemoryPoolImpl> {
+ public:
+  CachingMemoryPoolImpl(MemoryPool* pool, int64_t capacity, int64_t max_cached_size)
+      : pool_(pool),
+        capacity_(capacity),
+        max_cached_size_(max_cached_size),
+        id_(next_caching_pool_id++),
+        bytes_cached_(0) {
+    num_size_classes_ = SizeClass(max_cached_size) + 1;
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    const int size_class = SizeClass(size);
+    if (size_class < 0) {
+      RETURN_NOT_OK(pool_->Allocate(size, out));
+      stats_.UpdateAllocatedBytes(size);
+      return Status::OK();
+    }
+
+    const int64_t class_size = SizeClassBytes(size_class);
+    ThreadFreeLists* free_lists = GetThreadFreeLists();
+    {
+      std::lock_guard<std::mutex> lock(free_lists->mutex);
+      auto& list = free_lists->lists[size_class];
+      if (!list.empty()) {
+        *out = list.back();
+        list.pop_back();
+        bytes_cached_ -= class_size;
+        stats_.UpdateAllocatedBytes(size);
+        return Status::OK();
+      }
+    }
+    RETURN_NOT_OK(pool_->Allocate(class_size, out));
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const int old_size_class = SizeClass(old_size);
+    const int new_size_class = SizeClass(new_size);
+    if (old_size_class < 0 && new_size_class < 0) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    } else if (old_size_class != new_size_class) {
+      uint8_t* out;
+      RETURN_NOT_OK(Allocate(new_size, &out));
+      std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      Free(*ptr, old_size);
+      *ptr = out;
+      return Status::OK();
+    }
+    // Otherwise the region of the size class is large enough already
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    stats_.UpdateAllocatedBytes(-size);
+    const int size_class = SizeClass(size);
+    if (size_class < 0) {
+      pool_->Free(buffer, size);
+      return;
+    }
+
+    const int64_t class_size = SizeClassBytes(size_class);
+    if (bytes_cached_.fetch_add(class_size) + class_size > capacity_) {
+      bytes_cached_ -= class_size;
+      pool_->Free(buffer, class_size);
+      return;
+    }
+    ThreadFreeLists* free_lists = GetThreadFreeLists();
+    std::lock_guard<std::mutex> lock(free_lists->mutex);
+    free_lists->lists[size_class].push_back(buffer);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  int64_t bytes_cached() const { return bytes_cached_.load(); }
+
+  void ReleaseUnused() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& free_lists : thread_free_lists_) {
+      Release(free_lists.get());
+    }
+  }
+
+ private:
+  struct ThreadLocalEntry {
+    uint64_t pool_id;
+    std::weak_ptr<CachingMemoryPoolImpl> pool;
+    std::shared_ptr<ThreadFreeLists> free_lists;
+  };
+
+  // The free lists of a thread for each pool it used, returned to the pools
+  // still alive when the thread exits
+  struct ThreadLocalFreeLists {
+    ~ThreadLocalFreeLists() {
+      for (const auto& entry : entries) {
+        auto pool = entry.pool.lock();
+        if (pool != nullptr) {
+          pool->ReleaseThread(entry.free_lists);
+        }
+      }
+    }
+
+    std::vector<ThreadLocalEntry> entries;
+  };
+
+  // Return -1 if regions of this size aren't cached
+  int SizeClass(int64_t size) const {
+    if (size <= 0 || size > max_cached_size_) {
+      return -1;
+    }
+    return std::max(BitUtil::Log2(static_cast<uint64_t>(size)), kMinSizeClassLog2) -
+           kMinSizeClassLog2;
+  }
+
+  static int64_t SizeClassBytes(int size_class) {
+    return static_cast<int64_t>(1) << (size_class + kMinSizeClassLog2);
+  }
+
+  ThreadFreeLists* GetThreadFreeLists() {
+    static thread_local ThreadLocalFreeLists thread_local_free_lists;
+    auto& entries = thread_local_free_lists.entries;
+    for (const auto& entry : entries) {
+      if (entry.pool_id == id_) {
+        return entry.free_lists.get();
+      }
+    }
+
+    // First use of this pool by the thread. Forget the pools destroyed since.
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                 [](const ThreadLocalEntry& entry) {
+                                   return entry.pool.expired();
+                                 }),
+                  entries.end());
+    auto free_lists = std::make_shared<ThreadFreeLists>(num_size_classes_);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      thread_free_lists_.push_back(free_lists);
+    }
+    entries.push_back({id_, shared_from_this(), free_lists});
+    return free_lists.get();
+  }
+
+  void Release(ThreadFreeLists* free_lists) {
+    std::lock_guard<std::mutex> lock(free_lists->mutex);
+    for (int size_class = 0; size_class < num_size_classes_; ++size_class) {
+      auto& list = free_lists->lists[size_class];
+      const int64_t class_size = SizeClassBytes(size_class);
+      for (uint8_t* buffer : list) {
+        pool_->Free(buffer, class_size);
+      }
+      bytes_cached_ -= class_size * static_cast<int64_t>(list.size());
+      list.clear();
+    }
+  }
+
+  void ReleaseThread(const std::shared_ptr<ThreadFreeLists>& free_lists) {
+    Release(free_lists.get());
+    std::lock_guard<std::mutex> lock(mutex_);
+    thread_free_lists_.erase(
+        std::remove(thread_free_lists_.begin(), thread_free_lists_.end(), free_lists),
+        thread_free_lists_.end());
+  }
+
+  MemoryPool* pool_;
+  const int64_t capacity_;
+  const int64_t max_cached_size_;
+  const uint64_t id_;
+  int num_size_classes_;
+  std::atomic<int64_t> bytes_cached_;
+  internal::MemoryPoolStats stats_;
+
+  // Guards the registration of the free lists of each thread
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<ThreadFreeLists>> thread_free_lists_;
+};
+
+CachingMemoryPool::CachingMemoryPool(MemoryPool* pool, int64_t capacity,
+                                     int64_t max_cached_size)
+    : impl_(std::make_shared<CachingMemoryPoolImpl>(pool, capacity, max_cached_size)) {}
+
+CachingMemoryPool::~CachingMemoryPool() { impl_->ReleaseUnused(); }
+
+Status CachingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status CachingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                     uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void CachingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t CachingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t CachingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string CachingMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t CachingMemoryPool::bytes_cached() const { return impl_->bytes_cached(); }
+
+void CachingMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
 }  // namespace arrow
@@ -150,6 +150,52 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// Derived class for memory allocation.
+///
+/// Keeps freed memory regions for reuse instead of returning them to the
+/// parent MemoryPool. Regions of up to max_cached_size bytes are allocated
+/// from the parent with their size rounded up to a power of two (a "size
+/// class"). When freed, they are put on free lists of the calling thread, and
+/// later allocations of the same size class by that thread are served from
+/// these lists without synchronization with other threads.
+///
+/// At most capacity bytes are cached over all threads. Beyond that, freed
+/// regions are returned to the parent pool directly. The regions cached by a
+/// thread are returned to the parent pool when the thread exits, and all of
+/// them when the pool is destroyed or ReleaseUnused() is called.
+class ARROW_EXPORT CachingMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultCapacity = 64 * 1024 * 1024;
+  static constexpr int64_t kDefaultMaxCachedSize = 1024 * 1024;
+
+  explicit CachingMemoryPool(MemoryPool* pool, int64_t capacity = kDefaultCapacity,
+                             int64_t max_cached_size = kDefaultMaxCachedSize);
+  ~CachingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  /// The number of bytes allocated through this pool and not yet freed,
+  /// excluding cached regions
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of bytes of freed regions kept for reuse
+  int64_t bytes_cached() const;
+
+  /// Return the regions cached by all threads to the parent pool
+  void ReleaseUnused();
+
+ private:
+  class CachingMemoryPoolImpl;
+  std::shared_ptr<CachingMemoryPoolImpl> impl_;
+};
+
 /// Return a process-wide memory pool based on the system allocator.
 ARROW_EXPORT MemoryPool* system_memory_pool();
 
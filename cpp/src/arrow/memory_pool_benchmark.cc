@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/memory_pool.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+struct SystemAlloc {
+  static MemoryPool* GetAllocator() { return system_memory_pool(); }
+};
+
+#ifdef ARROW_JEMALLOC
+struct JemallocAlloc {
+  static MemoryPool* GetAllocator() {
+    MemoryPool* pool;
+    ARROW_CHECK_OK(jemalloc_memory_pool(&pool));
+    return pool;
+  }
+};
+#endif
+
+#ifdef ARROW_MIMALLOC
+struct MimallocAlloc {
+  static MemoryPool* GetAllocator() {
+    MemoryPool* pool;
+    ARROW_CHECK_OK(mimalloc_memory_pool(&pool));
+    return pool;
+  }
+};
+#endif
+
+struct CachingAlloc {
+  static MemoryPool* GetAllocator() {
+    static CachingMemoryPool pool(default_memory_pool());
+    return &pool;
+  }
+};
+
+// Allocate and free a buffer of the same size, from each of the threads
+template <typename Alloc>
+static void AllocateDeallocate(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t nbytes = state.range(0);
+  MemoryPool* pool = Alloc::GetAllocator();
+
+  for (auto _ : state) {
+    uint8_t* data;
+    ARROW_CHECK_OK(pool->Allocate(nbytes, &data));
+    benchmark::DoNotOptimize(data);
+    pool->Free(data, nbytes);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Keep a working set of buffers of random sizes, replacing a random one at
+// each iteration, as builders and decoders of concurrent scans do
+template <typename Alloc>
+static void AllocateWorkingSet(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t max_nbytes = state.range(0);
+  const int kWorkingSetSize = 64;
+  MemoryPool* pool = Alloc::GetAllocator();
+
+  std::default_random_engine engine(
+      static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())));
+  std::uniform_int_distribution<int64_t> sizes(1, max_nbytes);
+  std::uniform_int_distribution<int> indices(0, kWorkingSetSize - 1);
+  std::vector<std::pair<uint8_t*, int64_t>> buffers(kWorkingSetSize);
+  for (auto& buffer : buffers) {
+    buffer.second = sizes(engine);
+    ARROW_CHECK_OK(pool->Allocate(buffer.second, &buffer.first));
+  }
+
+  for (auto _ : state) {
+    auto& buffer = buffers[indices(engine)];
+    pool->Free(buffer.first, buffer.second);
+    buffer.second = sizes(engine);
+    ARROW_CHECK_OK(pool->Allocate(buffer.second, &buffer.first));
+    benchmark::DoNotOptimize(buffer.first);
+  }
+
+  for (const auto& buffer : buffers) {
+    pool->Free(buffer.first, buffer.second);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+#define BENCHMARK_ALLOCATOR(ALLOC)                       \
+  BENCHMARK_TEMPLATE(AllocateDeallocate, ALLOC)          \
+      ->RangeMultiplier(16)                              \
+      ->Range(64, 1 << 20)                               \
+      ->ThreadRange(1, 16)                               \
+      ->UseRealTime();                                   \
+  BENCHMARK_TEMPLATE(AllocateWorkingSet, ALLOC)          \
+      ->RangeMultiplier(16)                              \
+      ->Range(1 << 10, 1 << 16)                          \
+      ->ThreadRange(1, 16)                               \
+      ->UseRealTime()
+
+BENCHMARK_ALLOCATOR(SystemAlloc);
+#ifdef ARROW_JEMALLOC
+BENCHMARK_ALLOCATOR(JemallocAlloc);
+#endif
+#ifdef ARROW_MIMALLOC
+BENCHMARK_ALLOCATOR(MimallocAlloc);
+#endif
+BENCHMARK_ALLOCATOR(CachingAlloc);
+
+}  // namespace arrow
@@ -16,6 +16,10 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -144,6 +148,158 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pp.bytes_allocated());
 }
 
+// The pool is created for each test, so that its cached regions are returned
+// to the default pool at the end of the test
+class TestCachingMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  TestCachingMemoryPool() : pool_(default_memory_pool()) {}
+
+  MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  CachingMemoryPool pool_;
+};
+
+TEST_F(TestCachingMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestCachingMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestCachingMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(CachingMemoryPool, Reuse) {
+  ProxyMemoryPool parent(default_memory_pool());
+  CachingMemoryPool pool(&parent);
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(100, &data));
+  EXPECT_EQ(static_cast<uint64_t>(0), reinterpret_cast<uint64_t>(data) % 64);
+  ASSERT_EQ(100, pool.bytes_allocated());
+  // Allocated from the parent with the size rounded up to its size class
+  ASSERT_EQ(128, parent.bytes_allocated());
+
+  pool.Free(data, 100);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(128, pool.bytes_cached());
+  ASSERT_EQ(128, parent.bytes_allocated());
+
+  // A region of the same size class is reused
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(120, &data2));
+  ASSERT_EQ(data, data2);
+  ASSERT_EQ(0, pool.bytes_cached());
+  ASSERT_EQ(128, parent.bytes_allocated());
+
+  // Growing within the size class keeps the region
+  ASSERT_OK(pool.Reallocate(120, 128, &data2));
+  ASSERT_EQ(data, data2);
+  data2[127] = 42;
+  ASSERT_OK(pool.Reallocate(128, 1000, &data2));
+  ASSERT_EQ(42, data2[127]);
+  ASSERT_EQ(1000, pool.bytes_allocated());
+  ASSERT_EQ(128, pool.bytes_cached());
+  ASSERT_EQ(1024 + 128, parent.bytes_allocated());
+  pool.Free(data2, 1000);
+  ASSERT_EQ(1024 + 128, pool.bytes_cached());
+
+  pool.ReleaseUnused();
+  ASSERT_EQ(0, pool.bytes_cached());
+  ASSERT_EQ(0, parent.bytes_allocated());
+  ASSERT_EQ(1128, pool.max_memory());
+}
+
+TEST(CachingMemoryPool, Capacity) {
+  ProxyMemoryPool parent(default_memory_pool());
+  const int64_t capacity = 1024;
+  const int64_t max_cached_size = 256;
+  CachingMemoryPool pool(&parent, capacity, max_cached_size);
+
+  // Regions larger than max_cached_size are returned to the parent directly
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(1000, &data));
+  ASSERT_EQ(1000, parent.bytes_allocated());
+  pool.Free(data, 1000);
+  ASSERT_EQ(0, pool.bytes_cached());
+  ASSERT_EQ(0, parent.bytes_allocated());
+
+  std::vector<uint8_t*> regions(10);
+  for (auto& region : regions) {
+    ASSERT_OK(pool.Allocate(200, &region));
+  }
+  ASSERT_EQ(10 * 256, parent.bytes_allocated());
+  for (auto region : regions) {
+    pool.Free(region, 200);
+  }
+  // Only capacity bytes are kept
+  ASSERT_EQ(capacity, pool.bytes_cached());
+  ASSERT_EQ(capacity, parent.bytes_allocated());
+}
+
+TEST(CachingMemoryPool, ThreadExit) {
+  ProxyMemoryPool parent(default_memory_pool());
+  CachingMemoryPool pool(&parent);
+
+  std::thread thread([&] {
+    uint8_t* data;
+    ASSERT_OK(pool.Allocate(100, &data));
+    pool.Free(data, 100);
+    ASSERT_EQ(128, pool.bytes_cached());
+  });
+  thread.join();
+
+  // The regions cached by the thread were returned to the parent
+  ASSERT_EQ(0, pool.bytes_cached());
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
+TEST(CachingMemoryPool, Multithreaded) {
+  ProxyMemoryPool parent(default_memory_pool());
+  const int64_t capacity = 64 * 1024;
+  CachingMemoryPool pool(&parent, capacity);
+
+  const int num_threads = 8;
+  const int num_iterations = 2000;
+  // Regions freed by another thread than the one which allocated them
+  std::vector<std::vector<std::pair<uint8_t*, int64_t>>> handed_over(num_threads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&, i] {
+      std::default_random_engine engine(i);
+      std::uniform_int_distribution<int64_t> sizes(1, 4096);
+      std::vector<std::pair<uint8_t*, int64_t>> live;
+      for (int j = 0; j < num_iterations; ++j) {
+        const int64_t size = sizes(engine);
+        uint8_t* data;
+        ASSERT_OK(pool.Allocate(size, &data));
+        std::memset(data, i, static_cast<size_t>(size));
+        live.emplace_back(data, size);
+        if (live.size() > 16) {
+          pool.Free(live.front().first, live.front().second);
+          live.erase(live.begin());
+        }
+      }
+      handed_over[i] = std::move(live);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& regions : handed_over) {
+    for (const auto& region : regions) {
+      pool.Free(region.first, region.second);
+    }
+  }
+
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_LE(pool.bytes_cached(), capacity);
+  pool.ReleaseUnused();
+  ASSERT_EQ(0, pool.bytes_cached());
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
 TEST(Jemalloc, SetDirtyPageDecayMillis) {
   // ARROW-6910
 #ifdef ARROW_JEMALLOC
@@ -58,7 +58,7 @@ class BitWriter {
   int buffer_len() const { return max_bytes_; }
 
   /// Writes a value to buffered_values_, flushing to buffer_ if necessary.  This is bit
-  /// packed.  Returns false if there was not enough space. num_bits must be <= 32.
+  /// packed.  Returns false if there was not enough space. num_bits must be <= 64.
   bool PutValue(uint64_t v, int num_bits);
 
   /// Writes v to the next aligned byte using num_bytes. If T is larger than
@@ -72,9 +72,11 @@ class BitWriter {
   /// For more details on vlq:
   /// en.wikipedia.org/wiki/Variable-length_quantity
   bool PutVlqInt(uint32_t v);
+  bool PutVlqInt(uint64_t v);
 
   // Writes an int zigzag encoded.
   bool PutZigZagVlqInt(int32_t v);
+  bool PutZigZagVlqInt(int64_t v);
 
   /// Get a pointer to the next aligned byte and advance the underlying buffer
   /// by num_bytes.
@@ -127,7 +129,7 @@ class BitReader {
   }
 
   /// Gets the next value from the buffer.  Returns true if 'v' could be read or false if
-  /// there are not enough bytes left. num_bits must be <= 32.
+  /// there are not enough bytes left. num_bits must be <= 64.
   template <typename T>
   bool GetValue(int num_bits, T* v);
 
@@ -147,9 +149,15 @@ class BitReader {
   /// the beginning of a byte. Return false if there were not enough bytes in
   /// the buffer.
   bool GetVlqInt(int32_t* v);
+  bool GetVlqInt(int64_t* v);
 
   // Reads a zigzag encoded int `into` v.
   bool GetZigZagVlqInt(int32_t* v);
+  bool GetZigZagVlqInt(int64_t* v);
+
+  /// Skips num_bits bits of the stream. Returns false if there are not enough
+  /// bits left.
+  bool Advance(int64_t num_bits);
 
   /// Returns the number of bytes left in the stream, not including the current
   /// byte (i.e., there may be an additional fraction of a byte).
@@ -161,6 +169,9 @@ class BitReader {
   /// Maximum byte length of a vlq encoded int
   static const int MAX_VLQ_BYTE_LEN = 5;
 
+  /// Maximum byte length of a vlq encoded int64
+  static const int MAX_VLQ_BYTE_LEN_64 = 10;
+
  private:
   const uint8_t* buffer_;
   int max_bytes_;
@@ -174,9 +185,9 @@ class BitReader {
 };
 
 inline bool BitWriter::PutValue(uint64_t v, int num_bits) {
-  // TODO: revisit this limit if necessary (can be raised to 64 by fixing some edge cases)
-  DCHECK_LE(num_bits, 32);
-  DCHECK_EQ(v >> num_bits, 0) << "v = " << v << ", num_bits = " << num_bits;
+  DCHECK_LE(num_bits, 64);
+  DCHECK(num_bits == 64 || (v >> num_bits) == 0)
+      << "v = " << v << ", num_bits = " << num_bits;
 
   if (ARROW_PREDICT_FALSE(byte_offset_ * 8 + bit_offset_ + num_bits > max_bytes_ * 8))
     return false;
@@ -190,7 +201,8 @@ inline bool BitWriter::PutValue(uint64_t v, int num_bits) {
     buffered_values_ = 0;
     byte_offset_ += 8;
     bit_offset_ -= 64;
-    buffered_values_ = v >> (num_bits - bit_offset_);
+    // A shift by 64 is undefined, it happens when v exactly filled the buffered values
+    buffered_values_ = bit_offset_ == 0 ? 0 : v >> (num_bits - bit_offset_);
   }
   DCHECK_LT(bit_offset_, 64);
   return true;
@@ -235,6 +247,16 @@ inline bool BitWriter::PutVlqInt(uint32_t v) {
   return result;
 }
 
+inline bool BitWriter::PutVlqInt(uint64_t v) {
+  bool result = true;
+  while ((v & 0xFFFFFFFFFFFFFF80ULL) != 0ULL) {
+    result &= PutAligned<uint8_t>(static_cast<uint8_t>((v & 0x7F) | 0x80), 1);
+    v >>= 7;
+  }
+  result &= PutAligned<uint8_t>(static_cast<uint8_t>(v & 0x7F), 1);
+  return result;
+}
+
 namespace detail {
 
 template <typename T>
@@ -264,9 +286,12 @@ inline void GetValue_(int num_bits, T* v, int max_bytes, const uint8_t* buffer,
 #pragma warning(push)
 #pragma warning(disable : 4800 4805)
 #endif
-    // Read bits of v that crossed into new buffered_values_
-    *v = *v | static_cast<T>(BitUtil::TrailingBits(*buffered_values, *bit_offset)
-                             << (num_bits - *bit_offset));
+    // Read bits of v that crossed into new buffered_values_. There are none
+    // (and the shift would be undefined) if v ended with the previous word.
+    if (*bit_offset > 0) {
+      *v = *v | static_cast<T>(BitUtil::TrailingBits(*buffered_values, *bit_offset)
+                               << (num_bits - *bit_offset));
+    }
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
@@ -284,8 +309,7 @@ inline bool BitReader::GetValue(int num_bits, T* v) {
 template <typename T>
 inline int BitReader::GetBatch(int num_bits, T* v, int batch_size) {
   DCHECK(buffer_ != NULL);
-  // TODO: revisit this limit if necessary
-  DCHECK_LE(num_bits, 32);
+  DCHECK_LE(num_bits, 64);
   DCHECK_LE(num_bits, static_cast<int>(sizeof(T) * 8));
 
   int bit_offset = bit_offset_;
@@ -308,7 +332,15 @@ inline int BitReader::GetBatch(int num_bits, T* v, int batch_size) {
     }
   }
 
-  if (sizeof(T) == 4) {
+  if (sizeof(T) == 8) {
+    int num_unpacked =
+        internal::unpack64(buffer + byte_offset, reinterpret_cast<uint64_t*>(v + i),
+                           batch_size - i, num_bits);
+    i += num_unpacked;
+    byte_offset += num_unpacked * num_bits / 8;
+  } else if (ARROW_PREDICT_FALSE(num_bits > 32)) {
+    // Wider values than unpack32 supports are read one by one below
+  } else if (sizeof(T) == 4) {
     int num_unpacked =
         internal::unpack32(reinterpret_cast<const uint32_t*>(buffer + byte_offset),
                            reinterpret_cast<uint32_t*>(v + i), batch_size - i, num_bits);
@@ -383,16 +415,34 @@ inline bool BitReader::GetAligned(int num_bytes, T* v) {
 }
 
 inline bool BitReader::GetVlqInt(int32_t* v) {
-  *v = 0;
+  uint32_t u = 0;
+  int shift = 0;
+  int num_bytes = 0;
+  uint8_t byte = 0;
+  do {
+    // Reject overlong encodings before shifting past the width of the result
+    if (ARROW_PREDICT_FALSE(++num_bytes > MAX_VLQ_BYTE_LEN)) return false;
+    if (!GetAligned<uint8_t>(1, &byte)) return false;
+    u |= static_cast<uint32_t>(byte & 0x7F) << shift;
+    shift += 7;
+  } while ((byte & 0x80) != 0);
+  *v = static_cast<int32_t>(u);
+  return true;
+}
+
+inline bool BitReader::GetVlqInt(int64_t* v) {
+  uint64_t u = 0;
   int shift = 0;
   int num_bytes = 0;
   uint8_t byte = 0;
   do {
+    // Reject overlong encodings before shifting past the width of the result
+    if (ARROW_PREDICT_FALSE(++num_bytes > MAX_VLQ_BYTE_LEN_64)) return false;
     if (!GetAligned<uint8_t>(1, &byte)) return false;
-    *v |= (byte & 0x7F) << shift;
+    u |= static_cast<uint64_t>(byte & 0x7F) << shift;
     shift += 7;
-    DCHECK_LE(++num_bytes, MAX_VLQ_BYTE_LEN);
   } while ((byte & 0x80) != 0);
+  *v = static_cast<int64_t>(u);
   return true;
 }
 
@@ -402,6 +452,12 @@ inline bool BitWriter::PutZigZagVlqInt(int32_t v) {
   return PutVlqInt(u);
 }
 
+inline bool BitWriter::PutZigZagVlqInt(int64_t v) {
+  // Note negative left shift is undefined
+  uint64_t u = (static_cast<uint64_t>(v) << 1) ^ (v >> 63);
+  return PutVlqInt(u);
+}
+
 inline bool BitReader::GetZigZagVlqInt(int32_t* v) {
   int32_t u_signed;
   if (!GetVlqInt(&u_signed)) return false;
@@ -410,6 +466,33 @@ inline bool BitReader::GetZigZagVlqInt(int32_t* v) {
   return true;
 }
 
+inline bool BitReader::GetZigZagVlqInt(int64_t* v) {
+  int64_t u_signed;
+  if (!GetVlqInt(&u_signed)) return false;
+  uint64_t u = static_cast<uint64_t>(u_signed);
+  *reinterpret_cast<uint64_t*>(v) = (u >> 1) ^ -(static_cast<int64_t>(u & 1));
+  return true;
+}
+
+inline bool BitReader::Advance(int64_t num_bits) {
+  int64_t bits_required = bit_offset_ + num_bits;
+  if (ARROW_PREDICT_FALSE(BitUtil::BytesForBits(bits_required) >
+                          max_bytes_ - byte_offset_)) {
+    return false;
+  }
+  byte_offset_ += static_cast<int>(bits_required >> 3);
+  bit_offset_ = static_cast<int>(bits_required & 7);
+
+  // Reset buffered_values_ to start at the new byte offset
+  int bytes_remaining = max_bytes_ - byte_offset_;
+  if (ARROW_PREDICT_TRUE(bytes_remaining >= 8)) {
+    memcpy(&buffered_values_, buffer_ + byte_offset_, 8);
+  } else {
+    memcpy(&buffered_values_, buffer_ + byte_offset_, bytes_remaining);
+  }
+  return true;
+}
+
 }  // namespace BitUtil
 }  // namespace arrow
 
@@ -31,6 +31,7 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/array.h"
@@ -38,8 +39,13 @@
 #include "arrow/status.h"
 #include "arrow/util/align_util.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
 
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/bit_util_avx2.h"
+#endif
+
 namespace arrow {
 
 class MemoryPool;
@@ -261,11 +267,56 @@ bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right
 
 namespace {
 
+using BitmapBytesOpFunc = void (*)(const uint8_t*, const uint8_t*, uint8_t*, int64_t);
+
+template <typename Op>
+void BitmapBytesOp(const uint8_t* left, const uint8_t* right, uint8_t* out,
+                   int64_t nbytes) {
+  Op op;
+  for (int64_t i = 0; i < nbytes; ++i) {
+    out[i] = op(left[i], right[i]);
+  }
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+template <typename Op>
+BitmapBytesOpFunc BitmapBytesOpAvx2();
+
+template <>
+BitmapBytesOpFunc BitmapBytesOpAvx2<std::bit_and<uint8_t>>() {
+  return BitmapAndAvx2;
+}
+
+template <>
+BitmapBytesOpFunc BitmapBytesOpAvx2<std::bit_or<uint8_t>>() {
+  return BitmapOrAvx2;
+}
+
+template <>
+BitmapBytesOpFunc BitmapBytesOpAvx2<std::bit_xor<uint8_t>>() {
+  return BitmapXorAvx2;
+}
+#endif
+
+template <typename Op>
+struct BitmapBytesOpDynamicFunction {
+  using FunctionType = BitmapBytesOpFunc;
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, BitmapBytesOp<Op>}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+            ,
+            {DispatchLevel::AVX2, BitmapBytesOpAvx2<Op>()}
+#endif
+    };
+  }
+};
+
 template <typename Op>
 void AlignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                      int64_t right_offset, uint8_t* out, int64_t out_offset,
                      int64_t length) {
-  Op op;
+  static DynamicDispatch<BitmapBytesOpDynamicFunction<Op>> dispatch;
   DCHECK_EQ(left_offset % 8, right_offset % 8);
   DCHECK_EQ(left_offset % 8, out_offset % 8);
 
@@ -273,9 +324,7 @@ void AlignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* ri
   left += left_offset / 8;
   right += right_offset / 8;
   out += out_offset / 8;
-  for (int64_t i = 0; i < nbytes; ++i) {
-    out[i] = op(left[i], right[i]);
-  }
+  dispatch.func(left, right, out, nbytes);
 }
 
 template <typename Op>
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/util/bit_util_avx2.h"
+
+#include <immintrin.h>
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+struct AndOp {
+  static __m256i Call(__m256i left, __m256i right) {
+    return _mm256_and_si256(left, right);
+  }
+  static uint8_t Call(uint8_t left, uint8_t right) { return left & right; }
+};
+
+struct OrOp {
+  static __m256i Call(__m256i left, __m256i right) {
+    return _mm256_or_si256(left, right);
+  }
+  static uint8_t Call(uint8_t left, uint8_t right) { return left | right; }
+};
+
+struct XorOp {
+  static __m256i Call(__m256i left, __m256i right) {
+    return _mm256_xor_si256(left, right);
+  }
+  static uint8_t Call(uint8_t left, uint8_t right) { return left ^ right; }
+};
+
+template <typename Op>
+void BitmapOpAvx2(const uint8_t* left, const uint8_t* right, uint8_t* out,
+                  int64_t nbytes) {
+  int64_t i = 0;
+  for (; i + 64 <= nbytes; i += 64) {
+    const __m256i left0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(left + i));
+    const __m256i left1 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(left + i + 32));
+    const __m256i right0 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(right + i));
+    const __m256i right1 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(right + i + 32));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), Op::Call(left0, right0));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + 32),
+                        Op::Call(left1, right1));
+  }
+  for (; i < nbytes; ++i) {
+    out[i] = Op::Call(left[i], right[i]);
+  }
+}
+
+}  // namespace
+
+void BitmapAndAvx2(const uint8_t* left, const uint8_t* right, uint8_t* out,
+                   int64_t nbytes) {
+  BitmapOpAvx2<AndOp>(left, right, out, nbytes);
+}
+
+void BitmapOrAvx2(const uint8_t* left, const uint8_t* right, uint8_t* out,
+                  int64_t nbytes) {
+  BitmapOpAvx2<OrOp>(left, right, out, nbytes);
+}
+
+void BitmapXorAvx2(const uint8_t* left, const uint8_t* right, uint8_t* out,
+                   int64_t nbytes) {
+  BitmapOpAvx2<XorOp>(left, right, out, nbytes);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -14,43 +14,30 @@
 // KIND, either express or implied.  See the License for the
 // specific language governing permissions and limitations
 // under the License.
-
 #pragma once
 
-#include <memory>
-#include <string>
+#include <cstdint>
 
-#include "arrow/dataset/type_fwd.h"
-#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
 
 namespace arrow {
-namespace dataset {
-
-/// \brief Loads a previously-written collection of Arrow protocol
-/// files and exposes them in a way that can be consumed as a Dataset
-/// source
-class ARROW_DS_EXPORT DiskStoreReader : public DatasetSource {
- public:
-  DiskStoreReader(const std::string& path, fs::FileSystem* filesystem);
-
- private:
-  class DiskStoreReaderImpl;
-  std::unique_ptr<DiskStoreReaderImpl> impl_;
+namespace internal {
 
-  std::string path_;
-  fs::FileSystem* filesystem_;
+// AVX2 implementations of bytewise bitmap operations, writing
+// out[i] = left[i] OP right[i] for i in [0, nbytes). Only to be called on CPUs
+// with AVX2.
 
-  DiskStoreReader() {}
-};
+ARROW_EXPORT
+void BitmapAndAvx2(const uint8_t* left, const uint8_t* right, uint8_t* out,
+                   int64_t nbytes);
 
-/// \brief
-class ARROW_DS_EXPORT DiskStoreWriter {
- public:
-  Status Write(const RecordBatch& batch);
+ARROW_EXPORT
+void BitmapOrAvx2(const uint8_t* left, const uint8_t* right, uint8_t* out,
+                  int64_t nbytes);
 
- private:
-  DiskStoreWriter() {}
-};
+ARROW_EXPORT
+void BitmapXorAvx2(const uint8_t* left, const uint8_t* right, uint8_t* out,
+                   int64_t nbytes);
 
-}  // namespace dataset
+}  // namespace internal
 }  // namespace arrow
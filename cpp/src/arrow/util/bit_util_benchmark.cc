@@ -28,6 +28,15 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bpacking.h"
+#include "arrow/util/dispatch.h"
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/bpacking_avx2.h"
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+#include "arrow/util/bpacking_avx512.h"
+#endif
 
 namespace arrow {
 
@@ -384,6 +393,80 @@ BENCHMARK(GenerateBitsUnrolled)->Arg(kBufferSize);
 BENCHMARK(CopyBitmapWithoutOffset)->Arg(kBufferSize);
 BENCHMARK(CopyBitmapWithOffset)->Arg(kBufferSize);
 
+template <typename InType, typename OutType>
+static void BenchmarkUnpack(benchmark::State& state,
+                            int (*unpack)(const InType*, OutType*, int, int)) {
+  const int num_bits = static_cast<int>(state.range(0));
+  const int num_values = 4096;
+
+  std::vector<InType> packed(num_values / 32 * num_bits * 4 / sizeof(InType));
+  random_bytes(packed.size() * sizeof(InType), 0,
+               reinterpret_cast<uint8_t*>(packed.data()));
+  std::vector<OutType> unpacked(num_values);
+
+  for (auto _ : state) {
+    auto num_unpacked = unpack(packed.data(), unpacked.data(), num_values, num_bits);
+    benchmark::DoNotOptimize(num_unpacked);
+  }
+  state.SetItemsProcessed(state.iterations() * num_values);
+}
+
+static bool SkipIfUnsupported(benchmark::State& state, internal::DispatchLevel level) {
+  if (!internal::IsDispatchLevelSupported(level)) {
+    state.SkipWithError("CPU does not support the instruction set");
+    return true;
+  }
+  return false;
+}
+
+static void Unpack32Default(benchmark::State& state) {
+  BenchmarkUnpack(state, internal::unpack32_default);
+}
+
+static void Unpack64Default(benchmark::State& state) {
+  BenchmarkUnpack(state, internal::unpack64_default);
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+static void Unpack32Avx2(benchmark::State& state) {
+  if (SkipIfUnsupported(state, internal::DispatchLevel::AVX2)) return;
+  BenchmarkUnpack(state, internal::unpack32_avx2);
+}
+
+static void Unpack64Avx2(benchmark::State& state) {
+  if (SkipIfUnsupported(state, internal::DispatchLevel::AVX2)) return;
+  BenchmarkUnpack(state, internal::unpack64_avx2);
+}
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+static void Unpack32Avx512(benchmark::State& state) {
+  if (SkipIfUnsupported(state, internal::DispatchLevel::AVX512)) return;
+  BenchmarkUnpack(state, internal::unpack32_avx512);
+}
+
+static void Unpack64Avx512(benchmark::State& state) {
+  if (SkipIfUnsupported(state, internal::DispatchLevel::AVX512)) return;
+  BenchmarkUnpack(state, internal::unpack64_avx512);
+}
+#endif
+
+#define UNPACK32_BENCHMARK_ARGS                                              \
+  Arg(1)->Arg(2)->Arg(3)->Arg(5)->Arg(8)->Arg(12)->Arg(17)->Arg(24)->Arg(25) \
+      ->Arg(26)->Arg(28)->Arg(31)->Arg(32)
+#define UNPACK64_BENCHMARK_ARGS UNPACK32_BENCHMARK_ARGS->Arg(40)->Arg(57)->Arg(64)
+
+BENCHMARK(Unpack32Default)->UNPACK32_BENCHMARK_ARGS;
+BENCHMARK(Unpack64Default)->UNPACK64_BENCHMARK_ARGS;
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+BENCHMARK(Unpack32Avx2)->UNPACK32_BENCHMARK_ARGS;
+BENCHMARK(Unpack64Avx2)->UNPACK64_BENCHMARK_ARGS;
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+BENCHMARK(Unpack32Avx512)->UNPACK32_BENCHMARK_ARGS;
+BENCHMARK(Unpack64Avx512)->UNPACK64_BENCHMARK_ARGS;
+#endif
+
 #define AND_BENCHMARK_RANGES                      \
   {                                               \
     {kBufferSize * 4, kBufferSize * 16}, { 0, 2 } \
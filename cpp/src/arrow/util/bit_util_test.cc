@@ -1039,6 +1039,80 @@ TEST(BitStreamUtil, ZigZag) {
   TestZigZag(-std::numeric_limits<int32_t>::max());
 }
 
+static void TestZigZag64(int64_t v) {
+  uint8_t buffer[BitUtil::BitReader::MAX_VLQ_BYTE_LEN_64] = {};
+  BitUtil::BitWriter writer(buffer, sizeof(buffer));
+  BitUtil::BitReader reader(buffer, sizeof(buffer));
+  writer.PutZigZagVlqInt(v);
+  int64_t result;
+  EXPECT_TRUE(reader.GetZigZagVlqInt(&result));
+  EXPECT_EQ(v, result);
+}
+
+TEST(BitStreamUtil, ZigZag64) {
+  TestZigZag64(0);
+  TestZigZag64(1);
+  TestZigZag64(1234);
+  TestZigZag64(-1);
+  TestZigZag64(-1234);
+  TestZigZag64(std::numeric_limits<int64_t>::max());
+  TestZigZag64(std::numeric_limits<int64_t>::min());
+}
+
+TEST(BitStreamUtil, VlqIntTooLong) {
+  // Every byte has the continuation bit set, so that the encoding never ends
+  uint8_t buffer[BitUtil::BitReader::MAX_VLQ_BYTE_LEN_64 + 2];
+  std::memset(buffer, 0xff, sizeof(buffer));
+
+  int32_t v32;
+  BitUtil::BitReader reader32(buffer, sizeof(buffer));
+  EXPECT_FALSE(reader32.GetVlqInt(&v32));
+
+  int64_t v64;
+  BitUtil::BitReader reader64(buffer, sizeof(buffer));
+  EXPECT_FALSE(reader64.GetVlqInt(&v64));
+}
+
+TEST(BitStreamUtil, WideValues) {
+  // Values wider than 32 bits, crossing and ending on 64-bit word boundaries
+  const std::vector<int> bit_widths = {64, 33, 64, 63, 1, 64, 40};
+  const uint64_t values[] = {0xFEDCBA9876543210ULL, 0x1FFFFFFFFULL,
+                             std::numeric_limits<uint64_t>::max(), 0x7FFFFFFFFFFFFFFFULL,
+                             1, 0x0123456789ABCDEFULL, 0xFFFFFFFFFFULL};
+  uint8_t buffer[64] = {};
+  BitUtil::BitWriter writer(buffer, sizeof(buffer));
+  for (size_t i = 0; i < bit_widths.size(); ++i) {
+    ASSERT_TRUE(writer.PutValue(values[i], bit_widths[i]));
+  }
+  writer.Flush();
+
+  BitUtil::BitReader reader(buffer, sizeof(buffer));
+  for (size_t i = 0; i < bit_widths.size(); ++i) {
+    uint64_t result;
+    ASSERT_TRUE(reader.GetValue(bit_widths[i], &result));
+    ASSERT_EQ(values[i], result);
+  }
+
+  ASSERT_FALSE(reader.Advance(sizeof(buffer) * 8));
+
+  // Batches of 64-bit values, not aligned on a byte
+  uint8_t batch_buffer[4 * 8] = {};
+  BitUtil::BitWriter batch_writer(batch_buffer, sizeof(batch_buffer));
+  ASSERT_TRUE(batch_writer.PutValue(5, 3));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(batch_writer.PutValue(values[i], 64));
+  }
+  batch_writer.Flush();
+
+  BitUtil::BitReader batch_reader(batch_buffer, sizeof(batch_buffer));
+  ASSERT_TRUE(batch_reader.Advance(3));
+  uint64_t results[3];
+  ASSERT_EQ(3, batch_reader.GetBatch(64, results, 3));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(values[i], results[i]);
+  }
+}
+
 TEST(BitUtil, RoundTripLittleEndianTest) {
   uint64_t value = 0xFF;
 
@@ -0,0 +1,299 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/bpacking.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/bpacking_default.h"
+#include "arrow/util/bpacking_simd.h"
+#include "arrow/util/dispatch.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/bpacking_avx2.h"
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+#include "arrow/util/bpacking_avx512.h"
+#endif
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+struct Unpack32DynamicFunction {
+  using FunctionType = decltype(&unpack32_default);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, unpack32_default}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+            ,
+            {DispatchLevel::AVX2, unpack32_avx2}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+            ,
+            {DispatchLevel::AVX512, unpack32_avx512}
+#endif
+    };
+  }
+};
+
+struct Unpack64DynamicFunction {
+  using FunctionType = decltype(&unpack64_default);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, unpack64_default}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+            ,
+            {DispatchLevel::AVX2, unpack64_avx2}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+            ,
+            {DispatchLevel::AVX512, unpack64_avx512}
+#endif
+    };
+  }
+};
+
+// Fill the masks of the 4 lanes of a group for values of num_bits bits,
+// value_bytes bytes wide once unpacked
+template <typename ShiftType>
+void FillLaneMasks(int num_bits, int value_bytes, uint8_t* shuffles, ShiftType* shifts,
+                   int* offsets) {
+  const int values_per_lane = 16 / value_bytes;
+  for (int lane = 0; lane < 4; ++lane) {
+    const int lane_bit_offset = lane * values_per_lane * num_bits;
+    offsets[lane] = lane_bit_offset / 8;
+    for (int i = 0; i < values_per_lane; ++i) {
+      const int bit_offset = lane_bit_offset % 8 + i * num_bits;
+      for (int k = 0; k < value_bytes; ++k) {
+        shuffles[lane * 16 + i * value_bytes + k] =
+            static_cast<uint8_t>(bit_offset / 8 + k);
+      }
+      shifts[lane * values_per_lane + i] = static_cast<ShiftType>(bit_offset % 8);
+    }
+  }
+}
+
+// Unpack a value of more than 32 bits starting shift bits into the 9 bytes at
+// the given address
+inline uint64_t UnpackWideValue(const uint8_t* bytes, int shift, uint64_t mask) {
+  uint64_t low;
+  std::memcpy(&low, bytes, 8);
+  const uint64_t high = bytes[8];
+  // Shift in two steps, as shifting by 64 bits is undefined
+  return ((low >> shift) | ((high << 1) << (63 - shift))) & mask;
+}
+
+UnpackShuffleMasks MakeUnpackShuffleMasks() {
+  UnpackShuffleMasks masks;
+  std::memset(&masks, 0, sizeof(masks));
+  for (int num_bits = 1; num_bits <= UnpackShuffleMasks::kMaxNarrowWidth; ++num_bits) {
+    FillLaneMasks(num_bits, 4, masks.narrow_shuffles[num_bits],
+                  masks.narrow_shifts[num_bits], masks.narrow_offsets[num_bits]);
+  }
+  for (int num_bits = 1; num_bits <= UnpackShuffleMasks::kMaxWideWidth; ++num_bits) {
+    FillLaneMasks(num_bits, 8, masks.wide_shuffles[num_bits],
+                  masks.wide_shifts[num_bits], masks.wide_offsets[num_bits]);
+  }
+  return masks;
+}
+
+}  // namespace
+
+const UnpackShuffleMasks& GetUnpackShuffleMasks() {
+  static const UnpackShuffleMasks masks = MakeUnpackShuffleMasks();
+  return masks;
+}
+
+int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  static DynamicDispatch<Unpack32DynamicFunction> dispatch;
+  return dispatch.func(in, out, batch_size, num_bits);
+}
+
+int unpack64(const uint8_t* in, uint64_t* out, int batch_size, int num_bits) {
+  static DynamicDispatch<Unpack64DynamicFunction> dispatch;
+  return dispatch.func(in, out, batch_size, num_bits);
+}
+
+int unpack32_default(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+  int num_loops = batch_size / 32;
+
+  switch (num_bits) {
+    case 0:
+      for (int i = 0; i < num_loops; ++i) in = nullunpacker32(in, out + i * 32);
+      break;
+    case 1:
+      for (int i = 0; i < num_loops; ++i) in = unpack1_32(in, out + i * 32);
+      break;
+    case 2:
+      for (int i = 0; i < num_loops; ++i) in = unpack2_32(in, out + i * 32);
+      break;
+    case 3:
+      for (int i = 0; i < num_loops; ++i) in = unpack3_32(in, out + i * 32);
+      break;
+    case 4:
+      for (int i = 0; i < num_loops; ++i) in = unpack4_32(in, out + i * 32);
+      break;
+    case 5:
+      for (int i = 0; i < num_loops; ++i) in = unpack5_32(in, out + i * 32);
+      break;
+    case 6:
+      for (int i = 0; i < num_loops; ++i) in = unpack6_32(in, out + i * 32);
+      break;
+    case 7:
+      for (int i = 0; i < num_loops; ++i) in = unpack7_32(in, out + i * 32);
+      break;
+    case 8:
+      for (int i = 0; i < num_loops; ++i) in = unpack8_32(in, out + i * 32);
+      break;
+    case 9:
+      for (int i = 0; i < num_loops; ++i) in = unpack9_32(in, out + i * 32);
+      break;
+    case 10:
+      for (int i = 0; i < num_loops; ++i) in = unpack10_32(in, out + i * 32);
+      break;
+    case 11:
+      for (int i = 0; i < num_loops; ++i) in = unpack11_32(in, out + i * 32);
+      break;
+    case 12:
+      for (int i = 0; i < num_loops; ++i) in = unpack12_32(in, out + i * 32);
+      break;
+    case 13:
+      for (int i = 0; i < num_loops; ++i) in = unpack13_32(in, out + i * 32);
+      break;
+    case 14:
+      for (int i = 0; i < num_loops; ++i) in = unpack14_32(in, out + i * 32);
+      break;
+    case 15:
+      for (int i = 0; i < num_loops; ++i) in = unpack15_32(in, out + i * 32);
+      break;
+    case 16:
+      for (int i = 0; i < num_loops; ++i) in = unpack16_32(in, out + i * 32);
+      break;
+    case 17:
+      for (int i = 0; i < num_loops; ++i) in = unpack17_32(in, out + i * 32);
+      break;
+    case 18:
+      for (int i = 0; i < num_loops; ++i) in = unpack18_32(in, out + i * 32);
+      break;
+    case 19:
+      for (int i = 0; i < num_loops; ++i) in = unpack19_32(in, out + i * 32);
+      break;
+    case 20:
+      for (int i = 0; i < num_loops; ++i) in = unpack20_32(in, out + i * 32);
+      break;
+    case 21:
+      for (int i = 0; i < num_loops; ++i) in = unpack21_32(in, out + i * 32);
+      break;
+    case 22:
+      for (int i = 0; i < num_loops; ++i) in = unpack22_32(in, out + i * 32);
+      break;
+    case 23:
+      for (int i = 0; i < num_loops; ++i) in = unpack23_32(in, out + i * 32);
+      break;
+    case 24:
+      for (int i = 0; i < num_loops; ++i) in = unpack24_32(in, out + i * 32);
+      break;
+    case 25:
+      for (int i = 0; i < num_loops; ++i) in = unpack25_32(in, out + i * 32);
+      break;
+    case 26:
+      for (int i = 0; i < num_loops; ++i) in = unpack26_32(in, out + i * 32);
+      break;
+    case 27:
+      for (int i = 0; i < num_loops; ++i) in = unpack27_32(in, out + i * 32);
+      break;
+    case 28:
+      for (int i = 0; i < num_loops; ++i) in = unpack28_32(in, out + i * 32);
+      break;
+    case 29:
+      for (int i = 0; i < num_loops; ++i) in = unpack29_32(in, out + i * 32);
+      break;
+    case 30:
+      for (int i = 0; i < num_loops; ++i) in = unpack30_32(in, out + i * 32);
+      break;
+    case 31:
+      for (int i = 0; i < num_loops; ++i) in = unpack31_32(in, out + i * 32);
+      break;
+    case 32:
+      for (int i = 0; i < num_loops; ++i) in = unpack32_32(in, out + i * 32);
+      break;
+    default:
+      DCHECK(false) << "Unsupported num_bits";
+  }
+
+  return batch_size;
+}
+
+int unpack64_default(const uint8_t* in, uint64_t* out, int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+
+  if (num_bits <= 32) {
+    // Use the unrolled 32-bit kernels and widen their output
+    constexpr int kBufferSize = 1024;
+    uint32_t buffer[kBufferSize];
+    for (int i = 0; i < batch_size; i += kBufferSize) {
+      const int num_values = std::min(kBufferSize, batch_size - i);
+      unpack32_default(
+          reinterpret_cast<const uint32_t*>(in + static_cast<int64_t>(i) * num_bits / 8),
+          buffer, num_values, num_bits);
+      std::copy(buffer, buffer + num_values, out + i);
+    }
+    return batch_size;
+  }
+
+  if (num_bits == 64) {
+    if (batch_size > 0) {
+      std::memcpy(out, in, static_cast<size_t>(batch_size) * sizeof(uint64_t));
+    }
+    return batch_size;
+  }
+
+  // A value of more than 32 bits spans at most 9 bytes. The last values are
+  // unpacked from a zero-padded copy, to not read past the end of the input.
+  const uint64_t mask = num_bits == 64 ? ~uint64_t(0) : (uint64_t(1) << num_bits) - 1;
+  const int64_t num_bytes = static_cast<int64_t>(batch_size) * num_bits / 8;
+  int num_direct = batch_size;
+  while (num_direct > 0 &&
+         static_cast<int64_t>(num_direct - 1) * num_bits / 8 + 9 > num_bytes) {
+    --num_direct;
+  }
+
+  int i = 0;
+  for (; i < num_direct; ++i) {
+    const int64_t bit_offset = static_cast<int64_t>(i) * num_bits;
+    out[i] = UnpackWideValue(in + bit_offset / 8, static_cast<int>(bit_offset % 8), mask);
+  }
+  for (; i < batch_size; ++i) {
+    const int64_t bit_offset = static_cast<int64_t>(i) * num_bits;
+    uint8_t tail[9] = {};
+    std::memcpy(tail, in + bit_offset / 8,
+                static_cast<size_t>(num_bytes - bit_offset / 8));
+    out[i] = UnpackWideValue(tail, static_cast<int>(bit_offset % 8), mask);
+  }
+  return batch_size;
+}
+
+}  // namespace internal
+}  // namespace arrow
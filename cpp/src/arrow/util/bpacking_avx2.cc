@@ -0,0 +1,243 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/bpacking_avx2.h"
+
+#include <immintrin.h>
+
+#include "arrow/util/bpacking.h"
+#include "arrow/util/bpacking_simd.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// The fewest input bytes the kernels handle, so that the last 16 bytes can
+// always be loaded
+constexpr int64_t kMinInputBytes = 16;
+
+// Shuffle indices moving the bytes of a vector down, zeroing the bytes
+// shifted in
+alignas(16) constexpr uint8_t kShiftDownShuffles[32] = {
+    0,    1,    2,    3,    4,    5,    6,    7,    8,    9,    10,
+    11,   12,   13,   14,   15,   0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80};
+
+inline __m128i LoadUnaligned(const uint8_t* in) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+}
+
+// Load the 16 bytes of a lane, all within the input
+struct DirectLoad {
+  __m128i operator()(const uint8_t* in) const { return LoadUnaligned(in); }
+};
+
+// Load the bytes of a lane up to the end of the input, zeroing the others.
+// Past-the-end lanes are taken from the last 16 bytes of the input instead of
+// a padded copy, whose byte stores would stall the vector loads.
+struct TailLoad {
+  const uint8_t* end;
+
+  __m128i operator()(const uint8_t* in) const {
+    const int64_t overflow = in + 16 - end;
+    if (overflow <= 0) {
+      return LoadUnaligned(in);
+    }
+    return _mm_shuffle_epi8(LoadUnaligned(end - 16),
+                            LoadUnaligned(kShiftDownShuffles + overflow));
+  }
+};
+
+template <typename Load>
+__m256i LoadLanes(const Load& load, const uint8_t* low, const uint8_t* high) {
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(load(low)), load(high), 1);
+}
+
+// Unpack groups of 16 values of up to kMaxNarrowWidth bits, as two vectors of
+// 8 32-bit elements
+class NarrowUnpacker {
+ public:
+  static constexpr int kGroupSize = 16;
+
+  explicit NarrowUnpacker(int num_bits) {
+    const UnpackShuffleMasks& masks = GetUnpackShuffleMasks();
+    for (int v = 0; v < 2; ++v) {
+      shuffles_[v] = _mm256_load_si256(
+          reinterpret_cast<const __m256i*>(masks.narrow_shuffles[num_bits] + 32 * v));
+      shifts_[v] = _mm256_load_si256(
+          reinterpret_cast<const __m256i*>(masks.narrow_shifts[num_bits] + 8 * v));
+    }
+    for (int lane = 0; lane < 4; ++lane) {
+      offsets_[lane] = masks.narrow_offsets[num_bits][lane];
+    }
+    mask_ = _mm256_set1_epi32(static_cast<int>((1U << num_bits) - 1));
+  }
+
+  // The number of bytes loaded from the start of a group
+  int read_bytes() const { return offsets_[3] + 16; }
+
+  template <typename Load>
+  void Unpack(const Load& load, const uint8_t* in, __m256i* values) const {
+    for (int v = 0; v < 2; ++v) {
+      __m256i lanes = LoadLanes(load, in + offsets_[2 * v], in + offsets_[2 * v + 1]);
+      lanes = _mm256_shuffle_epi8(lanes, shuffles_[v]);
+      lanes = _mm256_srlv_epi32(lanes, shifts_[v]);
+      values[v] = _mm256_and_si256(lanes, mask_);
+    }
+  }
+
+  void Store(const __m256i* values, uint32_t* out) const {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), values[0]);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8), values[1]);
+  }
+
+  void Store(const __m256i* values, uint64_t* out) const {
+    for (int v = 0; v < 2; ++v) {
+      const __m256i low = _mm256_cvtepu32_epi64(_mm256_castsi256_si128(values[v]));
+      const __m256i high = _mm256_cvtepu32_epi64(_mm256_extracti128_si256(values[v], 1));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8 * v), low);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8 * v + 4), high);
+    }
+  }
+
+ private:
+  __m256i shuffles_[2];
+  __m256i shifts_[2];
+  __m256i mask_;
+  int offsets_[4];
+};
+
+// Unpack groups of 8 values of up to kMaxWideWidth bits, as two vectors of 4
+// 64-bit elements
+class WideUnpacker {
+ public:
+  static constexpr int kGroupSize = 8;
+
+  explicit WideUnpacker(int num_bits) {
+    const UnpackShuffleMasks& masks = GetUnpackShuffleMasks();
+    for (int v = 0; v < 2; ++v) {
+      shuffles_[v] = _mm256_load_si256(
+          reinterpret_cast<const __m256i*>(masks.wide_shuffles[num_bits] + 32 * v));
+      shifts_[v] = _mm256_load_si256(
+          reinterpret_cast<const __m256i*>(masks.wide_shifts[num_bits] + 4 * v));
+    }
+    for (int lane = 0; lane < 4; ++lane) {
+      offsets_[lane] = masks.wide_offsets[num_bits][lane];
+    }
+    mask_ = _mm256_set1_epi64x(static_cast<int64_t>((uint64_t(1) << num_bits) - 1));
+  }
+
+  int read_bytes() const { return offsets_[3] + 16; }
+
+  template <typename Load>
+  void Unpack(const Load& load, const uint8_t* in, __m256i* values) const {
+    for (int v = 0; v < 2; ++v) {
+      __m256i lanes = LoadLanes(load, in + offsets_[2 * v], in + offsets_[2 * v + 1]);
+      lanes = _mm256_shuffle_epi8(lanes, shuffles_[v]);
+      lanes = _mm256_srlv_epi64(lanes, shifts_[v]);
+      values[v] = _mm256_and_si256(lanes, mask_);
+    }
+  }
+
+  void Store(const __m256i* values, uint32_t* out) const {
+    // Gather the low halves of the 64-bit elements, then put them in order
+    const __m256i interleaved = _mm256_castps_si256(
+        _mm256_shuffle_ps(_mm256_castsi256_ps(values[0]), _mm256_castsi256_ps(values[1]),
+                          _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                        _mm256_permute4x64_epi64(interleaved, _MM_SHUFFLE(3, 1, 2, 0)));
+  }
+
+  void Store(const __m256i* values, uint64_t* out) const {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), values[0]);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 4), values[1]);
+  }
+
+ private:
+  __m256i shuffles_[2];
+  __m256i shifts_[2];
+  __m256i mask_;
+  int offsets_[4];
+};
+
+template <typename Unpacker, typename Load, typename OutType>
+void UnpackGroup(const Unpacker& unpacker, const Load& load, const uint8_t* in,
+                 OutType* out) {
+  __m256i values[2];
+  unpacker.Unpack(load, in, values);
+  unpacker.Store(values, out);
+}
+
+// Unpack batch_size values, a multiple of 32
+template <typename Unpacker, typename OutType>
+void UnpackBlocks(const Unpacker& unpacker, const uint8_t* in, OutType* out,
+                  int batch_size, int num_bits) {
+  const uint8_t* in_end = in + static_cast<int64_t>(batch_size) * num_bits / 8;
+  const OutType* out_end = out + batch_size;
+  const int64_t group_bytes = num_bits * Unpacker::kGroupSize / 8;
+
+  for (; out < out_end && in_end - in >= unpacker.read_bytes();
+       in += group_bytes, out += Unpacker::kGroupSize) {
+    UnpackGroup(unpacker, DirectLoad(), in, out);
+  }
+  // The loads of the last groups would read past the end of the input
+  const TailLoad tail_load{in_end};
+  for (; out < out_end; in += group_bytes, out += Unpacker::kGroupSize) {
+    UnpackGroup(unpacker, tail_load, in, out);
+  }
+}
+
+}  // namespace
+
+int unpack32_avx2(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+  const auto bytes = reinterpret_cast<const uint8_t*>(in);
+  const int64_t num_bytes = static_cast<int64_t>(batch_size) * num_bits / 8;
+
+  // 32-bit values are merely copied, which the portable version does as well
+  if (num_bytes < kMinInputBytes) {
+    return unpack32_default(in, out, batch_size, num_bits);
+  } else if (num_bits <= UnpackShuffleMasks::kMaxNarrowWidth) {
+    UnpackBlocks(NarrowUnpacker(num_bits), bytes, out, batch_size, num_bits);
+  } else if (num_bits > UnpackShuffleMasks::kMaxNarrowWidth && num_bits < 32) {
+    UnpackBlocks(WideUnpacker(num_bits), bytes, out, batch_size, num_bits);
+  } else {
+    return unpack32_default(in, out, batch_size, num_bits);
+  }
+  return batch_size;
+}
+
+int unpack64_avx2(const uint8_t* in, uint64_t* out, int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+  const int64_t num_bytes = static_cast<int64_t>(batch_size) * num_bits / 8;
+
+  if (num_bytes < kMinInputBytes) {
+    return unpack64_default(in, out, batch_size, num_bits);
+  } else if (num_bits <= UnpackShuffleMasks::kMaxNarrowWidth) {
+    UnpackBlocks(NarrowUnpacker(num_bits), in, out, batch_size, num_bits);
+  } else if (num_bits > UnpackShuffleMasks::kMaxNarrowWidth &&
+             num_bits <= UnpackShuffleMasks::kMaxWideWidth) {
+    UnpackBlocks(WideUnpacker(num_bits), in, out, batch_size, num_bits);
+  } else {
+    return unpack64_default(in, out, batch_size, num_bits);
+  }
+  return batch_size;
+}
+
+}  // namespace internal
+}  // namespace arrow
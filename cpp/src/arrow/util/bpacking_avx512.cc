@@ -0,0 +1,202 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/bpacking_avx512.h"
+
+#include <immintrin.h>
+
+#include "arrow/util/bpacking.h"
+#include "arrow/util/bpacking_simd.h"
+
+// The GCC AVX-512 intrinsics pass undefined vectors as the sources of unused
+// elements, which causes spurious warnings once inlined, silence them.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Load the 16 bytes of a lane, all within the input
+struct DirectLoad {
+  __m128i operator()(const uint8_t* in) const {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+  }
+};
+
+// Load the bytes of a lane up to the end of the input, zeroing the others.
+// The masked out bytes are not accessed, so this never reads past the end.
+struct TailLoad {
+  const uint8_t* end;
+
+  __m128i operator()(const uint8_t* in) const {
+    const int64_t available = end - in;
+    const __mmask16 mask =
+        available >= 16 ? 0xFFFF : static_cast<__mmask16>((1U << available) - 1);
+    return _mm_maskz_loadu_epi8(mask, in);
+  }
+};
+
+template <typename Load>
+__m512i LoadLanes(const Load& load, const uint8_t* in, const int* offsets) {
+  __m512i lanes = _mm512_castsi128_si512(load(in + offsets[0]));
+  lanes = _mm512_inserti32x4(lanes, load(in + offsets[1]), 1);
+  lanes = _mm512_inserti32x4(lanes, load(in + offsets[2]), 2);
+  return _mm512_inserti32x4(lanes, load(in + offsets[3]), 3);
+}
+
+// Unpack groups of 16 values of up to kMaxNarrowWidth bits, as a vector of
+// 16 32-bit elements
+class NarrowUnpacker {
+ public:
+  static constexpr int kGroupSize = 16;
+
+  explicit NarrowUnpacker(int num_bits) {
+    const UnpackShuffleMasks& masks = GetUnpackShuffleMasks();
+    shuffle_ = _mm512_load_si512(masks.narrow_shuffles[num_bits]);
+    shifts_ = _mm512_load_si512(masks.narrow_shifts[num_bits]);
+    for (int lane = 0; lane < 4; ++lane) {
+      offsets_[lane] = masks.narrow_offsets[num_bits][lane];
+    }
+    mask_ = _mm512_set1_epi32(static_cast<int>((1U << num_bits) - 1));
+  }
+
+  // The number of bytes loaded from the start of a group
+  int read_bytes() const { return offsets_[3] + 16; }
+
+  template <typename Load>
+  __m512i Unpack(const Load& load, const uint8_t* in) const {
+    __m512i lanes = LoadLanes(load, in, offsets_);
+    lanes = _mm512_shuffle_epi8(lanes, shuffle_);
+    lanes = _mm512_srlv_epi32(lanes, shifts_);
+    return _mm512_and_si512(lanes, mask_);
+  }
+
+  void Store(__m512i values, uint32_t* out) const { _mm512_storeu_si512(out, values); }
+
+  void Store(__m512i values, uint64_t* out) const {
+    _mm512_storeu_si512(out, _mm512_cvtepu32_epi64(_mm512_castsi512_si256(values)));
+    _mm512_storeu_si512(out + 8,
+                        _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(values, 1)));
+  }
+
+ private:
+  __m512i shuffle_;
+  __m512i shifts_;
+  __m512i mask_;
+  int offsets_[4];
+};
+
+// Unpack groups of 8 values of up to kMaxWideWidth bits, as a vector of 8
+// 64-bit elements
+class WideUnpacker {
+ public:
+  static constexpr int kGroupSize = 8;
+
+  explicit WideUnpacker(int num_bits) {
+    const UnpackShuffleMasks& masks = GetUnpackShuffleMasks();
+    shuffle_ = _mm512_load_si512(masks.wide_shuffles[num_bits]);
+    shifts_ = _mm512_load_si512(masks.wide_shifts[num_bits]);
+    for (int lane = 0; lane < 4; ++lane) {
+      offsets_[lane] = masks.wide_offsets[num_bits][lane];
+    }
+    mask_ = _mm512_set1_epi64(static_cast<int64_t>((uint64_t(1) << num_bits) - 1));
+  }
+
+  int read_bytes() const { return offsets_[3] + 16; }
+
+  template <typename Load>
+  __m512i Unpack(const Load& load, const uint8_t* in) const {
+    __m512i lanes = LoadLanes(load, in, offsets_);
+    lanes = _mm512_shuffle_epi8(lanes, shuffle_);
+    lanes = _mm512_srlv_epi64(lanes, shifts_);
+    return _mm512_and_si512(lanes, mask_);
+  }
+
+  void Store(__m512i values, uint32_t* out) const {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm512_cvtepi64_epi32(values));
+  }
+
+  void Store(__m512i values, uint64_t* out) const { _mm512_storeu_si512(out, values); }
+
+ private:
+  __m512i shuffle_;
+  __m512i shifts_;
+  __m512i mask_;
+  int offsets_[4];
+};
+
+template <typename Unpacker, typename Load, typename OutType>
+void UnpackGroup(const Unpacker& unpacker, const Load& load, const uint8_t* in,
+                 OutType* out) {
+  unpacker.Store(unpacker.Unpack(load, in), out);
+}
+
+// Unpack batch_size values, a multiple of 32
+template <typename Unpacker, typename OutType>
+void UnpackBlocks(const Unpacker& unpacker, const uint8_t* in, OutType* out,
+                  int batch_size, int num_bits) {
+  const uint8_t* in_end = in + static_cast<int64_t>(batch_size) * num_bits / 8;
+  const OutType* out_end = out + batch_size;
+  const int64_t group_bytes = num_bits * Unpacker::kGroupSize / 8;
+
+  for (; out < out_end && in_end - in >= unpacker.read_bytes();
+       in += group_bytes, out += Unpacker::kGroupSize) {
+    UnpackGroup(unpacker, DirectLoad(), in, out);
+  }
+  // The loads of the last groups would read past the end of the input
+  const TailLoad tail_load{in_end};
+  for (; out < out_end; in += group_bytes, out += Unpacker::kGroupSize) {
+    UnpackGroup(unpacker, tail_load, in, out);
+  }
+}
+
+}  // namespace
+
+int unpack32_avx512(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+  const auto bytes = reinterpret_cast<const uint8_t*>(in);
+
+  // 32-bit values are merely copied, which the portable version does as well
+  if (num_bits >= 1 && num_bits <= UnpackShuffleMasks::kMaxNarrowWidth) {
+    UnpackBlocks(NarrowUnpacker(num_bits), bytes, out, batch_size, num_bits);
+  } else if (num_bits > UnpackShuffleMasks::kMaxNarrowWidth && num_bits < 32) {
+    UnpackBlocks(WideUnpacker(num_bits), bytes, out, batch_size, num_bits);
+  } else {
+    return unpack32_default(in, out, batch_size, num_bits);
+  }
+  return batch_size;
+}
+
+int unpack64_avx512(const uint8_t* in, uint64_t* out, int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+
+  if (num_bits >= 1 && num_bits <= UnpackShuffleMasks::kMaxNarrowWidth) {
+    UnpackBlocks(NarrowUnpacker(num_bits), in, out, batch_size, num_bits);
+  } else if (num_bits > UnpackShuffleMasks::kMaxNarrowWidth &&
+             num_bits <= UnpackShuffleMasks::kMaxWideWidth) {
+    UnpackBlocks(WideUnpacker(num_bits), in, out, batch_size, num_bits);
+  } else {
+    return unpack64_default(in, out, batch_size, num_bits);
+  }
+  return batch_size;
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,59 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Tables shared by the SIMD implementations of unpack32 and unpack64.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief Byte shuffles and bit shifts extracting bit-packed values from
+/// 128-bit lanes
+///
+/// The values are unpacked in groups of 4 lanes, each loaded with 16 bytes
+/// from the given offset into the group. Values of up to kMaxNarrowWidth
+/// bits are unpacked 4 per lane into 32-bit elements (16 values per group),
+/// values of up to kMaxWideWidth bits 2 per lane into 64-bit elements (8
+/// values per group): the shuffle moves the bytes holding each value into its
+/// element, and the shift right aligns it. Groups start on byte boundaries,
+/// so the same masks apply to all groups. AVX2 kernels use the masks of the
+/// lanes 0-1 and 2-3 as two vectors.
+struct UnpackShuffleMasks {
+  // The widest values that always fit in 32 (resp. 64) bits once shifted
+  static constexpr int kMaxNarrowWidth = 25;
+  static constexpr int kMaxWideWidth = 56;
+
+  alignas(64) uint8_t narrow_shuffles[kMaxNarrowWidth + 1][64];
+  alignas(64) uint32_t narrow_shifts[kMaxNarrowWidth + 1][16];
+  int narrow_offsets[kMaxNarrowWidth + 1][4];
+
+  alignas(64) uint8_t wide_shuffles[kMaxWideWidth + 1][64];
+  alignas(64) uint64_t wide_shifts[kMaxWideWidth + 1][8];
+  int wide_offsets[kMaxWideWidth + 1][4];
+};
+
+/// \brief Return the masks, computed on first use
+ARROW_EXPORT
+const UnpackShuffleMasks& GetUnpackShuffleMasks();
+
+}  // namespace internal
+}  // namespace arrow
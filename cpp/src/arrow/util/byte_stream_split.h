@@ -0,0 +1,166 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Scatter / gather of the bytes of fixed width values into separate streams,
+// as used by the Parquet BYTE_STREAM_SPLIT encoding.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/util/sse_util.h"
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+template <typename T>
+void ByteStreamSplitEncodeScalar(const uint8_t* raw_values, const int64_t num_values,
+                                 uint8_t* output) {
+  constexpr int kNumStreams = static_cast<int>(sizeof(T));
+  for (int64_t i = 0; i < num_values; ++i) {
+    for (int j = 0; j < kNumStreams; ++j) {
+      output[j * num_values + i] = raw_values[i * kNumStreams + j];
+    }
+  }
+}
+
+template <typename T>
+void ByteStreamSplitDecodeScalar(const uint8_t* data, int64_t num_values, int64_t stride,
+                                 T* out) {
+  constexpr int kNumStreams = static_cast<int>(sizeof(T));
+  auto output_buffer_raw = reinterpret_cast<uint8_t*>(out);
+  for (int64_t i = 0; i < num_values; ++i) {
+    for (int j = 0; j < kNumStreams; ++j) {
+      output_buffer_raw[i * kNumStreams + j] = data[j * stride + i];
+    }
+  }
+}
+
+#if defined(ARROW_HAVE_SSE2)
+
+// Each step interleaves the bytes of the register j with those of the
+// register j + kNumStreams / 2. Seen as an array of kNumStreams * 16 bytes,
+// this rotates the bits of the byte indices left by one, so that
+// log2(kNumStreams) steps turn byte streams into values and 4 steps turn
+// values into byte streams.
+template <int kNumStreams>
+void ByteStreamSplitShuffleSse2(__m128i* stage, int num_steps) {
+  constexpr int kNumStreamsHalf = kNumStreams / 2;
+  __m128i next[kNumStreams];
+  for (int step = 0; step < num_steps; ++step) {
+    for (int j = 0; j < kNumStreamsHalf; ++j) {
+      next[j * 2] = _mm_unpacklo_epi8(stage[j], stage[kNumStreamsHalf + j]);
+      next[j * 2 + 1] = _mm_unpackhi_epi8(stage[j], stage[kNumStreamsHalf + j]);
+    }
+    for (int j = 0; j < kNumStreams; ++j) {
+      stage[j] = next[j];
+    }
+  }
+}
+
+template <typename T>
+void ByteStreamSplitEncodeSse2(const uint8_t* raw_values, const int64_t num_values,
+                               uint8_t* output) {
+  constexpr int kNumStreams = static_cast<int>(sizeof(T));
+  constexpr int64_t kBlockSize = static_cast<int64_t>(sizeof(__m128i));
+  const int64_t num_blocks = num_values / kBlockSize;
+
+  __m128i stage[kNumStreams];
+  for (int64_t block = 0; block < num_blocks; ++block) {
+    const int64_t offset = block * kBlockSize;
+    for (int j = 0; j < kNumStreams; ++j) {
+      stage[j] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+          raw_values + offset * kNumStreams + j * kBlockSize));
+    }
+    ByteStreamSplitShuffleSse2<kNumStreams>(stage, 4);
+    for (int j = 0; j < kNumStreams; ++j) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output + j * num_values + offset),
+                       stage[j]);
+    }
+  }
+
+  // Scalar tail, written at the end of each stream
+  for (int64_t i = num_blocks * kBlockSize; i < num_values; ++i) {
+    for (int j = 0; j < kNumStreams; ++j) {
+      output[j * num_values + i] = raw_values[i * kNumStreams + j];
+    }
+  }
+}
+
+template <typename T>
+void ByteStreamSplitDecodeSse2(const uint8_t* data, int64_t num_values, int64_t stride,
+                               T* out) {
+  constexpr int kNumStreams = static_cast<int>(sizeof(T));
+  constexpr int kNumStreamsLog2 = (kNumStreams == 8 ? 3 : 2);
+  constexpr int64_t kBlockSize = static_cast<int64_t>(sizeof(__m128i));
+  static_assert(kNumStreams == 4 || kNumStreams == 8, "Unsupported value width");
+  const int64_t num_blocks = num_values / kBlockSize;
+  auto output_buffer_raw = reinterpret_cast<uint8_t*>(out);
+
+  __m128i stage[kNumStreams];
+  for (int64_t block = 0; block < num_blocks; ++block) {
+    const int64_t offset = block * kBlockSize;
+    for (int j = 0; j < kNumStreams; ++j) {
+      stage[j] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(data + j * stride + offset));
+    }
+    ByteStreamSplitShuffleSse2<kNumStreams>(stage, kNumStreamsLog2);
+    for (int j = 0; j < kNumStreams; ++j) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output_buffer_raw +
+                                                  offset * kNumStreams + j * kBlockSize),
+                       stage[j]);
+    }
+  }
+
+  for (int64_t i = num_blocks * kBlockSize; i < num_values; ++i) {
+    for (int j = 0; j < kNumStreams; ++j) {
+      output_buffer_raw[i * kNumStreams + j] = data[j * stride + i];
+    }
+  }
+}
+
+#endif  // ARROW_HAVE_SSE2
+
+/// \brief Write the bytes of num_values values of type T as sizeof(T)
+/// consecutive streams of num_values bytes, the first stream holding the
+/// first byte of every value
+template <typename T>
+void ByteStreamSplitEncode(const uint8_t* raw_values, const int64_t num_values,
+                           uint8_t* output) {
+#if defined(ARROW_HAVE_SSE2)
+  ByteStreamSplitEncodeSse2<T>(raw_values, num_values, output);
+#else
+  ByteStreamSplitEncodeScalar<T>(raw_values, num_values, output);
+#endif
+}
+
+/// \brief Gather num_values values of type T from sizeof(T) byte streams
+/// which are stride bytes apart, starting at data
+template <typename T>
+void ByteStreamSplitDecode(const uint8_t* data, int64_t num_values, int64_t stride,
+                           T* out) {
+#if defined(ARROW_HAVE_SSE2)
+  ByteStreamSplitDecodeSse2<T>(data, num_values, stride, out);
+#else
+  ByteStreamSplitDecodeScalar<T>(data, num_values, stride, out);
+#endif
+}
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
@@ -74,6 +74,8 @@ std::string Codec::GetCodecAsString(Compression::type t) {
       return "BROTLI";
     case Compression::LZ4:
       return "LZ4";
+    case Compression::LZ4_FRAME:
+      return "LZ4_FRAME";
     case Compression::ZSTD:
       return "ZSTD";
     case Compression::BZ2:
@@ -136,6 +138,16 @@ Status Codec::Create(Compression::type codec_type, int compression_level,
       break;
 #else
       return Status::NotImplemented("LZ4 codec support not built");
+#endif
+    case Compression::LZ4_FRAME:
+#ifdef ARROW_WITH_LZ4
+      if (compression_level_set) {
+        return Status::Invalid("LZ4 doesn't support setting a compression level.");
+      }
+      codec.reset(new Lz4FrameCodec());
+      break;
+#else
+      return Status::NotImplemented("LZ4 codec support not built");
 #endif
     case Compression::ZSTD:
 #ifdef ARROW_WITH_ZSTD
@@ -189,6 +201,7 @@ bool Codec::IsAvailable(Compression::type codec_type) {
       return false;
 #endif
     case Compression::LZ4:
+    case Compression::LZ4_FRAME:
 #ifdef ARROW_WITH_LZ4
       return true;
 #else
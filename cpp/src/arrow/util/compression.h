@@ -30,7 +30,10 @@ class Status;
 
 struct Compression {
   /// \brief Compression algorithm
-  enum type { UNCOMPRESSED, SNAPPY, GZIP, BROTLI, ZSTD, LZ4, LZO, BZ2 };
+  ///
+  /// LZ4 uses the raw LZ4 block format for one-shot compression, LZ4_FRAME
+  /// uses the LZ4 frame format.
+  enum type { UNCOMPRESSED, SNAPPY, GZIP, BROTLI, ZSTD, LZ4, LZO, BZ2, LZ4_FRAME };
 };
 
 namespace util {
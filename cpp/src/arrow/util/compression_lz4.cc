@@ -298,5 +298,76 @@ Status Lz4Codec::Compress(int64_t input_len, const uint8_t* input,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Lz4 frame codec implementation
+
+Status Lz4FrameCodec::MakeCompressor(std::shared_ptr<Compressor>* out) {
+  auto ptr = std::make_shared<LZ4Compressor>();
+  RETURN_NOT_OK(ptr->Init());
+  *out = ptr;
+  return Status::OK();
+}
+
+Status Lz4FrameCodec::MakeDecompressor(std::shared_ptr<Decompressor>* out) {
+  auto ptr = std::make_shared<LZ4Decompressor>();
+  RETURN_NOT_OK(ptr->Init());
+  *out = ptr;
+  return Status::OK();
+}
+
+Status Lz4FrameCodec::Decompress(int64_t input_len, const uint8_t* input,
+                                 int64_t output_buffer_len, uint8_t* output_buffer) {
+  return Decompress(input_len, input, output_buffer_len, output_buffer, nullptr);
+}
+
+Status Lz4FrameCodec::Decompress(int64_t input_len, const uint8_t* input,
+                                 int64_t output_buffer_len, uint8_t* output_buffer,
+                                 int64_t* output_len) {
+  LZ4Decompressor decompressor;
+  RETURN_NOT_OK(decompressor.Init());
+
+  int64_t total_written = 0;
+  while (!decompressor.IsFinished() && input_len > 0) {
+    int64_t bytes_read, bytes_written;
+    bool need_more_output;
+    RETURN_NOT_OK(decompressor.Decompress(
+        input_len, input, output_buffer_len - total_written,
+        output_buffer + total_written, &bytes_read, &bytes_written, &need_more_output));
+    if (need_more_output) {
+      return Status::IOError("Lz4 decompressed output exceeds buffer size (",
+                             output_buffer_len, ")");
+    }
+    input += bytes_read;
+    input_len -= bytes_read;
+    total_written += bytes_written;
+  }
+  if (!decompressor.IsFinished() || input_len != 0) {
+    return Status::IOError("Corrupt Lz4 frame compressed data.");
+  }
+  if (output_len) {
+    *output_len = total_written;
+  }
+  return Status::OK();
+}
+
+int64_t Lz4FrameCodec::MaxCompressedLen(int64_t input_len,
+                                        const uint8_t* ARROW_ARG_UNUSED(input)) {
+  return static_cast<int64_t>(
+      LZ4F_compressFrameBound(static_cast<size_t>(input_len), nullptr /* prefs */));
+}
+
+Status Lz4FrameCodec::Compress(int64_t input_len, const uint8_t* input,
+                               int64_t output_buffer_len, uint8_t* output_buffer,
+                               int64_t* output_len) {
+  auto ret =
+      LZ4F_compressFrame(output_buffer, static_cast<size_t>(output_buffer_len), input,
+                         static_cast<size_t>(input_len), nullptr /* prefs */);
+  if (LZ4F_isError(ret)) {
+    return LZ4Error(ret, "Lz4 compression failure: ");
+  }
+  *output_len = static_cast<int64_t>(ret);
+  return Status::OK();
+}
+
 }  // namespace util
 }  // namespace arrow
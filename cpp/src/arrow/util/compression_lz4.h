@@ -49,6 +49,30 @@ class ARROW_EXPORT Lz4Codec : public Codec {
   const char* name() const override { return "lz4"; }
 };
 
+// Lz4 frame format codec.
+//
+// Unlike Lz4Codec, one-shot compression and decompression use the LZ4 frame
+// format, which is self-delimiting and compatible with the streaming API.
+class ARROW_EXPORT Lz4FrameCodec : public Codec {
+ public:
+  Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_buffer_len,
+                    uint8_t* output_buffer) override;
+
+  Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_buffer_len,
+                    uint8_t* output_buffer, int64_t* output_len) override;
+
+  Status Compress(int64_t input_len, const uint8_t* input, int64_t output_buffer_len,
+                  uint8_t* output_buffer, int64_t* output_len) override;
+
+  int64_t MaxCompressedLen(int64_t input_len, const uint8_t* input) override;
+
+  Status MakeCompressor(std::shared_ptr<Compressor>* out) override;
+
+  Status MakeDecompressor(std::shared_ptr<Decompressor>* out) override;
+
+  const char* name() const override { return "lz4_frame"; }
+};
+
 }  // namespace util
 }  // namespace arrow
 
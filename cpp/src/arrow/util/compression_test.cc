@@ -341,6 +341,7 @@ TEST(TestCodecMisc, GetCodecAsString) {
   ASSERT_EQ("LZO", Codec::GetCodecAsString(Compression::LZO));
   ASSERT_EQ("BROTLI", Codec::GetCodecAsString(Compression::BROTLI));
   ASSERT_EQ("LZ4", Codec::GetCodecAsString(Compression::LZ4));
+  ASSERT_EQ("LZ4_FRAME", Codec::GetCodecAsString(Compression::LZ4_FRAME));
   ASSERT_EQ("ZSTD", Codec::GetCodecAsString(Compression::ZSTD));
 }
 
@@ -531,6 +532,8 @@ INSTANTIATE_TEST_CASE_P(TestSnappy, CodecTest, ::testing::Values(Compression::SN
 
 #ifdef ARROW_WITH_LZ4
 INSTANTIATE_TEST_CASE_P(TestLZ4, CodecTest, ::testing::Values(Compression::LZ4));
+INSTANTIATE_TEST_CASE_P(TestLZ4Frame, CodecTest,
+                        ::testing::Values(Compression::LZ4_FRAME));
 #endif
 
 #ifdef ARROW_WITH_BROTLI
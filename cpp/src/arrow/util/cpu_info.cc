@@ -45,6 +45,7 @@
 #include <mutex>
 #include <string>
 
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string.h"
 
@@ -70,9 +71,41 @@ static struct {
     {"sse4_1", CpuInfo::SSE4_1},
     {"sse4_2", CpuInfo::SSE4_2},
     {"popcnt", CpuInfo::POPCNT},
+    {"avx", CpuInfo::AVX},
+    {"avx2", CpuInfo::AVX2},
+    {"avx512f", CpuInfo::AVX512F},
+    {"avx512cd", CpuInfo::AVX512CD},
+    {"avx512vl", CpuInfo::AVX512VL},
+    {"avx512dq", CpuInfo::AVX512DQ},
+    {"avx512bw", CpuInfo::AVX512BW},
+    {"bmi1", CpuInfo::BMI1},
+    {"bmi2", CpuInfo::BMI2},
 };
 static const int64_t num_flags = sizeof(flag_mappings) / sizeof(flag_mappings[0]);
 
+namespace {
+
+// Return the flags to clear for the ARROW_USER_SIMD_LEVEL environment variable,
+// which restricts the instruction sets used by the runtime dispatched kernels
+// (see arrow/util/dispatch.h), e.g. to compare the performance of the levels.
+int64_t UserSimdLevelMask() {
+  std::string level;
+  if (!GetEnvVar("ARROW_USER_SIMD_LEVEL", &level).ok() || level == "MAX" ||
+      level == "AVX512") {
+    return 0;
+  }
+  if (level == "AVX2") {
+    return CpuInfo::AVX512;
+  }
+  if (level == "NONE" || level == "SSE4_2") {
+    return CpuInfo::AVX | CpuInfo::AVX2 | CpuInfo::AVX512;
+  }
+  ARROW_LOG(WARNING) << "Invalid value for ARROW_USER_SIMD_LEVEL: " << level;
+  return 0;
+}
+
+}  // namespace
+
 #ifndef _WIN32
 namespace {
 
@@ -139,14 +172,28 @@ bool RetrieveCacheSize(int64_t* cache_sizes) {
   return true;
 }
 
+// Read the XCR0 register, which tells which register states the OS saves
+// on context switches
+uint64_t ReadXCR0() {
+#ifdef _MSC_VER
+  return _xgetbv(0);
+#else
+  uint32_t eax, edx;
+  __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
 bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (!hardware_flags || !model_name) {
     return false;
   }
   const int register_ECX_id = 1;
+  const int register_EBX_extended_id = 7;
   int highest_valid_id = 0;
   int highest_extended_valid_id = 0;
   std::bitset<32> features_ECX;
+  std::bitset<32> features_EBX_extended;
   std::array<int, 4> cpu_info;
 
   // Get highest valid id
@@ -158,6 +205,11 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   __cpuidex(cpu_info.data(), register_ECX_id, 0);
   features_ECX = cpu_info[2];
 
+  if (highest_valid_id >= register_EBX_extended_id) {
+    __cpuidex(cpu_info.data(), register_EBX_extended_id, 0);
+    features_EBX_extended = cpu_info[1];
+  }
+
   // Get highest extended id
   __cpuid(cpu_info.data(), 0x80000000);
   highest_extended_valid_id = cpu_info[0];
@@ -176,6 +228,24 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+
+  // The AVX register states must also be enabled by the OS (OSXSAVE + XCR0)
+  const uint64_t xcr0 = features_ECX[27] ? ReadXCR0() : 0;
+  const bool os_saves_ymm = (xcr0 & 0x6) == 0x6;
+  const bool os_saves_zmm = os_saves_ymm && (xcr0 & 0xe0) == 0xe0;
+  if (os_saves_ymm) {
+    if (features_ECX[28]) *hardware_flags |= CpuInfo::AVX;
+    if (features_EBX_extended[5]) *hardware_flags |= CpuInfo::AVX2;
+  }
+  if (os_saves_zmm) {
+    if (features_EBX_extended[16]) *hardware_flags |= CpuInfo::AVX512F;
+    if (features_EBX_extended[17]) *hardware_flags |= CpuInfo::AVX512DQ;
+    if (features_EBX_extended[28]) *hardware_flags |= CpuInfo::AVX512CD;
+    if (features_EBX_extended[30]) *hardware_flags |= CpuInfo::AVX512BW;
+    if (features_EBX_extended[31]) *hardware_flags |= CpuInfo::AVX512VL;
+  }
+  if (features_EBX_extended[3]) *hardware_flags |= CpuInfo::BMI1;
+  if (features_EBX_extended[8]) *hardware_flags |= CpuInfo::BMI2;
   return true;
 }
 #endif
@@ -268,6 +338,7 @@ void CpuInfo::Init() {
   } else {
     cycles_per_ms_ = 1000000;
   }
+  hardware_flags_ &= ~UserSimdLevelMask();
   original_hardware_flags_ = hardware_flags_;
 
   if (num_cores > 0) {
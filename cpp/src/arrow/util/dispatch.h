@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Runtime selection of kernels compiled for several instruction set levels.
+//
+// A kernel for level X lives in its own source file (e.g. foo_avx2.cc), which
+// the build compiles with the flags of level X when ARROW_HAVE_RUNTIME_X is
+// defined. Such files must only be entered through functions that were
+// selected by checking the CPU at runtime, and must not define entities
+// shared with other translation units (inline functions and templates of
+// common headers are fine as long as they end up inlined, so keep kernels to
+// plain loops over raw pointers).
+//
+// The ARROW_USER_SIMD_LEVEL environment variable (NONE, SSE4_2, AVX2, AVX512
+// or MAX) caps the level selected, e.g. to compare the performance of levels.
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "arrow/util/cpu_info.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief The instruction set levels kernels can be compiled for, in
+/// increasing order of preference
+enum class DispatchLevel : int {
+  NONE = 0,
+  SSE4_2,
+  AVX2,
+  AVX512,
+  MAX
+};
+
+/// \brief Return whether the CPU supports the instructions of the given level
+///
+/// Whether kernels for that level are compiled in is told by the
+/// ARROW_HAVE_RUNTIME_<level> macros.
+inline bool IsDispatchLevelSupported(DispatchLevel level) {
+  const auto cpu_info = CpuInfo::GetInstance();
+  switch (level) {
+    case DispatchLevel::NONE:
+      return true;
+    case DispatchLevel::SSE4_2:
+      return cpu_info->IsSupported(CpuInfo::SSE4_2);
+    case DispatchLevel::AVX2:
+      return cpu_info->IsSupported(CpuInfo::AVX2);
+    case DispatchLevel::AVX512:
+      // The AVX-512 kernels are compiled for Skylake-X, which also has BMI2
+      return cpu_info->IsSupported(CpuInfo::AVX512 | CpuInfo::BMI2);
+    default:
+      return false;
+  }
+}
+
+/// \brief Return the highest level supported by the CPU that kernels were
+/// compiled for
+inline DispatchLevel GetBestDispatchLevel() {
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (IsDispatchLevelSupported(DispatchLevel::AVX512)) {
+    return DispatchLevel::AVX512;
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (IsDispatchLevelSupported(DispatchLevel::AVX2)) {
+    return DispatchLevel::AVX2;
+  }
+#endif
+  return DispatchLevel::NONE;
+}
+
+/// \brief A function pointer resolved at construction to the implementation
+/// for the highest level supported by the CPU
+///
+/// DynamicFunction must define a FunctionType and a static implementations()
+/// method returning the (level, function) pairs compiled in, which must
+/// include one for DispatchLevel::NONE. Typical use is through a
+/// function-local static:
+///
+///   struct FooDynamicFunction {
+///     using FunctionType = decltype(&foo_default);
+///
+///     static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+///       return {{DispatchLevel::NONE, foo_default}
+///   #if defined(ARROW_HAVE_RUNTIME_AVX2)
+///               , {DispatchLevel::AVX2, foo_avx2}
+///   #endif
+///       };
+///     }
+///   };
+///
+///   int foo(...) {
+///     static DynamicDispatch<FooDynamicFunction> dispatch;
+///     return dispatch.func(...);
+///   }
+template <typename DynamicFunction>
+class DynamicDispatch {
+ public:
+  using FunctionType = typename DynamicFunction::FunctionType;
+  using Implementation = std::pair<DispatchLevel, FunctionType>;
+
+  DynamicDispatch() { Resolve(DynamicFunction::implementations()); }
+
+  FunctionType func = {};
+
+ protected:
+  void Resolve(const std::vector<Implementation>& implementations) {
+    DispatchLevel best_level = DispatchLevel::NONE;
+    for (const auto& impl : implementations) {
+      if ((func == nullptr || impl.first > best_level) &&
+          IsDispatchLevelSupported(impl.first)) {
+        best_level = impl.first;
+        func = impl.second;
+      }
+    }
+  }
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/util/hashing.h"
+
+#include <utility>
+#include <vector>
+
+#include "arrow/util/dispatch.h"
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/hashing_avx2.h"
+#endif
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+struct ComputeLongStringHashDynamicFunction {
+  using FunctionType = decltype(&ComputeLongStringHashDefault);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, ComputeLongStringHashDefault}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+            ,
+            {DispatchLevel::AVX2, ComputeLongStringHashAvx2}
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+hash_t ComputeLongStringHashDefault(const void* data, int64_t length,
+                                    const void* secret) {
+  return XXH3_64bits_withSecret(data, static_cast<size_t>(length), secret,
+                                XXH3_SECRET_SIZE_MIN);
+}
+
+hash_t ComputeLongStringHash(const void* data, int64_t length, const void* secret) {
+  static DynamicDispatch<ComputeLongStringHashDynamicFunction> dispatch;
+  return dispatch.func(data, length, secret);
+}
+
+}  // namespace internal
+}  // namespace arrow
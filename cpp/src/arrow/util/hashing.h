@@ -41,6 +41,7 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
 
 #define XXH_INLINE_ALL
 #define XXH_PRIVATE_API
@@ -63,6 +64,16 @@ typedef uint64_t hash_t;
 template <uint64_t AlgNum>
 inline hash_t ComputeStringHash(const void* data, int64_t length);
 
+// XXH3 hash of data longer than XXH3_MIDSIZE_MAX, with the vector instructions
+// selected at runtime for the CPU (this doesn't change the result).
+// secret must point to XXH3_SECRET_SIZE_MIN bytes.
+ARROW_EXPORT
+hash_t ComputeLongStringHash(const void* data, int64_t length, const void* secret);
+
+ARROW_EXPORT
+hash_t ComputeLongStringHashDefault(const void* data, int64_t length,
+                                    const void* secret);
+
 template <typename Scalar, uint64_t AlgNum>
 struct ScalarHelperBase {
   static bool CompareScalars(Scalar u, Scalar v) { return u == v; }
@@ -188,6 +199,10 @@ hash_t ComputeStringHash(const void* data, int64_t length) {
 
   static_assert(AlgNum < 2, "AlgNum too large");
   static constexpr auto secret = kXxh3Secrets + AlgNum;
+  if (ARROW_PREDICT_FALSE(length > XXH3_MIDSIZE_MAX)) {
+    // Only long inputs run the vectorized loop of XXH3
+    return ComputeLongStringHash(data, length, secret);
+  }
   return XXH3_64bits_withSecret(data, static_cast<size_t>(length), secret,
                                 XXH3_SECRET_SIZE_MIN);
 }
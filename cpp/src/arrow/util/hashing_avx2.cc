@@ -0,0 +1,39 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+// This file is compiled with AVX2 enabled, which makes XXH3 use its AVX2
+// accumulation loop. Only the vendored xxhash is included, as its functions
+// are all static and hence private to this file.
+
+#include "arrow/util/hashing_avx2.h"
+
+#define XXH_INLINE_ALL
+#define XXH_PRIVATE_API
+#define XXH_NAMESPACE arrow_hashing_avx2_
+
+#include "arrow/vendored/xxhash.h"
+
+namespace arrow {
+namespace internal {
+
+uint64_t ComputeLongStringHashAvx2(const void* data, int64_t length,
+                                   const void* secret) {
+  return XXH3_64bits_withSecret(data, static_cast<size_t>(length), secret,
+                                XXH3_SECRET_SIZE_MIN);
+}
+
+}  // namespace internal
+}  // namespace arrow
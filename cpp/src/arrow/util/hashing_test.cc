@@ -30,9 +30,14 @@
 
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/hashing_avx2.h"
+#endif
+
 namespace arrow {
 namespace internal {
 
@@ -146,6 +151,31 @@ TEST(HashingBounds, Strings) {
   }
 }
 
+TEST(HashingDispatch, LongStrings) {
+  // The hash of long strings must not depend on the instructions used
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> dist(0, 255);
+  std::string secret(XXH3_SECRET_SIZE_MIN, '\0');
+  for (auto& c : secret) {
+    c = static_cast<char>(dist(gen));
+  }
+  for (const size_t size : {241, 256, 1000, 1024, 4096, 10007}) {
+    std::string str(size, '\0');
+    for (auto& c : str) {
+      c = static_cast<char>(dist(gen));
+    }
+    const auto length = static_cast<int64_t>(size);
+    const hash_t expected =
+        ComputeLongStringHashDefault(str.data(), length, secret.data());
+    ASSERT_EQ(expected, ComputeLongStringHash(str.data(), length, secret.data()));
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+    if (IsDispatchLevelSupported(DispatchLevel::AVX2)) {
+      ASSERT_EQ(expected, ComputeLongStringHashAvx2(str.data(), length, secret.data()));
+    }
+#endif
+  }
+}
+
 TEST(ScalarMemoTable, Int64) {
   const int64_t A = 1234, B = 0, C = -98765321, D = 12345678901234LL, E = -1, F = 1,
                 G = 9223372036854775807LL, H = -9223372036854775807LL - 1;
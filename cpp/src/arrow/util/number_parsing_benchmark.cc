@@ -49,6 +49,22 @@ static std::vector<std::string> MakeIntStrings(int32_t num_items) {
   return strings;
 }
 
+// Integers of 8 to 16 digits
+template <typename c_int>
+static std::vector<std::string> MakeLongIntStrings(int32_t num_items) {
+  using c_int_limits = std::numeric_limits<c_int>;
+  std::vector<std::string> base_strings = {
+      "12345678",         c_int_limits::is_signed ? "-987654321" : "987654321",
+      "1234567890123",    c_int_limits::is_signed ? "-20181113171110" : "20181113171110",
+      "9876543210987654", "100000000",
+      "31415926535",      c_int_limits::is_signed ? "-4294967296" : "4294967296"};
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
 static std::vector<std::string> MakeFloatStrings(int32_t num_items) {
   std::vector<std::string> base_strings = {"0.0",         "5",        "-12.3",
                                            "98765430000", "3456.789", "0.0012345",
@@ -60,6 +76,19 @@ static std::vector<std::string> MakeFloatStrings(int32_t num_items) {
   return strings;
 }
 
+// Floats written with all their significant digits
+static std::vector<std::string> MakePreciseFloatStrings(int32_t num_items) {
+  std::vector<std::string> base_strings = {
+      "0.30000000000000004", "-1234.5678901234567", "6.02214076e23",
+      "3.141592653589793",   "-1.2345678901234e-5", "12345678.901234567",
+      "2.718281828459045e8", "9.87654321e-300"};
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
 static std::vector<std::string> MakeTimestampStrings(int32_t num_items) {
   std::vector<std::string> base_strings = {"2018-11-13 17:11:10", "2018-11-13 11:22:33",
                                            "2016-02-29 11:22:33"};
@@ -117,6 +146,26 @@ static void IntegerParsing(benchmark::State& state) {  // NOLINT non-const refer
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void LongIntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
+  auto strings = MakeLongIntStrings<C_TYPE>(1000);
+  StringConverter<ARROW_TYPE> converter;
+
+  while (state.KeepRunning()) {
+    C_TYPE total = 0;
+    for (const auto& s : strings) {
+      C_TYPE value;
+      if (!converter(s.data(), s.length(), &value)) {
+        std::cerr << "Conversion failed for '" << s << "'";
+        std::abort();
+      }
+      total = static_cast<C_TYPE>(total + value);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
 static void FloatParsing(benchmark::State& state) {  // NOLINT non-const reference
   auto strings = MakeFloatStrings(1000);
@@ -137,6 +186,26 @@ static void FloatParsing(benchmark::State& state) {  // NOLINT non-const referen
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void PreciseFloatParsing(benchmark::State& state) {  // NOLINT non-const reference
+  auto strings = MakePreciseFloatStrings(1000);
+  StringConverter<ARROW_TYPE> converter;
+
+  while (state.KeepRunning()) {
+    C_TYPE total = 0;
+    for (const auto& s : strings) {
+      C_TYPE value;
+      if (!converter(s.data(), s.length(), &value)) {
+        std::cerr << "Conversion failed for '" << s << "'";
+        std::abort();
+      }
+      total += value;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
 template <TimeUnit::type UNIT>
 static void TimestampParsing(benchmark::State& state) {  // NOLINT non-const reference
   using c_type = TimestampType::c_type;
@@ -212,8 +281,13 @@ BENCHMARK_TEMPLATE(IntegerParsing, UInt16Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt32Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt64Type);
 
+BENCHMARK_TEMPLATE(LongIntegerParsing, Int64Type);
+BENCHMARK_TEMPLATE(LongIntegerParsing, UInt64Type);
+
 BENCHMARK_TEMPLATE(FloatParsing, FloatType);
 BENCHMARK_TEMPLATE(FloatParsing, DoubleType);
+BENCHMARK_TEMPLATE(PreciseFloatParsing, FloatType);
+BENCHMARK_TEMPLATE(PreciseFloatParsing, DoubleType);
 
 BENCHMARK_TEMPLATE(TimestampParsing, TimeUnit::SECOND);
 BENCHMARK_TEMPLATE(TimestampParsing, TimeUnit::MILLI);
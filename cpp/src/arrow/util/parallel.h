@@ -19,8 +19,11 @@
 #define ARROW_UTIL_PARALLEL_H
 
 #include <atomic>
+#include <chrono>
+#include <future>
 #include <mutex>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "arrow/status.h"
@@ -40,8 +43,18 @@ Status ParallelFor(int num_tasks, FUNCTION&& func) {
   for (int i = 0; i < num_tasks; ++i) {
     futures[i] = pool->Submit(func, i);
   }
+  // Blocking a worker of the pool may starve the pool when tasks wait for
+  // nested ParallelFor calls, so run pending tasks while waiting
+  const bool helping = pool->OwnsThisThread();
   auto st = Status::OK();
   for (auto& fut : futures) {
+    while (helping &&
+           fut.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+      if (!pool->RunPendingTask()) {
+        // Another worker is running the task
+        fut.wait_for(std::chrono::milliseconds(1));
+      }
+    }
     st &= fut.get();
   }
   return st;
@@ -89,6 +102,20 @@ Status ParallelFor(int nthreads, int num_tasks, FUNCTION&& func) {
   return Status::OK();
 }
 
+// Like the 2-argument ParallelFor(), but runs the tasks serially in the calling
+// thread if `use_threads` is false or there is at most one task.
+
+template <class FUNCTION>
+Status OptionalParallelFor(bool use_threads, int num_tasks, FUNCTION&& func) {
+  if (use_threads && num_tasks > 1) {
+    return ParallelFor(num_tasks, std::forward<FUNCTION>(func));
+  }
+  for (int i = 0; i < num_tasks; ++i) {
+    RETURN_NOT_OK(func(i));
+  }
+  return Status::OK();
+}
+
 }  // namespace internal
 }  // namespace arrow
 
@@ -16,11 +16,316 @@
 // under the License.
 
 #include "arrow/util/parsing.h"
+
+#include <cfloat>
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/util/bit_util.h"
 #include "arrow/util/double_conversion.h"
+#include "arrow/util/parsing_powers_of_five.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 
 namespace arrow {
 namespace internal {
 
+namespace {
+
+// A decimal number `mantissa * 10^exponent`
+struct DecimalNumber {
+  uint64_t mantissa;
+  int64_t exponent;
+  bool negative;
+};
+
+inline bool IsDigit(char c) { return static_cast<uint8_t>(c - '0') <= 9; }
+
+// Accumulate the digits at `*s` into `mantissa`, returning the number of digits
+inline int64_t ParseDigits(const char** s, const char* end, uint64_t* mantissa) {
+  const char* const start = *s;
+  const char* p = start;
+  uint32_t eight_digits;
+  while (end - p >= 8 && detail::ParseEightDigits(p, &eight_digits)) {
+    *mantissa = *mantissa * 100000000ULL + eight_digits;
+    p += 8;
+  }
+  for (; p != end && IsDigit(*p); ++p) {
+    *mantissa = *mantissa * 10U + detail::ParseDecimalDigit(*p);
+  }
+  *s = p;
+  return p - start;
+}
+
+// Parse a number of the form "[-]digits[.digits][(e|E)[+|-]digits]" with at
+// most 19 significant digits.  Returns false for other strings, which are
+// left to double-conversion.
+bool ParseDecimalNumber(const char* s, size_t length, DecimalNumber* out) {
+  const char* p = s;
+  const char* const end = s + length;
+
+  out->negative = p != end && *p == '-';
+  if (out->negative) {
+    ++p;
+  }
+  const char* const digits_start = p;
+  uint64_t mantissa = 0;
+  const int64_t num_integer_digits = ParseDigits(&p, end, &mantissa);
+  if (num_integer_digits == 0) {
+    return false;
+  }
+  int64_t num_fraction_digits = 0;
+  if (p != end && *p == '.') {
+    ++p;
+    num_fraction_digits = ParseDigits(&p, end, &mantissa);
+    if (num_fraction_digits == 0) {
+      return false;
+    }
+  }
+  int64_t exponent = -num_fraction_digits;
+  if (p != end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    const bool negative_exponent = p != end && *p == '-';
+    if (p != end && (*p == '-' || *p == '+')) {
+      ++p;
+    }
+    if (p == end || !IsDigit(*p)) {
+      return false;
+    }
+    int64_t explicit_exponent = 0;
+    for (; p != end && IsDigit(*p); ++p) {
+      // Saturate, the result is zero or infinity way before
+      if (explicit_exponent < 0x10000) {
+        explicit_exponent = explicit_exponent * 10 + detail::ParseDecimalDigit(*p);
+      }
+    }
+    exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+  }
+  if (p != end) {
+    return false;
+  }
+  if (num_integer_digits + num_fraction_digits > 19) {
+    // The mantissa may have overflowed, unless there are enough leading zeros
+    int64_t num_digits = num_integer_digits + num_fraction_digits;
+    for (p = digits_start; p != end && (*p == '0' || *p == '.'); ++p) {
+      num_digits -= (*p == '0');
+    }
+    if (num_digits > 19) {
+      return false;
+    }
+  }
+  out->mantissa = mantissa;
+  out->exponent = exponent;
+  return true;
+}
+
+template <typename T>
+struct BinaryFormat;
+
+template <>
+struct BinaryFormat<double> {
+  using Bits = uint64_t;
+  static constexpr int kMantissaBits = 52;
+  static constexpr int kMinimumExponent = -1023;
+  static constexpr int kInfinitePower = 0x7FF;
+  static constexpr int kMinExponentRoundToEven = -4;
+  static constexpr int kMaxExponentRoundToEven = 23;
+  static constexpr int kSmallestPowerOfTen = -342;
+  static constexpr int kLargestPowerOfTen = 308;
+  // Mantissas and powers of ten represented exactly
+  static constexpr uint64_t kMaxExactMantissa = uint64_t(1) << 53;
+  static constexpr int kMaxExactPowerOfTen = 22;
+
+  static double ExactPowerOfTen(int64_t exponent) {
+    static constexpr double kPowers[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                         1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                         1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    return kPowers[exponent];
+  }
+};
+
+template <>
+struct BinaryFormat<float> {
+  using Bits = uint32_t;
+  static constexpr int kMantissaBits = 23;
+  static constexpr int kMinimumExponent = -127;
+  static constexpr int kInfinitePower = 0xFF;
+  static constexpr int kMinExponentRoundToEven = -17;
+  static constexpr int kMaxExponentRoundToEven = 10;
+  static constexpr int kSmallestPowerOfTen = -65;
+  static constexpr int kLargestPowerOfTen = 38;
+  static constexpr uint64_t kMaxExactMantissa = uint64_t(1) << 24;
+  static constexpr int kMaxExactPowerOfTen = 10;
+
+  static float ExactPowerOfTen(int64_t exponent) {
+    static constexpr float kPowers[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f,  1e5f,
+                                        1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+    return kPowers[exponent];
+  }
+};
+
+struct UInt128 {
+  uint64_t high;
+  uint64_t low;
+};
+
+inline UInt128 FullMultiply(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+  const auto product = static_cast<unsigned __int128>(a) * b;
+  return {static_cast<uint64_t>(product >> 64), static_cast<uint64_t>(product)};
+#elif defined(_MSC_VER) && defined(_M_X64)
+  UInt128 result;
+  result.low = _umul128(a, b, &result.high);
+  return result;
+#else
+  const uint64_t a_low = a & 0xFFFFFFFFULL, a_high = a >> 32;
+  const uint64_t b_low = b & 0xFFFFFFFFULL, b_high = b >> 32;
+  const uint64_t low_low = a_low * b_low;
+  const uint64_t high_low = a_high * b_low;
+  const uint64_t low_high = a_low * b_high;
+  const uint64_t high_high = a_high * b_high;
+  const uint64_t middle = (low_low >> 32) + (high_low & 0xFFFFFFFFULL) + low_high;
+  return {high_high + (high_low >> 32) + (middle >> 32),
+          (middle << 32) | (low_low & 0xFFFFFFFFULL)};
+#endif
+}
+
+// The Eisel-Lemire algorithm, as described in "Number Parsing at a Gigabyte
+// per Second" (Daniel Lemire): multiply the mantissa by a truncated 128-bit
+// power of five. Computes the biased exponent and the explicit mantissa bits,
+// or returns false if the truncated product is too close to a rounding
+// boundary to decide which way to round.
+template <typename T>
+bool ComputeFloat(int64_t exponent, uint64_t mantissa, int32_t* out_power2,
+                  uint64_t* out_mantissa) {
+  using Format = BinaryFormat<T>;
+
+  if (mantissa == 0 || exponent < Format::kSmallestPowerOfTen) {
+    *out_power2 = 0;
+    *out_mantissa = 0;
+    return true;
+  }
+  if (exponent > Format::kLargestPowerOfTen) {
+    *out_power2 = Format::kInfinitePower;
+    *out_mantissa = 0;
+    return true;
+  }
+  const int leading_zeros = BitUtil::CountLeadingZeros(mantissa);
+  mantissa <<= leading_zeros;
+
+  // Only the most significant bits of the product are needed, unless they are
+  // all ones and a carry from the lower bits could change them
+  const uint64_t* power_of_five =
+      detail::kPowersOfFive[exponent - detail::kSmallestPowerOfFive];
+  UInt128 product = FullMultiply(mantissa, power_of_five[0]);
+  constexpr uint64_t kPrecisionMask = ~uint64_t(0) >> (Format::kMantissaBits + 3);
+  if ((product.high & kPrecisionMask) == kPrecisionMask) {
+    const UInt128 low_product = FullMultiply(mantissa, power_of_five[1]);
+    product.low += low_product.high;
+    if (low_product.high > product.low) {
+      ++product.high;
+    }
+    // The bits of the power of five beyond the 128 truncated ones could still
+    // carry into the result: leave this number to the slow path
+    if ((product.high & kPrecisionMask) == kPrecisionMask &&
+        product.low == ~uint64_t(0) && low_product.low + mantissa < mantissa) {
+      return false;
+    }
+  }
+
+  const int upper_bit = static_cast<int>(product.high >> 63);
+  const int shift = upper_bit + 64 - Format::kMantissaBits - 3;
+  uint64_t result = product.high >> shift;
+  // floor(log2(10^exponent)) + 63, through log2(10) ~ 217706 / 2^16
+  const int32_t power_of_ten_log2 =
+      static_cast<int32_t>(((152170 + 65536) * exponent) >> 16) + 63;
+  int32_t power2 =
+      power_of_ten_log2 + upper_bit - leading_zeros - Format::kMinimumExponent;
+
+  if (power2 <= 0) {
+    // Subnormal, or zero
+    if (-power2 + 1 >= 64) {
+      *out_power2 = 0;
+      *out_mantissa = 0;
+      return true;
+    }
+    result >>= -power2 + 1;
+    result += result & 1;
+    result >>= 1;
+    // Rounding up may yield the smallest normal number
+    *out_power2 = result < (uint64_t(1) << Format::kMantissaBits) ? 0 : 1;
+    *out_mantissa = result & ~(uint64_t(1) << Format::kMantissaBits);
+    return true;
+  }
+
+  // Round half to even when exactly in between two floats, which is only
+  // possible when the power of five fits in 64 bits
+  if (product.low <= 1 && exponent >= Format::kMinExponentRoundToEven &&
+      exponent <= Format::kMaxExponentRoundToEven && (result & 3) == 1 &&
+      (result << shift) == product.high) {
+    result &= ~uint64_t(1);
+  }
+  result += result & 1;
+  result >>= 1;
+  if (result >= (uint64_t(2) << Format::kMantissaBits)) {
+    result = uint64_t(1) << Format::kMantissaBits;
+    ++power2;
+  }
+  result &= ~(uint64_t(1) << Format::kMantissaBits);
+  if (power2 >= Format::kInfinitePower) {
+    power2 = Format::kInfinitePower;
+    result = 0;
+  }
+  *out_power2 = power2;
+  *out_mantissa = result;
+  return true;
+}
+
+// Exact conversion of the simple decimal numbers, false for other strings and
+// for the numbers which can't be rounded without more precision
+template <typename T>
+bool FastStringToFloat(const char* s, size_t length, T* out) {
+  using Format = BinaryFormat<T>;
+  using Bits = typename Format::Bits;
+
+  DecimalNumber number;
+  if (!ParseDecimalNumber(s, length, &number)) {
+    return false;
+  }
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+  // Clinger's fast path: both operands are exact, so is the rounded result
+  if (number.mantissa <= Format::kMaxExactMantissa &&
+      number.exponent >= -Format::kMaxExactPowerOfTen &&
+      number.exponent <= Format::kMaxExactPowerOfTen) {
+    T value = static_cast<T>(number.mantissa);
+    if (number.exponent < 0) {
+      value /= Format::ExactPowerOfTen(-number.exponent);
+    } else {
+      value *= Format::ExactPowerOfTen(number.exponent);
+    }
+    *out = number.negative ? -value : value;
+    return true;
+  }
+#endif
+  int32_t power2;
+  uint64_t mantissa;
+  if (ARROW_PREDICT_FALSE(
+          !ComputeFloat<T>(number.exponent, number.mantissa, &power2, &mantissa))) {
+    return false;
+  }
+  Bits bits = static_cast<Bits>(mantissa) |
+              (static_cast<Bits>(power2) << Format::kMantissaBits);
+  if (number.negative) {
+    bits |= Bits(1) << (sizeof(Bits) * 8 - 1);
+  }
+  std::memcpy(out, &bits, sizeof(bits));
+  return true;
+}
+
+}  // namespace
+
 struct StringToFloatConverter::Impl {
   Impl()
       : main_converter_(flags_, main_junk_value_, main_junk_value_, "inf", "nan"),
@@ -44,6 +349,9 @@ StringToFloatConverter::StringToFloatConverter() : impl_(new Impl()) {}
 StringToFloatConverter::~StringToFloatConverter() {}
 
 bool StringToFloatConverter::StringToFloat(const char* s, size_t length, float* out) {
+  if (ARROW_PREDICT_TRUE(FastStringToFloat(s, length, out))) {
+    return true;
+  }
   int processed_length;
   float v;
   v = impl_->main_converter_.StringToFloat(s, static_cast<int>(length),
@@ -60,6 +368,9 @@ bool StringToFloatConverter::StringToFloat(const char* s, size_t length, float*
 }
 
 bool StringToFloatConverter::StringToFloat(const char* s, size_t length, double* out) {
+  if (ARROW_PREDICT_TRUE(FastStringToFloat(s, length, out))) {
+    return true;
+  }
   int processed_length;
   double v;
   v = impl_->main_converter_.StringToDouble(s, static_cast<int>(length),
@@ -22,6 +22,8 @@
 
 #include <cassert>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
@@ -29,6 +31,7 @@
 
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
 #include "arrow/vendored/datetime.h"
@@ -85,10 +88,9 @@ class StringConverter<BooleanType> {
   }
 };
 
-// Ideas for faster float parsing:
-// - http://rapidjson.org/md_doc_internals.html#ParsingDouble
-// - https://github.com/google/double-conversion [used here]
-// - https://github.com/achan001/dtoa-fast
+// Floats are parsed with Clinger's fast path or the Eisel-Lemire algorithm
+// (see https://arxiv.org/abs/2101.11408) when they have at most 19 significant
+// digits, and with https://github.com/google/double-conversion otherwise.
 
 class ARROW_EXPORT StringToFloatConverter {
  public:
@@ -131,6 +133,26 @@ namespace detail {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+// Parse 8 decimal digits at once, returning false if any is not a digit
+inline bool ParseEightDigits(const char* s, uint32_t* out) {
+  uint64_t chars;
+  std::memcpy(&chars, s, sizeof(chars));
+  chars = BitUtil::FromLittleEndian(chars);
+  // All characters are digits iff their high nibbles, and those of the
+  // characters plus 6, are 3
+  if (ARROW_PREDICT_FALSE(((chars & 0xF0F0F0F0F0F0F0F0ULL) |
+                           (((chars + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >>
+                            4)) != 0x3333333333333333ULL)) {
+    return false;
+  }
+  // Combine adjacent digits into 2-digit, then 4-digit, then 8-digit numbers
+  chars = ((chars & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+  chars = ((chars & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+  *out = static_cast<uint32_t>(((chars & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >>
+                               32);
+  return true;
+}
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -192,6 +214,22 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
   uint32_t result = 0;
 
+  if (length == 8 || length == 9) {
+    // Can't overflow
+    if (ARROW_PREDICT_FALSE(!ParseEightDigits(s, &result))) {
+      return false;
+    }
+    if (length == 9) {
+      const uint8_t digit = ParseDecimalDigit(s[8]);
+      if (ARROW_PREDICT_FALSE(digit > 9U)) {
+        return false;
+      }
+      result = result * 10U + digit;
+    }
+    *out = result;
+    return true;
+  }
+
   PARSE_UNSIGNED_ITERATION(uint32_t);
   PARSE_UNSIGNED_ITERATION(uint32_t);
   PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -211,6 +249,26 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
   uint64_t result = 0;
 
+  if (length >= 8 && length <= 19) {
+    // Can't overflow
+    for (; length >= 8; s += 8, length -= 8) {
+      uint32_t eight_digits;
+      if (ARROW_PREDICT_FALSE(!ParseEightDigits(s, &eight_digits))) {
+        return false;
+      }
+      result = result * 100000000ULL + eight_digits;
+    }
+    for (; length > 0; ++s, --length) {
+      const uint8_t digit = ParseDecimalDigit(*s);
+      if (ARROW_PREDICT_FALSE(digit > 9U)) {
+        return false;
+      }
+      result = result * 10U + digit;
+    }
+    *out = result;
+    return true;
+  }
+
   PARSE_UNSIGNED_ITERATION(uint64_t);
   PARSE_UNSIGNED_ITERATION(uint64_t);
   PARSE_UNSIGNED_ITERATION(uint64_t);
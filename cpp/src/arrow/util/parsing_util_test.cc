@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <limits>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -63,6 +64,15 @@ TEST(StringConversion, ToFloat) {
   // XXX ASSERT_EQ doesn't distinguish signed zeros
   AssertConversion(converter, "-0.0", -0.0f);
   AssertConversion(converter, "-1e20", -1e20f);
+  AssertConversion(converter, "16777217", 16777216.0f);
+  AssertConversion(converter, "3.4028235e38", 3.4028235e38f);
+  AssertConversion(converter, "1.17549435e-38", 1.17549435e-38f);
+  // Subnormal
+  AssertConversion(converter, "1.4e-45", 1.4e-45f);
+  AssertConversion(converter, "1e-50", 0.0f);
+  AssertConversion(converter, "1e39", std::numeric_limits<float>::infinity());
+  // Many significant digits
+  AssertConversion(converter, "0.1000000000000000055511151231257827", 0.1f);
 
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "e");
@@ -76,9 +86,30 @@ TEST(StringConversion, ToDouble) {
   // XXX ASSERT_EQ doesn't distinguish signed zeros
   AssertConversion(converter, "-0.0", -0.0);
   AssertConversion(converter, "-1e100", -1e100);
+  AssertConversion(converter, "1e23", 1e23);
+  AssertConversion(converter, "9007199254740993", 9007199254740992.0);
+  AssertConversion(converter, "1.7976931348623157e308", 1.7976931348623157e308);
+  AssertConversion(converter, "2.2250738585072014E-308", 2.2250738585072014e-308);
+  AssertConversion(converter, "0.000123456789012345678", 0.000123456789012345678);
+  AssertConversion(converter, "123456789.123456789e-5", 1234.56789123456789);
+  // Subnormal
+  AssertConversion(converter, "4.9406564584124654e-324", 4.9406564584124654e-324);
+  AssertConversion(converter, "1e-400", 0.0);
+  AssertConversion(converter, "1e309", std::numeric_limits<double>::infinity());
+  // Many significant digits
+  AssertConversion(converter, "3.141592653589793238462643383279", 3.141592653589793);
+  AssertConversion(converter, "0.00000000000000000000000000000001234", 1.234e-32);
+  // Other syntaxes
+  AssertConversion(converter, "+1.5", 1.5);
+  AssertConversion(converter, ".5", 0.5);
+  AssertConversion(converter, "5.", 5.0);
+  AssertConversion(converter, "inf", std::numeric_limits<double>::infinity());
 
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "e");
+  AssertConversionFails(converter, "1e");
+  AssertConversionFails(converter, "1.5.");
+  AssertConversionFails(converter, "12345678x");
 }
 
 #if !defined(_WIN32) || defined(NDEBUG)
@@ -204,12 +235,16 @@ TEST(StringConversion, ToUInt32) {
   AssertConversion(converter, "432198765", 432198765UL);
   AssertConversion(converter, "4294967295", 4294967295UL);
   AssertConversion(converter, "04294967295", 4294967295UL);
+  AssertConversion(converter, "12345678", 12345678UL);
+  AssertConversion(converter, "000000001", 1UL);
 
   // Non-representable values
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "4294967296");
   AssertConversionFails(converter, "12345678901");
 
+  AssertConversionFails(converter, "1234567a");
+  AssertConversionFails(converter, "12345678 ");
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "-");
   AssertConversionFails(converter, "0.0");
@@ -224,6 +259,8 @@ TEST(StringConversion, ToInt64) {
   AssertConversion(converter, "09223372036854775807", 9223372036854775807LL);
   AssertConversion(converter, "-9223372036854775808", -9223372036854775807LL - 1);
   AssertConversion(converter, "-009223372036854775808", -9223372036854775807LL - 1);
+  AssertConversion(converter, "1234567890123", 1234567890123LL);
+  AssertConversion(converter, "-98765432109876543", -98765432109876543LL);
 
   // Non-representable values
   AssertConversionFails(converter, "9223372036854775808");
@@ -240,10 +277,19 @@ TEST(StringConversion, ToUInt64) {
 
   AssertConversion(converter, "0", 0);
   AssertConversion(converter, "18446744073709551615", 18446744073709551615ULL);
+  AssertConversion(converter, "9999999999999999999", 9999999999999999999ULL);
+  AssertConversion(converter, "12345678", 12345678ULL);
+  AssertConversion(converter, "1234567887654321", 1234567887654321ULL);
+  AssertConversion(converter, "00000000000000000000001", 1ULL);
 
   // Non-representable values
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "18446744073709551616");
+  AssertConversionFails(converter, "20000000000000000000");
+
+  AssertConversionFails(converter, "1234567/");
+  AssertConversionFails(converter, "12345678:0123");
+  AssertConversionFails(converter, "123456789012345678+");
 
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "-");
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <cstring>
 #include <random>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -32,8 +33,17 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bpacking.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/rle_encoding.h"
 
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/bpacking_avx2.h"
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+#include "arrow/util/bpacking_avx512.h"
+#endif
+
 namespace arrow {
 namespace util {
 
@@ -137,6 +147,42 @@ TEST(BitArray, TestValues) {
   }
 }
 
+// Writes 'num_vals' random values of width 'bit_width' after a 1-bit value and
+// reads them back as 64-bit integers with GetBatch.
+void TestBitArrayGetBatch64(int bit_width, int num_vals) {
+  int len = static_cast<int>(BitUtil::BytesForBits(1 + bit_width * num_vals));
+  const uint64_t mask = bit_width == 64 ? ~uint64_t(0) : (uint64_t(1) << bit_width) - 1;
+
+  std::default_random_engine gen(bit_width);
+  std::uniform_int_distribution<uint64_t> dist;
+  std::vector<uint64_t> values(num_vals);
+  std::vector<uint8_t> buffer(len);
+  BitUtil::BitWriter writer(buffer.data(), len);
+  EXPECT_TRUE(writer.PutValue(1, 1));
+  for (auto& value : values) {
+    value = dist(gen) & mask;
+    EXPECT_TRUE(writer.PutValue(value, bit_width));
+  }
+  writer.Flush();
+
+  BitUtil::BitReader reader(buffer.data(), len);
+  int64_t first = 0;
+  EXPECT_TRUE(reader.GetValue(1, &first));
+  std::vector<int64_t> read_values(num_vals);
+  EXPECT_EQ(num_vals, reader.GetBatch(bit_width, read_values.data(), num_vals));
+  for (int i = 0; i < num_vals; ++i) {
+    ASSERT_EQ(values[i], static_cast<uint64_t>(read_values[i])) << "at index " << i;
+  }
+}
+
+TEST(BitArray, TestGetBatch64) {
+  for (int width = 1; width <= 64; ++width) {
+    TestBitArrayGetBatch64(width, 1);
+    TestBitArrayGetBatch64(width, 100);
+    TestBitArrayGetBatch64(width, 1000);
+  }
+}
+
 // Test some mixed values
 TEST(BitArray, TestMixed) {
   const int len = 1024;
@@ -533,5 +579,84 @@ TEST(RleDecoder, GetBatchSpaced) {
   }
 }
 
+// Check an unpack32 or unpack64 implementation against bit-by-bit unpacking of
+// random input
+template <typename InType, typename OutType>
+void CheckUnpack(int (*unpack)(const InType*, OutType*, int, int)) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<uint32_t> dist;
+
+  const int max_num_bits = static_cast<int>(sizeof(OutType) * 8);
+  for (int num_bits = 0; num_bits <= max_num_bits; ++num_bits) {
+    for (int num_values : {0, 31, 32, 100, 1024, 2080}) {
+      SCOPED_TRACE("num_bits = " + std::to_string(num_bits) +
+                   ", num_values = " + std::to_string(num_values));
+      // Size the input exactly, so that reads past its end are caught by ASan
+      const int num_elements = static_cast<int>(BitUtil::CeilDiv(
+          static_cast<int64_t>(num_values) * num_bits, sizeof(InType) * 8));
+      std::vector<InType> packed(num_elements);
+      for (auto& element : packed) {
+        element = static_cast<InType>(dist(gen));
+      }
+      const auto packed_bytes = reinterpret_cast<const uint8_t*>(packed.data());
+
+      std::vector<OutType> unpacked(num_values, static_cast<OutType>(0xdeadbeef));
+      const int num_unpacked =
+          unpack(packed.data(), unpacked.data(), num_values, num_bits);
+      ASSERT_EQ(num_values / 32 * 32, num_unpacked);
+
+      for (int i = 0; i < num_unpacked; ++i) {
+        OutType expected = 0;
+        for (int k = 0; k < num_bits; ++k) {
+          if (BitUtil::GetBit(packed_bytes, static_cast<int64_t>(i) * num_bits + k)) {
+            expected |= OutType(1) << k;
+          }
+        }
+        ASSERT_EQ(expected, unpacked[i]) << "at index " << i;
+      }
+    }
+  }
+}
+
+TEST(BitPacking, Unpack32) { CheckUnpack(internal::unpack32); }
+
+TEST(BitPacking, Unpack32Default) { CheckUnpack(internal::unpack32_default); }
+
+TEST(BitPacking, Unpack64) { CheckUnpack(internal::unpack64); }
+
+TEST(BitPacking, Unpack64Default) { CheckUnpack(internal::unpack64_default); }
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+TEST(BitPacking, Unpack32Avx2) {
+  if (!internal::IsDispatchLevelSupported(internal::DispatchLevel::AVX2)) {
+    return;
+  }
+  CheckUnpack(internal::unpack32_avx2);
+}
+
+TEST(BitPacking, Unpack64Avx2) {
+  if (!internal::IsDispatchLevelSupported(internal::DispatchLevel::AVX2)) {
+    return;
+  }
+  CheckUnpack(internal::unpack64_avx2);
+}
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+TEST(BitPacking, Unpack32Avx512) {
+  if (!internal::IsDispatchLevelSupported(internal::DispatchLevel::AVX512)) {
+    return;
+  }
+  CheckUnpack(internal::unpack32_avx512);
+}
+
+TEST(BitPacking, Unpack64Avx512) {
+  if (!internal::IsDispatchLevelSupported(internal::DispatchLevel::AVX512)) {
+    return;
+  }
+  CheckUnpack(internal::unpack64_avx512);
+}
+#endif
+
 }  // namespace util
 }  // namespace arrow
@@ -18,6 +18,7 @@
 #include "arrow/util/task_group.h"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <mutex>
@@ -113,7 +114,24 @@ class ThreadedTaskGroup : public TaskGroup {
   Status Finish() override {
     std::unique_lock<std::mutex> lock(mutex_);
     if (!finished_) {
-      cv_.wait(lock, [&]() { return nremaining_.load() == 0; });
+      if (thread_pool_->OwnsThisThread()) {
+        // Blocking a worker of the pool may starve the pool when tasks wait
+        // for nested task groups, so run pending tasks while waiting
+        while (nremaining_.load() != 0) {
+          lock.unlock();
+          const bool ran_task = thread_pool_->RunPendingTask();
+          lock.lock();
+          if (!ran_task) {
+            // Wake up periodically to run the tasks spawned meanwhile
+            cv_.wait_for(lock, std::chrono::milliseconds(1),
+                         [&]() { return nremaining_.load() == 0; });
+          }
+        }
+      } else {
+        cv_.wait(lock, [&]() { return nremaining_.load() == 0; });
+      }
+    }
+    if (!finished_) {
       // Current tasks may start other tasks, so only set this when done
       finished_ = true;
       if (parent_) {
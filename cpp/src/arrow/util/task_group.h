@@ -53,6 +53,9 @@ class ARROW_EXPORT TaskGroup : public std::enable_shared_from_this<TaskGroup> {
   /// or for at least one task (or subgroup) to error out.
   /// The returned Status propagates the error status of the first failing
   /// task (or subgroup).
+  /// When called from a worker of the group's thread pool, pending tasks of
+  /// the pool are run while waiting, so that nested task groups don't block
+  /// all workers.
   virtual Status Finish() = 0;
 
   /// The current agregate error Status.  Non-blocking, useful for stopping early.
@@ -328,6 +328,32 @@ TEST(ThreadedTaskGroup, SubGroupsErrors) {
   TestTaskSubGroupsErrors(TaskGroup::MakeThreaded(thread_pool.get()));
 }
 
+TEST(ThreadedTaskGroup, NestedTaskGroups) {
+  // Fewer workers than outer tasks: waiting on the inner task groups mustn't
+  // block the workers which the inner tasks need
+  std::shared_ptr<ThreadPool> thread_pool;
+  ASSERT_OK(ThreadPool::Make(2, &thread_pool));
+
+  const int N = 8;
+  std::atomic<int> count(0);
+  auto outer_group = TaskGroup::MakeThreaded(thread_pool.get());
+  for (int i = 0; i < N; ++i) {
+    outer_group->Append([&]() {
+      auto inner_group = TaskGroup::MakeThreaded(thread_pool.get());
+      for (int j = 0; j < N; ++j) {
+        inner_group->Append([&]() {
+          sleep_for(1e-4);
+          count++;
+          return Status::OK();
+        });
+      }
+      return inner_group->Finish();
+    });
+  }
+  ASSERT_OK(outer_group->Finish());
+  ASSERT_EQ(count.load(), N * N);
+}
+
 TEST(ThreadedTaskGroup, StressTaskGroupLifetime) {
   std::shared_ptr<ThreadPool> thread_pool;
   ASSERT_OK(ThreadPool::Make(16, &thread_pool));
@@ -18,8 +18,10 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
+#include <iterator>
 #include <list>
 #include <mutex>
 #include <string>
@@ -32,11 +34,57 @@
 namespace arrow {
 namespace internal {
 
-struct ThreadPool::State {
-  State() : desired_capacity_(0), please_shutdown_(false), quick_shutdown_(false) {}
+namespace {
+
+using Task = std::function<void()>;
+
+constexpr int kNumPriorities = static_cast<int>(TaskPriority::HIGH) + 1;
+
+// The queue of tasks of a worker.  The worker pushes and pops tasks at the
+// back, other workers steal tasks from the front.  The mutex is only
+// contended when stealing.
+struct WorkerQueue {
+  bool PopBack(Task* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (tasks_.empty()) {
+      return false;
+    }
+    *out = std::move(tasks_.back());
+    tasks_.pop_back();
+    return true;
+  }
+
+  bool PopFront(Task* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (tasks_.empty()) {
+      return false;
+    }
+    *out = std::move(tasks_.front());
+    tasks_.pop_front();
+    return true;
+  }
+
+  void PushBack(Task task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+
+  std::mutex mutex_;
+  std::deque<Task> tasks_;
+};
 
-  // NOTE: in case locking becomes too expensive, we can investigate lock-free FIFOs
-  // such as https://github.com/cameron314/concurrentqueue
+}  // namespace
+
+struct ThreadPool::State {
+  State()
+      : num_pending_(0),
+        num_high_priority_pending_(0),
+        num_sleeping_(0),
+        steal_index_(0),
+        desired_capacity_(0),
+        num_workers_(0),
+        please_shutdown_(false),
+        quick_shutdown_(false) {}
 
   std::mutex mutex_;
   std::condition_variable cv_;
@@ -45,28 +93,116 @@ struct ThreadPool::State {
   std::list<std::thread> workers_;
   // Trashcan for finished threads
   std::vector<std::thread> finished_workers_;
-  std::deque<std::function<void()>> pending_tasks_;
+  // Tasks spawned from outside the workers or with a high priority, indexed
+  // by priority
+  std::deque<Task> pending_tasks_[kNumPriorities];
+  // The queues of the running workers
+  std::vector<std::shared_ptr<WorkerQueue>> worker_queues_;
+
+  // The number of tasks in all queues, and of idle workers waiting for
+  // tasks.  These are usable unlocked, so that workers can spawn tasks
+  // to their queue without taking the lock.
+  std::atomic<int64_t> num_pending_;
+  std::atomic<int64_t> num_high_priority_pending_;
+  std::atomic<int> num_sleeping_;
+  // The worker queue to steal from first
+  size_t steal_index_;
 
   // Desired number of threads
-  int desired_capacity_;
+  std::atomic<int> desired_capacity_;
+  // Actual number of threads, i.e. workers_.size()
+  std::atomic<int> num_workers_;
   // Are we shutting down?
-  bool please_shutdown_;
-  bool quick_shutdown_;
+  std::atomic<bool> please_shutdown_;
+  std::atomic<bool> quick_shutdown_;
 };
 
+namespace {
+
+// The pool and queue of the worker running on this thread, if any
+struct CurrentWorker {
+  ThreadPool::State* state;
+  WorkerQueue* queue;
+};
+
+thread_local CurrentWorker current_worker = {nullptr, nullptr};
+
+bool TakeSharedTaskUnlocked(ThreadPool::State* state, TaskPriority priority,
+                            Task* out) {
+  auto& tasks = state->pending_tasks_[static_cast<int>(priority)];
+  if (tasks.empty()) {
+    return false;
+  }
+  *out = std::move(tasks.front());
+  tasks.pop_front();
+  if (priority == TaskPriority::HIGH) {
+    --state->num_high_priority_pending_;
+  }
+  --state->num_pending_;
+  return true;
+}
+
+// Take a task, in order of preference: a high priority task, the last task
+// of the queue of the calling worker (if own isn't null), a task spawned
+// from outside the workers, or the first task of another worker's queue.
+// The lock must be held.
+bool TakeTaskUnlocked(ThreadPool::State* state, WorkerQueue* own, Task* out) {
+  if (TakeSharedTaskUnlocked(state, TaskPriority::HIGH, out)) {
+    return true;
+  }
+  if (own != nullptr && own->PopBack(out)) {
+    --state->num_pending_;
+    return true;
+  }
+  if (TakeSharedTaskUnlocked(state, TaskPriority::NORMAL, out)) {
+    return true;
+  }
+  const size_t num_queues = state->worker_queues_.size();
+  for (size_t i = 0; i < num_queues; ++i) {
+    WorkerQueue* victim =
+        state->worker_queues_[(state->steal_index_ + i) % num_queues].get();
+    if (victim != own && victim->PopFront(out)) {
+      // Spread thieves over the queues
+      state->steal_index_ += i + 1;
+      --state->num_pending_;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Take the next task to run on the calling thread, own being the queue of
+// the calling worker or null
+bool TakeTask(ThreadPool::State* state, WorkerQueue* own, Task* out) {
+  // The hot path only takes the lock of the worker queue
+  if (own != nullptr && state->num_high_priority_pending_.load() == 0 &&
+      own->PopBack(out)) {
+    --state->num_pending_;
+    return true;
+  }
+  std::lock_guard<std::mutex> lock(state->mutex_);
+  return TakeTaskUnlocked(state, own, out);
+}
+
+}  // namespace
+
 // The worker loop is an independent function so that it can keep running
 // after the ThreadPool is destroyed.
 static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
                        std::list<std::thread>::iterator it) {
+  auto queue = std::make_shared<WorkerQueue>();
+  current_worker = {state.get(), queue.get()};
+
   std::unique_lock<std::mutex> lock(state->mutex_);
 
   // Since we hold the lock, `it` now points to the correct thread object
   // (LaunchWorkersUnlocked has exited)
   DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+  state->worker_queues_.push_back(queue);
 
   // If too many threads, we should secede from the pool
   const auto should_secede = [&]() -> bool {
-    return state->workers_.size() > static_cast<size_t>(state->desired_capacity_);
+    return state->num_workers_.load() > state->desired_capacity_.load();
   };
 
   while (true) {
@@ -74,28 +210,58 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
     // or shutdown could even have been requested.  So we only wait on the
     // condition variable at the end of the loop.
 
-    // Execute pending tasks if any
-    while (!state->pending_tasks_.empty() && !state->quick_shutdown_) {
-      // We check this opportunistically at each loop iteration since
-      // it releases the lock below.
+    // Execute pending tasks if any, without holding the lock
+    lock.unlock();
+    while (!state->quick_shutdown_.load()) {
+      // We check this opportunistically at each loop iteration
       if (should_secede()) {
         break;
       }
-      {
-        std::function<void()> task = std::move(state->pending_tasks_.front());
-        state->pending_tasks_.pop_front();
-        lock.unlock();
-        task();
+      Task task;
+      if (!TakeTask(state.get(), queue.get(), &task)) {
+        break;
       }
-      lock.lock();
+      task();
     }
-    // Now either the queue is empty *or* a quick shutdown was requested
-    if (state->please_shutdown_ || should_secede()) {
+    lock.lock();
+
+    // Now either the queues are empty *or* a quick shutdown was requested
+    if (state->quick_shutdown_ || should_secede()) {
       break;
     }
-    // Wait for next wakeup
-    state->cv_.wait(lock);
+    if (state->num_pending_.load() > 0) {
+      // Tasks were spawned meanwhile
+      continue;
+    }
+    if (state->please_shutdown_) {
+      break;
+    }
+    // Wait for next wakeup.  Workers spawning a task to their own queue
+    // only notify if a worker is sleeping, so check for pending tasks again
+    // once registered as sleeping.
+    ++state->num_sleeping_;
+    if (state->num_pending_.load() == 0) {
+      state->cv_.wait(lock);
+    }
+    --state->num_sleeping_;
+  }
+
+  // Hand over the tasks of our queue to the other workers, unless shutting
+  // down quickly
+  state->worker_queues_.erase(
+      std::find(state->worker_queues_.begin(), state->worker_queues_.end(), queue));
+  {
+    std::lock_guard<std::mutex> queue_lock(queue->mutex_);
+    if (state->quick_shutdown_) {
+      state->num_pending_ -= static_cast<int64_t>(queue->tasks_.size());
+    } else if (!queue->tasks_.empty()) {
+      auto& tasks = state->pending_tasks_[static_cast<int>(TaskPriority::NORMAL)];
+      std::move(queue->tasks_.begin(), queue->tasks_.end(), std::back_inserter(tasks));
+      state->cv_.notify_all();
+    }
+    queue->tasks_.clear();
   }
+  current_worker = {nullptr, nullptr};
 
   // We're done.  Move our thread object to the trashcan of finished
   // workers.  This has two motivations:
@@ -107,6 +273,7 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
   DCHECK_EQ(std::this_thread::get_id(), it->get_id());
   state->finished_workers_.push_back(std::move(*it));
   state->workers_.erase(it);
+  --state->num_workers_;
   if (state->please_shutdown_) {
     // Notify the function waiting in Shutdown().
     state->cv_shutdown_.notify_one();
@@ -139,8 +306,8 @@ void ThreadPool::ProtectAgainstFork() {
     int capacity = state_->desired_capacity_;
 
     auto new_state = std::make_shared<ThreadPool::State>();
-    new_state->please_shutdown_ = state_->please_shutdown_;
-    new_state->quick_shutdown_ = state_->quick_shutdown_;
+    new_state->please_shutdown_ = state_->please_shutdown_.load();
+    new_state->quick_shutdown_ = state_->quick_shutdown_.load();
 
     pid_ = current_pid;
     sp_state_ = new_state;
@@ -200,9 +367,13 @@ Status ThreadPool::Shutdown(bool wait) {
   state_->cv_.notify_all();
   state_->cv_shutdown_.wait(lock, [this] { return state_->workers_.empty(); });
   if (!state_->quick_shutdown_) {
-    DCHECK_EQ(state_->pending_tasks_.size(), 0);
+    DCHECK_EQ(state_->num_pending_.load(), 0);
   } else {
-    state_->pending_tasks_.clear();
+    for (auto& tasks : state_->pending_tasks_) {
+      tasks.clear();
+    }
+    state_->num_pending_ = 0;
+    state_->num_high_priority_pending_ = 0;
   }
   CollectFinishedWorkersUnlocked();
   return Status::OK();
@@ -221,25 +392,60 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
 
   for (int i = 0; i < threads; i++) {
     state_->workers_.emplace_back();
+    ++state_->num_workers_;
     auto it = --(state_->workers_.end());
     *it = std::thread([state, it] { WorkerLoop(state, it); });
   }
 }
 
-Status ThreadPool::SpawnReal(std::function<void()> task) {
+Status ThreadPool::SpawnReal(TaskPriority priority, std::function<void()> task) {
+  ProtectAgainstFork();
+  if (priority == TaskPriority::NORMAL && current_worker.state == state_) {
+    // Spawned by one of our workers: push to its queue without locking the
+    // pool, and only wake up a worker if one is sleeping
+    if (state_->please_shutdown_) {
+      return Status::Invalid("operation forbidden during or after shutdown");
+    }
+    current_worker.queue->PushBack(std::move(task));
+    ++state_->num_pending_;
+    if (state_->num_sleeping_.load() > 0) {
+      std::lock_guard<std::mutex> lock(state_->mutex_);
+      state_->cv_.notify_one();
+    }
+    return Status::OK();
+  }
   {
-    ProtectAgainstFork();
     std::lock_guard<std::mutex> lock(state_->mutex_);
     if (state_->please_shutdown_) {
       return Status::Invalid("operation forbidden during or after shutdown");
     }
     CollectFinishedWorkersUnlocked();
-    state_->pending_tasks_.push_back(std::move(task));
+    state_->pending_tasks_[static_cast<int>(priority)].push_back(std::move(task));
+    if (priority == TaskPriority::HIGH) {
+      ++state_->num_high_priority_pending_;
+    }
+    ++state_->num_pending_;
   }
   state_->cv_.notify_one();
   return Status::OK();
 }
 
+bool ThreadPool::RunPendingTask() {
+  ProtectAgainstFork();
+  WorkerQueue* own = current_worker.state == state_ ? current_worker.queue : nullptr;
+  Task task;
+  if (!TakeTask(state_, own, &task)) {
+    return false;
+  }
+  task();
+  return true;
+}
+
+bool ThreadPool::OwnsThisThread() {
+  ProtectAgainstFork();
+  return current_worker.state == state_;
+}
+
 Status ThreadPool::Make(int threads, std::shared_ptr<ThreadPool>* out) {
   auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
   RETURN_NOT_OK(pool->SetCapacity(threads));
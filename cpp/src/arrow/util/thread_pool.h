@@ -22,6 +22,7 @@
 #include <unistd.h>
 #endif
 
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <future>
@@ -72,6 +73,20 @@ struct packaged_task_wrapper {
 
 }  // namespace detail
 
+/// \brief The priority of a task spawned on a ThreadPool
+///
+/// Pending high priority tasks are started before normal priority ones, e.g.
+/// so that tasks completing IO don't wait behind CPU-bound decoding tasks.
+enum class TaskPriority : int8_t { NORMAL = 0, HIGH = 1 };
+
+/// \brief A pool of worker threads executing tasks
+///
+/// Each worker has its own queue of tasks. A task spawned from a worker
+/// thread goes into that worker's queue, and the worker runs the tasks of its
+/// queue last-in first-out, which keeps the data of nested tasks hot in its
+/// caches. Tasks spawned from other threads, and high priority tasks, go into
+/// shared first-in first-out queues. Idle workers take tasks from the shared
+/// queues, then steal the oldest tasks of the other workers' queues.
 class ARROW_EXPORT ThreadPool {
  public:
   // Construct a thread pool with the given number of worker threads
@@ -104,7 +119,13 @@ class ARROW_EXPORT ThreadPool {
   // Spawn a fire-and-forget task on one of the workers.
   template <typename Function>
   Status Spawn(Function&& func) {
-    return SpawnReal(std::forward<Function>(func));
+    return SpawnReal(TaskPriority::NORMAL, std::forward<Function>(func));
+  }
+
+  // Spawn a fire-and-forget task with the given priority.
+  template <typename Function>
+  Status Spawn(TaskPriority priority, Function&& func) {
+    return SpawnReal(priority, std::forward<Function>(func));
   }
 
   // Submit a callable and arguments for execution.  Return a future that
@@ -116,6 +137,14 @@ class ARROW_EXPORT ThreadPool {
   template <typename Function, typename... Args,
             typename Result = typename std::result_of<Function && (Args && ...)>::type>
   std::future<Result> Submit(Function&& func, Args&&... args) {
+    return Submit(TaskPriority::NORMAL, std::forward<Function>(func),
+                  std::forward<Args>(args)...);
+  }
+
+  // Submit a callable and arguments for execution with the given priority.
+  template <typename Function, typename... Args,
+            typename Result = typename std::result_of<Function && (Args && ...)>::type>
+  std::future<Result> Submit(TaskPriority priority, Function&& func, Args&&... args) {
     // Trying to templatize std::packaged_task with Function doesn't seem
     // to work, so go through std::bind to simplify the packaged signature
     using PackagedTask = std::packaged_task<Result()>;
@@ -123,13 +152,23 @@ class ARROW_EXPORT ThreadPool {
         std::bind(std::forward<Function>(func), std::forward<Args>(args)...));
     auto fut = task.get_future();
 
-    Status st = SpawnReal(detail::packaged_task_wrapper<Result>(std::move(task)));
+    Status st =
+        SpawnReal(priority, detail::packaged_task_wrapper<Result>(std::move(task)));
     if (!st.ok()) {
       st.Abort("ThreadPool::Submit() was probably called after Shutdown()");
     }
     return fut;
   }
 
+  // Run a pending task on the calling thread, if any, and return whether a
+  // task was run.  A worker waiting for the completion of other tasks can
+  // call this in a loop instead of blocking, so that nested waits don't
+  // starve the pool of workers.
+  bool RunPendingTask();
+
+  // Whether the calling thread is one of the workers of this pool.
+  bool OwnsThisThread();
+
   struct State;
 
  protected:
@@ -141,7 +180,7 @@ class ARROW_EXPORT ThreadPool {
 
   ARROW_DISALLOW_COPY_AND_ASSIGN(ThreadPool);
 
-  Status SpawnReal(std::function<void()> task);
+  Status SpawnReal(TaskPriority priority, std::function<void()> task);
   // Collect finished worker threads, making sure the OS threads have exited
   void CollectFinishedWorkersUnlocked();
   // Launch a given number of additional workers
@@ -147,6 +147,40 @@ static void ThreadedTaskGroup(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * nspawns);
 }
 
+// Benchmark threaded TaskGroups whose tasks wait on nested threaded TaskGroups,
+// e.g. the column reads of the files of a dataset scan
+static void NestedTaskGroups(benchmark::State& state) {
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto workload_size = static_cast<int32_t>(state.range(1));
+
+  std::shared_ptr<ThreadPool> pool;
+  ABORT_NOT_OK(ThreadPool::Make(nthreads, &pool));
+
+  Task task(workload_size);
+
+  // More outer tasks than workers, so that all workers wait on inner groups
+  const int32_t nouter = 256;
+  const int32_t ninner = 10000000 / workload_size / nouter + 1;
+
+  for (auto _ : state) {
+    auto task_group = TaskGroup::MakeThreaded(pool.get());
+    for (int32_t i = 0; i < nouter; ++i) {
+      task_group->Append([&]() {
+        auto inner_task_group = TaskGroup::MakeThreaded(pool.get());
+        for (int32_t j = 0; j < ninner; ++j) {
+          // Pass the task by reference to avoid copying it around
+          inner_task_group->Append(std::ref(task));
+        }
+        return inner_task_group->Finish();
+      });
+    }
+    ABORT_NOT_OK(task_group->Finish());
+  }
+  ABORT_NOT_OK(pool->Shutdown(true /* wait */));
+
+  state.SetItemsProcessed(state.iterations() * nouter * ninner);
+}
+
 static const int32_t kWorkloadSizes[] = {1000, 10000, 100000};
 
 static void WorkloadCost_Customize(benchmark::internal::Benchmark* b) {
@@ -159,7 +193,7 @@ static void WorkloadCost_Customize(benchmark::internal::Benchmark* b) {
 
 static void ThreadPoolSpawn_Customize(benchmark::internal::Benchmark* b) {
   for (const int32_t w : kWorkloadSizes) {
-    for (const int nthreads : {1, 2, 4, 8}) {
+    for (const int nthreads : {1, 2, 4, 8, 16, 32, 64}) {
       b->Args({nthreads, w});
     }
   }
@@ -190,6 +224,7 @@ BENCHMARK(ReferenceWorkloadCost)->Apply(WorkloadCost_Customize);
 BENCHMARK(SerialTaskGroup)->Apply(WorkloadCost_Customize);
 BENCHMARK(ThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
 BENCHMARK(ThreadedTaskGroup)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK(NestedTaskGroups)->Apply(ThreadPoolSpawn_Customize);
 
 }  // namespace internal
 }  // namespace arrow
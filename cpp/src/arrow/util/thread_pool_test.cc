@@ -21,6 +21,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstdio>
@@ -28,6 +29,8 @@
 #include <functional>
 #include <future>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
 #include <thread>
 #include <vector>
@@ -38,6 +41,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/thread_pool.h"
 
 namespace arrow {
@@ -296,6 +300,102 @@ TEST_F(TestThreadPool, Submit) {
   }
 }
 
+// Test task priorities and the scheduling of tasks spawned by workers
+
+TEST_F(TestThreadPool, Priorities) {
+  auto pool = this->MakeThreadPool(1);
+  std::mutex mutex;
+  std::vector<int> order;
+  auto record = [&](int i) {
+    std::lock_guard<std::mutex> lock(mutex);
+    order.push_back(i);
+  };
+
+  // Keep the single worker busy until all tasks are spawned
+  std::atomic<bool> release(false);
+  ASSERT_OK(pool->Spawn([&] { busy_wait(10, [&] { return release.load(); }); }));
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_OK(pool->Spawn(std::bind(record, i)));
+  }
+  for (int i = 5; i < 10; ++i) {
+    ASSERT_OK(pool->Spawn(TaskPriority::HIGH, std::bind(record, i)));
+  }
+  auto fut = pool->Submit(TaskPriority::HIGH, add<int>, 4, 5);
+  release.store(true);
+  ASSERT_EQ(fut.get(), 9);
+  ASSERT_OK(pool->Shutdown());
+
+  // High priority tasks ran first, in spawning order
+  ASSERT_EQ(order, std::vector<int>({5, 6, 7, 8, 9, 0, 1, 2, 3, 4}));
+}
+
+TEST_F(TestThreadPool, WorkerTasksLastInFirstOut) {
+  auto pool = this->MakeThreadPool(1);
+  std::vector<int> order;
+  auto fut = pool->Submit([&] {
+    for (int i = 0; i < 5; ++i) {
+      ASSERT_OK(pool->Spawn([&order, i] { order.push_back(i); }));
+    }
+  });
+  fut.get();
+  ASSERT_OK(pool->Shutdown());
+
+  // Tasks spawned by the worker ran from its own queue, newest first
+  ASSERT_EQ(order, std::vector<int>({4, 3, 2, 1, 0}));
+}
+
+TEST_F(TestThreadPool, WorkStealing) {
+  auto pool = this->MakeThreadPool(4);
+  const int ntasks = 1000;
+  std::atomic<int> count(0);
+  std::mutex mutex;
+  std::set<std::thread::id> thread_ids;
+
+  // The spawning worker blocks until all tasks have run, so other workers
+  // have to steal them from its queue
+  std::thread::id spawning_thread_id;
+  auto fut = pool->Submit([&] {
+    spawning_thread_id = std::this_thread::get_id();
+    for (int i = 0; i < ntasks; ++i) {
+      ASSERT_OK(pool->Spawn([&] {
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          thread_ids.insert(std::this_thread::get_id());
+        }
+        ++count;
+      }));
+    }
+    busy_wait(10, [&] { return count.load() == ntasks; });
+  });
+  fut.get();
+  ASSERT_EQ(count.load(), ntasks);
+  ASSERT_GE(thread_ids.size(), 1);
+  ASSERT_EQ(thread_ids.count(spawning_thread_id), 0);
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST_F(TestThreadPool, RunPendingTask) {
+  auto pool = this->MakeThreadPool(1);
+  ASSERT_FALSE(pool->OwnsThisThread());
+  auto fut = pool->Submit([&] { return pool->OwnsThisThread(); });
+  ASSERT_TRUE(fut.get());
+
+  // Keep the single worker busy, and run the pending task on this thread
+  std::atomic<bool> started(false), release(false);
+  ASSERT_OK(pool->Spawn([&] {
+    started.store(true);
+    busy_wait(10, [&] { return release.load(); });
+  }));
+  busy_wait(10, [&] { return started.load(); });
+  std::thread::id task_thread_id;
+  ASSERT_OK(pool->Spawn([&] { task_thread_id = std::this_thread::get_id(); }));
+  ASSERT_TRUE(pool->RunPendingTask());
+  ASSERT_EQ(task_thread_id, std::this_thread::get_id());
+  ASSERT_FALSE(pool->RunPendingTask());
+  release.store(true);
+  ASSERT_OK(pool->Shutdown());
+}
+
 // Test fork safety on Unix
 
 #if !(defined(_WIN32) || defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER) || \
@@ -356,6 +456,29 @@ TEST_F(TestThreadPool, ForkSafety) {
 }
 #endif
 
+TEST(TestGlobalThreadPool, NestedParallelFor) {
+  // With a single worker, the outer task must run the nested tasks itself
+  // rather than wait for them
+  const int capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetCpuThreadPoolCapacity(1));
+
+  std::atomic<int> count(0);
+  auto outer = [&]() {
+    return ParallelFor(4, [&](int) {
+      return ParallelFor(4, [&](int) {
+        ++count;
+        return Status::OK();
+      });
+    });
+  };
+  auto fut = GetCpuThreadPool()->Submit(outer);
+  ASSERT_EQ(std::future_status::ready, fut.wait_for(std::chrono::seconds(30)));
+  ASSERT_OK(fut.get());
+  ASSERT_EQ(count.load(), 16);
+
+  ASSERT_OK(SetCpuThreadPoolCapacity(capacity));
+}
+
 TEST(TestGlobalThreadPool, Capacity) {
   // Sanity check
   auto pool = GetCpuThreadPool();
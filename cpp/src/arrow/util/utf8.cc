@@ -16,15 +16,24 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <mutex>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/sse_util.h"
 #include "arrow/util/utf8.h"
+#include "arrow/util/utf8_internal.h"
 #include "arrow/vendored/utf8cpp/checked.h"
 
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/utf8_avx2.h"
+#endif
+
 namespace arrow {
 namespace util {
 namespace internal {
@@ -74,6 +83,164 @@ ARROW_EXPORT void CheckUTF8Initialized() {
       << "InitializeUTF8() must be called before calling UTF8 routines";
 }
 
+using ::arrow::internal::DispatchLevel;
+using ::arrow::internal::DynamicDispatch;
+
+namespace {
+
+#if defined(ARROW_HAVE_SSE4_2)
+
+// SSE implementation of the lookup algorithm (see utf8_internal.h)
+class UTF8ValidatorSse {
+ public:
+  UTF8ValidatorSse()
+      : byte_1_high_(LoadTable(utf8_lookup::kByte1High)),
+        byte_1_low_(LoadTable(utf8_lookup::kByte1Low)),
+        byte_2_high_(LoadTable(utf8_lookup::kByte2High)),
+        error_(_mm_setzero_si128()),
+        prev_input_(_mm_setzero_si128()),
+        prev_incomplete_(_mm_setzero_si128()) {}
+
+  void CheckBlock(const uint8_t* data) {
+    const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16));
+    const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32));
+    const __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48));
+    const __m128i any = _mm_or_si128(_mm_or_si128(v0, v1), _mm_or_si128(v2, v3));
+    if (ARROW_PREDICT_TRUE(_mm_movemask_epi8(any) == 0)) {
+      // All ASCII: only a character left incomplete by the previous block
+      // is an error
+      error_ = _mm_or_si128(error_, prev_incomplete_);
+      prev_input_ = v3;
+      prev_incomplete_ = _mm_setzero_si128();
+      return;
+    }
+    CheckVector(v0);
+    CheckVector(v1);
+    CheckVector(v2);
+    CheckVector(v3);
+    prev_incomplete_ = IsIncomplete(v3);
+  }
+
+  bool Finish() {
+    error_ = _mm_or_si128(error_, prev_incomplete_);
+    return _mm_testz_si128(error_, error_) != 0;
+  }
+
+ protected:
+  static __m128i LoadTable(const uint8_t* table) {
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(table));
+  }
+
+  static __m128i HighNibbles(__m128i v) {
+    return _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F));
+  }
+
+  void CheckVector(__m128i input) {
+    using namespace utf8_lookup;  // NOLINT
+    const __m128i prev1 = _mm_alignr_epi8(input, prev_input_, 16 - 1);
+    const __m128i byte_1_high = _mm_shuffle_epi8(byte_1_high_, HighNibbles(prev1));
+    const __m128i byte_1_low =
+        _mm_shuffle_epi8(byte_1_low_, _mm_and_si128(prev1, _mm_set1_epi8(0x0F)));
+    const __m128i byte_2_high = _mm_shuffle_epi8(byte_2_high_, HighNibbles(input));
+    const __m128i special_cases =
+        _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+    const __m128i prev2 = _mm_alignr_epi8(input, prev_input_, 16 - 2);
+    const __m128i prev3 = _mm_alignr_epi8(input, prev_input_, 16 - 3);
+    const __m128i is_third_byte =
+        _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(kThirdByteLeadMin)));
+    const __m128i is_fourth_byte =
+        _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(kFourthByteLeadMin)));
+    const __m128i must_be_continuation = _mm_and_si128(
+        _mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8(-128));
+
+    error_ = _mm_or_si128(error_, _mm_xor_si128(must_be_continuation, special_cases));
+    prev_input_ = input;
+  }
+
+  static __m128i IsIncomplete(__m128i input) {
+    using namespace utf8_lookup;  // NOLINT
+    const __m128i max_value = _mm_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        static_cast<char>(kMaxThirdLastByte), static_cast<char>(kMaxSecondLastByte),
+        static_cast<char>(kMaxLastByte));
+    return _mm_subs_epu8(input, max_value);
+  }
+
+  const __m128i byte_1_high_;
+  const __m128i byte_1_low_;
+  const __m128i byte_2_high_;
+  __m128i error_;
+  __m128i prev_input_;
+  __m128i prev_incomplete_;
+};
+
+#endif  // ARROW_HAVE_SSE4_2
+
+struct ValidateLargeUTF8DynamicFunction {
+  using FunctionType = decltype(&ValidateLargeUTF8Default);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, ValidateLargeUTF8Default}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+            ,
+            {DispatchLevel::AVX2, ValidateLargeUTF8Avx2}
+#endif
+    };
+  }
+};
+
+// Whether `c` can start a UTF8 character, assuming valid UTF8 data
+inline bool IsUTF8CharStart(uint8_t c) { return (c & 0xC0) != 0x80; }
+
+template <typename OffsetType>
+bool ValidateUTF8ValuesImpl(const uint8_t* data, const OffsetType* offsets,
+                            int64_t length) {
+  if (length == 0) {
+    return true;
+  }
+  const OffsetType start = offsets[0];
+  const OffsetType end = offsets[length];
+  // Validate all the values at once.  Since the result is a sequence of whole
+  // characters, each value is valid if it starts at a character boundary.
+  if (!ValidateUTF8(data + start, end - start)) {
+    return false;
+  }
+  bool valid = true;
+  for (int64_t i = 1; i < length; ++i) {
+    const OffsetType offset = offsets[i];
+    valid &= offset == end || IsUTF8CharStart(data[offset]);
+  }
+  return valid;
+}
+
+}  // namespace
+
+bool ValidateLargeUTF8Default(const uint8_t* data, int64_t size) {
+#if defined(ARROW_HAVE_SSE4_2)
+  UTF8ValidatorSse validator;
+  while (size >= utf8_lookup::kBlockSize) {
+    validator.CheckBlock(data);
+    data += utf8_lookup::kBlockSize;
+    size -= utf8_lookup::kBlockSize;
+  }
+  if (size > 0) {
+    uint8_t padded[utf8_lookup::kBlockSize] = {};
+    std::memcpy(padded, data, static_cast<size_t>(size));
+    validator.CheckBlock(padded);
+  }
+  return validator.Finish();
+#else
+  return ValidateUTF8Inline(data, size);
+#endif
+}
+
+bool ValidateLargeUTF8(const uint8_t* data, int64_t size) {
+  static DynamicDispatch<ValidateLargeUTF8DynamicFunction> dispatch;
+  return dispatch.func(data, size);
+}
+
 }  // namespace internal
 
 static std::once_flag utf8_initialized;
@@ -82,6 +249,14 @@ void InitializeUTF8() {
   std::call_once(utf8_initialized, internal::InitializeLargeTable);
 }
 
+bool ValidateUTF8Values(const uint8_t* data, const int32_t* offsets, int64_t length) {
+  return internal::ValidateUTF8ValuesImpl(data, offsets, length);
+}
+
+bool ValidateUTF8Values(const uint8_t* data, const int64_t* offsets, int64_t length) {
+  return internal::ValidateUTF8ValuesImpl(data, offsets, length);
+}
+
 static const uint8_t kBOM[] = {0xEF, 0xBB, 0xBF};
 
 Status SkipUTF8BOM(const uint8_t* data, int64_t size, const uint8_t** out) {
@@ -80,18 +80,23 @@ static inline uint16_t ValidateOneUTF8Byte(uint8_t byte, uint16_t state) {
 
 ARROW_EXPORT void CheckUTF8Initialized();
 
-}  // namespace internal
+// UTF8 validation of data longer than kUTF8LargeSize, with the vector
+// instructions selected at runtime for the CPU.
+ARROW_EXPORT bool ValidateLargeUTF8(const uint8_t* data, int64_t size);
 
-// This function needs to be called before doing UTF8 validation.
-ARROW_EXPORT void InitializeUTF8();
+ARROW_EXPORT bool ValidateLargeUTF8Default(const uint8_t* data, int64_t size);
 
-inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
+// Shorter data is validated inline, as calling a vectorized implementation
+// doesn't pay off.
+static constexpr int64_t kUTF8LargeSize = 64;
+
+inline bool ValidateUTF8Inline(const uint8_t* data, int64_t size) {
   static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
   // For some reason, defining this variable outside the loop helps clang
   uint64_t mask;
 
 #ifndef NDEBUG
-  internal::CheckUTF8Initialized();
+  CheckUTF8Initialized();
 #endif
 
   while (size >= 8) {
@@ -112,45 +117,45 @@ inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
     // (once in reject state, we always remain in reject state).
     // It is guaranteed that size >= 8 when arriving here, which allows
     // us to avoid size checks.
-    uint16_t state = internal::kUTF8ValidateAccept;
+    uint16_t state = kUTF8ValidateAccept;
     // Byte 0
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
     --size;
     // Byte 1
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
     --size;
     // Byte 2
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
     --size;
     // Byte 3
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
     --size;
     // Byte 4
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
     --size;
-    if (state == internal::kUTF8ValidateAccept) {
+    if (state == kUTF8ValidateAccept) {
       continue;  // Got full char, switch back to ASCII detection
     }
     // Byte 5
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
     --size;
-    if (state == internal::kUTF8ValidateAccept) {
+    if (state == kUTF8ValidateAccept) {
       continue;  // Got full char, switch back to ASCII detection
     }
     // Byte 6
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
     --size;
-    if (state == internal::kUTF8ValidateAccept) {
+    if (state == kUTF8ValidateAccept) {
       continue;  // Got full char, switch back to ASCII detection
     }
     // Byte 7
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
     --size;
-    if (state == internal::kUTF8ValidateAccept) {
+    if (state == kUTF8ValidateAccept) {
       continue;  // Got full char, switch back to ASCII detection
     }
     // kUTF8ValidateAccept not reached along 4 transitions has to mean a rejection
-    assert(state == internal::kUTF8ValidateReject);
+    assert(state == kUTF8ValidateReject);
     return false;
   }
 
@@ -158,11 +163,23 @@ inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
   // Note the state table is designed so that, once in the reject state,
   // we remain in that state until the end.  So we needn't check for
   // rejection at each char (we don't gain much by short-circuiting here).
-  uint16_t state = internal::kUTF8ValidateAccept;
+  uint16_t state = kUTF8ValidateAccept;
   while (size-- > 0) {
-    state = internal::ValidateOneUTF8Byte(*data++, state);
+    state = ValidateOneUTF8Byte(*data++, state);
   }
-  return ARROW_PREDICT_TRUE(state == internal::kUTF8ValidateAccept);
+  return ARROW_PREDICT_TRUE(state == kUTF8ValidateAccept);
+}
+
+}  // namespace internal
+
+// This function needs to be called before doing UTF8 validation.
+ARROW_EXPORT void InitializeUTF8();
+
+inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
+  if (size > internal::kUTF8LargeSize) {
+    return internal::ValidateLargeUTF8(data, size);
+  }
+  return internal::ValidateUTF8Inline(data, size);
 }
 
 inline bool ValidateUTF8(const util::string_view& str) {
@@ -172,6 +189,13 @@ inline bool ValidateUTF8(const util::string_view& str) {
   return ValidateUTF8(data, length);
 }
 
+// Validate the values of a string array, given its `length + 1` value offsets
+// into `data`.  The offsets must be valid, and null values must be empty.
+ARROW_EXPORT bool ValidateUTF8Values(const uint8_t* data, const int32_t* offsets,
+                                     int64_t length);
+ARROW_EXPORT bool ValidateUTF8Values(const uint8_t* data, const int64_t* offsets,
+                                     int64_t length);
+
 // Skip UTF8 byte order mark, if any.
 ARROW_EXPORT
 Status SkipUTF8BOM(const uint8_t* data, int64_t size, const uint8_t** out);
@@ -0,0 +1,143 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/utf8_avx2.h"
+
+#include <immintrin.h>
+
+#include <cstring>
+
+#include "arrow/util/macros.h"
+#include "arrow/util/utf8_internal.h"
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+namespace {
+
+// AVX2 implementation of the lookup algorithm (see utf8_internal.h)
+class UTF8ValidatorAvx2 {
+ public:
+  UTF8ValidatorAvx2()
+      : byte_1_high_(LoadTable(utf8_lookup::kByte1High)),
+        byte_1_low_(LoadTable(utf8_lookup::kByte1Low)),
+        byte_2_high_(LoadTable(utf8_lookup::kByte2High)),
+        error_(_mm256_setzero_si256()),
+        prev_input_(_mm256_setzero_si256()),
+        prev_incomplete_(_mm256_setzero_si256()) {}
+
+  void CheckBlock(const uint8_t* data) {
+    const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32));
+    if (ARROW_PREDICT_TRUE(_mm256_movemask_epi8(_mm256_or_si256(v0, v1)) == 0)) {
+      // All ASCII: only a character left incomplete by the previous block
+      // is an error
+      error_ = _mm256_or_si256(error_, prev_incomplete_);
+      prev_input_ = v1;
+      prev_incomplete_ = _mm256_setzero_si256();
+      return;
+    }
+    CheckVector(v0);
+    CheckVector(v1);
+    prev_incomplete_ = IsIncomplete(v1);
+  }
+
+  bool Finish() {
+    error_ = _mm256_or_si256(error_, prev_incomplete_);
+    return _mm256_testz_si256(error_, error_) != 0;
+  }
+
+ protected:
+  static __m256i LoadTable(const uint8_t* table) {
+    return _mm256_broadcastsi128_si256(
+        _mm_load_si128(reinterpret_cast<const __m128i*>(table)));
+  }
+
+  static __m256i HighNibbles(__m256i v) {
+    return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F));
+  }
+
+  // The input shifted by N bytes, with the last bytes of the previous input
+  // shifted in
+  template <int N>
+  static __m256i Prev(__m256i input, __m256i prev_input) {
+    return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev_input, input, 0x21),
+                              16 - N);
+  }
+
+  void CheckVector(__m256i input) {
+    using namespace utf8_lookup;  // NOLINT
+    const __m256i prev1 = Prev<1>(input, prev_input_);
+    const __m256i byte_1_high = _mm256_shuffle_epi8(byte_1_high_, HighNibbles(prev1));
+    const __m256i byte_1_low = _mm256_shuffle_epi8(
+        byte_1_low_, _mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)));
+    const __m256i byte_2_high = _mm256_shuffle_epi8(byte_2_high_, HighNibbles(input));
+    const __m256i special_cases =
+        _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+    const __m256i prev2 = Prev<2>(input, prev_input_);
+    const __m256i prev3 = Prev<3>(input, prev_input_);
+    const __m256i is_third_byte =
+        _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(kThirdByteLeadMin)));
+    const __m256i is_fourth_byte = _mm256_subs_epu8(
+        prev3, _mm256_set1_epi8(static_cast<char>(kFourthByteLeadMin)));
+    const __m256i must_be_continuation = _mm256_and_si256(
+        _mm256_or_si256(is_third_byte, is_fourth_byte), _mm256_set1_epi8(-128));
+
+    error_ = _mm256_or_si256(error_,
+                             _mm256_xor_si256(must_be_continuation, special_cases));
+    prev_input_ = input;
+  }
+
+  static __m256i IsIncomplete(__m256i input) {
+    using namespace utf8_lookup;  // NOLINT
+    const __m256i max_value = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, static_cast<char>(kMaxThirdLastByte),
+        static_cast<char>(kMaxSecondLastByte), static_cast<char>(kMaxLastByte));
+    return _mm256_subs_epu8(input, max_value);
+  }
+
+  const __m256i byte_1_high_;
+  const __m256i byte_1_low_;
+  const __m256i byte_2_high_;
+  __m256i error_;
+  __m256i prev_input_;
+  __m256i prev_incomplete_;
+};
+
+}  // namespace
+
+bool ValidateLargeUTF8Avx2(const uint8_t* data, int64_t size) {
+  UTF8ValidatorAvx2 validator;
+  while (size >= utf8_lookup::kBlockSize) {
+    validator.CheckBlock(data);
+    data += utf8_lookup::kBlockSize;
+    size -= utf8_lookup::kBlockSize;
+  }
+  if (size > 0) {
+    uint8_t padded[utf8_lookup::kBlockSize] = {};
+    std::memcpy(padded, data, static_cast<size_t>(size));
+    validator.CheckBlock(padded);
+  }
+  return validator.Finish();
+}
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
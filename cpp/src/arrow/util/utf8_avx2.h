@@ -17,9 +17,19 @@
 
 #pragma once
 
-#include "arrow/dataset/type_fwd.h"
-#include "arrow/dataset/visibility.h"
+#include <cstdint>
+
+#include "arrow/util/visibility.h"
 
 namespace arrow {
-namespace dataset {}  // namespace dataset
+namespace util {
+namespace internal {
+
+// AVX2 implementation of ValidateLargeUTF8(). Only to be called on CPUs with
+// AVX2.
+ARROW_EXPORT
+bool ValidateLargeUTF8Avx2(const uint8_t* data, int64_t size);
+
+}  // namespace internal
+}  // namespace util
 }  // namespace arrow
@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Tables for vectorized UTF8 validation, shared by the implementations for
+// the different instruction set levels.
+//
+// This is the "lookup" algorithm of John Keiser and Daniel Lemire,
+// "Validating UTF-8 In Less Than One Instruction Per Byte"
+// (https://arxiv.org/abs/2010.03090), as used in simdjson.  Each byte is
+// classified together with the previous one by three 16-entry table lookups
+// (the high nibble of the previous byte, its low nibble, and the high nibble
+// of the current byte), each giving a bitmask of the errors the nibble is
+// compatible with.  The bitwise AND of the three lookups is the set of
+// errors found in the pair of bytes.  Continuation bytes expected from a
+// lead byte two or three bytes earlier are checked separately.
+
+#pragma once
+
+#include <cstdint>
+
+namespace arrow {
+namespace util {
+namespace internal {
+namespace utf8_lookup {
+
+// Error kinds in a pair of consecutive bytes
+static constexpr uint8_t kTooShort = 1 << 0;   // lead byte not followed by a cont.
+static constexpr uint8_t kTooLong = 1 << 1;    // ASCII followed by a continuation
+static constexpr uint8_t kOverlong3 = 1 << 2;  // E0 followed by 80..9F
+static constexpr uint8_t kTooLarge = 1 << 3;   // F4 followed by 90..BF, or F5..FF
+static constexpr uint8_t kSurrogate = 1 << 4;  // ED followed by A0..BF
+static constexpr uint8_t kOverlong2 = 1 << 5;  // C0 or C1
+static constexpr uint8_t kTooLarge1000 = 1 << 6;
+static constexpr uint8_t kOverlong4 = 1 << 6;  // F0 followed by 80..8F
+// Two continuation bytes in a row, which is only valid in a 3- or 4-byte
+// character: this bit is flipped when the continuation was expected
+static constexpr uint8_t kTwoConts = 1 << 7;
+static constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+// Indexed by the high nibble of the previous byte
+alignas(16) static constexpr uint8_t kByte1High[16] = {
+    // 0_______ (ASCII)
+    kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+    // 10______ (continuation)
+    kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+    // 1100____ (2-byte lead)
+    kTooShort | kOverlong2,
+    // 1101____ (2-byte lead)
+    kTooShort,
+    // 1110____ (3-byte lead)
+    kTooShort | kOverlong3 | kSurrogate,
+    // 1111____ (4-byte lead)
+    kTooShort | kTooLarge | kTooLarge1000 | kOverlong4};
+
+// Indexed by the low nibble of the previous byte
+alignas(16) static constexpr uint8_t kByte1Low[16] = {
+    // ____0000
+    kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+    // ____0001
+    kCarry | kOverlong2,
+    // ____001_
+    kCarry, kCarry,
+    // ____0100
+    kCarry | kTooLarge,
+    // ____0101 to ____1100
+    kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+    // ____1101
+    kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+    // ____111_
+    kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000};
+
+// Indexed by the high nibble of the current byte
+alignas(16) static constexpr uint8_t kByte2High[16] = {
+    // 0_______ (ASCII)
+    kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+    kTooShort,
+    // 1000____
+    kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+    // 1001____
+    kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+    // 101_____
+    kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+    kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+    // 11______ (lead)
+    kTooShort, kTooShort, kTooShort, kTooShort};
+
+// A byte two places after a 3- or 4-byte lead (111_____) and a byte three
+// places after a 4-byte lead (1111____) must be continuations.  Subtracting
+// these with unsigned saturation sets the high bit exactly for such leads.
+static constexpr uint8_t kThirdByteLeadMin = 0xE0 - 0x80;
+static constexpr uint8_t kFourthByteLeadMin = 0xF0 - 0x80;
+
+// A character is incomplete at the end of a vector if any of its last
+// three bytes is a lead byte for more bytes than are left.  Subtracting
+// these maximums with unsigned saturation gives non-zero for such bytes.
+static constexpr uint8_t kMaxLastByte = 0xC0 - 1;
+static constexpr uint8_t kMaxSecondLastByte = 0xE0 - 1;
+static constexpr uint8_t kMaxThirdLastByte = 0xF0 - 1;
+
+// Data is validated by blocks of this size, the last block being padded
+// with ASCII
+static constexpr int64_t kBlockSize = 64;
+
+}  // namespace utf8_lookup
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
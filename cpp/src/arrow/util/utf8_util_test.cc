@@ -18,14 +18,20 @@
 #include <cstdint>
 #include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
 
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/string.h"
 #include "arrow/util/utf8.h"
 
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/utf8_avx2.h"
+#endif
+
 namespace arrow {
 namespace util {
 
@@ -89,25 +95,41 @@ std::vector<std::string> UTF8Test::all_invalid_sequences;
 
 class UTF8ValidationTest : public UTF8Test {};
 
-::testing::AssertionResult IsValidUTF8(const std::string& s) {
-  if (ValidateUTF8(reinterpret_cast<const uint8_t*>(s.data()), s.size())) {
-    return ::testing::AssertionSuccess();
-  } else {
-    std::string h = HexEncode(reinterpret_cast<const uint8_t*>(s.data()),
-                              static_cast<int32_t>(s.size()));
-    return ::testing::AssertionFailure()
-           << "string '" << h << "' didn't validate as UTF8";
+// Check the result of ValidateUTF8() and of all the implementations usable
+// on this CPU, whatever the size of the data
+::testing::AssertionResult ValidatesAs(const std::string& s, bool expected) {
+  using ::arrow::internal::DispatchLevel;
+  using ::arrow::internal::IsDispatchLevelSupported;
+
+  const auto data = reinterpret_cast<const uint8_t*>(s.data());
+  const auto size = static_cast<int64_t>(s.size());
+  std::vector<std::pair<std::string, bool>> results = {
+      {"ValidateUTF8", ValidateUTF8(data, size)},
+      {"ValidateUTF8Inline", internal::ValidateUTF8Inline(data, size)},
+      {"ValidateLargeUTF8Default", internal::ValidateLargeUTF8Default(data, size)}};
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (IsDispatchLevelSupported(DispatchLevel::AVX2)) {
+    results.emplace_back("ValidateLargeUTF8Avx2",
+                         internal::ValidateLargeUTF8Avx2(data, size));
   }
+#endif
+  for (const auto& result : results) {
+    if (result.second != expected) {
+      std::string h = HexEncode(data, static_cast<int32_t>(size));
+      return ::testing::AssertionFailure()
+             << "string '" << h << "' " << (expected ? "didn't validate" : "validated")
+             << " as UTF8 with " << result.first;
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+::testing::AssertionResult IsValidUTF8(const std::string& s) {
+  return ValidatesAs(s, true);
 }
 
 ::testing::AssertionResult IsInvalidUTF8(const std::string& s) {
-  if (!ValidateUTF8(reinterpret_cast<const uint8_t*>(s.data()), s.size())) {
-    return ::testing::AssertionSuccess();
-  } else {
-    std::string h = HexEncode(reinterpret_cast<const uint8_t*>(s.data()),
-                              static_cast<int32_t>(s.size()));
-    return ::testing::AssertionFailure() << "string '" << h << "' validated as UTF8";
-  }
+  return ValidatesAs(s, false);
 }
 
 void AssertValidUTF8(const std::string& s) { ASSERT_TRUE(IsValidUTF8(s)); }
@@ -251,6 +273,68 @@ TEST_F(UTF8ValidationTest, RandomTruncated) {
   }
 }
 
+TEST_F(UTF8ValidationTest, BlockBoundaries) {
+  // Vectorized implementations work on blocks of 64 bytes: put characters
+  // across all positions of a few blocks
+  for (int pos = 0; pos < 200; ++pos) {
+    const std::string prefix(pos, 'x');
+    for (const auto& s : all_valid_sequences) {
+      AssertValidUTF8(prefix + s);
+      AssertValidUTF8(prefix + s + std::string(200 - pos, 'y'));
+      if (s.size() > 1) {
+        AssertInvalidUTF8(prefix + s.substr(0, s.size() - 1));
+        AssertInvalidUTF8(prefix + s.substr(0, s.size() - 1) + std::string(100, 'y'));
+      }
+    }
+    for (const auto& s : all_invalid_sequences) {
+      AssertInvalidUTF8(prefix + s);
+      AssertInvalidUTF8(prefix + s + std::string(200 - pos, 'y'));
+    }
+  }
+}
+
+TEST_F(UTF8ValidationTest, Values) {
+  auto values_valid = [](const std::string& data, const std::vector<int32_t>& offsets) {
+    const auto length = static_cast<int64_t>(offsets.size()) - 1;
+    const std::vector<int64_t> large_offsets(offsets.begin(), offsets.end());
+    const auto raw_data = reinterpret_cast<const uint8_t*>(data.data());
+    const bool valid = ValidateUTF8Values(raw_data, offsets.data(), length);
+    EXPECT_EQ(valid, ValidateUTF8Values(raw_data, large_offsets.data(), length));
+    return valid;
+  };
+
+  ASSERT_TRUE(values_valid("", {0}));
+  ASSERT_TRUE(values_valid("", {0, 0, 0}));
+  ASSERT_TRUE(values_valid("ab\xc3\xa9", {0, 1, 4}));
+  ASSERT_TRUE(values_valid("ab\xc3\xa9", {0, 2, 2, 4, 4}));
+  ASSERT_TRUE(values_valid("xab\xc3\xa9", {1, 3, 5}));
+  ASSERT_FALSE(values_valid("ab\xc3", {0, 2, 3}));
+  // The data is valid, but not the values
+  ASSERT_FALSE(values_valid("ab\xc3\xa9", {0, 3, 4}));
+  ASSERT_FALSE(values_valid("\xe8\x9d\xa5", {0, 1, 1, 3}));
+  ASSERT_FALSE(values_valid("\xe8\x9d\xa5", {0, 2, 3}));
+  // Only the given values are validated
+  ASSERT_TRUE(values_valid("\xff" "ab" "\xff", {1, 2, 3}));
+
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<size_t> valid_dist(0, all_valid_sequences.size() - 1);
+  std::string data;
+  std::vector<int32_t> offsets = {0};
+  for (int i = 0; i < 1000; ++i) {
+    data += all_valid_sequences[valid_dist(gen)];
+    offsets.push_back(static_cast<int32_t>(data.size()));
+  }
+  ASSERT_TRUE(values_valid(data, offsets));
+  // Split a multi-byte character between two values
+  for (size_t i = 1; i < offsets.size() - 1; ++i) {
+    if (offsets[i + 1] - offsets[i] > 1) {
+      ++offsets[i];
+      break;
+    }
+  }
+  ASSERT_FALSE(values_valid(data, offsets));
+}
+
 TEST(SkipUTF8BOM, Basics) {
   auto CheckOk = [](const std::string& s, size_t expected_offset) -> void {
     const uint8_t* data = reinterpret_cast<const uint8_t*>(s.data());
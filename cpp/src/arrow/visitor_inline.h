@@ -206,7 +206,7 @@ struct ArrayDataVisitor<T, enable_if_base_binary<T>> {
     if (!arr.buffers[2]) {
       data = &empty_value;
     } else {
-      data = arr.GetValues<uint8_t>(2);
+      data = arr.GetValues<uint8_t>(2, /*absolute_offset=*/0);
     }
 
     if (arr.null_count != 0) {
@@ -17,12 +17,81 @@ namespace flatbuf {
 
 struct FieldNode;
 
+struct BodyCompression;
+
 struct RecordBatch;
 
 struct DictionaryBatch;
 
 struct Message;
 
+enum CompressionType {
+  CompressionType_LZ4_FRAME = 0,
+  CompressionType_ZSTD = 1,
+  CompressionType_MIN = CompressionType_LZ4_FRAME,
+  CompressionType_MAX = CompressionType_ZSTD
+};
+
+inline const CompressionType (&EnumValuesCompressionType())[2] {
+  static const CompressionType values[] = {
+    CompressionType_LZ4_FRAME,
+    CompressionType_ZSTD
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesCompressionType() {
+  static const char * const names[] = {
+    "LZ4_FRAME",
+    "ZSTD",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameCompressionType(CompressionType e) {
+  if (e < CompressionType_LZ4_FRAME || e > CompressionType_ZSTD) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesCompressionType()[index];
+}
+
+/// Provided for forward compatibility in case we need to support different
+/// strategies for compressing the IPC message body (like whole-body
+/// compression rather than buffer-level) in the future
+enum BodyCompressionMethod {
+  /// Each constituent buffer is first compressed with the indicated
+  /// compressor, and then written with the uncompressed length in the first 8
+  /// bytes as a 64-bit little-endian signed integer followed by the compressed
+  /// buffer bytes (and then padding as required by the protocol). The
+  /// uncompressed length may be set to -1 to indicate that the data that
+  /// follows is not compressed, which can be useful for cases where
+  /// compression does not yield appreciable savings.
+  BodyCompressionMethod_BUFFER = 0,
+  BodyCompressionMethod_MIN = BodyCompressionMethod_BUFFER,
+  BodyCompressionMethod_MAX = BodyCompressionMethod_BUFFER
+};
+
+inline const BodyCompressionMethod (&EnumValuesBodyCompressionMethod())[1] {
+  static const BodyCompressionMethod values[] = {
+    BodyCompressionMethod_BUFFER
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesBodyCompressionMethod() {
+  static const char * const names[] = {
+    "BUFFER",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameBodyCompressionMethod(BodyCompressionMethod e) {
+  if (e < BodyCompressionMethod_BUFFER || e > BodyCompressionMethod_BUFFER) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesBodyCompressionMethod()[index];
+}
+
 /// ----------------------------------------------------------------------
 /// The root Message type
 /// This union enables us to easily send different message types without
@@ -136,6 +205,61 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(8) FieldNode FLATBUFFERS_FINAL_CLASS {
 };
 FLATBUFFERS_STRUCT_END(FieldNode, 16);
 
+/// Optional compression for the memory buffers constituting IPC message
+/// bodies. Intended for use with RecordBatch but could be used for other
+/// message types
+struct BodyCompression FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_CODEC = 4,
+    VT_METHOD = 6
+  };
+  /// Compressor library
+  CompressionType codec() const {
+    return static_cast<CompressionType>(GetField<int8_t>(VT_CODEC, 0));
+  }
+  /// Indicates the way the record batch body was compressed
+  BodyCompressionMethod method() const {
+    return static_cast<BodyCompressionMethod>(GetField<int8_t>(VT_METHOD, 0));
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int8_t>(verifier, VT_CODEC) &&
+           VerifyField<int8_t>(verifier, VT_METHOD) &&
+           verifier.EndTable();
+  }
+};
+
+struct BodyCompressionBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_codec(CompressionType codec) {
+    fbb_.AddElement<int8_t>(BodyCompression::VT_CODEC, static_cast<int8_t>(codec), 0);
+  }
+  void add_method(BodyCompressionMethod method) {
+    fbb_.AddElement<int8_t>(BodyCompression::VT_METHOD, static_cast<int8_t>(method), 0);
+  }
+  explicit BodyCompressionBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  BodyCompressionBuilder &operator=(const BodyCompressionBuilder &);
+  flatbuffers::Offset<BodyCompression> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<BodyCompression>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<BodyCompression> CreateBodyCompression(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    CompressionType codec = CompressionType_LZ4_FRAME,
+    BodyCompressionMethod method = BodyCompressionMethod_BUFFER) {
+  BodyCompressionBuilder builder_(_fbb);
+  builder_.add_method(method);
+  builder_.add_codec(codec);
+  return builder_.Finish();
+}
+
 /// A data header describing the shared memory layout of a "record" or "row"
 /// batch. Some systems call this a "row batch" internally and others a "record
 /// batch".
@@ -143,7 +267,8 @@ struct RecordBatch FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_LENGTH = 4,
     VT_NODES = 6,
-    VT_BUFFERS = 8
+    VT_BUFFERS = 8,
+    VT_COMPRESSION = 10
   };
   /// number of records / rows. The arrays in the batch should all have this
   /// length
@@ -163,6 +288,10 @@ struct RecordBatch FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<const Buffer *> *buffers() const {
     return GetPointer<const flatbuffers::Vector<const Buffer *> *>(VT_BUFFERS);
   }
+  /// Optional compression of the message body
+  const BodyCompression *compression() const {
+    return GetPointer<const BodyCompression *>(VT_COMPRESSION);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int64_t>(verifier, VT_LENGTH) &&
@@ -170,6 +299,8 @@ struct RecordBatch FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyVector(nodes()) &&
            VerifyOffset(verifier, VT_BUFFERS) &&
            verifier.VerifyVector(buffers()) &&
+           VerifyOffset(verifier, VT_COMPRESSION) &&
+           verifier.VerifyTable(compression()) &&
            verifier.EndTable();
   }
 };
@@ -186,6 +317,9 @@ struct RecordBatchBuilder {
   void add_buffers(flatbuffers::Offset<flatbuffers::Vector<const Buffer *>> buffers) {
     fbb_.AddOffset(RecordBatch::VT_BUFFERS, buffers);
   }
+  void add_compression(flatbuffers::Offset<BodyCompression> compression) {
+    fbb_.AddOffset(RecordBatch::VT_COMPRESSION, compression);
+  }
   explicit RecordBatchBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -202,9 +336,11 @@ inline flatbuffers::Offset<RecordBatch> CreateRecordBatch(
     flatbuffers::FlatBufferBuilder &_fbb,
     int64_t length = 0,
     flatbuffers::Offset<flatbuffers::Vector<const FieldNode *>> nodes = 0,
-    flatbuffers::Offset<flatbuffers::Vector<const Buffer *>> buffers = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<const Buffer *>> buffers = 0,
+    flatbuffers::Offset<BodyCompression> compression = 0) {
   RecordBatchBuilder builder_(_fbb);
   builder_.add_length(length);
+  builder_.add_compression(compression);
   builder_.add_buffers(buffers);
   builder_.add_nodes(nodes);
   return builder_.Finish();
@@ -214,14 +350,16 @@ inline flatbuffers::Offset<RecordBatch> CreateRecordBatchDirect(
     flatbuffers::FlatBufferBuilder &_fbb,
     int64_t length = 0,
     const std::vector<FieldNode> *nodes = nullptr,
-    const std::vector<Buffer> *buffers = nullptr) {
+    const std::vector<Buffer> *buffers = nullptr,
+    flatbuffers::Offset<BodyCompression> compression = 0) {
   auto nodes__ = nodes ? _fbb.CreateVectorOfStructs<FieldNode>(*nodes) : 0;
   auto buffers__ = buffers ? _fbb.CreateVectorOfStructs<Buffer>(*buffers) : 0;
   return org::apache::arrow::flatbuf::CreateRecordBatch(
       _fbb,
       length,
       nodes__,
-      buffers__);
+      buffers__,
+      compression);
 }
 
 /// For sending dictionary encoding information. Any Field can be
@@ -24,8 +24,10 @@
 #include "gtest/gtest.h"
 
 #include <arrow/compute/api.h>
+#include <chrono>
 #include <cstdint>
 #include <functional>
+#include <future>
 #include <sstream>
 #include <vector>
 
@@ -35,6 +37,7 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 #include "parquet/api/reader.h"
 #include "parquet/api/writer.h"
@@ -1879,6 +1882,121 @@ TEST(TestArrowReadWrite, MultithreadedRead) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, MultithreadedWrite) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 3, &table));
+
+  // Row groups which don't line up with the chunks of the columns
+  const int64_t row_group_size = 700;
+  std::shared_ptr<Buffer> serial_buffer, parallel_buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(
+      table, row_group_size, default_arrow_writer_properties(), &serial_buffer));
+  auto arrow_properties = ArrowWriterProperties::Builder().set_use_threads(true)->build();
+  ASSERT_TRUE(arrow_properties->use_threads());
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(table, row_group_size, arrow_properties, &parallel_buffer));
+
+  // The column chunks are written in the same order, at the same offsets
+  ASSERT_TRUE(serial_buffer->Equals(*parallel_buffer));
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(parallel_buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  ASSERT_EQ(5, reader->num_row_groups());
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+}
+
+TEST(TestArrowReadWrite, PreBufferedRead) {
+  const int num_columns = 10;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 10,
+                                             default_arrow_writer_properties(), &buffer));
+
+  for (bool use_threads : {false, true}) {
+    // A limit of zero reads the row groups one at a time, the default limit
+    // reads them all at once
+    for (int64_t limit : {static_cast<int64_t>(0), kArrowDefaultPreBufferLimit}) {
+      ArrowReaderProperties properties = default_arrow_reader_properties();
+      properties.set_use_threads(use_threads);
+      properties.set_pre_buffer(true);
+      properties.set_pre_buffer_limit(limit);
+
+      std::unique_ptr<FileReader> reader;
+      FileReaderBuilder builder;
+      ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+      ASSERT_OK(builder.properties(properties)->Build(&reader));
+      ASSERT_EQ(10, reader->num_row_groups());
+
+      std::shared_ptr<Table> result;
+      ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+      ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+
+      // Read a subset of the row groups and columns, then the same row group
+      // again, which isn't pre-buffered anymore
+      ASSERT_OK_NO_THROW(reader->ReadRowGroups({1, 2, 5}, {3, 7}, &result));
+      ASSERT_EQ(2, result->num_columns());
+      ASSERT_EQ(3 * num_rows / 10, result->num_rows());
+      ::arrow::AssertChunkedEqual(*table->column(7)->Slice(num_rows / 10, num_rows / 5),
+                                  *result->column(1)->Slice(0, num_rows / 5));
+      ASSERT_OK_NO_THROW(reader->ReadRowGroups({5}, {3, 7}, &result));
+      ::arrow::AssertChunkedEqual(*table->column(3)->Slice(num_rows / 2, num_rows / 10),
+                                  *result->column(0));
+
+      ASSERT_RAISES(Invalid, reader->ReadRowGroups({0}, {num_columns}, &result));
+      ASSERT_RAISES(Invalid, reader->ReadRowGroups({10}, {0}, &result));
+    }
+  }
+}
+
+TEST(TestArrowReadWrite, PreBufferedReadFromCpuThreadPool) {
+  // Pre-buffered reads issued from a task of a single-threaded CPU pool must
+  // not wait on fetches queued behind it
+  const int capacity = ::arrow::GetCpuThreadPoolCapacity();
+  ASSERT_OK(::arrow::SetCpuThreadPoolCapacity(1));
+
+  const int num_columns = 10;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 10,
+                                             default_arrow_writer_properties(), &buffer));
+
+  for (bool use_threads : {false, true}) {
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_use_threads(use_threads);
+    properties.set_pre_buffer(true);
+    properties.set_pre_buffer_limit(0);
+
+    std::shared_ptr<Table> result;
+    auto read = [&]() -> Status {
+      std::unique_ptr<FileReader> reader;
+      FileReaderBuilder builder;
+      RETURN_NOT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+      RETURN_NOT_OK(builder.properties(properties)->Build(&reader));
+      return reader->ReadTable(&result);
+    };
+    auto fut = ::arrow::internal::GetCpuThreadPool()->Submit(read);
+    ASSERT_EQ(std::future_status::ready, fut.wait_for(std::chrono::seconds(30)));
+    ASSERT_OK(fut.get());
+    ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+  }
+
+  ASSERT_OK(::arrow::SetCpuThreadPoolCapacity(capacity));
+}
+
 TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   const int num_columns = 10;
   const int num_rows = 100;
@@ -19,7 +19,9 @@
 
 #include <algorithm>
 #include <cstring>
+#include <functional>
 #include <future>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -112,6 +114,15 @@ class FileReaderImpl : public FileReader {
     return SomeRowGroupsFactory(Iota(reader_->metadata()->num_row_groups()));
   }
 
+  FileColumnIteratorFactory RowRangeFactory(int row_group, int64_t first_row,
+                                            int64_t num_rows) {
+    return [row_group, first_row, num_rows](int i, ParquetFileReader* reader) {
+      auto iterator = new FileColumnIterator(i, reader, {row_group});
+      iterator->SetRowRange(first_row, num_rows);
+      return iterator;
+    };
+  }
+
   Status BoundsCheckColumn(int column) {
     if (column < 0 || column >= this->num_columns()) {
       return Status::Invalid("Column index out of bounds (got ", column,
@@ -154,10 +165,16 @@ class FileReaderImpl : public FileReader {
   Status GetFieldReader(int i, const std::vector<int>& indices,
                         const std::vector<int>& row_groups,
                         std::unique_ptr<ColumnReaderImpl>* out) {
+    return GetFieldReader(i, indices, SomeRowGroupsFactory(row_groups), out);
+  }
+
+  Status GetFieldReader(int i, const std::vector<int>& indices,
+                        FileColumnIteratorFactory iterator_factory,
+                        std::unique_ptr<ColumnReaderImpl>* out) {
     auto ctx = std::make_shared<ReaderContext>();
     ctx->reader = reader_.get();
     ctx->pool = pool_;
-    ctx->iterator_factory = SomeRowGroupsFactory(row_groups);
+    ctx->iterator_factory = std::move(iterator_factory);
     ctx->filter_leaves = true;
     ctx->included_leaves.insert(indices.begin(), indices.end());
     return GetReader(manifest_.schema_fields[i], ctx, out);
@@ -171,14 +188,23 @@ class FileReaderImpl : public FileReader {
                          std::shared_ptr<Field>* out_field,
                          std::shared_ptr<ChunkedArray>* out) {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
-    std::unique_ptr<ColumnReaderImpl> reader;
-    RETURN_NOT_OK(GetFieldReader(i, indices, row_groups, &reader));
-
-    *out_field = reader->field();
-
     // TODO(wesm): This calculation doesn't make much sense when we have repeated
     // schema nodes
     int64_t records_to_read = GetTotalRecords(row_groups, i);
+    return ReadSchemaField(i, indices, SomeRowGroupsFactory(row_groups),
+                           records_to_read, out_field, out);
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  Status ReadSchemaField(int i, const std::vector<int>& indices,
+                         FileColumnIteratorFactory iterator_factory,
+                         int64_t records_to_read, std::shared_ptr<Field>* out_field,
+                         std::shared_ptr<ChunkedArray>* out) {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    std::unique_ptr<ColumnReaderImpl> reader;
+    RETURN_NOT_OK(GetFieldReader(i, indices, std::move(iterator_factory), &reader));
+
+    *out_field = reader->field();
     return reader->NextBatch(records_to_read, out);
     END_PARQUET_CATCH_EXCEPTIONS
   }
@@ -245,6 +271,23 @@ class FileReaderImpl : public FileReader {
     return ReadRowGroup(i, Iota(reader_->metadata()->num_columns()), table);
   }
 
+  Status ReadRowGroupRange(int i, const std::vector<int>& column_indices,
+                           int64_t first_row, int64_t num_rows,
+                           std::shared_ptr<Table>* out) override;
+
+  // Read the row groups in windows whose column chunks are pre-buffered, the
+  // next window being fetched while the current one is decoded
+  Status ReadRowGroupsPreBuffered(const std::vector<int>& row_groups,
+                                  const std::vector<int>& indices,
+                                  std::shared_ptr<Table>* out);
+
+  // Read the fields which have columns indicated in the indices vector,
+  // through the column chunks given by the iterator factory
+  Status ReadFields(const std::vector<int>& indices,
+                    const FileColumnIteratorFactory& iterator_factory,
+                    const std::function<int64_t(int)>& records_to_read,
+                    std::shared_ptr<Table>* out);
+
   Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
                               const std::vector<int>& column_indices,
                               std::unique_ptr<RecordBatchReader>* out) override;
@@ -432,6 +475,10 @@ class LeafReader : public ColumnReaderImpl {
   void NextRowGroup() {
     std::unique_ptr<PageReader> page_reader = input_->NextChunk();
     record_reader_->SetPageReader(std::move(page_reader));
+    if (input_->rows_to_skip() > 0) {
+      // The chunk starts with rows preceding the requested row range
+      record_reader_->SkipRecords(input_->rows_to_skip());
+    }
   }
 
   std::shared_ptr<ReaderContext> ctx_;
@@ -768,6 +815,137 @@ Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_facto
 Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
                                      const std::vector<int>& indices,
                                      std::shared_ptr<Table>* out) {
+  if (reader_properties_.pre_buffer() && !row_groups.empty()) {
+    return ReadRowGroupsPreBuffered(row_groups, indices, out);
+  }
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  // TODO(wesm): This calculation doesn't make much sense when we have repeated
+  // schema nodes
+  auto records_to_read = [&](int field_index) {
+    return GetTotalRecords(row_groups, field_index);
+  };
+  return ReadFields(indices, SomeRowGroupsFactory(row_groups), records_to_read, out);
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
+Status FileReaderImpl::ReadRowGroupsPreBuffered(const std::vector<int>& row_groups,
+                                                const std::vector<int>& indices,
+                                                std::shared_ptr<Table>* out) {
+  for (auto row_group : row_groups) {
+    RETURN_NOT_OK(BoundsCheckRowGroup(row_group));
+  }
+  for (auto column : indices) {
+    if (column < 0 || column >= reader_->metadata()->num_columns()) {
+      return Status::Invalid("Invalid column index");
+    }
+  }
+
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  // Split the row groups into windows taking up to half of the pre-buffer
+  // limit each, since a window is fetched while the previous one is decoded
+  const int64_t window_limit = reader_properties_.pre_buffer_limit() / 2;
+  std::vector<std::vector<int>> windows;
+  int64_t window_bytes = 0;
+  for (auto row_group : row_groups) {
+    auto row_group_metadata = reader_->metadata()->RowGroup(row_group);
+    int64_t row_group_bytes = 0;
+    for (auto column : indices) {
+      row_group_bytes += row_group_metadata->ColumnChunk(column)->total_compressed_size();
+    }
+    if (windows.empty() || window_bytes + row_group_bytes > window_limit) {
+      windows.emplace_back();
+      window_bytes = 0;
+    }
+    windows.back().push_back(row_group);
+    window_bytes += row_group_bytes;
+  }
+
+  auto PreBufferFunc = [this, &windows, &indices](size_t window) {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    reader_->PreBuffer(windows[window], indices);
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  };
+
+  // PreBuffer blocks until ReadRanges completes its reads on the IO thread
+  // pool. It is run on a dedicated thread rather than on the CPU thread pool,
+  // where it would hold a worker and could deadlock if this read was itself
+  // issued from a CPU task
+  std::future<Status> pre_buffered;
+  std::thread fetcher;
+  auto StartPreBuffer = [&](size_t window) {
+    std::packaged_task<Status()> task(std::bind(PreBufferFunc, window));
+    pre_buffered = task.get_future();
+    fetcher = std::thread(std::move(task));
+  };
+  auto FinishPreBuffer = [&]() {
+    Status st = pre_buffered.get();
+    fetcher.join();
+    return st;
+  };
+
+  StartPreBuffer(0);
+  std::vector<std::shared_ptr<Table>> tables(windows.size());
+  Status st;
+  size_t i = 0;
+  for (; i < windows.size(); ++i) {
+    st = FinishPreBuffer();
+    if (!st.ok()) {
+      break;
+    }
+    if (i + 1 < windows.size()) {
+      StartPreBuffer(i + 1);
+    }
+    const std::vector<int>& window = windows[i];
+    auto records_to_read = [&](int field_index) {
+      return GetTotalRecords(window, field_index);
+    };
+    st = ReadFields(indices, SomeRowGroupsFactory(window), records_to_read, &tables[i]);
+    if (!st.ok()) {
+      break;
+    }
+  }
+  if (!st.ok()) {
+    if (fetcher.joinable()) {
+      // The pending fetch refers to this reader
+      fetcher.join();
+    }
+    // Release the column chunks buffered for the windows which won't be read
+    for (; i < windows.size(); ++i) {
+      reader_->ClearPreBuffer(windows[i], indices);
+    }
+    return st;
+  }
+
+  if (tables.size() == 1) {
+    *out = std::move(tables[0]);
+    return Status::OK();
+  }
+  return ConcatenateTables(tables, out);
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
+Status FileReaderImpl::ReadRowGroupRange(int i, const std::vector<int>& column_indices,
+                                         int64_t first_row, int64_t num_rows,
+                                         std::shared_ptr<Table>* out) {
+  RETURN_NOT_OK(BoundsCheckRowGroup(i));
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  const int64_t row_group_rows = reader_->metadata()->RowGroup(i)->num_rows();
+  if (first_row < 0 || num_rows < 0 || first_row + num_rows > row_group_rows) {
+    return Status::Invalid("Row range [", first_row, ", ", first_row + num_rows,
+                           ") is out of bounds of row group ", i, " with ",
+                           row_group_rows, " rows");
+  }
+  auto records_to_read = [num_rows](int field_index) { return num_rows; };
+  return ReadFields(column_indices, RowRangeFactory(i, first_row, num_rows),
+                    records_to_read, out);
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
+Status FileReaderImpl::ReadFields(const std::vector<int>& indices,
+                                  const FileColumnIteratorFactory& iterator_factory,
+                                  const std::function<int64_t(int)>& records_to_read,
+                                  std::shared_ptr<Table>* out) {
   BEGIN_PARQUET_CATCH_EXCEPTIONS
 
   // We only need to read schema fields which have columns indicated
@@ -782,8 +960,8 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
   std::vector<std::shared_ptr<ChunkedArray>> columns(num_fields);
 
   auto ReadColumnFunc = [&](int i) {
-    return ReadSchemaField(field_indices[i], indices, row_groups, &fields[i],
-                           &columns[i]);
+    return ReadSchemaField(field_indices[i], indices, iterator_factory,
+                           records_to_read(field_indices[i]), &fields[i], &columns[i]);
   };
 
   if (reader_properties_.use_threads()) {
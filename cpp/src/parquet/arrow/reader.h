@@ -201,6 +201,16 @@ class PARQUET_EXPORT FileReader {
 
   virtual ::arrow::Status ReadRowGroup(int i, std::shared_ptr<::arrow::Table>* out) = 0;
 
+  /// \brief Read the rows [first_row, first_row + num_rows) of the given
+  /// columns of a row group into a Table
+  ///
+  /// Column chunks with a page index only have the pages holding these rows
+  /// read and decompressed. Rows can be selected with the page statistics of
+  /// the column index, see RowGroupReader::GetColumnIndex.
+  virtual ::arrow::Status ReadRowGroupRange(int i, const std::vector<int>& column_indices,
+                                            int64_t first_row, int64_t num_rows,
+                                            std::shared_ptr<::arrow::Table>* out) = 0;
+
   virtual ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                         const std::vector<int>& column_indices,
                                         std::shared_ptr<::arrow::Table>* out) = 0;
@@ -67,10 +67,20 @@ class FileColumnIterator {
       : column_index_(column_index),
         reader_(reader),
         schema_(reader->metadata()->schema()),
-        row_groups_(row_groups.begin(), row_groups.end()) {}
+        row_groups_(row_groups.begin(), row_groups.end()),
+        first_row_(0),
+        num_rows_(-1),
+        rows_to_skip_(0) {}
 
   virtual ~FileColumnIterator() {}
 
+  // Only return the pages holding the rows [first_row, first_row + num_rows)
+  // of each row group
+  void SetRowRange(int64_t first_row, int64_t num_rows) {
+    first_row_ = first_row;
+    num_rows_ = num_rows;
+  }
+
   std::unique_ptr<::parquet::PageReader> NextChunk() {
     if (row_groups_.empty()) {
       return nullptr;
@@ -78,9 +88,18 @@ class FileColumnIterator {
 
     auto row_group_reader = reader_->RowGroup(row_groups_.front());
     row_groups_.pop_front();
-    return row_group_reader->GetColumnPageReader(column_index_);
+    if (num_rows_ < 0) {
+      rows_to_skip_ = 0;
+      return row_group_reader->GetColumnPageReader(column_index_);
+    }
+    return row_group_reader->GetColumnPageReaderForRows(column_index_, first_row_,
+                                                        num_rows_, &rows_to_skip_);
   }
 
+  // The number of leading rows of the last chunk which are outside of the row
+  // range
+  int64_t rows_to_skip() const { return rows_to_skip_; }
+
   const SchemaDescriptor* schema() const { return schema_; }
 
   const ColumnDescriptor* descr() const { return schema_->Column(column_index_); }
@@ -94,6 +113,9 @@ class FileColumnIterator {
   ParquetFileReader* reader_;
   const SchemaDescriptor* schema_;
   std::deque<int> row_groups_;
+  int64_t first_row_;
+  int64_t num_rows_;
+  int64_t rows_to_skip_;
 };
 
 using FileColumnIteratorFactory =
@@ -31,6 +31,7 @@
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/base64.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 #include "parquet/arrow/reader_internal.h"
@@ -493,6 +494,9 @@ class FileWriterImpl : public FileWriter {
     }
 
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (UseThreads(table)) {
+        return WriteRowGroupInParallel(table, offset, size);
+      }
       RETURN_NOT_OK(NewRowGroup(size));
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -517,6 +521,38 @@ class FileWriterImpl : public FileWriter {
 
   const WriterProperties& properties() const { return *writer_->properties(); }
 
+  // Whether the column chunks of the table can be written concurrently, each
+  // column of the table being a single Parquet column
+  bool UseThreads(const Table& table) const {
+    return arrow_properties_->use_threads() && table.num_columns() > 1 &&
+           table.num_columns() == writer_->schema()->num_columns() &&
+           properties().file_encryption_properties() == nullptr;
+  }
+
+  // Encode and compress the column chunks of a row group concurrently. The
+  // pages are buffered in memory by the row group writer, which appends the
+  // column chunks to the file in column order when it is closed.
+  Status WriteRowGroupInParallel(const Table& table, int64_t offset, int64_t size) {
+    if (row_group_writer_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+
+    auto WriteColumnFunc = [&](int i) {
+      ColumnWriter* column_writer = row_group_writer_->column(i);
+      const SchemaField* schema_field = nullptr;
+      RETURN_NOT_OK(schema_manifest_.GetColumnField(i, &schema_field));
+      // The scratch buffers of the write context can't be shared between threads
+      ArrowWriteContext ctx(column_write_context_.memory_pool, arrow_properties_.get());
+      ArrowColumnWriter arrow_writer(&ctx, column_writer, schema_field,
+                                     &schema_manifest_);
+      RETURN_NOT_OK(arrow_writer.Write(*table.column(i), offset, size));
+      PARQUET_CATCH_NOT_OK(column_writer->FinishPages());
+      return Status::OK();
+    };
+    return ::arrow::internal::ParallelFor(table.num_columns(), WriteColumnFunc);
+  }
+
   ::arrow::MemoryPool* memory_pool() const override {
     return column_write_context_.memory_pool;
   }
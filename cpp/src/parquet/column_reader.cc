@@ -573,8 +573,12 @@ class ColumnReaderImplBase {
       current_decoder_ = it->second.get();
     } else {
       switch (encoding) {
-        case Encoding::PLAIN: {
-          auto decoder = MakeTypedDecoder<DType>(Encoding::PLAIN, descr_);
+        case Encoding::PLAIN:
+        case Encoding::DELTA_BINARY_PACKED:
+        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+        case Encoding::DELTA_BYTE_ARRAY:
+        case Encoding::BYTE_STREAM_SPLIT: {
+          auto decoder = MakeTypedDecoder<DType>(encoding, descr_);
           current_decoder_ = decoder.get();
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
@@ -582,11 +586,6 @@ class ColumnReaderImplBase {
         case Encoding::RLE_DICTIONARY:
           throw ParquetException("Dictionary page must be before data page.");
 
-        case Encoding::DELTA_BINARY_PACKED:
-        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-        case Encoding::DELTA_BYTE_ARRAY:
-          ParquetException::NYI("Unsupported encoding");
-
         default:
           throw ParquetException("Unknown encoding type.");
       }
@@ -1124,6 +1123,13 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     // Call Finish on the binary builders to reset them
   }
 
+  int64_t SkipRecords(int64_t num_records) override {
+    const int64_t records_skipped = ReadRecords(num_records);
+    Reset();
+    ResetBuilder();
+    return records_skipped;
+  }
+
   void SetPageReader(std::unique_ptr<PageReader> reader) override {
     at_record_start_ = true;
     this->pager_ = std::move(reader);
@@ -1227,6 +1233,9 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     std::cout << std::endl;
   }
 
+  // Discard the values accumulated in Arrow builders, if any
+  virtual void ResetBuilder() {}
+
   void ResetValues() {
     if (values_written_ > 0) {
       // Resize to 0, but do not shrink to fit
@@ -1264,6 +1273,8 @@ class FLBARecordReader : public TypedRecordReader<FLBAType>,
     return ::arrow::ArrayVector({chunk});
   }
 
+  void ResetBuilder() override { builder_->Reset(); }
+
   void ReadValuesDense(int64_t values_to_read) override {
     auto values = ValuesHead<FLBA>();
     int64_t num_decoded =
@@ -1320,6 +1331,11 @@ class ByteArrayChunkedRecordReader : public TypedRecordReader<ByteArrayType>,
     return result;
   }
 
+  void ResetBuilder() override {
+    accumulator_.builder->Reset();
+    accumulator_.chunks = {};
+  }
+
   void ReadValuesDense(int64_t values_to_read) override {
     int64_t num_decoded = this->current_decoder_->DecodeArrowNonNull(
         static_cast<int>(values_to_read), &accumulator_);
@@ -1365,6 +1381,13 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
     }
   }
 
+  void ResetBuilder() override {
+    builder_.ResetFull();
+    result_chunks_.clear();
+    // The dictionary was dropped with the builder's memo table
+    this->new_dictionary_ = true;
+  }
+
   void MaybeWriteNewDictionary() {
     if (this->new_dictionary_) {
       /// If there is a new dictionary, we may need to flush the builder, then
@@ -214,6 +214,11 @@ class RecordReader {
   /// \return number of records read
   virtual int64_t ReadRecords(int64_t num_records) = 0;
 
+  /// \brief Skip the indicated number of records of the column chunk, whose
+  /// values are read and discarded. Only valid before any records are read
+  /// \return number of records skipped
+  virtual int64_t SkipRecords(int64_t num_records) = 0;
+
   /// \brief Pre-allocate space for data. Results in better flat read performance
   virtual void Reserve(int64_t num_values) = 0;
 
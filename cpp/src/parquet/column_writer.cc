@@ -22,6 +22,7 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -31,16 +32,20 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_stream_utils.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/internal_file_encryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/murmur3.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -227,15 +232,26 @@ class SerializedPageWriter : public PageWriter {
   }
 
   void Close(bool has_dictionary, bool fallback) override {
+    FinishMetadata(/*base_offset=*/0, has_dictionary, fallback);
+    // Write metadata at end of column chunk
+    metadata_->WriteTo(sink_.get());
+  }
+
+  // Finish the column chunk metadata. The page offsets are relative to
+  // base_offset, which is the position of the column chunk in the file when
+  // its pages were written to an in-memory sink.
+  void FinishMetadata(int64_t base_offset, bool has_dictionary, bool fallback) {
     if (meta_encryptor_ != nullptr) {
       UpdateEncryption(encryption::kColumnMetaData);
     }
+    // The dictionary page of a buffered column chunk starts at offset 0
+    const int64_t dictionary_page_offset =
+        has_dictionary ? dictionary_page_offset_ + base_offset : 0;
     // index_page_offset = -1 since they are not supported
-    metadata_->Finish(num_values_, dictionary_page_offset_, -1, data_page_offset_,
-                      total_compressed_size_, total_uncompressed_size_, has_dictionary,
-                      fallback, meta_encryptor_);
-    // Write metadata at end of column chunk
-    metadata_->WriteTo(sink_.get());
+    metadata_->Finish(num_values_, dictionary_page_offset, -1,
+                      data_page_offset_ + base_offset, total_compressed_size_,
+                      total_uncompressed_size_, has_dictionary, fallback,
+                      meta_encryptor_);
   }
 
   /**
@@ -293,7 +309,8 @@ class SerializedPageWriter : public PageWriter {
 
     int64_t start_pos = -1;
     PARQUET_THROW_NOT_OK(sink_->Tell(&start_pos));
-    if (data_page_offset_ == 0) {
+    // The first data page may start at offset 0 of a buffered row group sink
+    if (page_ordinal_ == 0) {
       data_page_offset_ = start_pos;
     }
 
@@ -422,13 +439,9 @@ class BufferedPageWriter : public PageWriter {
   }
 
   void Close(bool has_dictionary, bool fallback) override {
-    // index_page_offset = -1 since they are not supported
     int64_t final_position = -1;
     PARQUET_THROW_NOT_OK(final_sink_->Tell(&final_position));
-    metadata_->Finish(
-        pager_->num_values(), pager_->dictionary_page_offset() + final_position, -1,
-        pager_->data_page_offset() + final_position, pager_->total_compressed_size(),
-        pager_->total_uncompressed_size(), has_dictionary, fallback);
+    pager_->FinishMetadata(final_position, has_dictionary, fallback);
 
     // Write metadata at end of column chunk
     metadata_->WriteTo(in_memory_sink_.get());
@@ -497,8 +510,10 @@ class ColumnWriterImpl {
         num_buffered_values_(0),
         num_buffered_encoded_values_(0),
         rows_written_(0),
+        page_first_row_(0),
         total_bytes_written_(0),
         total_compressed_bytes_(0),
+        pages_finished_(false),
         closed_(false),
         fallback_(false),
         definition_levels_sink_(allocator_),
@@ -513,10 +528,22 @@ class ColumnWriterImpl {
       compressed_data_ =
           std::static_pointer_cast<ResizableBuffer>(AllocateBuffer(allocator_, 0));
     }
+
+    // Like the Bloom filter, the location of the page index is recorded after
+    // the column chunk is written, which is too late for encrypted metadata.
+    auto encryption_properties =
+        properties->column_encryption_properties(descr_->path()->ToDotString());
+    const bool encrypted =
+        encryption_properties != nullptr && encryption_properties->is_encrypted();
+    if (properties->page_index_enabled(descr_->path()) && !encrypted) {
+      page_index_builder_ = std::make_shared<PageIndexBuilder>();
+    }
   }
 
   virtual ~ColumnWriterImpl() = default;
 
+  void FinishPages();
+
   int64_t Close();
 
  protected:
@@ -540,19 +567,27 @@ class ColumnWriterImpl {
 
   // Serializes Data Pages
   void WriteDataPage(const CompressedDataPage& page) {
-    total_bytes_written_ += pager_->WriteDataPage(page);
+    int64_t bytes_written = pager_->WriteDataPage(page);
+    total_bytes_written_ += bytes_written;
+    if (page_index_builder_ != nullptr) {
+      page_index_builder_->AddPageSize(bytes_written);
+    }
   }
 
   // Write multiple definition levels
   void WriteDefinitionLevels(int64_t num_levels, const int16_t* levels) {
-    DCHECK(!closed_);
+    DCHECK(!pages_finished_);
     PARQUET_THROW_NOT_OK(
         definition_levels_sink_.Append(levels, sizeof(int16_t) * num_levels));
   }
 
   // Write multiple repetition levels
   void WriteRepetitionLevels(int64_t num_levels, const int16_t* levels) {
-    DCHECK(!closed_);
+    DCHECK(!pages_finished_);
+    if (num_levels > 0 && levels[0] != 0 && repetition_levels_sink_.length() == 0) {
+      // The page starts in the middle of a row, so rows can't be selected by page
+      page_index_builder_.reset();
+    }
     PARQUET_THROW_NOT_OK(
         repetition_levels_sink_.Append(levels, sizeof(int16_t) * num_levels));
   }
@@ -592,12 +627,18 @@ class ColumnWriterImpl {
   // Total number of rows written with this ColumnWriter
   int rows_written_;
 
+  // Index of the first row of the current data page
+  int64_t page_first_row_;
+
   // Records the total number of bytes written by the serializer
   int64_t total_bytes_written_;
 
   // Records the current number of compressed bytes in a column
   int64_t total_compressed_bytes_;
 
+  // Flag to check if all the values have been committed to pages
+  bool pages_finished_;
+
   // Flag to check if the Writer has been closed
   bool closed_;
 
@@ -615,6 +656,8 @@ class ColumnWriterImpl {
 
   std::vector<CompressedDataPage> data_pages_;
 
+  std::shared_ptr<PageIndexBuilder> page_index_builder_;
+
  private:
   void InitSinks() {
     definition_levels_sink_.Rewind(0);
@@ -684,6 +727,13 @@ void ColumnWriterImpl::AddDataPage() {
   page_stats.set_is_signed(SortOrder::SIGNED == descr_->sort_order());
   ResetPageStatistics();
 
+  if (page_index_builder_ != nullptr) {
+    const bool null_page =
+        page_stats.has_null_count && page_stats.null_count == num_buffered_values_;
+    page_index_builder_->AddPage(page_stats, null_page, page_first_row_);
+  }
+  page_first_row_ = rows_written_;
+
   std::shared_ptr<Buffer> compressed_data;
   if (pager_->has_compressor()) {
     pager_->Compress(*(uncompressed_data_.get()), compressed_data_.get());
@@ -716,14 +766,21 @@ void ColumnWriterImpl::AddDataPage() {
   num_buffered_encoded_values_ = 0;
 }
 
-int64_t ColumnWriterImpl::Close() {
-  if (!closed_) {
-    closed_ = true;
+void ColumnWriterImpl::FinishPages() {
+  if (!pages_finished_) {
+    pages_finished_ = true;
     if (has_dictionary_ && !fallback_) {
       WriteDictionaryPage();
     }
 
     FlushBufferedDataPages();
+  }
+}
+
+int64_t ColumnWriterImpl::Close() {
+  if (!closed_) {
+    closed_ = true;
+    FinishPages();
 
     EncodedStatistics chunk_statistics = GetChunkStatistics();
     chunk_statistics.ApplyStatSizeLimits(
@@ -735,6 +792,11 @@ int64_t ColumnWriterImpl::Close() {
       metadata_->SetStatistics(chunk_statistics);
     }
     pager_->Close(has_dictionary_, fallback_);
+
+    if (page_index_builder_ != nullptr) {
+      auto chunk_metadata = ColumnChunkMetaData::Make(metadata_->contents(), descr_);
+      page_index_builder_->Finish(chunk_metadata->data_page_offset());
+    }
   }
 
   return total_bytes_written_;
@@ -799,6 +861,93 @@ static inline bool IsDictionaryEncoding(Encoding::type encoding) {
   return encoding == Encoding::PLAIN_DICTIONARY;
 }
 
+// Collects the hashes of the values written to a column chunk and builds its
+// Bloom filter in Finish(). Distinct hashes are buffered until there are more
+// than the NDV hint, so that the filter of a small column chunk is sized for its
+// actual number of distinct values rather than for the hint.
+class BloomFilterBuilder {
+ public:
+  BloomFilterBuilder(const ColumnDescriptor* descr, const BloomFilterOptions& options)
+      : type_length_(static_cast<uint32_t>(descr->type_length())),
+        max_ndv_(static_cast<size_t>(std::max(options.ndv, 1))),
+        fpp_(options.fpp) {}
+
+  void Insert(bool value) {}  // Not supported for BOOLEAN columns
+  void Insert(int32_t value) { InsertHash(hasher_.Hash(value)); }
+  void Insert(int64_t value) { InsertHash(hasher_.Hash(value)); }
+  void Insert(float value) { InsertHash(hasher_.Hash(value)); }
+  void Insert(double value) { InsertHash(hasher_.Hash(value)); }
+  void Insert(const Int96& value) { InsertHash(hasher_.Hash(&value)); }
+  void Insert(const ByteArray& value) { InsertHash(hasher_.Hash(&value)); }
+  void Insert(const FLBA& value) { InsertHash(hasher_.Hash(&value, type_length_)); }
+
+  template <typename T>
+  void Insert(const T* values, int64_t num_values) {
+    for (int64_t i = 0; i < num_values; ++i) {
+      Insert(values[i]);
+    }
+  }
+
+  template <typename T>
+  void InsertSpaced(const T* values, int64_t num_spaced_values,
+                    const uint8_t* valid_bits, int64_t valid_bits_offset) {
+    arrow::internal::BitmapReader valid_reader(valid_bits, valid_bits_offset,
+                                               num_spaced_values);
+    for (int64_t i = 0; i < num_spaced_values; ++i) {
+      if (valid_reader.IsSet()) {
+        Insert(values[i]);
+      }
+      valid_reader.Next();
+    }
+  }
+
+  // Insert the non-null values of a BinaryArray or StringArray
+  void Insert(const arrow::Array& values) {
+    const auto& binary_values = checked_cast<const arrow::BinaryArray&>(values);
+    for (int64_t i = 0; i < binary_values.length(); ++i) {
+      if (binary_values.IsValid(i)) {
+        Insert(ByteArray(binary_values.GetView(i)));
+      }
+    }
+  }
+
+  std::unique_ptr<BloomFilter> Finish() {
+    if (filter_ == nullptr) {
+      MakeFilter(hashes_.size());
+    }
+    return std::move(filter_);
+  }
+
+ private:
+  void InsertHash(uint64_t hash) {
+    if (filter_ != nullptr) {
+      filter_->InsertHash(hash);
+      return;
+    }
+    hashes_.insert(hash);
+    if (hashes_.size() > max_ndv_) {
+      MakeFilter(max_ndv_);
+    }
+  }
+
+  void MakeFilter(size_t ndv) {
+    filter_.reset(new BlockSplitBloomFilter());
+    filter_->Init(
+        BlockSplitBloomFilter::OptimalNumOfBits(static_cast<uint32_t>(ndv), fpp_) / 8);
+    for (uint64_t hash : hashes_) {
+      filter_->InsertHash(hash);
+    }
+    std::unordered_set<uint64_t>().swap(hashes_);
+  }
+
+  const uint32_t type_length_;
+  const size_t max_ndv_;
+  const double fpp_;
+  MurmurHash3 hasher_;
+  std::unordered_set<uint64_t> hashes_;
+  std::unique_ptr<BlockSplitBloomFilter> filter_;
+};
+
 template <typename DType>
 class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<DType> {
  public:
@@ -817,9 +966,45 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_ = MakeStatistics<DType>(descr_, allocator_);
       chunk_statistics_ = MakeStatistics<DType>(descr_, allocator_);
     }
+
+    // The location of the Bloom filter is recorded in the column metadata after
+    // the column chunk is written, which is too late for encrypted metadata.
+    auto encryption_properties =
+        properties->column_encryption_properties(descr_->path()->ToDotString());
+    const bool encrypted =
+        encryption_properties != nullptr && encryption_properties->is_encrypted();
+    if (properties->bloom_filter_enabled(descr_->path()) &&
+        descr_->physical_type() != Type::BOOLEAN && !encrypted) {
+      bloom_filter_builder_.reset(new BloomFilterBuilder(
+          descr_, properties->bloom_filter_options(descr_->path())));
+    }
   }
 
-  int64_t Close() override { return ColumnWriterImpl::Close(); }
+  void FinishPages() override {
+    ColumnWriterImpl::FinishPages();
+    if (bloom_filter_builder_ != nullptr) {
+      bloom_filter_ = bloom_filter_builder_->Finish();
+      bloom_filter_builder_.reset();
+    }
+  }
+
+  int64_t Close() override {
+    FinishPages();
+    int64_t total_bytes_written = ColumnWriterImpl::Close();
+    if (page_index_builder_ != nullptr) {
+      page_index_builder_->set_boundary_order(
+          pages_ascending_ ? BoundaryOrder::ASCENDING
+                           : (pages_descending_ ? BoundaryOrder::DESCENDING
+                                                : BoundaryOrder::UNORDERED));
+    }
+    return total_bytes_written;
+  }
+
+  const BloomFilter* bloom_filter() const override { return bloom_filter_.get(); }
+
+  std::shared_ptr<PageIndexBuilder> page_index() const override {
+    return page_index_builder_;
+  }
 
   void WriteBatch(int64_t num_values, const int16_t* def_levels,
                   const int16_t* rep_levels, const T* values) override {
@@ -927,11 +1112,37 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
 
   void ResetPageStatistics() override {
     if (chunk_statistics_ != nullptr) {
+      if (page_index_builder_ != nullptr) {
+        UpdateBoundaryOrder();
+      }
       chunk_statistics_->Merge(*page_statistics_);
       page_statistics_->Reset();
     }
   }
 
+  // Compare the min and max values of the current page with those of the
+  // previous page which has values
+  void UpdateBoundaryOrder() {
+    if (!page_statistics_->HasMinMax()) {
+      return;
+    }
+    if (last_page_statistics_ == nullptr) {
+      last_page_statistics_ = MakeStatistics<DType>(descr_, allocator_);
+      comparator_ = MakeComparator<DType>(descr_);
+    } else {
+      const T& min = page_statistics_->min();
+      const T& max = page_statistics_->max();
+      const T& last_min = last_page_statistics_->min();
+      const T& last_max = last_page_statistics_->max();
+      pages_ascending_ = pages_ascending_ && !comparator_->Compare(min, last_min) &&
+                         !comparator_->Compare(max, last_max);
+      pages_descending_ = pages_descending_ && !comparator_->Compare(last_min, min) &&
+                          !comparator_->Compare(last_max, max);
+      last_page_statistics_->Reset();
+    }
+    last_page_statistics_->Merge(*page_statistics_);
+  }
+
   Type::type type() const override { return descr_->physical_type(); }
 
   const ColumnDescriptor* descr() const override { return descr_; }
@@ -950,6 +1161,15 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   std::unique_ptr<Encoder> current_encoder_;
   std::shared_ptr<TypedStats> page_statistics_;
   std::shared_ptr<TypedStats> chunk_statistics_;
+  std::unique_ptr<BloomFilterBuilder> bloom_filter_builder_;
+  std::unique_ptr<BloomFilter> bloom_filter_;
+
+  // Statistics of the last page with values and page order, for the boundary
+  // order of the page index
+  std::shared_ptr<TypedStats> last_page_statistics_;
+  std::shared_ptr<TypedComparator<DType>> comparator_;
+  bool pages_ascending_ = true;
+  bool pages_descending_ = true;
 
   // If writing a sequence of arrow::DictionaryArray to the writer, we keep the
   // dictionary passed to DictEncoder<T>::PutDictionary so we can check
@@ -1089,6 +1309,9 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if (bloom_filter_builder_ != nullptr) {
+      bloom_filter_builder_->Insert(values, num_values);
+    }
   }
 
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
@@ -1106,6 +1329,14 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset, num_values,
                                      num_nulls);
     }
+    if (bloom_filter_builder_ != nullptr) {
+      if (descr_->schema_node()->is_optional()) {
+        bloom_filter_builder_->InsertSpaced(values, num_spaced_values, valid_bits,
+                                            valid_bits_offset);
+      } else {
+        bloom_filter_builder_->Insert(values, num_values);
+      }
+    }
   }
 };
 
@@ -1174,6 +1405,10 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_lev
     if (page_statistics_ != nullptr) {
       PARQUET_CATCH_NOT_OK(page_statistics_->Update(*dictionary));
     }
+    // Likewise, the Bloom filter may have false positives for unobserved values
+    if (bloom_filter_builder_ != nullptr) {
+      bloom_filter_builder_->Insert(*dictionary);
+    }
     preserved_dictionary_ = dictionary;
   } else if (!dictionary->Equals(*preserved_dictionary_)) {
     // Dictionary has changed
@@ -1593,6 +1828,9 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(const int16_t* def_
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(*data_slice);
     }
+    if (bloom_filter_builder_ != nullptr) {
+      bloom_filter_builder_->Insert(*data_slice);
+    }
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
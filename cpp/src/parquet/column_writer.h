@@ -42,9 +42,11 @@ class RleEncoder;
 namespace parquet {
 
 struct ArrowWriteContext;
+class BloomFilter;
 class ColumnDescriptor;
 class CompressedDataPage;
 class DictionaryPage;
+class PageIndexBuilder;
 class ColumnChunkMetaDataBuilder;
 class Encryptor;
 class WriterProperties;
@@ -115,6 +117,12 @@ class PARQUET_EXPORT ColumnWriter {
                                             std::unique_ptr<PageWriter>,
                                             const WriterProperties* properties);
 
+  /// \brief Commits any buffered values to pages without closing the
+  /// ColumnWriter. No more values can be written afterwards. In a buffered row
+  /// group, the pages are kept in memory until RowGroupWriter::Close(), so this
+  /// lets the columns be encoded and compressed concurrently.
+  virtual void FinishPages() = 0;
+
   /// \brief Closes the ColumnWriter, commits any buffered values to pages.
   /// \return Total size of the column in bytes
   virtual int64_t Close() = 0;
@@ -139,6 +147,14 @@ class PARQUET_EXPORT ColumnWriter {
   /// \brief The file-level writer properties
   virtual const WriterProperties* properties() = 0;
 
+  /// \brief The Bloom filter of the values written to the column chunk, or
+  /// null if not enabled for this column. Only available after Close()
+  virtual const BloomFilter* bloom_filter() const = 0;
+
+  /// \brief The page index of the data pages written to the column chunk, or
+  /// null if not enabled for this column. Only available after Close()
+  virtual std::shared_ptr<PageIndexBuilder> page_index() const = 0;
+
   /// \brief Write Apache Arrow columnar data directly to ColumnWriter. Returns
   /// error status if the array data type is not compatible with the concrete
   /// writer type
@@ -383,22 +383,41 @@ TYPED_TEST(TestPrimitiveWriter, RequiredBitPacked) {
   this->TestRequiredWithEncoding(Encoding::BIT_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaBinaryPacked) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
+TYPED_TEST(TestPrimitiveWriter, RequiredRLEDictionary) {
+  this->TestRequiredWithEncoding(Encoding::RLE_DICTIONARY);
 }
+*/
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaLengthByteArray) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+template <typename TestType>
+class TestDeltaBinaryPackedWriter : public TestPrimitiveWriter<TestType> {};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBinaryPackedTypes;
+
+TYPED_TEST_CASE(TestDeltaBinaryPackedWriter, DeltaBinaryPackedTypes);
+
+TYPED_TEST(TestDeltaBinaryPackedWriter, Required) {
+  this->TestRequiredWithSettings(Encoding::DELTA_BINARY_PACKED,
+                                 Compression::UNCOMPRESSED, false, true, LARGE_SIZE);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaByteArray) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_BYTE_ARRAY);
+template <typename TestType>
+class TestByteStreamSplitWriter : public TestPrimitiveWriter<TestType> {};
+
+typedef ::testing::Types<FloatType, DoubleType> ByteStreamSplitTypes;
+
+TYPED_TEST_CASE(TestByteStreamSplitWriter, ByteStreamSplitTypes);
+
+TYPED_TEST(TestByteStreamSplitWriter, Required) {
+  this->TestRequiredWithSettings(Encoding::BYTE_STREAM_SPLIT,
+                                 Compression::UNCOMPRESSED, false, true, LARGE_SIZE);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredRLEDictionary) {
-  this->TestRequiredWithEncoding(Encoding::RLE_DICTIONARY);
+#ifdef ARROW_WITH_ZSTD
+TYPED_TEST(TestByteStreamSplitWriter, RequiredWithZstdCompression) {
+  this->TestRequiredWithSettings(Encoding::BYTE_STREAM_SPLIT, Compression::ZSTD, false,
+                                 false, LARGE_SIZE);
 }
-*/
+#endif
 
 TYPED_TEST(TestPrimitiveWriter, RequiredPlainWithStats) {
   this->TestRequiredWithSettings(Encoding::PLAIN, Compression::UNCOMPRESSED, false, true,
@@ -682,6 +701,14 @@ TEST_F(TestByteArrayValuesWriter, CheckDefaultStats) {
   ASSERT_TRUE(this->metadata_is_stats_set());
 }
 
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaLengthByteArray) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+}
+
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaByteArray) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BYTE_ARRAY);
+}
+
 TEST(TestColumnWriter, RepeatedListsUpdateSpacedBug) {
   // In ARROW-3930 we discovered a bug when writing from Arrow when we had data
   // that looks like this:
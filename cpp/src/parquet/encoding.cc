@@ -22,6 +22,7 @@
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -29,6 +30,7 @@
 #include "arrow/builder.h"
 #include "arrow/stl.h"
 #include "arrow/util/bit_stream_utils.h"
+#include "arrow/util/byte_stream_split.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
@@ -815,6 +817,467 @@ void DictEncoderImpl<ByteArrayType>::PutDictionary(const arrow::Array& values) {
   }
 }
 
+// ----------------------------------------------------------------------
+// DeltaBitPackEncoder
+
+/// See the DELTA_BINARY_PACKED section of
+/// https://github.com/apache/parquet-format/blob/master/Encodings.md. The
+/// values are encoded as the deltas between consecutive values, in blocks of
+/// kBlockSize deltas. The deltas of a block are stored as their difference to
+/// the smallest delta of the block, bit packed in kNumMiniBlocks mini blocks
+/// which each have their own bit width.
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
+
+  static constexpr uint32_t kBlockSize = 128;
+  static constexpr uint32_t kNumMiniBlocks = 4;
+  static constexpr uint32_t kValuesPerMiniBlock = kBlockSize / kNumMiniBlocks;
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool),
+        sink_(pool),
+        total_value_count_(0),
+        first_value_(0),
+        current_value_(0),
+        num_deltas_(0) {
+    if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
+      throw ParquetException("Delta bit pack encoding should only be for integer data.");
+    }
+  }
+
+  int64_t EstimatedDataEncodedSize() override {
+    // Assume the buffered deltas take their full width until the block is packed
+    return kMaxHeaderSize + sink_.length() + num_deltas_ * sizeof(T);
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  using TypedEncoder<DType>::Put;
+
+  void Put(const T* src, int num_values) override;
+
+  void Put(const arrow::Array& values) override;
+
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    std::shared_ptr<ResizableBuffer> buffer;
+    PARQUET_THROW_NOT_OK(arrow::AllocateResizableBuffer(this->memory_pool(),
+                                                        num_values * sizeof(T), &buffer));
+    int32_t num_valid_values = 0;
+    arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                    num_values);
+    T* data = reinterpret_cast<T*>(buffer->mutable_data());
+    for (int32_t i = 0; i < num_values; i++) {
+      if (valid_bits_reader.IsSet()) {
+        data[num_valid_values++] = src[i];
+      }
+      valid_bits_reader.Next();
+    }
+    Put(data, num_valid_values);
+  }
+
+ private:
+  // Block size, number of mini blocks, total value count and first value
+  static constexpr int kMaxHeaderSize = 3 * arrow::BitUtil::BitReader::MAX_VLQ_BYTE_LEN +
+                                        arrow::BitUtil::BitReader::MAX_VLQ_BYTE_LEN_64;
+
+  void FlushBlock();
+
+  arrow::BufferBuilder sink_;
+  uint32_t total_value_count_;
+  T first_value_;
+  T current_value_;
+  // Deltas of the current block, computed with wrap-around arithmetic
+  T deltas_[kBlockSize];
+  uint32_t num_deltas_;
+  // Scratch space to bit pack a mini block, large enough for 64-bit deltas
+  uint8_t mini_block_buffer_[kValuesPerMiniBlock * sizeof(uint64_t)];
+};
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const T* src, int num_values) {
+  if (num_values == 0) {
+    return;
+  }
+
+  int idx = 0;
+  if (total_value_count_ == 0) {
+    first_value_ = current_value_ = src[0];
+    idx = 1;
+  }
+  total_value_count_ += num_values;
+
+  for (; idx < num_values; ++idx) {
+    deltas_[num_deltas_++] =
+        static_cast<T>(static_cast<UT>(src[idx]) - static_cast<UT>(current_value_));
+    current_value_ = src[idx];
+    if (num_deltas_ == kBlockSize) {
+      FlushBlock();
+    }
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::FlushBlock() {
+  if (num_deltas_ == 0) {
+    return;
+  }
+
+  const T min_delta = *std::min_element(deltas_, deltas_ + num_deltas_);
+  const UT unsigned_min_delta = static_cast<UT>(min_delta);
+  const uint32_t num_mini_blocks = static_cast<uint32_t>(
+      arrow::BitUtil::CeilDiv(num_deltas_, kValuesPerMiniBlock));
+
+  // Block header: the min delta and the bit width of each mini block. The
+  // bit widths of the mini blocks without values are written as zero.
+  uint8_t header[arrow::BitUtil::BitReader::MAX_VLQ_BYTE_LEN_64 + kNumMiniBlocks];
+  arrow::BitUtil::BitWriter header_writer(header, static_cast<int>(sizeof(header)));
+  header_writer.PutZigZagVlqInt(min_delta);
+
+  int bit_widths[kNumMiniBlocks];
+  for (uint32_t i = 0; i < kNumMiniBlocks; ++i) {
+    bit_widths[i] = 0;
+    if (i < num_mini_blocks) {
+      const uint32_t start = i * kValuesPerMiniBlock;
+      const uint32_t end = std::min(start + kValuesPerMiniBlock, num_deltas_);
+      UT max_delta = 0;
+      for (uint32_t j = start; j < end; ++j) {
+        max_delta = std::max<UT>(max_delta, static_cast<UT>(deltas_[j]) -
+                                                unsigned_min_delta);
+      }
+      bit_widths[i] = arrow::BitUtil::NumRequiredBits(max_delta);
+    }
+    header_writer.PutAligned<uint8_t>(static_cast<uint8_t>(bit_widths[i]), 1);
+  }
+  header_writer.Flush();
+  PARQUET_THROW_NOT_OK(sink_.Append(header, header_writer.bytes_written()));
+
+  // Mini blocks, the last one being padded with zeros to kValuesPerMiniBlock values
+  for (uint32_t i = 0; i < num_mini_blocks; ++i) {
+    if (bit_widths[i] == 0) {
+      continue;
+    }
+    arrow::BitUtil::BitWriter writer(mini_block_buffer_,
+                                     static_cast<int>(sizeof(mini_block_buffer_)));
+    const uint32_t start = i * kValuesPerMiniBlock;
+    for (uint32_t j = start; j < start + kValuesPerMiniBlock; ++j) {
+      const UT value =
+          j < num_deltas_ ? static_cast<UT>(deltas_[j]) - unsigned_min_delta : 0;
+      writer.PutValue(static_cast<uint64_t>(value), bit_widths[i]);
+    }
+    writer.Flush();
+    PARQUET_THROW_NOT_OK(sink_.Append(mini_block_buffer_, writer.bytes_written()));
+  }
+  num_deltas_ = 0;
+}
+
+template <typename DType>
+std::shared_ptr<Buffer> DeltaBitPackEncoder<DType>::FlushValues() {
+  FlushBlock();
+
+  uint8_t header[kMaxHeaderSize];
+  arrow::BitUtil::BitWriter header_writer(header, kMaxHeaderSize);
+  header_writer.PutVlqInt(kBlockSize);
+  header_writer.PutVlqInt(kNumMiniBlocks);
+  header_writer.PutVlqInt(total_value_count_);
+  header_writer.PutZigZagVlqInt(static_cast<int64_t>(first_value_));
+  header_writer.Flush();
+
+  const int64_t header_size = header_writer.bytes_written();
+  std::shared_ptr<ResizableBuffer> buffer =
+      AllocateBuffer(this->memory_pool(), header_size + sink_.length());
+  memcpy(buffer->mutable_data(), header, header_size);
+  if (sink_.length() > 0) {
+    memcpy(buffer->mutable_data() + header_size, sink_.data(), sink_.length());
+  }
+
+  sink_.Rewind(0);
+  total_value_count_ = 0;
+  first_value_ = current_value_ = 0;
+  return buffer;
+}
+
+template <typename ArrayType, typename EncoderType>
+void DirectPutSpacedImpl(const arrow::Array& values, EncoderType* encoder) {
+  if (values.type_id() != ArrayType::TypeClass::type_id) {
+    std::string type_name = ArrayType::TypeClass::type_name();
+    throw ParquetException("direct put to " + type_name + " from " +
+                           values.type()->ToString() + " not supported");
+  }
+
+  const auto& data = checked_cast<const ArrayType&>(values);
+  if (data.null_count() == 0) {
+    encoder->Put(data.raw_values(), static_cast<int>(data.length()));
+  } else {
+    encoder->PutSpaced(data.raw_values(), static_cast<int>(data.length()),
+                       data.null_bitmap_data(), data.offset());
+  }
+}
+
+template <>
+void DeltaBitPackEncoder<Int32Type>::Put(const arrow::Array& values) {
+  DirectPutSpacedImpl<arrow::Int32Array>(values, this);
+}
+
+template <>
+void DeltaBitPackEncoder<Int64Type>::Put(const arrow::Array& values) {
+  DirectPutSpacedImpl<arrow::Int64Array>(values, this);
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const arrow::Array& values) {
+  ParquetException::NYI("direct put of " + values.type()->ToString());
+}
+
+// ----------------------------------------------------------------------
+// DeltaLengthByteArrayEncoder
+
+/// The lengths of the values are DELTA_BINARY_PACKED, followed by the
+/// concatenated values
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        sink_(pool),
+        length_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return length_encoder_.EstimatedDataEncodedSize() + sink_.length();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  using TypedEncoder<ByteArrayType>::Put;
+
+  void Put(const ByteArray* src, int num_values) override;
+
+  void Put(const arrow::Array& values) override;
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                    num_values);
+    for (int32_t i = 0; i < num_values; i++) {
+      if (valid_bits_reader.IsSet()) {
+        Put(&src[i], 1);
+      }
+      valid_bits_reader.Next();
+    }
+  }
+
+ private:
+  void PutValue(const uint8_t* data, uint32_t length) {
+    const int32_t value_length = static_cast<int32_t>(length);
+    length_encoder_.Put(&value_length, 1);
+    PARQUET_THROW_NOT_OK(sink_.Append(data, length));
+  }
+
+  arrow::BufferBuilder sink_;
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+};
+
+void DeltaLengthByteArrayEncoder::Put(const ByteArray* src, int num_values) {
+  for (int i = 0; i < num_values; ++i) {
+    PutValue(src[i].ptr, src[i].len);
+  }
+}
+
+void DeltaLengthByteArrayEncoder::Put(const arrow::Array& values) {
+  AssertBinary(values);
+  const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+  PARQUET_THROW_NOT_OK(
+      sink_.Reserve(data.value_offset(data.length()) - data.value_offset(0)));
+  for (int64_t i = 0; i < data.length(); i++) {
+    if (data.IsValid(i)) {
+      auto view = data.GetView(i);
+      PutValue(reinterpret_cast<const uint8_t*>(view.data()),
+               static_cast<uint32_t>(view.size()));
+    }
+  }
+}
+
+std::shared_ptr<Buffer> DeltaLengthByteArrayEncoder::FlushValues() {
+  std::shared_ptr<Buffer> lengths = length_encoder_.FlushValues();
+
+  std::shared_ptr<ResizableBuffer> buffer =
+      AllocateBuffer(this->memory_pool(), lengths->size() + sink_.length());
+  memcpy(buffer->mutable_data(), lengths->data(), lengths->size());
+  if (sink_.length() > 0) {
+    memcpy(buffer->mutable_data() + lengths->size(), sink_.data(), sink_.length());
+  }
+  sink_.Rewind(0);
+  return buffer;
+}
+
+// ----------------------------------------------------------------------
+// DeltaByteArrayEncoder
+
+/// Incremental encoding: the length of the prefix each value shares with the
+/// previous value is DELTA_BINARY_PACKED, followed by the remaining suffixes
+/// encoded as DELTA_LENGTH_BYTE_ARRAY
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  using TypedEncoder<ByteArrayType>::Put;
+
+  void Put(const ByteArray* src, int num_values) override;
+
+  void Put(const arrow::Array& values) override;
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                    num_values);
+    for (int32_t i = 0; i < num_values; i++) {
+      if (valid_bits_reader.IsSet()) {
+        PutValue(src[i].ptr, src[i].len);
+      }
+      valid_bits_reader.Next();
+    }
+  }
+
+ private:
+  void PutValue(const uint8_t* data, uint32_t length) {
+    const uint32_t max_prefix =
+        std::min(length, static_cast<uint32_t>(last_value_.size()));
+    uint32_t prefix_length = 0;
+    while (prefix_length < max_prefix &&
+           data[prefix_length] == static_cast<uint8_t>(last_value_[prefix_length])) {
+      ++prefix_length;
+    }
+    const int32_t encoded_prefix_length = static_cast<int32_t>(prefix_length);
+    prefix_length_encoder_.Put(&encoded_prefix_length, 1);
+    const ByteArray suffix(length - prefix_length, data + prefix_length);
+    suffix_encoder_.Put(&suffix, 1);
+    last_value_.assign(reinterpret_cast<const char*>(data), length);
+  }
+
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  std::string last_value_;
+};
+
+void DeltaByteArrayEncoder::Put(const ByteArray* src, int num_values) {
+  for (int i = 0; i < num_values; ++i) {
+    PutValue(src[i].ptr, src[i].len);
+  }
+}
+
+void DeltaByteArrayEncoder::Put(const arrow::Array& values) {
+  AssertBinary(values);
+  const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+  for (int64_t i = 0; i < data.length(); i++) {
+    if (data.IsValid(i)) {
+      auto view = data.GetView(i);
+      PutValue(reinterpret_cast<const uint8_t*>(view.data()),
+               static_cast<uint32_t>(view.size()));
+    }
+  }
+}
+
+std::shared_ptr<Buffer> DeltaByteArrayEncoder::FlushValues() {
+  std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+  std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+
+  std::shared_ptr<ResizableBuffer> buffer =
+      AllocateBuffer(this->memory_pool(), prefix_lengths->size() + suffixes->size());
+  memcpy(buffer->mutable_data(), prefix_lengths->data(), prefix_lengths->size());
+  memcpy(buffer->mutable_data() + prefix_lengths->size(), suffixes->data(),
+         suffixes->size());
+  // Each page starts without a previous value
+  last_value_.clear();
+  return buffer;
+}
+
+// ----------------------------------------------------------------------
+// ByteStreamSplitEncoder
+
+/// See the BYTE_STREAM_SPLIT section of
+/// https://github.com/apache/parquet-format/blob/master/Encodings.md. The
+/// values are buffered as plain values and scattered into sizeof(T) streams,
+/// one per byte of the values, when the page is flushed.
+template <typename DType>
+class ByteStreamSplitEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+
+  explicit ByteStreamSplitEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::BYTE_STREAM_SPLIT, pool), values_(pool) {
+    if (DType::type_num != Type::FLOAT && DType::type_num != Type::DOUBLE) {
+      throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
+    }
+  }
+
+  int64_t EstimatedDataEncodedSize() override { return values_.length(); }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<ResizableBuffer> output =
+        AllocateBuffer(this->memory_pool(), values_.length());
+    const int64_t num_values = values_.length() / static_cast<int64_t>(sizeof(T));
+    arrow::util::internal::ByteStreamSplitEncode<T>(values_.data(), num_values,
+                                                    output->mutable_data());
+    values_.Rewind(0);
+    return output;
+  }
+
+  using TypedEncoder<DType>::Put;
+
+  void Put(const T* src, int num_values) override {
+    if (num_values > 0) {
+      PARQUET_THROW_NOT_OK(values_.Append(src, num_values * sizeof(T)));
+    }
+  }
+
+  void Put(const arrow::Array& values) override;
+
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PARQUET_THROW_NOT_OK(values_.Reserve(num_values * sizeof(T)));
+    arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                    num_values);
+    for (int32_t i = 0; i < num_values; i++) {
+      if (valid_bits_reader.IsSet()) {
+        values_.UnsafeAppend(src + i, sizeof(T));
+      }
+      valid_bits_reader.Next();
+    }
+  }
+
+ private:
+  arrow::BufferBuilder values_;
+};
+
+template <>
+void ByteStreamSplitEncoder<FloatType>::Put(const arrow::Array& values) {
+  DirectPutSpacedImpl<arrow::FloatArray>(values, this);
+}
+
+template <>
+void ByteStreamSplitEncoder<DoubleType>::Put(const arrow::Array& values) {
+  DirectPutSpacedImpl<arrow::DoubleArray>(values, this);
+}
+
+template <typename DType>
+void ByteStreamSplitEncoder<DType>::Put(const arrow::Array& values) {
+  ParquetException::NYI("direct put of " + values.type()->ToString());
+}
+
 // ----------------------------------------------------------------------
 // Encoder and decoder factory functions
 
@@ -863,6 +1326,36 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
         DCHECK(false) << "Encoder not implemented";
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::BYTE_STREAM_SPLIT) {
+    switch (type_num) {
+      case Type::FLOAT:
+        return std::unique_ptr<Encoder>(
+            new ByteStreamSplitEncoder<FloatType>(descr, pool));
+      case Type::DOUBLE:
+        return std::unique_ptr<Encoder>(
+            new ByteStreamSplitEncoder<DoubleType>(descr, pool));
+      default:
+        throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
+    }
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -2013,6 +2506,7 @@ template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
   typedef typename DType::c_type T;
+  using UT = typename std::make_unsigned<T>::type;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = arrow::default_memory_pool())
@@ -2025,8 +2519,7 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   void SetData(int num_values, const uint8_t* data, int len) override {
     this->num_values_ = num_values;
     decoder_ = arrow::BitUtil::BitReader(data, len);
-    values_current_block_ = 0;
-    values_current_mini_block_ = 0;
+    InitHeader();
   }
 
   int Decode(T* buffer, int max_values) override {
@@ -2036,99 +2529,261 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::Accumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    std::vector<T> values(num_values - null_count);
+    const int values_decoded = GetInternal(values.data(), num_values - null_count);
+    if (ARROW_PREDICT_FALSE(values_decoded != num_values - null_count)) {
+      ParquetException::EofException();
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
-    PARQUET_THROW_NOT_OK(out->AppendValues(values));
-    return num_values;
+
+    if (null_count == 0) {
+      PARQUET_THROW_NOT_OK(out->AppendValues(values.data(), values_decoded));
+      return values_decoded;
+    }
+    PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+    arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
+    int value_index = 0;
+    for (int i = 0; i < num_values; ++i) {
+      if (bit_reader.IsSet()) {
+        out->UnsafeAppend(values[value_index++]);
+      } else {
+        out->UnsafeAppendNull();
+      }
+      bit_reader.Next();
+    }
+    return values_decoded;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::DictAccumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    std::vector<T> values(num_values - null_count);
+    const int values_decoded = GetInternal(values.data(), num_values - null_count);
+    if (ARROW_PREDICT_FALSE(values_decoded != num_values - null_count)) {
+      ParquetException::EofException();
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
+
     PARQUET_THROW_NOT_OK(out->Reserve(num_values));
-    for (T value : values) {
-      PARQUET_THROW_NOT_OK(out->Append(value));
+    if (null_count == 0) {
+      for (T value : values) {
+        PARQUET_THROW_NOT_OK(out->Append(value));
+      }
+      return values_decoded;
     }
-    return num_values;
+    arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
+    int value_index = 0;
+    for (int i = 0; i < num_values; ++i) {
+      if (bit_reader.IsSet()) {
+        PARQUET_THROW_NOT_OK(out->Append(values[value_index++]));
+      } else {
+        PARQUET_THROW_NOT_OK(out->AppendNull());
+      }
+      bit_reader.Next();
+    }
+    return values_decoded;
   }
 
+  /// The number of bytes of the encoded values, valid once all values were
+  /// decoded. DELTA_LENGTH_BYTE_ARRAY data follows the encoded lengths.
+  int bytes_left() { return decoder_.bytes_left(); }
+
  private:
-  void InitBlock() {
+  void InitHeader() {
     int32_t block_size;
-    if (!decoder_.GetVlqInt(&block_size)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&num_mini_blocks_)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&values_current_block_)) {
+    int32_t total_value_count;
+    int64_t first_value;
+    if (!decoder_.GetVlqInt(&block_size) || !decoder_.GetVlqInt(&num_mini_blocks_) ||
+        !decoder_.GetVlqInt(&total_value_count) ||
+        !decoder_.GetZigZagVlqInt(&first_value)) {
       ParquetException::EofException();
     }
-    if (!decoder_.GetZigZagVlqInt(&last_value_)) ParquetException::EofException();
+    if (block_size <= 0 || block_size % 128 != 0 || num_mini_blocks_ <= 0 ||
+        block_size % num_mini_blocks_ != 0 ||
+        (block_size / num_mini_blocks_) % 32 != 0 || total_value_count < 0) {
+      throw ParquetException("Invalid DELTA_BINARY_PACKED header");
+    }
+    values_per_mini_block_ = block_size / num_mini_blocks_;
+    total_values_remaining_ = total_value_count;
+    last_value_ = static_cast<T>(first_value);
+    first_value_read_ = false;
 
-    delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
-    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    if (delta_bit_widths_ == nullptr) {
+      delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
+    } else {
+      PARQUET_THROW_NOT_OK(delta_bit_widths_->Resize(num_mini_blocks_, false));
+    }
+    // The first mini block is read with the first block header
+    mini_block_idx_ = num_mini_blocks_;
+    values_current_mini_block_ = 0;
+  }
+
+  void InitBlock() {
+    int64_t min_delta;
+    if (!decoder_.GetZigZagVlqInt(&min_delta)) ParquetException::EofException();
+    min_delta_ = static_cast<T>(min_delta);
 
-    if (!decoder_.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
+    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
     for (int i = 0; i < num_mini_blocks_; ++i) {
       if (!decoder_.GetAligned<uint8_t>(1, bit_width_data + i)) {
         ParquetException::EofException();
       }
     }
-    values_per_mini_block_ = block_size / num_mini_blocks_;
     mini_block_idx_ = 0;
-    delta_bit_width_ = bit_width_data[0];
+    InitMiniBlock(bit_width_data[0]);
+  }
+
+  void InitMiniBlock(int bit_width) {
+    if (ARROW_PREDICT_FALSE(bit_width > static_cast<int>(sizeof(T) * 8))) {
+      throw ParquetException("Invalid bit width in DELTA_BINARY_PACKED data");
+    }
+    delta_bit_width_ = bit_width;
     values_current_mini_block_ = values_per_mini_block_;
   }
 
-  template <typename T>
   int GetInternal(T* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    const uint8_t* bit_width_data = delta_bit_widths_->data();
-    for (int i = 0; i < max_values; ++i) {
+    max_values = std::min(max_values, std::min(this->num_values_,
+                                               total_values_remaining_));
+    if (max_values == 0) {
+      return 0;
+    }
+
+    int i = 0;
+    if (ARROW_PREDICT_FALSE(!first_value_read_)) {
+      buffer[i++] = last_value_;
+      first_value_read_ = true;
+    }
+    while (i < max_values) {
       if (ARROW_PREDICT_FALSE(values_current_mini_block_ == 0)) {
         ++mini_block_idx_;
-        if (mini_block_idx_ < static_cast<size_t>(delta_bit_widths_->size())) {
-          delta_bit_width_ = bit_width_data[mini_block_idx_];
-          values_current_mini_block_ = values_per_mini_block_;
+        if (mini_block_idx_ < num_mini_blocks_) {
+          InitMiniBlock(delta_bit_widths_->data()[mini_block_idx_]);
         } else {
           InitBlock();
-          buffer[i] = last_value_;
-          continue;
         }
       }
 
-      // TODO: the key to this algorithm is to decode the entire miniblock at once.
-      int64_t delta;
-      if (!decoder_.GetValue(delta_bit_width_, &delta)) ParquetException::EofException();
-      delta += min_delta_;
-      last_value_ += static_cast<int32_t>(delta);
-      buffer[i] = last_value_;
-      --values_current_mini_block_;
+      // Unpack as many deltas of the mini block as needed at once
+      const int num_deltas = std::min(max_values - i, values_current_mini_block_);
+      if (delta_bit_width_ == 0) {
+        std::fill(buffer + i, buffer + i + num_deltas, static_cast<T>(0));
+      } else if (decoder_.GetBatch(delta_bit_width_, buffer + i, num_deltas) !=
+                 num_deltas) {
+        ParquetException::EofException();
+      }
+      for (int j = i; j < i + num_deltas; ++j) {
+        last_value_ = static_cast<T>(static_cast<UT>(last_value_) +
+                                     static_cast<UT>(min_delta_) +
+                                     static_cast<UT>(buffer[j]));
+        buffer[j] = last_value_;
+      }
+      values_current_mini_block_ -= num_deltas;
+      i += num_deltas;
     }
+
     this->num_values_ -= max_values;
+    total_values_remaining_ -= max_values;
+    if (total_values_remaining_ == 0 && values_current_mini_block_ > 0) {
+      // Skip the padding of the last mini block, so that bytes_left() is exact
+      if (!decoder_.Advance(static_cast<int64_t>(delta_bit_width_) *
+                            values_current_mini_block_)) {
+        ParquetException::EofException();
+      }
+      values_current_mini_block_ = 0;
+    }
     return max_values;
   }
 
   MemoryPool* pool_;
   arrow::BitUtil::BitReader decoder_;
-  int32_t values_current_block_;
   int32_t num_mini_blocks_;
-  uint64_t values_per_mini_block_;
-  uint64_t values_current_mini_block_;
+  int values_per_mini_block_;
+  int values_current_mini_block_;
+  int total_values_remaining_;
+  bool first_value_read_;
 
-  int32_t min_delta_;
-  size_t mini_block_idx_;
+  T min_delta_;
+  int32_t mini_block_idx_;
   std::shared_ptr<ResizableBuffer> delta_bit_widths_;
   int delta_bit_width_;
 
-  int32_t last_value_;
+  T last_value_;
 };
 
+// ----------------------------------------------------------------------
+// Decoding of BYTE_ARRAY values into Arrow builders, for the decoders which
+// produce whole values with Decode()
+
+Status AppendSpacedByteArrays(const ByteArray* values, int num_values, int null_count,
+                              const uint8_t* valid_bits, int64_t valid_bits_offset,
+                              typename EncodingTraits<ByteArrayType>::Accumulator* out) {
+  ArrowBinaryHelper helper(out);
+  RETURN_NOT_OK(helper.builder->Reserve(num_values));
+  int value_index = 0;
+  auto append_value = [&](int i) {
+    const ByteArray& value = values[value_index++];
+    if (ARROW_PREDICT_FALSE(!helper.CanFit(value.len))) {
+      // This element would exceed the capacity of a chunk
+      RETURN_NOT_OK(helper.PushChunk());
+      RETURN_NOT_OK(helper.builder->Reserve(num_values - i));
+    }
+    return helper.Append(value.ptr, static_cast<int32_t>(value.len));
+  };
+
+  if (null_count == 0) {
+    for (int i = 0; i < num_values; ++i) {
+      RETURN_NOT_OK(append_value(i));
+    }
+    return Status::OK();
+  }
+  arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
+  for (int i = 0; i < num_values; ++i) {
+    if (bit_reader.IsSet()) {
+      RETURN_NOT_OK(append_value(i));
+    } else {
+      helper.UnsafeAppendNull();
+    }
+    bit_reader.Next();
+  }
+  return Status::OK();
+}
+
+Status AppendSpacedByteArrays(const ByteArray* values, int num_values, int null_count,
+                              const uint8_t* valid_bits, int64_t valid_bits_offset,
+                              arrow::BinaryDictionary32Builder* builder) {
+  RETURN_NOT_OK(builder->Reserve(num_values));
+  if (null_count == 0) {
+    for (int i = 0; i < num_values; ++i) {
+      RETURN_NOT_OK(builder->Append(values[i].ptr, static_cast<int32_t>(values[i].len)));
+    }
+    return Status::OK();
+  }
+  arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
+  int value_index = 0;
+  for (int i = 0; i < num_values; ++i) {
+    if (bit_reader.IsSet()) {
+      const ByteArray& value = values[value_index++];
+      RETURN_NOT_OK(builder->Append(value.ptr, static_cast<int32_t>(value.len)));
+    } else {
+      RETURN_NOT_OK(builder->AppendNull());
+    }
+    bit_reader.Next();
+  }
+  return Status::OK();
+}
+
+template <typename BuilderType>
+int DecodeByteArraysArrow(TypedDecoder<ByteArrayType>* decoder, int num_values,
+                          int null_count, const uint8_t* valid_bits,
+                          int64_t valid_bits_offset, BuilderType* builder) {
+  const int values_to_decode = num_values - null_count;
+  std::vector<ByteArray> values(values_to_decode);
+  if (decoder->Decode(values.data(), values_to_decode) != values_to_decode) {
+    ParquetException::EofException();
+  }
+  PARQUET_THROW_NOT_OK(AppendSpacedByteArrays(values.data(), num_values, null_count,
+                                              valid_bits, valid_bits_offset, builder));
+  return values_to_decode;
+}
+
 // ----------------------------------------------------------------------
 // DELTA_LENGTH_BYTE_ARRAY
 
@@ -2139,48 +2794,55 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
                                        MemoryPool* pool = arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
         len_decoder_(nullptr, pool),
-        pool_(pool) {}
+        lengths_(0, 0, ::arrow::stl::allocator<int32_t>(pool)) {}
 
   void SetData(int num_values, const uint8_t* data, int len) override {
-    num_values_ = num_values;
-    if (len == 0) return;
-    int total_lengths_len = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    this->len_decoder_.SetData(num_values, data, total_lengths_len);
-    data_ = data + total_lengths_len;
-    this->len_ = len - 4 - total_lengths_len;
+    // Decode all the lengths to find where the values start
+    len_decoder_.SetData(num_values, data, len);
+    lengths_.resize(num_values);
+    num_values_ = len_decoder_.Decode(lengths_.data(), num_values);
+    length_idx_ = 0;
+
+    const int lengths_size = len - len_decoder_.bytes_left();
+    data_ = data + lengths_size;
+    len_ = len - lengths_size;
   }
 
   int Decode(ByteArray* buffer, int max_values) override {
-    using VectorT = ArrowPoolVector<int>;
     max_values = std::min(max_values, num_values_);
-    VectorT lengths(max_values, 0, ::arrow::stl::allocator<int>(pool_));
-    len_decoder_.Decode(lengths.data(), max_values);
     for (int i = 0; i < max_values; ++i) {
-      buffer[i].len = lengths[i];
+      const int32_t length = lengths_[length_idx_ + i];
+      if (ARROW_PREDICT_FALSE(length < 0 || len_ < length)) {
+        ParquetException::EofException();
+      }
+      buffer[i].len = length;
       buffer[i].ptr = data_;
-      this->data_ += lengths[i];
-      this->len_ -= lengths[i];
+      data_ += length;
+      len_ -= length;
     }
-    this->num_values_ -= max_values;
+    length_idx_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysArrow(this, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysArrow(this, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
   }
 
  private:
   DeltaBitPackDecoder<Int32Type> len_decoder_;
-  ::arrow::MemoryPool* pool_;
+  ArrowPoolVector<int32_t> lengths_;
+  int length_idx_;
 };
 
 // ----------------------------------------------------------------------
@@ -2192,50 +2854,203 @@ class DeltaByteArrayDecoder : public DecoderImpl,
   explicit DeltaByteArrayDecoder(const ColumnDescriptor* descr,
                                  MemoryPool* pool = arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_BYTE_ARRAY),
+        pool_(pool),
         prefix_len_decoder_(nullptr, pool),
-        suffix_decoder_(nullptr, pool),
-        last_value_(0, nullptr) {}
+        suffix_decoder_(nullptr, pool) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
-    num_values_ = num_values;
-    if (len == 0) return;
-    int prefix_len_length = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    len -= 4;
-    prefix_len_decoder_.SetData(num_values, data, prefix_len_length);
-    data += prefix_len_length;
-    len -= prefix_len_length;
-    suffix_decoder_.SetData(num_values, data, len);
-  }
-
-  // TODO: this doesn't work and requires memory management. We need to allocate
-  // new strings to store the results.
-  virtual int Decode(ByteArray* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    for (int i = 0; i < max_values; ++i) {
-      int prefix_len = 0;
-      prefix_len_decoder_.Decode(&prefix_len, 1);
-      ByteArray suffix = {0, nullptr};
-      suffix_decoder_.Decode(&suffix, 1);
-      buffer[i].len = prefix_len + suffix.len;
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    // Decode all the prefix lengths to find where the suffixes start
+    prefix_len_decoder_.SetData(num_values, data, len);
+    prefix_lengths_.resize(num_values);
+    num_values_ = prefix_len_decoder_.Decode(prefix_lengths_.data(), num_values);
+    prefix_length_idx_ = 0;
 
-      uint8_t* result = reinterpret_cast<uint8_t*>(malloc(buffer[i].len));
-      memcpy(result, last_value_.ptr, prefix_len);
-      memcpy(result + prefix_len, suffix.ptr, suffix.len);
+    const int prefix_lengths_size = len - prefix_len_decoder_.bytes_left();
+    suffix_decoder_.SetData(num_values_, data + prefix_lengths_size,
+                            len - prefix_lengths_size);
+    last_value_ = ByteArray();
+    buffers_.clear();
+  }
 
-      buffer[i].ptr = result;
+  /// The decoded values point into buffers owned by the decoder, which stay
+  /// valid until the next data page, like values pointing into the page
+  int Decode(ByteArray* buffer, int max_values) override {
+    max_values = std::min(max_values, num_values_);
+    if (suffix_decoder_.Decode(buffer, max_values) != max_values) {
+      ParquetException::EofException();
+    }
+
+    // Compute the size of the values to reassemble them in a single buffer
+    int64_t values_size = 0;
+    for (int i = 0; i < max_values; ++i) {
+      const int32_t prefix_len = prefix_lengths_[prefix_length_idx_ + i];
+      if (ARROW_PREDICT_FALSE(prefix_len < 0)) {
+        throw ParquetException("Invalid prefix length in DELTA_BYTE_ARRAY data");
+      }
+      values_size += prefix_len + buffer[i].len;
+    }
+    std::shared_ptr<ResizableBuffer> values = AllocateBuffer(pool_, values_size);
+    buffers_.push_back(values);
+
+    uint8_t* out = values->mutable_data();
+    for (int i = 0; i < max_values; ++i) {
+      const uint32_t prefix_len =
+          static_cast<uint32_t>(prefix_lengths_[prefix_length_idx_ + i]);
+      if (ARROW_PREDICT_FALSE(prefix_len > last_value_.len)) {
+        throw ParquetException("Invalid prefix length in DELTA_BYTE_ARRAY data");
+      }
+      if (prefix_len > 0) {
+        memcpy(out, last_value_.ptr, prefix_len);
+      }
+      if (buffer[i].len > 0) {
+        memcpy(out + prefix_len, buffer[i].ptr, buffer[i].len);
+      }
+      buffer[i].ptr = out;
+      buffer[i].len += prefix_len;
       last_value_ = buffer[i];
+      out += buffer[i].len;
     }
-    this->num_values_ -= max_values;
+
+    prefix_length_idx_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
+    return DecodeByteArraysArrow(this, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
+    return DecodeByteArraysArrow(this, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
+  }
+
  private:
+  MemoryPool* pool_;
   DeltaBitPackDecoder<Int32Type> prefix_len_decoder_;
   DeltaLengthByteArrayDecoder suffix_decoder_;
+  std::vector<int32_t> prefix_lengths_;
+  int prefix_length_idx_;
+  std::vector<std::shared_ptr<Buffer>> buffers_;
   ByteArray last_value_;
 };
 
+// ----------------------------------------------------------------------
+// BYTE_STREAM_SPLIT decoding
+
+template <typename DType>
+class ByteStreamSplitDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
+ public:
+  using T = typename DType::c_type;
+
+  explicit ByteStreamSplitDecoder(const ColumnDescriptor* descr)
+      : DecoderImpl(descr, Encoding::BYTE_STREAM_SPLIT),
+        num_values_in_buffer_(0),
+        num_decoded_(0) {
+    if (DType::type_num != Type::FLOAT && DType::type_num != Type::DOUBLE) {
+      throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
+    }
+  }
+
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    // num_values also counts the nulls of the page, so the length of the
+    // streams is given by the size of the data
+    if (ARROW_PREDICT_FALSE(len % static_cast<int>(sizeof(T)) != 0)) {
+      throw ParquetException("BYTE_STREAM_SPLIT data size is not a multiple of " +
+                             std::to_string(sizeof(T)));
+    }
+    DecoderImpl::SetData(num_values, data, len);
+    num_values_in_buffer_ = len / static_cast<int>(sizeof(T));
+    num_decoded_ = 0;
+  }
+
+  int Decode(T* buffer, int max_values) override {
+    max_values = std::min(max_values, std::min(this->num_values_,
+                                               num_values_in_buffer_ - num_decoded_));
+    DecodeValues(buffer, max_values, max_values);
+    return max_values;
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<DType>::Accumulator* out) override {
+    const int values_to_decode = num_values - null_count;
+    if (ARROW_PREDICT_FALSE(values_to_decode > num_values_in_buffer_ - num_decoded_)) {
+      ParquetException::EofException();
+    }
+    values_.resize(values_to_decode);
+    DecodeValues(values_.data(), values_to_decode, num_values);
+
+    if (null_count == 0) {
+      PARQUET_THROW_NOT_OK(out->AppendValues(values_.data(), values_to_decode));
+      return values_to_decode;
+    }
+    PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+    arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
+    int value_index = 0;
+    for (int i = 0; i < num_values; ++i) {
+      if (bit_reader.IsSet()) {
+        out->UnsafeAppend(values_[value_index++]);
+      } else {
+        out->UnsafeAppendNull();
+      }
+      bit_reader.Next();
+    }
+    return values_to_decode;
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<DType>::DictAccumulator* out) override {
+    const int values_to_decode = num_values - null_count;
+    if (ARROW_PREDICT_FALSE(values_to_decode > num_values_in_buffer_ - num_decoded_)) {
+      ParquetException::EofException();
+    }
+    values_.resize(values_to_decode);
+    DecodeValues(values_.data(), values_to_decode, num_values);
+
+    PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+    if (null_count == 0) {
+      for (int i = 0; i < values_to_decode; ++i) {
+        PARQUET_THROW_NOT_OK(out->Append(values_[i]));
+      }
+      return values_to_decode;
+    }
+    arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
+    int value_index = 0;
+    for (int i = 0; i < num_values; ++i) {
+      if (bit_reader.IsSet()) {
+        PARQUET_THROW_NOT_OK(out->Append(values_[value_index++]));
+      } else {
+        PARQUET_THROW_NOT_OK(out->AppendNull());
+      }
+      bit_reader.Next();
+    }
+    return values_to_decode;
+  }
+
+ private:
+  // Gather the next num_values values, num_slots being the number of values
+  // and nulls which are consumed from the page
+  void DecodeValues(T* out, int num_values, int num_slots) {
+    arrow::util::internal::ByteStreamSplitDecode<T>(data_ + num_decoded_, num_values,
+                                                    num_values_in_buffer_, out);
+    num_decoded_ += num_values;
+    this->num_values_ -= num_slots;
+  }
+
+  // Number of values in each of the byte streams
+  int num_values_in_buffer_;
+  int num_decoded_;
+  // Scratch space for DecodeArrow
+  std::vector<T> values_;
+};
+
 // ----------------------------------------------------------------------
 
 std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encoding,
@@ -2261,6 +3076,34 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
       default:
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int64Type>(descr));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaLengthByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::BYTE_STREAM_SPLIT) {
+    switch (type_num) {
+      case Type::FLOAT:
+        return std::unique_ptr<Decoder>(new ByteStreamSplitDecoder<FloatType>(descr));
+      case Type::DOUBLE:
+        return std::unique_ptr<Decoder>(new ByteStreamSplitDecoder<DoubleType>(descr));
+      default:
+        throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
+    }
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -24,6 +24,7 @@
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
+#include "arrow/util/compression.h"
 
 #include "parquet/encoding.h"
 #include "parquet/platform.h"
@@ -116,6 +117,74 @@ static void BM_PlainDecodingInt64(benchmark::State& state) {
 
 BENCHMARK(BM_PlainDecodingInt64)->Range(MIN_RANGE, MAX_RANGE);
 
+static std::vector<int64_t> DeltaInt64Values(int64_t length) {
+  // Slowly increasing values, like timestamps or row ids, which is the data
+  // DELTA_BINARY_PACKED is designed for
+  std::vector<int64_t> values(length);
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> d(0, 100);
+  int64_t value = 1000000;
+  for (auto& v : values) {
+    value += d(gen);
+    v = value;
+  }
+  return values;
+}
+
+static void BM_DeltaBitPackEncodingInt64(benchmark::State& state) {
+  std::vector<int64_t> values = DeltaInt64Values(state.range(0));
+  auto encoder = MakeTypedEncoder<Int64Type>(Encoding::DELTA_BINARY_PACKED);
+  for (auto _ : state) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    encoder->FlushValues();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int64_t));
+}
+
+BENCHMARK(BM_DeltaBitPackEncodingInt64)->Range(MIN_RANGE, MAX_RANGE);
+
+static void DecodeDeltaBitPackInt64(const std::vector<int64_t>& values,
+                                    benchmark::State& state) {
+  auto encoder = MakeTypedEncoder<Int64Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  std::vector<int64_t> decoded(values.size());
+  for (auto _ : state) {
+    auto decoder = MakeTypedDecoder<Int64Type>(Encoding::DELTA_BINARY_PACKED);
+    decoder->SetData(static_cast<int>(values.size()), buf->data(),
+                     static_cast<int>(buf->size()));
+    decoder->Decode(decoded.data(), static_cast<int>(decoded.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(int64_t));
+}
+
+static void BM_DeltaBitPackDecodingInt64(benchmark::State& state) {
+  DecodeDeltaBitPackInt64(DeltaInt64Values(state.range(0)), state);
+}
+
+BENCHMARK(BM_DeltaBitPackDecodingInt64)->Range(MIN_RANGE, MAX_RANGE);
+
+// Random values of state.range(1) - 1 bits, whose deltas take up to
+// state.range(1) bits once offset by the minimum delta
+static void BM_DeltaBitPackDecodingInt64_width(benchmark::State& state) {
+  std::vector<int64_t> values(state.range(0));
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> d(0, (int64_t(1) << (state.range(1) - 1)) - 1);
+  for (auto& v : values) {
+    v = d(gen);
+  }
+  DecodeDeltaBitPackInt64(values, state);
+}
+
+BENCHMARK(BM_DeltaBitPackDecodingInt64_width)
+    ->Args({MAX_RANGE, 4})
+    ->Args({MAX_RANGE, 12})
+    ->Args({MAX_RANGE, 24})
+    ->Args({MAX_RANGE, 32})
+    ->Args({MAX_RANGE, 40})
+    ->Args({MAX_RANGE, 56});
+
 static void BM_PlainEncodingDouble(benchmark::State& state) {
   std::vector<double> values(state.range(0), 64.0);
   auto encoder = MakeTypedEncoder<DoubleType>(Encoding::PLAIN);
@@ -157,6 +226,90 @@ static void BM_PlainDecodingDouble(benchmark::State& state) {
 
 BENCHMARK(BM_PlainDecodingDouble)->Range(MIN_RANGE, MAX_RANGE);
 
+// Slowly varying measurements, like sensor readings, whose bytes of high order
+// are mostly the same from one value to the next
+template <typename T>
+static std::vector<T> SensorValues(int64_t length) {
+  std::vector<T> values(length);
+  std::default_random_engine gen(42);
+  std::normal_distribution<T> d(0, 0.1);
+  T value = 20;
+  for (auto& v : values) {
+    value += d(gen);
+    v = value;
+  }
+  return values;
+}
+
+template <typename DType>
+static void BM_ByteStreamSplitEncoding(benchmark::State& state) {
+  using T = typename DType::c_type;
+  std::vector<T> values = SensorValues<T>(state.range(0));
+  auto encoder = MakeTypedEncoder<DType>(Encoding::BYTE_STREAM_SPLIT);
+  for (auto _ : state) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    encoder->FlushValues();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename DType>
+static void BM_ByteStreamSplitDecoding(benchmark::State& state) {
+  using T = typename DType::c_type;
+  std::vector<T> values = SensorValues<T>(state.range(0));
+  auto encoder = MakeTypedEncoder<DType>(Encoding::BYTE_STREAM_SPLIT);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  for (auto _ : state) {
+    auto decoder = MakeTypedDecoder<DType>(Encoding::BYTE_STREAM_SPLIT);
+    decoder->SetData(static_cast<int>(values.size()), buf->data(),
+                     static_cast<int>(buf->size()));
+    decoder->Decode(values.data(), static_cast<int>(values.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncoding, FloatType)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncoding, DoubleType)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecoding, FloatType)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecoding, DoubleType)->Range(MIN_RANGE, MAX_RANGE);
+
+#ifdef ARROW_WITH_ZSTD
+// Encode and compress a page of sensor values, reporting the compression ratio
+// of the encoding
+template <typename DType, Encoding::type encoding>
+static void BM_EncodeAndCompressZstd(benchmark::State& state) {
+  using T = typename DType::c_type;
+  std::vector<T> values = SensorValues<T>(state.range(0));
+  auto encoder = MakeTypedEncoder<DType>(encoding);
+  std::unique_ptr<::arrow::util::Codec> codec;
+  ABORT_NOT_OK(::arrow::util::Codec::Create(Compression::ZSTD, &codec));
+
+  int64_t compressed_size = 0;
+  for (auto _ : state) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    std::shared_ptr<Buffer> buf = encoder->FlushValues();
+    std::shared_ptr<ResizableBuffer> compressed = AllocateBuffer(
+        default_memory_pool(), codec->MaxCompressedLen(buf->size(), buf->data()));
+    ABORT_NOT_OK(codec->Compress(buf->size(), buf->data(), compressed->size(),
+                                 compressed->mutable_data(), &compressed_size));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+  state.counters["compression_ratio"] =
+      static_cast<double>(state.range(0) * sizeof(T)) / compressed_size;
+}
+
+BENCHMARK_TEMPLATE(BM_EncodeAndCompressZstd, FloatType, Encoding::PLAIN)
+    ->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_EncodeAndCompressZstd, FloatType, Encoding::BYTE_STREAM_SPLIT)
+    ->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_EncodeAndCompressZstd, DoubleType, Encoding::PLAIN)
+    ->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_EncodeAndCompressZstd, DoubleType, Encoding::BYTE_STREAM_SPLIT)
+    ->Range(MIN_RANGE, MAX_RANGE);
+#endif
+
 static void BM_PlainEncodingFloat(benchmark::State& state) {
   std::vector<float> values(state.range(0), 64.0);
   auto encoder = MakeTypedEncoder<FloatType>(Encoding::PLAIN);
@@ -263,6 +416,20 @@ static void BM_DictDecodingInt64_literals(benchmark::State& state) {
 
 BENCHMARK(BM_DictDecodingInt64_literals)->Range(MIN_RANGE, MAX_RANGE);
 
+// Random values out of state.range(1) distinct ones, so that the dictionary
+// indices are bit-packed with about log2(state.range(1)) bits
+static void BM_DictDecodingInt64_cardinality(benchmark::State& state) {
+  std::vector<int64_t> values(state.range(0));
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> d(0, state.range(1) - 1);
+  for (auto& v : values) {
+    v = d(gen);
+  }
+  DecodeDict<Int64Type>(values, state);
+}
+
+BENCHMARK(BM_DictDecodingInt64_cardinality)->Ranges({{MAX_RANGE, MAX_RANGE}, {2, 65536}});
+
 // ----------------------------------------------------------------------
 // Shared benchmarks for decoding using arrow builders
 
@@ -420,6 +587,48 @@ BENCHMARK_DEFINE_F(BM_ArrowBinaryPlain, DecodeArrowNonNull_Dict)
 BENCHMARK_REGISTER_F(BM_ArrowBinaryPlain, DecodeArrowNonNull_Dict)
     ->Range(MIN_RANGE, MAX_RANGE);
 
+// ----------------------------------------------------------------------
+// Benchmark Decoding from DELTA_BYTE_ARRAY Encoding
+class BM_ArrowBinaryDeltaByteArray : public BenchmarkDecodeArrow {
+ public:
+  void DoEncodeArrow() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    encoder->Put(*input_array_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  void DoEncodeLowLevel() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    encoder->Put(values_.data(), num_values_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  std::unique_ptr<ByteArrayDecoder> InitializeDecoder() override {
+    auto decoder = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    decoder->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+    return decoder;
+  }
+};
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArray, EncodeArrow)
+(benchmark::State& state) { EncodeArrowBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArray, EncodeArrow)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArray, EncodeLowLevel)
+(benchmark::State& state) { EncodeLowLevelBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArray, EncodeLowLevel)
+    ->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArray, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArray, DecodeArrow_Dense)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArray, DecodeArrowNonNull_Dense)
+(benchmark::State& state) { DecodeArrowNonNullDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArray, DecodeArrowNonNull_Dense)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
 // ----------------------------------------------------------------------
 // Benchmark Decoding from Dictionary Encoding
 class BM_ArrowBinaryDict : public BenchmarkDecodeArrow {
@@ -324,6 +324,209 @@ TEST(TestDictionaryEncoding, CannotDictDecodeBoolean) {
   ASSERT_THROW(MakeDictDecoder<BooleanType>(nullptr), ParquetException);
 }
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encoding tests
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackedTypes;
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public TestEncodingBase<Type> {
+ public:
+  typedef typename Type::c_type T;
+
+  virtual void CheckRoundtrip() {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    // Decode in batches which are not aligned with the blocks
+    int values_decoded = 0;
+    while (values_decoded < num_values_) {
+      int batch_decoded = decoder->Decode(decode_buf_ + values_decoded, 77);
+      ASSERT_GT(batch_decoded, 0);
+      values_decoded += batch_decoded;
+    }
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_EQ(0, decoder->Decode(decode_buf_, 1));
+    ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
+  }
+
+  void ExecuteSorted(int nvalues) {
+    this->InitData(nvalues, 1);
+    std::sort(draws_, draws_ + num_values_);
+    CheckRoundtrip();
+  }
+
+  void ExecuteConstant(int nvalues) {
+    this->InitData(nvalues, 1);
+    std::fill(draws_, draws_ + num_values_, draws_[0]);
+    CheckRoundtrip();
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+TYPED_TEST_CASE(TestDeltaBitPackEncoding, DeltaBitPackedTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, BasicRoundTrip) {
+  // Random values use the full bit width, including the extreme values
+  ASSERT_NO_FATAL_FAILURE(this->Execute(10000, 1));
+  // Partial mini blocks and blocks
+  for (int nvalues : {1, 2, 31, 33, 128, 129, 1000}) {
+    ASSERT_NO_FATAL_FAILURE(this->Execute(nvalues, 1));
+  }
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, SortedRoundTrip) {
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteSorted(10000));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, ConstantRoundTrip) {
+  // All the deltas have a zero bit width
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteConstant(1000));
+}
+
+TEST(TestDeltaBitPackEncoding, SpecExample) {
+  // Example from the DELTA_BINARY_PACKED section of the Parquet format
+  // specification: 7, 5, 3, 1, 2, 3, 4, 5
+  const std::vector<int32_t> values = {7, 5, 3, 1, 2, 3, 4, 5};
+  const std::vector<uint8_t> expected = {
+      0x80, 0x01, 0x04, 0x08, 0x0e,  // block size, mini blocks, count, first value
+      0x03, 0x02, 0x00, 0x00, 0x00,  // min delta, bit widths
+      0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};  // first mini block
+  auto encoder = MakeTypedEncoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  auto buffer = encoder->FlushValues();
+  ASSERT_EQ(expected,
+            std::vector<uint8_t>(buffer->data(), buffer->data() + buffer->size()));
+}
+
+TEST(TestDeltaBitPackEncoding, UnsupportedTypes) {
+  ASSERT_THROW(MakeEncoder(Type::DOUBLE, Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeDecoder(Type::BYTE_ARRAY, Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeEncoder(Type::INT32, Encoding::DELTA_BYTE_ARRAY), ParquetException);
+}
+
+TEST(TestDeltaBitPackEncoding, ArrowDirectPutWithNulls) {
+  auto values = arrow::ArrayFromJSON(arrow::int64(), "[1, null, 3, 5, null, -4, 100]");
+  auto encoder = MakeTypedEncoder<Int64Type>(Encoding::DELTA_BINARY_PACKED);
+  ASSERT_NO_THROW(encoder->Put(*values));
+  auto buffer = encoder->FlushValues();
+
+  auto decoder = MakeTypedDecoder<Int64Type>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(static_cast<int>(values->length()), buffer->data(),
+                   static_cast<int>(buffer->size()));
+  typename EncodingTraits<Int64Type>::Accumulator builder;
+  ASSERT_EQ(values->length() - values->null_count(),
+            decoder->DecodeArrow(static_cast<int>(values->length()),
+                                 static_cast<int>(values->null_count()),
+                                 values->null_bitmap_data(), values->offset(), &builder));
+  std::shared_ptr<arrow::Array> result;
+  ASSERT_OK(builder.Finish(&result));
+  ASSERT_ARRAYS_EQUAL(*values, *result);
+}
+
+// ----------------------------------------------------------------------
+// BYTE_STREAM_SPLIT encoding tests
+
+typedef ::testing::Types<FloatType, DoubleType> ByteStreamSplitTypes;
+
+template <typename Type>
+class TestByteStreamSplitEncoding : public TestEncodingBase<Type> {
+ public:
+  typedef typename Type::c_type T;
+
+  virtual void CheckRoundtrip() {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::BYTE_STREAM_SPLIT, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::BYTE_STREAM_SPLIT, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+    ASSERT_EQ(num_values_ * static_cast<int64_t>(sizeof(T)), encode_buffer_->size());
+
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    // Decode in batches which are not aligned with the vectorized loops
+    int values_decoded = 0;
+    while (values_decoded < num_values_) {
+      int batch_decoded = decoder->Decode(decode_buf_ + values_decoded, 37);
+      ASSERT_GT(batch_decoded, 0);
+      values_decoded += batch_decoded;
+    }
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_EQ(0, decoder->Decode(decode_buf_, 1));
+    ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+TYPED_TEST_CASE(TestByteStreamSplitEncoding, ByteStreamSplitTypes);
+
+TYPED_TEST(TestByteStreamSplitEncoding, BasicRoundTrip) {
+  ASSERT_NO_FATAL_FAILURE(this->Execute(10000, 1));
+  for (int nvalues : {1, 15, 16, 17, 1000}) {
+    ASSERT_NO_FATAL_FAILURE(this->Execute(nvalues, 1));
+  }
+}
+
+TEST(TestByteStreamSplitEncoding, StreamLayout) {
+  const std::vector<uint32_t> raw_values = {0x04030201, 0x08070605, 0x0c0b0a09};
+  std::vector<float> values(raw_values.size());
+  memcpy(values.data(), raw_values.data(), raw_values.size() * sizeof(uint32_t));
+
+  auto encoder = MakeTypedEncoder<FloatType>(Encoding::BYTE_STREAM_SPLIT);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  auto buffer = encoder->FlushValues();
+  const std::vector<uint8_t> expected = {0x01, 0x05, 0x09, 0x02, 0x06, 0x0a,
+                                         0x03, 0x07, 0x0b, 0x04, 0x08, 0x0c};
+  ASSERT_EQ(expected,
+            std::vector<uint8_t>(buffer->data(), buffer->data() + buffer->size()));
+}
+
+TEST(TestByteStreamSplitEncoding, UnsupportedTypes) {
+  ASSERT_THROW(MakeEncoder(Type::INT32, Encoding::BYTE_STREAM_SPLIT), ParquetException);
+  ASSERT_THROW(MakeDecoder(Type::BYTE_ARRAY, Encoding::BYTE_STREAM_SPLIT),
+               ParquetException);
+
+  // The data size must be a multiple of the value size
+  const uint8_t data[5] = {};
+  auto decoder = MakeTypedDecoder<DoubleType>(Encoding::BYTE_STREAM_SPLIT);
+  ASSERT_THROW(decoder->SetData(1, data, 5), ParquetException);
+}
+
+TEST(TestByteStreamSplitEncoding, ArrowDirectPutWithNulls) {
+  arrow::random::RandomArrayGenerator rag(0);
+  auto values = rag.Float64(1000, -100, 100, /*null_probability=*/0.25);
+  auto encoder = MakeTypedEncoder<DoubleType>(Encoding::BYTE_STREAM_SPLIT);
+  ASSERT_NO_THROW(encoder->Put(*values));
+  auto buffer = encoder->FlushValues();
+  ASSERT_EQ((values->length() - values->null_count()) * sizeof(double),
+            buffer->size());
+
+  // Like the column reader, count the nulls in the number of values of the page
+  auto decoder = MakeTypedDecoder<DoubleType>(Encoding::BYTE_STREAM_SPLIT);
+  decoder->SetData(static_cast<int>(values->length()), buffer->data(),
+                   static_cast<int>(buffer->size()));
+  typename EncodingTraits<DoubleType>::Accumulator builder;
+  ASSERT_EQ(values->length() - values->null_count(),
+            decoder->DecodeArrow(static_cast<int>(values->length()),
+                                 static_cast<int>(values->null_count()),
+                                 values->null_bitmap_data(), values->offset(), &builder));
+  ASSERT_EQ(0, decoder->values_left());
+  std::shared_ptr<arrow::Array> result;
+  ASSERT_OK(builder.Finish(&result));
+  ASSERT_ARRAYS_EQUAL(*values, *result);
+}
+
 // ----------------------------------------------------------------------
 // Shared arrow builder decode tests
 
@@ -862,5 +1065,92 @@ TEST_F(DictEncoding, CheckDecodeIndicesNoNulls) {
   CheckDict(actual_num_values, *builder);
 }
 
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY arrow builder decode tests
+
+class DeltaLengthByteArrayEncoding : public TestArrowBuilderDecoding {
+ public:
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+    decoder_ = plain_decoder_.get();
+    ASSERT_NO_THROW(encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+};
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowNonNullDenseBuilder) {
+  this->CheckDecodeArrowNonNullUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowNonNullDictBuilder) {
+  this->CheckDecodeArrowNonNullUsingDictBuilder();
+}
+
+class DeltaByteArrayEncoding : public TestArrowBuilderDecoding {
+ public:
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    decoder_ = plain_decoder_.get();
+    ASSERT_NO_THROW(encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+};
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowNonNullDenseBuilder) {
+  this->CheckDecodeArrowNonNullUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowNonNullDictBuilder) {
+  this->CheckDecodeArrowNonNullUsingDictBuilder();
+}
+
+TEST(DeltaByteArrayEncodingAdHoc, SharedPrefixes) {
+  auto values = arrow::ArrayFromJSON(
+      arrow::utf8(), R"(["http://a.org/x", "http://a.org/xy", null, "http://b.org",
+                        "", "http://b.org", "h"])");
+  for (auto encoding : {Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY}) {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(encoding);
+    ASSERT_NO_THROW(encoder->Put(*values));
+    auto buffer = encoder->FlushValues();
+
+    auto decoder = MakeTypedDecoder<ByteArrayType>(encoding);
+    const int num_values = static_cast<int>(values->length() - values->null_count());
+    decoder->SetData(num_values, buffer->data(), static_cast<int>(buffer->size()));
+    std::vector<ByteArray> decoded(num_values);
+    // Values decoded by an earlier call must remain valid
+    ASSERT_EQ(2, decoder->Decode(decoded.data(), 2));
+    ASSERT_EQ(num_values - 2, decoder->Decode(decoded.data() + 2, num_values));
+
+    const auto& binary_values = static_cast<const arrow::BinaryArray&>(*values);
+    int decoded_index = 0;
+    for (int64_t i = 0; i < values->length(); ++i) {
+      if (values->IsValid(i)) {
+        ASSERT_EQ(binary_values.GetString(i),
+                  ByteArrayToString(decoded[decoded_index++]));
+      }
+    }
+  }
+}
+
 }  // namespace test
 }  // namespace parquet
@@ -20,15 +20,21 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
 
+#include "parquet/bloom_filter.h"
+#include "parquet/column_page.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_scanner.h"
 #include "parquet/deprecated_io.h"
@@ -37,6 +43,7 @@
 #include "parquet/file_writer.h"
 #include "parquet/internal_file_decryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -76,21 +83,159 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::unique_ptr<BloomFilter> RowGroupReader::Contents::GetColumnBloomFilter(int i) {
+  return NULLPTR;
+}
+
+std::unique_ptr<BloomFilter> RowGroupReader::GetColumnBloomFilter(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnBloomFilter(i);
+}
+
+std::unique_ptr<ColumnIndex> RowGroupReader::Contents::GetColumnIndex(int i) {
+  return NULLPTR;
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::Contents::GetOffsetIndex(int i) {
+  return NULLPTR;
+}
+
+std::unique_ptr<PageReader> RowGroupReader::Contents::GetColumnPageReaderForRows(
+    int i, int64_t first_row, int64_t num_rows, int64_t* rows_to_skip) {
+  *rows_to_skip = first_row;
+  return GetColumnPageReader(i);
+}
+
+std::unique_ptr<ColumnIndex> RowGroupReader::GetColumnIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnIndex(i);
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::GetOffsetIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetOffsetIndex(i);
+}
+
+std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReaderForRows(
+    int i, int64_t first_row, int64_t num_rows, int64_t* rows_to_skip) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnPageReaderForRows(i, first_row, num_rows, rows_to_skip);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
+// Column chunks read ahead by ParquetFileReader::PreBuffer, keyed by
+// (row group, column) ordinals. A chunk is handed out once, so that its buffer
+// is released as soon as the page reader decoding it is done.
+class ChunkBufferCache {
+ public:
+  void Put(const std::pair<int, int>& key, std::shared_ptr<Buffer> buffer) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    chunks_[key] = std::move(buffer);
+  }
+
+  // Return nullptr if the column chunk isn't buffered
+  std::shared_ptr<Buffer> Take(int row_group, int column) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = chunks_.find({row_group, column});
+    if (it == chunks_.end()) {
+      return nullptr;
+    }
+    std::shared_ptr<Buffer> buffer = std::move(it->second);
+    chunks_.erase(it);
+    return buffer;
+  }
+
+  void Erase(int row_group, int column) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    chunks_.erase({row_group, column});
+  }
+
+ private:
+  std::mutex mutex_;
+  std::map<std::pair<int, int>, std::shared_ptr<Buffer>> chunks_;
+};
+
+// Compute the byte range of a column chunk in the file
+static ::arrow::io::ReadRange ComputeColumnChunkRange(FileMetaData* file_metadata,
+                                                      ArrowInputFile* source,
+                                                      const ColumnChunkMetaData* col) {
+  int64_t col_start = col->data_page_offset();
+  if (col->has_dictionary_page() && col->dictionary_page_offset() > 0 &&
+      col_start > col->dictionary_page_offset()) {
+    col_start = col->dictionary_page_offset();
+  }
+
+  int64_t col_length = col->total_compressed_size();
+
+  // PARQUET-816 workaround for old files created by older parquet-mr
+  const ApplicationVersion& version = file_metadata->writer_version();
+  if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
+    // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
+    // dictionary page header size in total_compressed_size and total_uncompressed_size
+    // (see IMPALA-694). We add padding to compensate.
+    int64_t size = -1;
+    PARQUET_THROW_NOT_OK(source->GetSize(&size));
+    int64_t bytes_remaining = size - (col_start + col_length);
+    int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
+    col_length += padding;
+  }
+
+  return {col_start, col_length};
+}
+
+// Returns the pages of several page readers in turn, e.g. the dictionary page
+// and the selected data pages of a column chunk, which are read separately
+class ConcatenatedPageReader : public PageReader {
+ public:
+  explicit ConcatenatedPageReader(std::vector<std::unique_ptr<PageReader>> readers)
+      : readers_(std::move(readers)), current_(0) {}
+
+  std::shared_ptr<Page> NextPage() override {
+    while (current_ < readers_.size()) {
+      std::shared_ptr<Page> page = readers_[current_]->NextPage();
+      if (page != nullptr) {
+        return page;
+      }
+      ++current_;
+    }
+    return nullptr;
+  }
+
+  void set_max_page_header_size(uint32_t size) override {
+    for (auto& reader : readers_) {
+      reader->set_max_page_header_size(size);
+    }
+  }
+
+ private:
+  std::vector<std::unique_ptr<PageReader>> readers_;
+  size_t current_;
+};
+
 // RowGroupReader::Contents implementation for the Parquet file specification
 class SerializedRowGroup : public RowGroupReader::Contents {
  public:
   SerializedRowGroup(const std::shared_ptr<ArrowInputFile>& source,
                      FileMetaData* file_metadata, int row_group_number,
                      const ReaderProperties& props,
-                     InternalFileDecryptor* file_decryptor = nullptr)
+                     InternalFileDecryptor* file_decryptor = nullptr,
+                     std::shared_ptr<ChunkBufferCache> cached_chunks = NULLPTR)
       : source_(source),
         file_metadata_(file_metadata),
         properties_(props),
         row_group_ordinal_(row_group_number),
-        file_decryptor_(file_decryptor) {
+        file_decryptor_(file_decryptor),
+        cached_chunks_(std::move(cached_chunks)) {
     row_group_metadata_ = file_metadata->RowGroup(row_group_number);
   }
 
@@ -102,30 +247,15 @@ class SerializedRowGroup : public RowGroupReader::Contents {
     // Read column chunk from the file
     auto col = row_group_metadata_->ColumnChunk(i, row_group_ordinal_, file_decryptor_);
 
-    int64_t col_start = col->data_page_offset();
-    if (col->has_dictionary_page() && col->dictionary_page_offset() > 0 &&
-        col_start > col->dictionary_page_offset()) {
-      col_start = col->dictionary_page_offset();
-    }
-
-    int64_t col_length = col->total_compressed_size();
-
-    // PARQUET-816 workaround for old files created by older parquet-mr
-    const ApplicationVersion& version = file_metadata_->writer_version();
-    if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
-      // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
-      // dictionary page header size in total_compressed_size and total_uncompressed_size
-      // (see IMPALA-694). We add padding to compensate.
-      int64_t size = -1;
-      PARQUET_THROW_NOT_OK(source_->GetSize(&size));
-      int64_t bytes_remaining = size - (col_start + col_length);
-      int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
-      col_length += padding;
+    std::shared_ptr<ArrowInputStream> stream;
+    std::shared_ptr<Buffer> chunk = TakeCachedChunk(i);
+    if (chunk != nullptr) {
+      stream = std::make_shared<::arrow::io::BufferReader>(std::move(chunk));
+    } else {
+      auto range = ComputeColumnChunkRange(file_metadata_, source_.get(), col.get());
+      stream = properties_.GetStream(source_, range.offset, range.length);
     }
 
-    std::shared_ptr<ArrowInputStream> stream =
-        properties_.GetStream(source_, col_start, col_length);
-
     std::unique_ptr<ColumnCryptoMetaData> crypto_metadata = col->crypto_metadata();
 
     // Column is encrypted only if crypto_metadata exists.
@@ -162,13 +292,128 @@ class SerializedRowGroup : public RowGroupReader::Contents {
                             properties_.memory_pool(), &ctx);
   }
 
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i, row_group_ordinal_, file_decryptor_);
+    if (!col->has_bloom_filter()) {
+      return nullptr;
+    }
+
+    int64_t length = col->bloom_filter_length();
+    if (length < 0) {
+      // Older writers don't record the length, read it from the filter header
+      // (bitset length, hash strategy and algorithm)
+      constexpr int64_t kHeaderSize = 3 * sizeof(uint32_t);
+      std::shared_ptr<Buffer> header;
+      PARQUET_THROW_NOT_OK(
+          source_->ReadAt(col->bloom_filter_offset(), kHeaderSize, &header));
+      if (header->size() != kHeaderSize) {
+        throw ParquetException("Failed reading Bloom filter header");
+      }
+      length = kHeaderSize + arrow::util::SafeLoadAs<uint32_t>(header->data());
+    }
+
+    auto stream = properties_.GetStream(source_, col->bloom_filter_offset(), length);
+    return std::unique_ptr<BloomFilter>(
+        new BlockSplitBloomFilter(BlockSplitBloomFilter::Deserialize(stream.get())));
+  }
+
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i, row_group_ordinal_, file_decryptor_);
+    if (!col->has_column_index()) {
+      return nullptr;
+    }
+    std::shared_ptr<Buffer> buffer =
+        ReadIndex(col->column_index_offset(), col->column_index_length());
+    uint32_t length = static_cast<uint32_t>(buffer->size());
+    return ColumnIndex::Make(buffer->data(), &length);
+  }
+
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i, row_group_ordinal_, file_decryptor_);
+    if (!col->has_offset_index()) {
+      return nullptr;
+    }
+    std::shared_ptr<Buffer> buffer =
+        ReadIndex(col->offset_index_offset(), col->offset_index_length());
+    uint32_t length = static_cast<uint32_t>(buffer->size());
+    return OffsetIndex::Make(buffer->data(), &length);
+  }
+
+  std::unique_ptr<PageReader> GetColumnPageReaderForRows(int i, int64_t first_row,
+                                                         int64_t num_rows,
+                                                         int64_t* rows_to_skip) override {
+    *rows_to_skip = first_row;
+    auto col = row_group_metadata_->ColumnChunk(i, row_group_ordinal_, file_decryptor_);
+    // The page ordinals of encrypted columns are part of the page AADs, so their
+    // pages are read from the start of the column chunk
+    if (!col->has_offset_index() || col->crypto_metadata() != nullptr ||
+        num_rows <= 0) {
+      return GetColumnPageReader(i);
+    }
+    std::unique_ptr<OffsetIndex> offset_index = GetOffsetIndex(i);
+    const std::vector<PageLocation>& pages = offset_index->page_locations();
+    if (pages.empty()) {
+      return GetColumnPageReader(i);
+    }
+
+    const PageLocation& first_page = pages[offset_index->FindPage(first_row)];
+    const PageLocation& last_page =
+        pages[offset_index->FindPage(first_row + num_rows - 1)];
+    *rows_to_skip = first_row - first_page.first_row_index;
+
+    auto range = ComputeColumnChunkRange(file_metadata_, source_.get(), col.get());
+    std::shared_ptr<Buffer> chunk = TakeCachedChunk(i);
+    std::vector<std::unique_ptr<PageReader>> page_readers;
+    if (pages[0].offset > range.offset) {
+      // The dictionary page precedes the data pages
+      page_readers.push_back(PageReader::Open(
+          GetChunkStream(chunk, range, range.offset, pages[0].offset - range.offset),
+          col->num_values(), col->compression(), properties_.memory_pool()));
+    }
+    const int64_t data_length =
+        last_page.offset + last_page.compressed_page_size - first_page.offset;
+    page_readers.push_back(PageReader::Open(
+        GetChunkStream(chunk, range, first_page.offset, data_length), col->num_values(),
+        col->compression(), properties_.memory_pool()));
+    return std::unique_ptr<PageReader>(
+        new ConcatenatedPageReader(std::move(page_readers)));
+  }
+
  private:
+  std::shared_ptr<Buffer> ReadIndex(int64_t offset, int32_t length) {
+    std::shared_ptr<Buffer> buffer;
+    PARQUET_THROW_NOT_OK(source_->ReadAt(offset, length, &buffer));
+    if (buffer->size() != length) {
+      throw ParquetException("Failed reading page index");
+    }
+    return buffer;
+  }
+
+  std::shared_ptr<Buffer> TakeCachedChunk(int i) {
+    if (cached_chunks_ == nullptr) {
+      return nullptr;
+    }
+    return cached_chunks_->Take(row_group_ordinal_, i);
+  }
+
+  // Stream over part of a column chunk, from the pre-buffered chunk if any
+  std::shared_ptr<ArrowInputStream> GetChunkStream(
+      const std::shared_ptr<Buffer>& chunk, const ::arrow::io::ReadRange& chunk_range,
+      int64_t offset, int64_t length) {
+    if (chunk != nullptr) {
+      return std::make_shared<::arrow::io::BufferReader>(
+          ::arrow::SliceBuffer(chunk, offset - chunk_range.offset, length));
+    }
+    return properties_.GetStream(source_, offset, length);
+  }
+
   std::shared_ptr<ArrowInputFile> source_;
   FileMetaData* file_metadata_;
   std::unique_ptr<RowGroupMetaData> row_group_metadata_;
   ReaderProperties properties_;
   int16_t row_group_ordinal_;
   InternalFileDecryptor* file_decryptor_;
+  std::shared_ptr<ChunkBufferCache> cached_chunks_;
 };
 
 // ----------------------------------------------------------------------
@@ -181,7 +426,9 @@ class SerializedFile : public ParquetFileReader::Contents {
  public:
   SerializedFile(const std::shared_ptr<ArrowInputFile>& source,
                  const ReaderProperties& props = default_reader_properties())
-      : source_(source), properties_(props) {}
+      : source_(source),
+        properties_(props),
+        cached_chunks_(std::make_shared<ChunkBufferCache>()) {}
 
   ~SerializedFile() override {
     try {
@@ -197,10 +444,50 @@ class SerializedFile : public ParquetFileReader::Contents {
   std::shared_ptr<RowGroupReader> GetRowGroup(int i) override {
     std::unique_ptr<SerializedRowGroup> contents(
         new SerializedRowGroup(source_, file_metadata_.get(), static_cast<int16_t>(i),
-                               properties_, file_decryptor_.get()));
+                               properties_, file_decryptor_.get(), cached_chunks_));
     return std::make_shared<RowGroupReader>(std::move(contents));
   }
 
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices) override {
+    std::vector<std::pair<int, int>> keys;
+    std::vector<::arrow::io::ReadRange> ranges;
+    for (int row_group : row_groups) {
+      auto row_group_metadata = file_metadata_->RowGroup(row_group);
+      for (int column : column_indices) {
+        auto col = row_group_metadata->ColumnChunk(
+            column, static_cast<int16_t>(row_group), file_decryptor_.get());
+        keys.emplace_back(row_group, column);
+        ranges.push_back(ComputeColumnChunkRange(file_metadata_.get(), source_.get(),
+                                                 col.get()));
+      }
+    }
+
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    PARQUET_THROW_NOT_OK(
+        source_->ReadRanges(ranges, properties_.read_ranges_options(), &buffers));
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+      if (buffers[i]->size() < ranges[i].length) {
+        throw ParquetException("Failed reading column chunk (requested " +
+                               std::to_string(ranges[i].length) + " bytes but got " +
+                               std::to_string(buffers[i]->size()) + " bytes)");
+      }
+    }
+    for (size_t i = 0; i < keys.size(); ++i) {
+      cached_chunks_->Put(keys[i], std::move(buffers[i]));
+    }
+  }
+
+  void ClearPreBuffer(const std::vector<int>& row_groups,
+                      const std::vector<int>& column_indices) override {
+    for (int row_group : row_groups) {
+      for (int column : column_indices) {
+        cached_chunks_->Erase(row_group, column);
+      }
+    }
+  }
+
   std::shared_ptr<FileMetaData> metadata() const override { return file_metadata_; }
 
   void set_metadata(const std::shared_ptr<FileMetaData>& metadata) {
@@ -267,6 +554,8 @@ class SerializedFile : public ParquetFileReader::Contents {
 
   std::unique_ptr<InternalFileDecryptor> file_decryptor_;
 
+  std::shared_ptr<ChunkBufferCache> cached_chunks_;
+
   void ParseUnencryptedFileMetadata(const std::shared_ptr<Buffer>& footer_buffer,
                                     int64_t footer_read_size, int64_t file_size,
                                     std::shared_ptr<Buffer>* metadata_buffer,
@@ -536,6 +825,16 @@ std::shared_ptr<RowGroupReader> ParquetFileReader::RowGroup(int i) {
   return contents_->GetRowGroup(i);
 }
 
+void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
+                                  const std::vector<int>& column_indices) {
+  contents_->PreBuffer(row_groups, column_indices);
+}
+
+void ParquetFileReader::ClearPreBuffer(const std::vector<int>& row_groups,
+                                       const std::vector<int>& column_indices) {
+  contents_->ClearPreBuffer(row_groups, column_indices);
+}
+
 // ----------------------------------------------------------------------
 // File metadata helpers
 
@@ -29,8 +29,11 @@
 
 namespace parquet {
 
+class BloomFilter;
+class ColumnIndex;
 class ColumnReader;
 class FileMetaData;
+class OffsetIndex;
 class PageReader;
 class RandomAccessSource;
 class RowGroupMetaData;
@@ -45,6 +48,11 @@ class PARQUET_EXPORT RowGroupReader {
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
+    virtual std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+    virtual std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+    virtual std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
+    virtual std::unique_ptr<PageReader> GetColumnPageReaderForRows(
+        int i, int64_t first_row, int64_t num_rows, int64_t* rows_to_skip);
   };
 
   explicit RowGroupReader(std::unique_ptr<Contents> contents);
@@ -58,6 +66,26 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Read the Bloom filter of the indicated row group-relative column, or
+  // return null if the column chunk has none
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+
+  // Read the page index of the indicated row group-relative column, or return
+  // null if the column chunk has none
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
+
+  // Return a PageReader over the data pages of the indicated row group-relative
+  // column which hold the rows [first_row, first_row + num_rows), and the
+  // dictionary page if any. The number of rows of the first returned page
+  // which precede first_row is returned in rows_to_skip.
+  //
+  // Pages are selected with the offset index of the column chunk. Without one,
+  // or if the column is encrypted, all pages are returned.
+  std::unique_ptr<PageReader> GetColumnPageReaderForRows(int i, int64_t first_row,
+                                                         int64_t num_rows,
+                                                         int64_t* rows_to_skip);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -79,6 +107,10 @@ class PARQUET_EXPORT ParquetFileReader {
     virtual void Close() = 0;
     virtual std::shared_ptr<RowGroupReader> GetRowGroup(int i) = 0;
     virtual std::shared_ptr<FileMetaData> metadata() const = 0;
+    virtual void PreBuffer(const std::vector<int>& row_groups,
+                           const std::vector<int>& column_indices) {}
+    virtual void ClearPreBuffer(const std::vector<int>& row_groups,
+                                const std::vector<int>& column_indices) {}
   };
 
   ParquetFileReader();
@@ -118,6 +150,25 @@ class PARQUET_EXPORT ParquetFileReader {
   // Returns the file metadata. Only one instance is ever created
   std::shared_ptr<FileMetaData> metadata() const;
 
+  /// \brief Read the column chunks of the given row groups and columns at once
+  ///
+  /// The byte ranges of the column chunks are coalesced according to the
+  /// ReaderProperties' read_ranges_options() and read concurrently with
+  /// RandomAccessFile::ReadRanges. Row group readers then read these column
+  /// chunks from memory, once: the buffer of a column chunk is released when
+  /// its page reader is destroyed, and reading the column chunk again goes to
+  /// the file. The chunks of successive calls are buffered together.
+  ///
+  /// This method is thread-safe, e.g. a call may fetch the next row groups
+  /// while the previous ones are being decoded.
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices);
+
+  /// \brief Release the pre-buffered column chunks of the given row groups and
+  /// columns which haven't been read yet
+  void ClearPreBuffer(const std::vector<int>& row_groups,
+                      const std::vector<int>& column_indices);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
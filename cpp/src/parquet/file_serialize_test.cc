@@ -17,10 +17,12 @@
 
 #include <gtest/gtest.h>
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
 #include "parquet/file_reader.h"
 #include "parquet/file_writer.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/test_util.h"
 #include "parquet/types.h"
@@ -33,6 +35,27 @@ using schema::PrimitiveNode;
 
 namespace test {
 
+uint64_t HashValue(const BloomFilter& filter, bool value) { return 0; }
+uint64_t HashValue(const BloomFilter& filter, int32_t value) {
+  return filter.Hash(value);
+}
+uint64_t HashValue(const BloomFilter& filter, int64_t value) {
+  return filter.Hash(value);
+}
+uint64_t HashValue(const BloomFilter& filter, float value) { return filter.Hash(value); }
+uint64_t HashValue(const BloomFilter& filter, double value) {
+  return filter.Hash(value);
+}
+uint64_t HashValue(const BloomFilter& filter, const Int96& value) {
+  return filter.Hash(&value);
+}
+uint64_t HashValue(const BloomFilter& filter, const ByteArray& value) {
+  return filter.Hash(&value);
+}
+uint64_t HashValue(const BloomFilter& filter, const FLBA& value) {
+  return filter.Hash(&value, FLBA_LENGTH);
+}
+
 template <typename TestType>
 class TestSerialize : public PrimitiveTypedTest<TestType> {
  public:
@@ -141,6 +164,172 @@ class TestSerialize : public PrimitiveTypedTest<TestType> {
     }
   }
 
+  void BloomFilterTest() {
+    auto sink = CreateOutputStream();
+    auto gnode = std::static_pointer_cast<GroupNode>(this->node_);
+    auto props = WriterProperties::Builder().enable_bloom_filter()->build();
+    auto file_writer = ParquetFileWriter::Open(sink, gnode, props);
+    this->GenerateData(rows_per_rowgroup_);
+
+    // One row group written column by column, and one buffered row group
+    RowGroupWriter* row_group_writer = file_writer->AppendRowGroup();
+    for (int col = 0; col < num_columns_; ++col) {
+      auto column_writer =
+          static_cast<TypedColumnWriter<TestType>*>(row_group_writer->NextColumn());
+      column_writer->WriteBatch(rows_per_rowgroup_, this->def_levels_.data(), nullptr,
+                                this->values_ptr_);
+    }
+    row_group_writer->Close();
+    row_group_writer = file_writer->AppendBufferedRowGroup();
+    for (int col = 0; col < num_columns_; ++col) {
+      auto column_writer =
+          static_cast<TypedColumnWriter<TestType>*>(row_group_writer->column(col));
+      column_writer->WriteBatch(rows_per_rowgroup_, this->def_levels_.data(), nullptr,
+                                this->values_ptr_);
+    }
+    row_group_writer->Close();
+    file_writer->Close();
+
+    std::shared_ptr<Buffer> buffer;
+    PARQUET_THROW_NOT_OK(sink->Finish(&buffer));
+    auto source = std::make_shared<::arrow::io::BufferReader>(buffer);
+    auto file_reader = ParquetFileReader::Open(source);
+    ASSERT_EQ(2, file_reader->metadata()->num_row_groups());
+
+    for (int rg = 0; rg < 2; ++rg) {
+      auto rg_reader = file_reader->RowGroup(rg);
+      for (int i = 0; i < num_columns_; ++i) {
+        auto bloom_filter = rg_reader->GetColumnBloomFilter(i);
+        if (TestType::type_num == Type::BOOLEAN) {
+          // Not supported for BOOLEAN columns
+          ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(i)->has_bloom_filter());
+          ASSERT_EQ(nullptr, bloom_filter);
+          continue;
+        }
+        ASSERT_TRUE(rg_reader->metadata()->ColumnChunk(i)->has_bloom_filter());
+        ASSERT_NE(nullptr, bloom_filter);
+        for (int j = 0; j < rows_per_rowgroup_; ++j) {
+          ASSERT_TRUE(
+              bloom_filter->FindHash(HashValue(*bloom_filter, this->values_[j])));
+        }
+      }
+
+      // The data of the column chunks is unaffected
+      auto col_reader =
+          std::static_pointer_cast<TypedColumnReader<TestType>>(rg_reader->Column(0));
+      this->SetupValuesOut(rows_per_rowgroup_);
+      int64_t values_read;
+      col_reader->ReadBatch(rows_per_rowgroup_, nullptr, nullptr, this->values_out_ptr_,
+                            &values_read);
+      this->SyncValuesOut();
+      ASSERT_EQ(rows_per_rowgroup_, values_read);
+      ASSERT_EQ(this->values_, this->values_out_);
+    }
+  }
+
+  void PageIndexTest() {
+    auto sink = CreateOutputStream();
+    auto gnode = std::static_pointer_cast<GroupNode>(this->node_);
+    // A data page for every batch of rows_per_batch_ values
+    auto props = WriterProperties::Builder()
+                     .enable_write_page_index()
+                     ->write_batch_size(rows_per_batch_)
+                     ->data_pagesize(1)
+                     ->build();
+    auto file_writer = ParquetFileWriter::Open(sink, gnode, props);
+    this->GenerateData(rows_per_rowgroup_);
+
+    // One row group written column by column, and one buffered row group
+    RowGroupWriter* row_group_writer = file_writer->AppendRowGroup();
+    for (int col = 0; col < num_columns_; ++col) {
+      auto column_writer =
+          static_cast<TypedColumnWriter<TestType>*>(row_group_writer->NextColumn());
+      column_writer->WriteBatch(rows_per_rowgroup_, this->def_levels_.data(), nullptr,
+                                this->values_ptr_);
+    }
+    row_group_writer->Close();
+    row_group_writer = file_writer->AppendBufferedRowGroup();
+    for (int col = 0; col < num_columns_; ++col) {
+      auto column_writer =
+          static_cast<TypedColumnWriter<TestType>*>(row_group_writer->column(col));
+      column_writer->WriteBatch(rows_per_rowgroup_, this->def_levels_.data(), nullptr,
+                                this->values_ptr_);
+    }
+    row_group_writer->Close();
+    file_writer->Close();
+
+    std::shared_ptr<Buffer> buffer;
+    PARQUET_THROW_NOT_OK(sink->Finish(&buffer));
+    auto source = std::make_shared<::arrow::io::BufferReader>(buffer);
+    auto file_reader = ParquetFileReader::Open(source);
+    ASSERT_EQ(2, file_reader->metadata()->num_row_groups());
+
+    const int num_pages = rows_per_rowgroup_ / rows_per_batch_;
+    for (int rg = 0; rg < 2; ++rg) {
+      auto rg_reader = file_reader->RowGroup(rg);
+      for (int i = 0; i < num_columns_; ++i) {
+        auto col_metadata = rg_reader->metadata()->ColumnChunk(i);
+        ASSERT_TRUE(col_metadata->has_offset_index());
+
+        auto offset_index = rg_reader->GetOffsetIndex(i);
+        ASSERT_NE(nullptr, offset_index);
+        ASSERT_EQ(num_pages, offset_index->num_pages());
+        const auto& pages = offset_index->page_locations();
+        ASSERT_EQ(col_metadata->data_page_offset(), pages[0].offset);
+        for (int page = 0; page < num_pages; ++page) {
+          ASSERT_EQ(page * rows_per_batch_, pages[page].first_row_index);
+          if (page > 0) {
+            ASSERT_EQ(pages[page - 1].offset + pages[page - 1].compressed_page_size,
+                      pages[page].offset);
+          }
+        }
+        ASSERT_EQ(2, offset_index->FindPage(2 * rows_per_batch_ + 1));
+
+        // No page statistics are written without a sort order
+        if (this->schema_.Column(i)->sort_order() == SortOrder::UNKNOWN) {
+          ASSERT_FALSE(col_metadata->has_column_index());
+          ASSERT_EQ(nullptr, rg_reader->GetColumnIndex(i));
+          continue;
+        }
+        ASSERT_TRUE(col_metadata->has_column_index());
+        auto column_index = rg_reader->GetColumnIndex(i);
+        ASSERT_NE(nullptr, column_index);
+        ASSERT_EQ(num_pages, column_index->num_pages());
+        ASSERT_TRUE(column_index->has_null_counts());
+        for (int page = 0; page < num_pages; ++page) {
+          ASSERT_FALSE(column_index->null_pages()[page]);
+          ASSERT_FALSE(column_index->encoded_min_values()[page].empty());
+          ASSERT_FALSE(column_index->encoded_max_values()[page].empty());
+          ASSERT_EQ(0, column_index->null_counts()[page]);
+        }
+      }
+
+      // Only read the pages holding the rows [15, 35)
+      const int64_t first_row = 15, num_rows = 20;
+      int64_t rows_to_skip = -1;
+      auto page_reader =
+          rg_reader->GetColumnPageReaderForRows(0, first_row, num_rows, &rows_to_skip);
+      ASSERT_EQ(first_row % rows_per_batch_, rows_to_skip);
+      auto col_reader = std::static_pointer_cast<TypedColumnReader<TestType>>(
+          ColumnReader::Make(this->schema_.Column(0), std::move(page_reader)));
+      ASSERT_EQ(rows_to_skip, col_reader->Skip(rows_to_skip));
+
+      this->SetupValuesOut(num_rows);
+      std::vector<int16_t> def_levels_out(num_rows);
+      int64_t values_read;
+      ASSERT_EQ(num_rows,
+                col_reader->ReadBatch(num_rows, def_levels_out.data(), nullptr,
+                                      this->values_out_ptr_, &values_read));
+      this->SyncValuesOut();
+      ASSERT_EQ(num_rows, values_read);
+      for (int64_t j = 0; j < num_rows; ++j) {
+        ASSERT_EQ(this->values_[first_row + j], this->values_out_[j]);
+      }
+      // The pages after the row range are not read
+      ASSERT_FALSE(col_reader->HasNext());
+    }
+  }
+
   void UnequalNumRows(int64_t max_rows, const std::vector<int64_t> rows_per_column) {
     auto sink = CreateOutputStream();
     auto gnode = std::static_pointer_cast<GroupNode>(this->node_);
@@ -268,6 +457,12 @@ TYPED_TEST(TestSerialize, SmallFileUncompressed) {
   ASSERT_NO_FATAL_FAILURE(this->FileSerializeTest(Compression::UNCOMPRESSED));
 }
 
+TYPED_TEST(TestSerialize, BloomFilter) {
+  ASSERT_NO_FATAL_FAILURE(this->BloomFilterTest());
+}
+
+TYPED_TEST(TestSerialize, PageIndex) { ASSERT_NO_FATAL_FAILURE(this->PageIndexTest()); }
+
 TYPED_TEST(TestSerialize, TooFewRows) {
   std::vector<int64_t> num_rows = {100, 100, 100, 99};
   ASSERT_THROW(this->UnequalNumRows(100, num_rows), ParquetException);
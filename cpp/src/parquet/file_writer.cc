@@ -23,11 +23,13 @@
 #include <utility>
 #include <vector>
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_writer.h"
 #include "parquet/deprecated_io.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/exception.h"
 #include "parquet/internal_file_encryptor.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
@@ -77,13 +79,21 @@ inline void ThrowRowsMisMatchError(int col, int64_t prev, int64_t curr) {
 // ----------------------------------------------------------------------
 // RowGroupSerializer
 
+// Page index of a closed column chunk, written before the file footer
+struct ColumnChunkPageIndex {
+  int row_group;
+  int column;
+  std::shared_ptr<PageIndexBuilder> page_index;
+};
+
 // RowGroupWriter::Contents implementation for the Parquet file specification
 class RowGroupSerializer : public RowGroupWriter::Contents {
  public:
   RowGroupSerializer(const std::shared_ptr<ArrowOutputStream>& sink,
                      RowGroupMetaDataBuilder* metadata, int16_t row_group_ordinal,
                      const WriterProperties* properties, bool buffered_row_group = false,
-                     InternalFileEncryptor* file_encryptor = nullptr)
+                     InternalFileEncryptor* file_encryptor = nullptr,
+                     std::vector<ColumnChunkPageIndex>* page_indexes = nullptr)
       : sink_(sink),
         metadata_(metadata),
         properties_(properties),
@@ -93,11 +103,13 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
         next_column_index_(0),
         num_rows_(0),
         buffered_row_group_(buffered_row_group),
-        file_encryptor_(file_encryptor) {
+        file_encryptor_(file_encryptor),
+        page_indexes_(page_indexes) {
     if (buffered_row_group) {
       InitColumns();
     } else {
       column_writers_.push_back(nullptr);
+      column_metadata_.push_back(nullptr);
     }
   }
 
@@ -124,6 +136,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
 
     if (column_writers_[0]) {
       total_bytes_written_ += column_writers_[0]->Close();
+      WriteBloomFilter(*column_writers_[0], column_metadata_[0]);
+      CollectPageIndex(*column_writers_[0], next_column_index_ - 1);
     }
 
     ++next_column_index_;
@@ -140,6 +154,7 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
         col_meta, row_group_ordinal_, static_cast<int16_t>(next_column_index_ - 1),
         properties_->memory_pool(), false, meta_encryptor, data_encryptor);
     column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_);
+    column_metadata_[0] = col_meta;
     return column_writers_[0].get();
   }
 
@@ -185,11 +200,16 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
       for (size_t i = 0; i < column_writers_.size(); i++) {
         if (column_writers_[i]) {
           total_bytes_written_ += column_writers_[i]->Close();
+          WriteBloomFilter(*column_writers_[i], column_metadata_[i]);
+          CollectPageIndex(*column_writers_[i], buffered_row_group_
+                                                    ? static_cast<int>(i)
+                                                    : next_column_index_ - 1);
           column_writers_[i].reset();
         }
       }
 
       column_writers_.clear();
+      column_metadata_.clear();
 
       // Ensures all columns have been written
       metadata_->set_num_rows(num_rows_);
@@ -208,6 +228,7 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   mutable int64_t num_rows_;
   bool buffered_row_group_;
   InternalFileEncryptor* file_encryptor_;
+  std::vector<ColumnChunkPageIndex>* page_indexes_;
 
   void CheckRowsWritten() const {
     // verify when only one column is written at a time
@@ -243,15 +264,40 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
                           : nullptr;
       std::unique_ptr<PageWriter> pager = PageWriter::Open(
           sink_, properties_->compression(path), properties_->compression_level(path),
-          col_meta, static_cast<int16_t>(row_group_ordinal_),
-          static_cast<int16_t>(next_column_index_), properties_->memory_pool(),
-          buffered_row_group_, meta_encryptor, data_encryptor);
+          col_meta, static_cast<int16_t>(row_group_ordinal_), static_cast<int16_t>(i),
+          properties_->memory_pool(), buffered_row_group_, meta_encryptor,
+          data_encryptor);
       column_writers_.push_back(
           ColumnWriter::Make(col_meta, std::move(pager), properties_));
+      column_metadata_.push_back(col_meta);
+    }
+  }
+
+  // Append the Bloom filter of a closed column chunk to the file, and record its
+  // location in the column chunk metadata
+  void WriteBloomFilter(const ColumnWriter& column_writer,
+                        ColumnChunkMetaDataBuilder* col_meta) {
+    const BloomFilter* bloom_filter = column_writer.bloom_filter();
+    if (bloom_filter == nullptr) {
+      return;
+    }
+    int64_t start_pos = -1, final_pos = -1;
+    PARQUET_THROW_NOT_OK(sink_->Tell(&start_pos));
+    bloom_filter->WriteTo(sink_.get());
+    PARQUET_THROW_NOT_OK(sink_->Tell(&final_pos));
+    col_meta->SetBloomFilter(start_pos, static_cast<int32_t>(final_pos - start_pos));
+  }
+
+  // Keep the page index of a closed column chunk until the file is closed
+  void CollectPageIndex(const ColumnWriter& column_writer, int column) {
+    std::shared_ptr<PageIndexBuilder> page_index = column_writer.page_index();
+    if (page_index != nullptr && page_indexes_ != nullptr) {
+      page_indexes_->push_back({row_group_ordinal_, column, std::move(page_index)});
     }
   }
 
   std::vector<std::shared_ptr<ColumnWriter>> column_writers_;
+  std::vector<ColumnChunkMetaDataBuilder*> column_metadata_;
 };
 
 // ----------------------------------------------------------------------
@@ -284,6 +330,8 @@ class FileSerializer : public ParquetFileWriter::Contents {
       }
       row_group_writer_.reset();
 
+      WritePageIndexes();
+
       // Write magic bytes and metadata
       auto file_encryption_properties = properties_->file_encryption_properties();
 
@@ -314,7 +362,7 @@ class FileSerializer : public ParquetFileWriter::Contents {
     auto rg_metadata = metadata_->AppendRowGroup();
     std::unique_ptr<RowGroupWriter::Contents> contents(new RowGroupSerializer(
         sink_, rg_metadata, static_cast<int16_t>(num_row_groups_ - 1), properties_.get(),
-        buffered_row_group, file_encryptor_.get()));
+        buffered_row_group, file_encryptor_.get(), &page_indexes_));
     row_group_writer_.reset(new RowGroupWriter(std::move(contents)));
     return row_group_writer_.get();
   }
@@ -375,6 +423,30 @@ class FileSerializer : public ParquetFileWriter::Contents {
     }
   }
 
+  // Write the column indexes of all column chunks, then their offset indexes,
+  // and record their locations in the file metadata
+  void WritePageIndexes() {
+    int64_t start_pos = -1, final_pos = -1;
+    for (const ColumnChunkPageIndex& item : page_indexes_) {
+      if (!item.page_index->has_column_index()) {
+        continue;
+      }
+      PARQUET_THROW_NOT_OK(sink_->Tell(&start_pos));
+      item.page_index->WriteColumnIndex(sink_.get());
+      PARQUET_THROW_NOT_OK(sink_->Tell(&final_pos));
+      metadata_->SetColumnIndexLocation(item.row_group, item.column, start_pos,
+                                        static_cast<int32_t>(final_pos - start_pos));
+    }
+    for (const ColumnChunkPageIndex& item : page_indexes_) {
+      PARQUET_THROW_NOT_OK(sink_->Tell(&start_pos));
+      item.page_index->WriteOffsetIndex(sink_.get());
+      PARQUET_THROW_NOT_OK(sink_->Tell(&final_pos));
+      metadata_->SetOffsetIndexLocation(item.row_group, item.column, start_pos,
+                                        static_cast<int32_t>(final_pos - start_pos));
+    }
+    page_indexes_.clear();
+  }
+
   std::shared_ptr<ArrowOutputStream> sink_;
   bool is_open_;
   const std::shared_ptr<WriterProperties> properties_;
@@ -386,6 +458,8 @@ class FileSerializer : public ParquetFileWriter::Contents {
 
   std::unique_ptr<InternalFileEncryptor> file_encryptor_;
 
+  std::vector<ColumnChunkPageIndex> page_indexes_;
+
   void StartFile() {
     auto file_encryption_properties = properties_->file_encryption_properties();
     if (file_encryption_properties == nullptr) {
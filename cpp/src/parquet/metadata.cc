@@ -272,6 +272,36 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
 
   inline int64_t index_page_offset() const { return column_metadata_->index_page_offset; }
 
+  inline bool has_bloom_filter() const {
+    return column_metadata_->__isset.bloom_filter_offset;
+  }
+
+  inline int64_t bloom_filter_offset() const {
+    return column_metadata_->bloom_filter_offset;
+  }
+
+  inline int32_t bloom_filter_length() const {
+    return column_metadata_->__isset.bloom_filter_length
+               ? column_metadata_->bloom_filter_length
+               : -1;
+  }
+
+  inline bool has_column_index() const {
+    return column_->__isset.column_index_offset && column_->__isset.column_index_length;
+  }
+
+  inline int64_t column_index_offset() const { return column_->column_index_offset; }
+
+  inline int32_t column_index_length() const { return column_->column_index_length; }
+
+  inline bool has_offset_index() const {
+    return column_->__isset.offset_index_offset && column_->__isset.offset_index_length;
+  }
+
+  inline int64_t offset_index_offset() const { return column_->offset_index_offset; }
+
+  inline int32_t offset_index_length() const { return column_->offset_index_length; }
+
   inline int64_t total_compressed_size() const {
     return column_metadata_->total_compressed_size;
   }
@@ -356,6 +386,36 @@ int64_t ColumnChunkMetaData::index_page_offset() const {
   return impl_->index_page_offset();
 }
 
+bool ColumnChunkMetaData::has_bloom_filter() const { return impl_->has_bloom_filter(); }
+
+int64_t ColumnChunkMetaData::bloom_filter_offset() const {
+  return impl_->bloom_filter_offset();
+}
+
+int32_t ColumnChunkMetaData::bloom_filter_length() const {
+  return impl_->bloom_filter_length();
+}
+
+bool ColumnChunkMetaData::has_column_index() const { return impl_->has_column_index(); }
+
+int64_t ColumnChunkMetaData::column_index_offset() const {
+  return impl_->column_index_offset();
+}
+
+int32_t ColumnChunkMetaData::column_index_length() const {
+  return impl_->column_index_length();
+}
+
+bool ColumnChunkMetaData::has_offset_index() const { return impl_->has_offset_index(); }
+
+int64_t ColumnChunkMetaData::offset_index_offset() const {
+  return impl_->offset_index_offset();
+}
+
+int32_t ColumnChunkMetaData::offset_index_length() const {
+  return impl_->offset_index_length();
+}
+
 Compression::type ColumnChunkMetaData::compression() const {
   return impl_->compression();
 }
@@ -919,6 +979,11 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     column_chunk_->meta_data.__set_statistics(ToThrift(val));
   }
 
+  void SetBloomFilter(int64_t offset, int32_t length) {
+    column_chunk_->meta_data.__set_bloom_filter_offset(offset);
+    column_chunk_->meta_data.__set_bloom_filter_length(length);
+  }
+
   void Finish(int64_t num_values, int64_t dictionary_page_offset,
               int64_t index_page_offset, int64_t data_page_offset,
               int64_t compressed_size, int64_t uncompressed_size, bool has_dictionary,
@@ -1096,6 +1161,10 @@ void ColumnChunkMetaDataBuilder::SetStatistics(const EncodedStatistics& result)
   impl_->SetStatistics(result);
 }
 
+void ColumnChunkMetaDataBuilder::SetBloomFilter(int64_t offset, int32_t length) {
+  impl_->SetBloomFilter(offset, length);
+}
+
 int64_t ColumnChunkMetaDataBuilder::total_compressed_size() const {
   return impl_->total_compressed_size();
 }
@@ -1228,6 +1297,20 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
     return current_row_group_builder_.get();
   }
 
+  void SetColumnIndexLocation(int row_group, int column, int64_t offset,
+                              int32_t length) {
+    format::ColumnChunk& column_chunk = row_groups_.at(row_group).columns.at(column);
+    column_chunk.__set_column_index_offset(offset);
+    column_chunk.__set_column_index_length(length);
+  }
+
+  void SetOffsetIndexLocation(int row_group, int column, int64_t offset,
+                              int32_t length) {
+    format::ColumnChunk& column_chunk = row_groups_.at(row_group).columns.at(column);
+    column_chunk.__set_offset_index_offset(offset);
+    column_chunk.__set_offset_index_length(length);
+  }
+
   std::unique_ptr<FileMetaData> Finish() {
     int64_t total_rows = 0;
     for (auto row_group : row_groups_) {
@@ -1357,6 +1440,16 @@ RowGroupMetaDataBuilder* FileMetaDataBuilder::AppendRowGroup() {
   return impl_->AppendRowGroup();
 }
 
+void FileMetaDataBuilder::SetColumnIndexLocation(int row_group, int column,
+                                                 int64_t offset, int32_t length) {
+  impl_->SetColumnIndexLocation(row_group, column, offset, length);
+}
+
+void FileMetaDataBuilder::SetOffsetIndexLocation(int row_group, int column,
+                                                 int64_t offset, int32_t length) {
+  impl_->SetOffsetIndexLocation(row_group, column, offset, length);
+}
+
 std::unique_ptr<FileMetaData> FileMetaDataBuilder::Finish() { return impl_->Finish(); }
 
 std::unique_ptr<FileCryptoMetaData> FileMetaDataBuilder::GetCryptoMetaData() {
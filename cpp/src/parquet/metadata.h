@@ -154,6 +154,17 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t total_compressed_size() const;
   int64_t total_uncompressed_size() const;
   std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const;
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
+  // Size of the serialized Bloom filter, or -1 if not recorded by the writer
+  int32_t bloom_filter_length() const;
+  // Location of the page index of the column chunk, see parquet/page_index.h
+  bool has_column_index() const;
+  int64_t column_index_offset() const;
+  int32_t column_index_length() const;
+  bool has_offset_index() const;
+  int64_t offset_index_offset() const;
+  int32_t offset_index_length() const;
 
  private:
   explicit ColumnChunkMetaData(const void* metadata, const ColumnDescriptor* descr,
@@ -298,6 +309,8 @@ class PARQUET_EXPORT ColumnChunkMetaDataBuilder {
   void set_file_path(const std::string& path);
   // column metadata
   void SetStatistics(const EncodedStatistics& stats);
+  // location of the column chunk's Bloom filter in the file
+  void SetBloomFilter(int64_t offset, int32_t length);
   // get the column descriptor
   const ColumnDescriptor* descr() const;
 
@@ -365,6 +378,11 @@ class PARQUET_EXPORT FileMetaDataBuilder {
   // The prior RowGroupMetaDataBuilder (if any) is destroyed
   RowGroupMetaDataBuilder* AppendRowGroup();
 
+  // Record the location of the page index of a column chunk written before
+  // the footer
+  void SetColumnIndexLocation(int row_group, int column, int64_t offset, int32_t length);
+  void SetOffsetIndexLocation(int row_group, int column, int64_t offset, int32_t length);
+
   // Complete the Thrift structure
   std::unique_ptr<FileMetaData> Finish();
 
@@ -0,0 +1,196 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "arrow/util/logging.h"
+#include "parquet/exception.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+// ----------------------------------------------------------------------
+// OffsetIndex
+
+OffsetIndex::OffsetIndex(std::vector<PageLocation> page_locations)
+    : page_locations_(std::move(page_locations)) {}
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
+                                               uint32_t* index_len) {
+  format::OffsetIndex offset_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), index_len,
+                       &offset_index);
+
+  std::vector<PageLocation> page_locations;
+  page_locations.reserve(offset_index.page_locations.size());
+  for (const format::PageLocation& location : offset_index.page_locations) {
+    page_locations.push_back(
+        {location.offset, location.compressed_page_size, location.first_row_index});
+  }
+  return std::unique_ptr<OffsetIndex>(new OffsetIndex(std::move(page_locations)));
+}
+
+int OffsetIndex::FindPage(int64_t row_index) const {
+  auto it = std::upper_bound(
+      page_locations_.begin(), page_locations_.end(), row_index,
+      [](int64_t row, const PageLocation& page) { return row < page.first_row_index; });
+  if (it == page_locations_.begin()) {
+    return 0;
+  }
+  return static_cast<int>(it - page_locations_.begin()) - 1;
+}
+
+// ----------------------------------------------------------------------
+// ColumnIndex
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const void* serialized_index,
+                                               uint32_t* index_len) {
+  format::ColumnIndex column_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), index_len,
+                       &column_index);
+
+  const size_t num_pages = column_index.null_pages.size();
+  if (column_index.min_values.size() != num_pages ||
+      column_index.max_values.size() != num_pages ||
+      (column_index.__isset.null_counts &&
+       column_index.null_counts.size() != num_pages)) {
+    throw ParquetException("Corrupted column index: inconsistent number of pages");
+  }
+
+  std::unique_ptr<ColumnIndex> result(new ColumnIndex());
+  result->null_pages_ = std::move(column_index.null_pages);
+  result->min_values_ = std::move(column_index.min_values);
+  result->max_values_ = std::move(column_index.max_values);
+  result->boundary_order_ =
+      static_cast<BoundaryOrder::type>(column_index.boundary_order);
+  if (column_index.__isset.null_counts) {
+    result->null_counts_ = std::move(column_index.null_counts);
+  }
+  return result;
+}
+
+// ----------------------------------------------------------------------
+// PageIndexBuilder
+
+class PageIndexBuilder::PageIndexBuilderImpl {
+ public:
+  PageIndexBuilderImpl()
+      : has_column_index_(true), has_null_counts_(true), num_sized_pages_(0) {}
+
+  void AddPage(const EncodedStatistics& stats, bool null_page, int64_t first_row_index) {
+    if (has_column_index_) {
+      if (!null_page && !(stats.has_min && stats.has_max)) {
+        // Statistics disabled or truncated, the pages can't be selected by value
+        has_column_index_ = false;
+      } else {
+        column_index_.null_pages.push_back(null_page);
+        column_index_.min_values.push_back(null_page ? std::string() : stats.min());
+        column_index_.max_values.push_back(null_page ? std::string() : stats.max());
+        if (stats.has_null_count) {
+          null_counts_.push_back(stats.null_count);
+        } else {
+          has_null_counts_ = false;
+        }
+      }
+    }
+
+    format::PageLocation location;
+    location.__set_first_row_index(first_row_index);
+    offset_index_.page_locations.push_back(location);
+  }
+
+  void AddPageSize(int64_t compressed_page_size) {
+    DCHECK_LT(num_sized_pages_, offset_index_.page_locations.size());
+    offset_index_.page_locations[num_sized_pages_++].__set_compressed_page_size(
+        static_cast<int32_t>(compressed_page_size));
+  }
+
+  void set_boundary_order(BoundaryOrder::type boundary_order) {
+    column_index_.__set_boundary_order(
+        static_cast<format::BoundaryOrder::type>(boundary_order));
+  }
+
+  void Finish(int64_t first_page_offset) {
+    DCHECK_EQ(num_sized_pages_, offset_index_.page_locations.size());
+    int64_t offset = first_page_offset;
+    for (format::PageLocation& location : offset_index_.page_locations) {
+      location.__set_offset(offset);
+      offset += location.compressed_page_size;
+    }
+    if (has_column_index_ && has_null_counts_) {
+      column_index_.__set_null_counts(null_counts_);
+    }
+  }
+
+  bool has_column_index() const { return has_column_index_; }
+
+  void WriteColumnIndex(ArrowOutputStream* sink) const {
+    DCHECK(has_column_index_);
+    ThriftSerializer serializer;
+    serializer.Serialize(&column_index_, sink);
+  }
+
+  void WriteOffsetIndex(ArrowOutputStream* sink) const {
+    ThriftSerializer serializer;
+    serializer.Serialize(&offset_index_, sink);
+  }
+
+ private:
+  format::ColumnIndex column_index_;
+  format::OffsetIndex offset_index_;
+  std::vector<int64_t> null_counts_;
+  bool has_column_index_;
+  bool has_null_counts_;
+  size_t num_sized_pages_;
+};
+
+PageIndexBuilder::PageIndexBuilder() : impl_(new PageIndexBuilderImpl()) {}
+
+PageIndexBuilder::~PageIndexBuilder() {}
+
+void PageIndexBuilder::AddPage(const EncodedStatistics& stats, bool null_page,
+                               int64_t first_row_index) {
+  impl_->AddPage(stats, null_page, first_row_index);
+}
+
+void PageIndexBuilder::AddPageSize(int64_t compressed_page_size) {
+  impl_->AddPageSize(compressed_page_size);
+}
+
+void PageIndexBuilder::set_boundary_order(BoundaryOrder::type boundary_order) {
+  impl_->set_boundary_order(boundary_order);
+}
+
+void PageIndexBuilder::Finish(int64_t first_page_offset) {
+  impl_->Finish(first_page_offset);
+}
+
+bool PageIndexBuilder::has_column_index() const { return impl_->has_column_index(); }
+
+void PageIndexBuilder::WriteColumnIndex(ArrowOutputStream* sink) const {
+  impl_->WriteColumnIndex(sink);
+}
+
+void PageIndexBuilder::WriteOffsetIndex(ArrowOutputStream* sink) const {
+  impl_->WriteOffsetIndex(sink);
+}
+
+}  // namespace parquet
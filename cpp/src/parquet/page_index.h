@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PARQUET_PAGE_INDEX_H
+#define PARQUET_PAGE_INDEX_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/platform.h"
+
+namespace parquet {
+
+class EncodedStatistics;
+
+// The page index of a column chunk is made of a ColumnIndex, with the min and
+// max values of each data page, and an OffsetIndex, with the location of each
+// data page in the file. Both are written after the row groups, so that readers
+// can select pages by value and then only read the pages they need.
+
+struct BoundaryOrder {
+  enum type { UNORDERED = 0, ASCENDING = 1, DESCENDING = 2 };
+};
+
+struct PARQUET_EXPORT PageLocation {
+  // Offset of the page header in the file
+  int64_t offset;
+  // Size of the page, including its header
+  int32_t compressed_page_size;
+  // Index of the first row of the page within the row group
+  int64_t first_row_index;
+};
+
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  static std::unique_ptr<OffsetIndex> Make(const void* serialized_index,
+                                           uint32_t* index_len);
+
+  int num_pages() const { return static_cast<int>(page_locations_.size()); }
+
+  // The locations of the data pages of the column chunk, in file order
+  const std::vector<PageLocation>& page_locations() const { return page_locations_; }
+
+  // Return the index of the page holding the given row of the row group
+  int FindPage(int64_t row_index) const;
+
+ private:
+  explicit OffsetIndex(std::vector<PageLocation> page_locations);
+
+  std::vector<PageLocation> page_locations_;
+};
+
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  static std::unique_ptr<ColumnIndex> Make(const void* serialized_index,
+                                           uint32_t* index_len);
+
+  int num_pages() const { return static_cast<int>(null_pages_.size()); }
+
+  // Whether each page only holds null values, in which case its min and max
+  // values are empty
+  const std::vector<bool>& null_pages() const { return null_pages_; }
+
+  // Plain-encoded min and max values of each page, comparable with the sort
+  // order of the column like encoded Statistics
+  const std::vector<std::string>& encoded_min_values() const { return min_values_; }
+  const std::vector<std::string>& encoded_max_values() const { return max_values_; }
+
+  // Whether the min and max values of the non-null pages are ordered
+  BoundaryOrder::type boundary_order() const { return boundary_order_; }
+
+  bool has_null_counts() const { return !null_counts_.empty(); }
+  const std::vector<int64_t>& null_counts() const { return null_counts_; }
+
+ private:
+  ColumnIndex() = default;
+
+  std::vector<bool> null_pages_;
+  std::vector<std::string> min_values_;
+  std::vector<std::string> max_values_;
+  BoundaryOrder::type boundary_order_ = BoundaryOrder::UNORDERED;
+  std::vector<int64_t> null_counts_;
+};
+
+// Collects the page index of a column chunk while it is written
+class PARQUET_EXPORT PageIndexBuilder {
+ public:
+  PageIndexBuilder();
+  ~PageIndexBuilder();
+
+  // Add a data page, in the order pages are written to the file. The column
+  // index is dropped if a page which has values has no min and max statistics.
+  void AddPage(const EncodedStatistics& stats, bool null_page, int64_t first_row_index);
+
+  // Record the size of the next data page written to the file, including its
+  // header
+  void AddPageSize(int64_t compressed_page_size);
+
+  void set_boundary_order(BoundaryOrder::type boundary_order);
+
+  // Compute the page offsets from the offset of the first data page. Data pages
+  // of a column chunk are stored contiguously.
+  void Finish(int64_t first_page_offset);
+
+  bool has_column_index() const;
+
+  void WriteColumnIndex(ArrowOutputStream* sink) const;
+  void WriteOffsetIndex(ArrowOutputStream* sink) const;
+
+ private:
+  class PageIndexBuilderImpl;
+  std::unique_ptr<PageIndexBuilderImpl> impl_;
+};
+
+}  // namespace parquet
+
+#endif  // PARQUET_PAGE_INDEX_H
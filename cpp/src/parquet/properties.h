@@ -24,6 +24,7 @@
 #include <unordered_set>
 #include <utility>
 
+#include "arrow/io/interfaces.h"
 #include "arrow/type.h"
 #include "arrow/util/compression.h"
 
@@ -66,6 +67,15 @@ class PARQUET_EXPORT ReaderProperties {
 
   int64_t buffer_size() const { return buffer_size_; }
 
+  /// Options for coalescing the reads of ParquetFileReader::PreBuffer
+  void set_read_ranges_options(const ::arrow::io::ReadRangesOptions& options) {
+    read_ranges_options_ = options;
+  }
+
+  const ::arrow::io::ReadRangesOptions& read_ranges_options() const {
+    return read_ranges_options_;
+  }
+
   void file_decryption_properties(
       const std::shared_ptr<FileDecryptionProperties>& decryption) {
     file_decryption_properties_ = decryption;
@@ -79,6 +89,7 @@ class PARQUET_EXPORT ReaderProperties {
   MemoryPool* pool_;
   int64_t buffer_size_;
   bool buffered_stream_enabled_;
+  ::arrow::io::ReadRangesOptions read_ranges_options_;
   std::shared_ptr<FileDecryptionProperties> file_decryption_properties_;
 };
 
@@ -96,6 +107,19 @@ static constexpr ParquetVersion::type DEFAULT_WRITER_VERSION =
     ParquetVersion::PARQUET_1_0;
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
+static constexpr bool DEFAULT_IS_BLOOM_FILTER_ENABLED = false;
+static constexpr int32_t DEFAULT_BLOOM_FILTER_NDV = 1024 * 1024;
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.05;
+static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = false;
+
+/// \brief Sizing hints for the Bloom filter of a column chunk
+struct PARQUET_EXPORT BloomFilterOptions {
+  /// Expected maximum number of distinct values in a column chunk. Column chunks
+  /// with fewer distinct values get a filter sized for their actual count.
+  int32_t ndv = DEFAULT_BLOOM_FILTER_NDV;
+  /// Target false positive probability, in (0, 1)
+  double fpp = DEFAULT_BLOOM_FILTER_FPP;
+};
 
 class PARQUET_EXPORT ColumnProperties {
  public:
@@ -109,7 +133,9 @@ class PARQUET_EXPORT ColumnProperties {
         dictionary_enabled_(dictionary_enabled),
         statistics_enabled_(statistics_enabled),
         max_stats_size_(max_stats_size),
-        compression_level_(Codec::UseDefaultCompressionLevel()) {}
+        compression_level_(Codec::UseDefaultCompressionLevel()),
+        bloom_filter_enabled_(DEFAULT_IS_BLOOM_FILTER_ENABLED),
+        page_index_enabled_(DEFAULT_IS_PAGE_INDEX_ENABLED) {}
 
   void set_encoding(Encoding::type encoding) { encoding_ = encoding; }
 
@@ -131,6 +157,18 @@ class PARQUET_EXPORT ColumnProperties {
     compression_level_ = compression_level;
   }
 
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
+  void set_bloom_filter_options(const BloomFilterOptions& bloom_filter_options) {
+    bloom_filter_options_ = bloom_filter_options;
+  }
+
+  void set_page_index_enabled(bool page_index_enabled) {
+    page_index_enabled_ = page_index_enabled;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -143,6 +181,12 @@ class PARQUET_EXPORT ColumnProperties {
 
   int compression_level() const { return compression_level_; }
 
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
+  const BloomFilterOptions& bloom_filter_options() const { return bloom_filter_options_; }
+
+  bool page_index_enabled() const { return page_index_enabled_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -150,6 +194,9 @@ class PARQUET_EXPORT ColumnProperties {
   bool statistics_enabled_;
   size_t max_stats_size_;
   int compression_level_;
+  bool bloom_filter_enabled_;
+  BloomFilterOptions bloom_filter_options_;
+  bool page_index_enabled_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -375,6 +422,78 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// \brief Write a Bloom filter for every column chunk, so that readers can
+    /// skip row groups which do not contain a given value.
+    ///
+    /// Bloom filters are not written for BOOLEAN and encrypted columns.
+    Builder* enable_bloom_filter(const BloomFilterOptions& options = {}) {
+      default_column_properties_.set_bloom_filter_enabled(true);
+      default_column_properties_.set_bloom_filter_options(options);
+      return this;
+    }
+
+    Builder* disable_bloom_filter() {
+      default_column_properties_.set_bloom_filter_enabled(false);
+      return this;
+    }
+
+    /// \brief Write a Bloom filter for the column chunks of the column
+    /// described by path.
+    Builder* enable_bloom_filter(const std::string& path,
+                                 const BloomFilterOptions& options = {}) {
+      bloom_filter_enabled_[path] = true;
+      bloom_filter_options_[path] = options;
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path,
+                                 const BloomFilterOptions& options = {}) {
+      return this->enable_bloom_filter(path->ToDotString(), options);
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
+    /// \brief Write the page index of every column chunk: the min and max
+    /// values of each data page, and the location of each data page in the
+    /// file. Readers use it to only read the pages of the rows they need.
+    ///
+    /// Page indexes are not written for encrypted columns. The column index,
+    /// with the page min and max values, also requires statistics.
+    Builder* enable_write_page_index() {
+      default_column_properties_.set_page_index_enabled(true);
+      return this;
+    }
+
+    Builder* disable_write_page_index() {
+      default_column_properties_.set_page_index_enabled(false);
+      return this;
+    }
+
+    Builder* enable_write_page_index(const std::string& path) {
+      page_index_enabled_[path] = true;
+      return this;
+    }
+
+    Builder* enable_write_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_write_page_index(path->ToDotString());
+    }
+
+    Builder* disable_write_page_index(const std::string& path) {
+      page_index_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_write_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_write_page_index(path->ToDotString());
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -393,6 +512,12 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : bloom_filter_enabled_)
+        get(item.first).set_bloom_filter_enabled(item.second);
+      for (const auto& item : bloom_filter_options_)
+        get(item.first).set_bloom_filter_options(item.second);
+      for (const auto& item : page_index_enabled_)
+        get(item.first).set_page_index_enabled(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
@@ -418,6 +543,9 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, bool> bloom_filter_enabled_;
+    std::unordered_map<std::string, BloomFilterOptions> bloom_filter_options_;
+    std::unordered_map<std::string, bool> page_index_enabled_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -481,6 +609,19 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled();
+  }
+
+  const BloomFilterOptions& bloom_filter_options(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_options();
+  }
+
+  bool page_index_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).page_index_enabled();
+  }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
@@ -536,6 +677,8 @@ static constexpr bool kArrowDefaultUseThreads = false;
 
 // Default number of rows to read when using ::arrow::RecordBatchReader
 static constexpr int64_t kArrowDefaultBatchSize = 64 * 1024;
+static constexpr bool kArrowDefaultPreBuffer = false;
+static constexpr int64_t kArrowDefaultPreBufferLimit = 256 * 1024 * 1024;
 
 /// EXPERIMENTAL: Properties for configuring FileReader behavior.
 class PARQUET_EXPORT ArrowReaderProperties {
@@ -543,7 +686,9 @@ class PARQUET_EXPORT ArrowReaderProperties {
   explicit ArrowReaderProperties(bool use_threads = kArrowDefaultUseThreads)
       : use_threads_(use_threads),
         read_dict_indices_(),
-        batch_size_(kArrowDefaultBatchSize) {}
+        batch_size_(kArrowDefaultBatchSize),
+        pre_buffer_(kArrowDefaultPreBuffer),
+        pre_buffer_limit_(kArrowDefaultPreBufferLimit) {}
 
   void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
 
@@ -568,10 +713,33 @@ class PARQUET_EXPORT ArrowReaderProperties {
 
   int64_t batch_size() const { return batch_size_; }
 
+  /// \brief Read the selected column chunks ahead of decoding them
+  ///
+  /// When reading several row groups, the column chunks of consecutive row
+  /// groups are fetched with ParquetFileReader::PreBuffer, i.e. coalesced and
+  /// read concurrently, on the IO thread pool. The chunks of the next row
+  /// groups are fetched while the current ones are decoded, which hides the
+  /// latency of remote filesystems.
+  void set_pre_buffer(bool pre_buffer) { pre_buffer_ = pre_buffer; }
+
+  bool pre_buffer() const { return pre_buffer_; }
+
+  /// \brief Bound the bytes of column chunks buffered ahead when pre_buffer()
+  /// is enabled
+  ///
+  /// The row groups being decoded and the row groups being fetched each take
+  /// up to half of the limit. A row group whose selected column chunks exceed
+  /// that is still read at once.
+  void set_pre_buffer_limit(int64_t limit) { pre_buffer_limit_ = limit; }
+
+  int64_t pre_buffer_limit() const { return pre_buffer_limit_; }
+
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
   int64_t batch_size_;
+  bool pre_buffer_;
+  int64_t pre_buffer_limit_;
 };
 
 /// EXPERIMENTAL: Constructs the default ArrowReaderProperties
@@ -587,7 +755,8 @@ class PARQUET_EXPORT ArrowWriterProperties {
           coerce_timestamps_enabled_(false),
           coerce_timestamps_unit_(::arrow::TimeUnit::SECOND),
           truncated_timestamps_allowed_(false),
-          store_schema_(false) {}
+          store_schema_(false),
+          use_threads_(kArrowDefaultUseThreads) {}
     virtual ~Builder() {}
 
     Builder* disable_deprecated_int96_timestamps() {
@@ -624,10 +793,19 @@ class PARQUET_EXPORT ArrowWriterProperties {
       return this;
     }
 
+    /// \brief Encode and compress the column chunks of each row group written
+    /// by FileWriter::WriteTable in parallel on the CPU thread pool. The
+    /// column chunks are buffered in memory and written in column order, so
+    /// the file is the same as when writing on a single thread.
+    Builder* set_use_threads(bool use_threads) {
+      use_threads_ = use_threads;
+      return this;
+    }
+
     std::shared_ptr<ArrowWriterProperties> build() {
       return std::shared_ptr<ArrowWriterProperties>(new ArrowWriterProperties(
           write_timestamps_as_int96_, coerce_timestamps_enabled_, coerce_timestamps_unit_,
-          truncated_timestamps_allowed_, store_schema_));
+          truncated_timestamps_allowed_, store_schema_, use_threads_));
     }
 
    private:
@@ -638,6 +816,7 @@ class PARQUET_EXPORT ArrowWriterProperties {
     bool truncated_timestamps_allowed_;
 
     bool store_schema_;
+    bool use_threads_;
   };
 
   bool support_deprecated_int96_timestamps() const { return write_timestamps_as_int96_; }
@@ -651,22 +830,27 @@ class PARQUET_EXPORT ArrowWriterProperties {
 
   bool store_schema() const { return store_schema_; }
 
+  bool use_threads() const { return use_threads_; }
+
  private:
   explicit ArrowWriterProperties(bool write_nanos_as_int96,
                                  bool coerce_timestamps_enabled,
                                  ::arrow::TimeUnit::type coerce_timestamps_unit,
-                                 bool truncated_timestamps_allowed, bool store_schema)
+                                 bool truncated_timestamps_allowed, bool store_schema,
+                                 bool use_threads)
       : write_timestamps_as_int96_(write_nanos_as_int96),
         coerce_timestamps_enabled_(coerce_timestamps_enabled),
         coerce_timestamps_unit_(coerce_timestamps_unit),
         truncated_timestamps_allowed_(truncated_timestamps_allowed),
-        store_schema_(store_schema) {}
+        store_schema_(store_schema),
+        use_threads_(use_threads) {}
 
   const bool write_timestamps_as_int96_;
   const bool coerce_timestamps_enabled_;
   const ::arrow::TimeUnit::type coerce_timestamps_unit_;
   const bool truncated_timestamps_allowed_;
   const bool store_schema_;
+  const bool use_threads_;
 };
 
 /// \brief State object used for writing Arrow data directly to a Parquet
@@ -65,6 +65,43 @@ TEST(TestWriterProperties, AdvancedHandling) {
             props->encoding(ColumnPath::FromDotString("delta-length")));
 }
 
+TEST(TestWriterProperties, BloomFilter) {
+  BloomFilterOptions options;
+  options.ndv = 1000;
+  options.fpp = 0.01;
+  std::shared_ptr<WriterProperties> props = WriterProperties::Builder()
+                                                .enable_bloom_filter("a", options)
+                                                ->disable_bloom_filter("b")
+                                                ->build();
+
+  ASSERT_TRUE(props->bloom_filter_enabled(ColumnPath::FromDotString("a")));
+  ASSERT_EQ(1000, props->bloom_filter_options(ColumnPath::FromDotString("a")).ndv);
+  ASSERT_EQ(0.01, props->bloom_filter_options(ColumnPath::FromDotString("a")).fpp);
+  ASSERT_FALSE(props->bloom_filter_enabled(ColumnPath::FromDotString("b")));
+  ASSERT_EQ(DEFAULT_IS_BLOOM_FILTER_ENABLED,
+            props->bloom_filter_enabled(ColumnPath::FromDotString("c")));
+
+  props = WriterProperties::Builder().enable_bloom_filter()->build();
+  ASSERT_TRUE(props->bloom_filter_enabled(ColumnPath::FromDotString("c")));
+  ASSERT_EQ(DEFAULT_BLOOM_FILTER_NDV,
+            props->bloom_filter_options(ColumnPath::FromDotString("c")).ndv);
+}
+
+TEST(TestWriterProperties, PageIndex) {
+  std::shared_ptr<WriterProperties> props = WriterProperties::Builder()
+                                                .enable_write_page_index()
+                                                ->disable_write_page_index("b")
+                                                ->build();
+
+  ASSERT_TRUE(props->page_index_enabled(ColumnPath::FromDotString("a")));
+  ASSERT_FALSE(props->page_index_enabled(ColumnPath::FromDotString("b")));
+
+  props = WriterProperties::Builder().enable_write_page_index("a")->build();
+  ASSERT_TRUE(props->page_index_enabled(ColumnPath::FromDotString("a")));
+  ASSERT_EQ(DEFAULT_IS_PAGE_INDEX_ENABLED,
+            props->page_index_enabled(ColumnPath::FromDotString("b")));
+}
+
 TEST(TestReaderProperties, GetStreamInsufficientData) {
   // ARROW-6058
   std::string data = "shorter than expected";
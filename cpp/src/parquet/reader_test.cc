@@ -105,6 +105,50 @@ TEST_F(TestAllTypesPlain, TestBatchRead) {
   ASSERT_FALSE(col->HasNext());
 }
 
+TEST_F(TestAllTypesPlain, PreBuffer) {
+  reader_->PreBuffer({0}, {0, 1});
+  std::shared_ptr<RowGroupReader> group = reader_->RowGroup(0);
+
+  // column 0, id, is read from the pre-buffered column chunk
+  std::shared_ptr<Int32Reader> col =
+      std::dynamic_pointer_cast<Int32Reader>(group->Column(0));
+  int16_t def_levels[8];
+  int16_t rep_levels[8];
+  int32_t values[8];
+  int64_t values_read;
+  auto levels_read = col->ReadBatch(8, def_levels, rep_levels, values, &values_read);
+  ASSERT_EQ(8, levels_read);
+  ASSERT_EQ(8, values_read);
+  ASSERT_FALSE(col->HasNext());
+
+  // column 2 was not pre-buffered and is read from the file
+  std::shared_ptr<Int32Scanner> scanner(new Int32Scanner(group->Column(2)));
+  int32_t val;
+  bool is_null;
+  for (int i = 0; i < 8; ++i) {
+    ASSERT_TRUE(scanner->NextValue(&val, &is_null));
+  }
+  ASSERT_FALSE(scanner->HasNext());
+}
+
+TEST_F(TestAllTypesPlain, ClearPreBuffer) {
+  reader_->PreBuffer({0}, {0, 1});
+  reader_->ClearPreBuffer({0}, {0, 1});
+  std::shared_ptr<RowGroupReader> group = reader_->RowGroup(0);
+
+  // column 0, id, is read from the file again
+  std::shared_ptr<Int32Reader> col =
+      std::dynamic_pointer_cast<Int32Reader>(group->Column(0));
+  int16_t def_levels[8];
+  int16_t rep_levels[8];
+  int32_t values[8];
+  int64_t values_read;
+  auto levels_read = col->ReadBatch(8, def_levels, rep_levels, values, &values_read);
+  ASSERT_EQ(8, levels_read);
+  ASSERT_EQ(8, values_read);
+  ASSERT_FALSE(col->HasNext());
+}
+
 TEST_F(TestAllTypesPlain, TestFlatScannerInt32) {
   std::shared_ptr<RowGroupReader> group = reader_->RowGroup(0);
 